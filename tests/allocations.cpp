@@ -0,0 +1,82 @@
+// checks how many times _utf8string allocates when strings are joined and moved
+// build and run with: g++ -std=c++11 -I.. allocations.cpp -o allocations && ./allocations
+#include "utf8string.h"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+
+static size_t allocations = 0;
+
+void *operator new(size_t size)
+{
+	++allocations;
+
+	void *p = malloc(size ? size : 1);
+	if(p == NULL) throw std::bad_alloc();
+
+	return p;
+}
+
+void operator delete(void *p) noexcept
+{
+	free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+	free(p);
+}
+
+static int failures = 0;
+
+static void check(const char *name, size_t expected, size_t actual)
+{
+	if(expected != actual)
+	{
+		printf("FAILED %s: expected %u allocations, got %u\n", name, (unsigned)expected, (unsigned)actual);
+		++failures;
+	}
+	else
+	{
+		printf("ok     %s: %u allocations\n", name, (unsigned)actual);
+	}
+}
+
+int main()
+{
+	using sd_utf8::utf8string;
+	using sd_utf8::utf8string_view;
+
+	// the pieces are long enough that the result never fits in the small string buffer
+	utf8string a("première partie du texte, ");
+	utf8string b("второй кусок текста, ");
+	std::string c("third piece of the text, ");
+	const char *d = "vierter Teil des Textes, ";
+	utf8string_view e("第五部分的文本, ");
+	utf8string f("and the sixth one.");
+
+	size_t before = allocations;
+	utf8string joined = utf8string::concat(a, b, c, d, e, f);
+	check("concat() of 6 pieces", 1, allocations - before);
+
+	before = allocations;
+	utf8string sum = a + b;
+	check("a + b", 1, allocations - before);
+
+	before = allocations;
+	utf8string moved(std::move(joined));
+	check("move constructor", 0, allocations - before);
+
+	before = allocations;
+	sum = std::move(moved);
+	check("move assignment", 0, allocations - before);
+
+	before = allocations;
+	utf8string assigned;
+	assigned.assign(std::move(sum));
+	check("assign() from an rvalue", 0, allocations - before);
+
+	return (failures == 0) ? 0 : 1;
+}
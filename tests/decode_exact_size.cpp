@@ -0,0 +1,80 @@
+// checks that decoding into a buffer that is exactly the size of the output never writes past it
+// build and run with: g++ -std=c++11 -I.. decode_exact_size.cpp -o decode_exact_size && ./decode_exact_size
+// the buffers have guard units after them. Building with -fsanitize=address also catches a write past the end
+#include "utf8string.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+static const std::uint32_t guard = 0xDEADBEEF;
+static const size_t guard_size = 32;
+
+template <typename char_type>
+static bool guardintact(const std::vector<char_type> &buffer, size_t size)
+{
+	for(size_t i = size; i < size + guard_size; ++i)
+	{
+		if(buffer[i] != (char_type)guard) return false;
+	}
+
+	return true;
+}
+
+static void check(const char *name, bool ok)
+{
+	if(!ok)
+	{
+		printf("FAILED %s\n", name);
+		++failures;
+	}
+}
+
+static void checktext(const char *text)
+{
+	sd_utf8::utf8string str(text);
+	const sd_utf8::_uchar8bit *begin = (const sd_utf8::_uchar8bit *)text;
+	const sd_utf8::_uchar8bit *end = begin + strlen(text);
+
+	// copy() into exactly size() characters
+	std::vector<sd_utf8::_char32bit> utf32(str.size() + guard_size, (sd_utf8::_char32bit)guard);
+	size_t written = str.copy(&utf32[0], str.size());
+	check("copy() to UTF-32 writes past the buffer", guardintact(utf32, str.size()));
+	check("copy() to UTF-32 writes every character", written == str.size());
+
+	// DecodeUTF8() into exactly the UTF-16 size
+	size_t utf16_size = sd_utf8::GetUTF16BufferSize(begin, end);
+	std::vector<std::uint16_t> utf16(utf16_size + guard_size, (std::uint16_t)guard);
+	written = sd_utf8::DecodeUTF8(begin, end, &utf16[0], utf16_size);
+	check("DecodeUTF8() to UTF-16 writes past the buffer", guardintact(utf16, utf16_size));
+	check("DecodeUTF8() to UTF-16 writes every unit", written == utf16_size);
+
+	// the wstring cast sizes its buffer exactly
+	std::wstring wide = str;
+	check("the wstring cast loses characters", wide.size() == ((sizeof(wchar_t) == 2) ? utf16_size : str.size()));
+}
+
+int main()
+{
+	// 4 emoji is 16 bytes but only 4 characters. A decoder that sizes the output by the input writes 16 units
+	checktext("\xF0\x9F\x98\x80\xF0\x9F\x98\x81\xF0\x9F\x98\x82\xF0\x9F\x98\x83");
+
+	// ASCII runs before wide characters take the mixed block path
+	checktext("ab\xF0\x9F\x98\x80\xF0\x9F\x98\x81\xF0\x9F\x98\x82\xF0\x9F\x98\x83 and more text after it");
+	checktext("\xE6\x9D\xB1\xE4\xBA\xAC\xE9\x83\xBD\xE3\x81\xAE\xE5\xA4\xA9\xE6\xB0\x97\xE3\x81\xAF\xE6\x99\xB4");
+	checktext("caf\xC3\xA9 d\xC3\xA9j\xC3\xA0 vu, na\xC3\xAFve fa\xC3\xA7" "ade \xF0\x9F\x98\x80");
+
+	// every length up to 64 bytes of mixed 1, 2, 3 and 4 byte characters
+	const char *pieces[4] = { "a", "\xC3\xA9", "\xE6\x9D\xB1", "\xF0\x9F\x98\x80" };
+	std::string text;
+	for(size_t i = 0; i < 64; ++i)
+	{
+		text += pieces[(i * 7 + i / 3) % 4];
+		checktext(text.c_str());
+	}
+
+	if(failures == 0) printf("ok\n");
+
+	return (failures == 0) ? 0 : 1;
+}
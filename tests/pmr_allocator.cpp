@@ -0,0 +1,44 @@
+// checks that the copies made by the case mapping functions and NormalizeUTF8() keep the arena allocator of the source
+// build and run with: g++ -std=c++17 -I.. pmr_allocator.cpp -o pmr_allocator && ./pmr_allocator
+#include "utf8string.h"
+#include "utf8normalize.h"
+#include <cstdio>
+
+static int failures = 0;
+
+#if defined(UTF8STRING_HAS_PMR)
+static void check(const char *name, const sd_utf8::pmr::utf8string &str, std::pmr::memory_resource *expected)
+{
+	if(str.get_allocator().resource() != expected)
+	{
+		printf("FAILED %s: the result doesn't use the arena\n", name);
+		++failures;
+	}
+	else
+	{
+		printf("ok     %s\n", name);
+	}
+}
+#endif
+
+int main()
+{
+#if defined(UTF8STRING_HAS_PMR)
+	sd_utf8::pmr::utf8arena<> arena;
+	sd_utf8::pmr::utf8string str("Straße und ÉCOLE, long enough to leave the small string buffer", arena.allocator());
+
+	check("to_lower()", str.to_lower(), arena.resource());
+	check("to_upper()", str.to_upper(), arena.resource());
+	check("case_fold()", str.case_fold(), arena.resource());
+
+	// the first is already in NFC and is only copied, the second has to be composed
+	sd_utf8::pmr::utf8string decomposed("Cafe\xCC\x81 with a combining accent, long enough to leave the small string buffer", arena.allocator());
+
+	check("NormalizeUTF8() of a normalized string", sd_utf8::NormalizeUTF8(str), arena.resource());
+	check("NormalizeUTF8() of a decomposed string", sd_utf8::NormalizeUTF8(decomposed), arena.resource());
+#else
+	printf("skipped: std::pmr isn't available\n");
+#endif
+
+	return (failures == 0) ? 0 : 1;
+}
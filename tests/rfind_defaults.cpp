@@ -0,0 +1,40 @@
+// checks what rfind() searches when it isn't given a position
+// build and run with: g++ -std=c++11 -I.. rfind_defaults.cpp -o rfind_defaults && ./rfind_defaults
+#include "utf8string.h"
+#include <cstdio>
+
+static int failures = 0;
+
+static void check(const char *name, size_t expected, size_t actual)
+{
+	if(expected != actual)
+	{
+		printf("FAILED %s: expected %d, got %d\n", name, (int)expected, (int)actual);
+		++failures;
+	}
+	else
+	{
+		printf("ok     %s: %d\n", name, (int)actual);
+	}
+}
+
+int main()
+{
+	using sd_utf8::utf8string;
+	using sd_utf8::utf8string_view;
+
+	const size_t npos = utf8string::npos;
+	utf8string str("x héllo x héllo");
+
+	// the view and c string overloads search the whole string like std::string
+	check("rfind(const char *)", 10, str.rfind("héllo"));
+	check("rfind(utf8string_view)", 10, str.rfind(utf8string_view("héllo")));
+	check("utf8string_view::rfind()", 10, utf8string_view(str).rfind(utf8string_view("héllo")));
+
+	// the _utf8string overload keeps its old default of 0
+	check("rfind(const utf8string &) at 0", 0, str.rfind(utf8string("x")));
+	check("rfind(const utf8string &) not at 0", npos, str.rfind(utf8string("héllo")));
+	check("rfind(const utf8string &, npos)", 10, str.rfind(utf8string("héllo"), npos));
+
+	return (failures == 0) ? 0 : 1;
+}
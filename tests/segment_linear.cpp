@@ -0,0 +1,121 @@
+// checks that stepping over segments takes time in proportion to the length of the text
+// each case is timed on a text and on one 4 times as long. Linear time is about 4 times slower, quadratic about 16
+// build and run with: g++ -std=c++11 -O2 -I.. segment_linear.cpp -o segment_linear && ./segment_linear
+#include "utf8segment.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+static int failures = 0;
+
+static std::string repeat(const std::string &piece, size_t n)
+{
+	std::string text;
+	for(size_t i = 0; i < n; ++i) text += piece;
+
+	return text;
+}
+
+template <class Rules>
+static size_t forward(const std::string &text)
+{
+	sd_utf8::utf8segments<Rules> segments((const sd_utf8::_uchar8bit *)text.data(), (const sd_utf8::_uchar8bit *)text.data() + text.size());
+
+	size_t count = 0;
+	for(typename sd_utf8::utf8segments<Rules>::iterator it = segments.begin(); it != segments.end(); ++it) ++count;
+
+	return count;
+}
+
+template <class Rules>
+static size_t backward(const std::string &text)
+{
+	sd_utf8::utf8segments<Rules> segments((const sd_utf8::_uchar8bit *)text.data(), (const sd_utf8::_uchar8bit *)text.data() + text.size());
+
+	size_t count = 0;
+	for(typename sd_utf8::utf8segments<Rules>::iterator it = segments.end(); it != segments.begin(); --it) ++count;
+
+	return count;
+}
+
+// the fastest of a few runs in milliseconds
+static double measure(size_t (*walk)(const std::string &), const std::string &text)
+{
+	double best = 0;
+
+	for(int i = 0; i < 5; ++i)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		walk(text);
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		if((i == 0) || (ms < best)) best = ms;
+
+		// quadratic time is already seconds at this size, there's no need to wait for more runs
+		if(ms > 1000) break;
+	}
+
+	return best;
+}
+
+// text(n) builds a text of about n bytes
+static void check(const char *name, size_t (*walk)(const std::string &), std::string (*text)(size_t))
+{
+	const size_t n = 20000;
+
+	double small = measure(walk, text(n));
+	double large = measure(walk, text(n * 4));
+
+	// a few milliseconds are allowed for timer noise
+	if((large > small * 10) && (large > 5))
+	{
+		printf("FAILED %s: %.2f ms for %u bytes, %.2f ms for %u bytes\n", name, small, (unsigned)n, large, (unsigned)(n * 4));
+		++failures;
+	}
+	else
+	{
+		printf("ok     %s: %.2f ms, %.2f ms\n", name, small, large);
+	}
+}
+
+// SB8 looks ahead for a lowercase letter after a terminator, the spaces or closing marks after it
+static std::string spaces_after_term(size_t n)
+{
+	return "Hello there. " + std::string(n, ' ') + "1";
+}
+
+static std::string closes_after_term(size_t n)
+{
+	return "Hello there." + std::string(n, ')') + "1";
+}
+
+static std::string sentences(size_t n)
+{
+	return repeat("Hi! x 1. 2 ", n / 11);
+}
+
+// marks in a row, or between a letter and a number, can't join and are always a boundary
+static std::string double_marks(size_t n)
+{
+	return repeat("a..", n / 3);
+}
+
+static std::string marks_between(size_t n)
+{
+	return repeat("a.1.", n / 4);
+}
+
+int main()
+{
+	using sd_utf8::utf8sentence_rules;
+	using sd_utf8::utf8word_rules;
+
+	check("sentences forward, spaces after a terminator", forward<utf8sentence_rules>, spaces_after_term);
+	check("sentences forward, closes after a terminator", forward<utf8sentence_rules>, closes_after_term);
+	check("sentences backward, spaces after a terminator", backward<utf8sentence_rules>, spaces_after_term);
+	check("sentences backward, short sentences", backward<utf8sentence_rules>, sentences);
+	check("words backward, two marks in a row", backward<utf8word_rules>, double_marks);
+	check("words backward, marks between letters and numbers", backward<utf8word_rules>, marks_between);
+
+	return (failures == 0) ? 0 : 1;
+}
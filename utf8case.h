@@ -0,0 +1,359 @@
+// utf8case.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8CASEHEADER
+#define UTF8CASEHEADER
+
+#include "utf8utils.h"
+#include "utf8casetables.h"
+
+namespace sd_utf8
+{
+
+// the case mappings. Lowercase and uppercase are the full mappings from SpecialCasing.txt that don't depend on
+// the language or the characters around them, so "ß" uppercases to "SS" and "İ" lowercases to "i̇". Case folding is
+// for comparing strings without case and maps "ß", "ss" and "SS" all to "ss"
+enum utf8case_mapping
+{
+	utf8case_lower,
+	utf8case_upper,
+	utf8case_fold
+};
+
+// maps c and writes the characters it maps to into out. returns how many there are, 1 to 3
+// a character without a mapping maps to itself
+inline size_t MapUnicodeCase(_char32bit c, utf8case_mapping mapping, _char32bit out[3])
+{
+	const utf8case_record &record = GetUTF8CaseRecord(c);
+
+	if(record.expansion[mapping] != 0)
+	{
+		const std::uint32_t *expansion = GetUTF8CaseExpansion(record.expansion[mapping]);
+
+		out[0] = expansion[0];
+		out[1] = expansion[1];
+		out[2] = expansion[2];
+
+		return (expansion[2] != 0) ? 3 : 2;
+	}
+
+	out[0] = (_char32bit)((std::int32_t)c + record.delta[mapping]);
+	return 1;
+}
+
+// maps a single ASCII character
+inline _uchar8bit MapASCIICharacterCase(_uchar8bit c, utf8case_mapping mapping)
+{
+	_uchar8bit first = (mapping == utf8case_upper) ? 'a' : 'A';
+
+	return ((_uchar8bit)(c - first) < 26) ? (_uchar8bit)(c ^ 0x20) : c;
+}
+
+// maps the ASCII characters at the start of [begin, end) into out and returns how many there were
+// stops at the first byte that isn't ASCII. out can be begin to map in place
+// case folding ASCII is the same as lowercasing it
+inline size_t MapASCIICase(const _uchar8bit *begin, const _uchar8bit *end, _uchar8bit *out, utf8case_mapping mapping)
+{
+	// the first letter of the range that changes, 'A' or 'a'
+	_uchar8bit first = (mapping == utf8case_upper) ? 'a' : 'A';
+	const _uchar8bit *cur = begin;
+
+	// each version adds an offset that moves the letters that change to the bottom of the signed range so one
+	// signed compare finds them, then flips their 0x20 bit. Bytes that aren't ASCII never change so a block that
+	// isn't all ASCII can still be mapped and the ASCII bytes at the start of it kept
+#if defined(UTF8_USE_AVX2)
+	const __m256i offset256 = _mm256_set1_epi8((char)(0x80 - first));
+	const __m256i limit256 = _mm256_set1_epi8((char)(-128 + 26));
+	const __m256i flip256 = _mm256_set1_epi8(0x20);
+
+	while(end - cur >= 32)
+	{
+		__m256i bytes = _mm256_loadu_si256((const __m256i *)cur);
+		__m256i letters = _mm256_cmpgt_epi8(limit256, _mm256_add_epi8(bytes, offset256));
+		__m256i mapped = _mm256_xor_si256(bytes, _mm256_and_si256(letters, flip256));
+
+		int non_ascii = _mm256_movemask_epi8(bytes);
+		if(non_ascii != 0)
+		{
+			_uchar8bit block[32];
+			_mm256_storeu_si256((__m256i *)block, mapped);
+
+			size_t ascii_count = GetLowestSetBit((std::uint32_t)non_ascii);
+			memcpy(out, block, ascii_count);
+
+			return (size_t)(cur - begin) + ascii_count;
+		}
+
+		_mm256_storeu_si256((__m256i *)out, mapped);
+		cur += 32;
+		out += 32;
+	}
+#endif
+
+#if defined(UTF8_USE_SSE2)
+	const __m128i offset = _mm_set1_epi8((char)(0x80 - first));
+	const __m128i limit = _mm_set1_epi8((char)(-128 + 26));
+	const __m128i flip = _mm_set1_epi8(0x20);
+
+	while(end - cur >= 16)
+	{
+		__m128i bytes = _mm_loadu_si128((const __m128i *)cur);
+		__m128i letters = _mm_cmplt_epi8(_mm_add_epi8(bytes, offset), limit);
+		__m128i mapped = _mm_xor_si128(bytes, _mm_and_si128(letters, flip));
+
+		int non_ascii = _mm_movemask_epi8(bytes);
+		if(non_ascii != 0)
+		{
+			_uchar8bit block[16];
+			_mm_storeu_si128((__m128i *)block, mapped);
+
+			size_t ascii_count = GetLowestSetBit((std::uint32_t)non_ascii);
+			memcpy(out, block, ascii_count);
+
+			return (size_t)(cur - begin) + ascii_count;
+		}
+
+		_mm_storeu_si128((__m128i *)out, mapped);
+		cur += 16;
+		out += 16;
+	}
+#endif
+
+	// plain C++ version, 8 bytes at a time
+	// with every byte below 0x80 the additions can't carry into the next byte
+	const std::uint64_t ones = 0x0101010101010101ULL;
+	while(end - cur >= 8)
+	{
+		std::uint64_t bytes;
+		memcpy(&bytes, cur, 8);
+
+		if((bytes & (ones * 0x80)) != 0) break;
+
+		// the top bit is set in bytes that are at least first and not past the last letter
+		std::uint64_t at_least_first = bytes + ones * (0x80 - first);
+		std::uint64_t past_last = bytes + ones * (0x80 - first - 26);
+		std::uint64_t letters = at_least_first & ~past_last & (ones * 0x80);
+
+		bytes ^= letters >> 2;
+		memcpy(out, &bytes, 8);
+
+		cur += 8;
+		out += 8;
+	}
+
+	for(; (cur < end) && (*cur < 0x80); ++cur, ++out) *out = MapASCIICharacterCase(*cur, mapping);
+
+	return (size_t)(cur - begin);
+}
+
+// maps the 2 byte character at in into the 2 bytes at out if its mapping is also a single 2 byte character
+// returns false and doesn't write anything if it isn't. in and out can be the same
+inline bool MapUTF8CaseTwoBytes(const _uchar8bit *in, _uchar8bit *out, utf8case_mapping mapping)
+{
+	if(((in[0] & 0xE0) != 0xC0) || ((in[1] & 0xC0) != 0x80)) return false;
+
+	_char32bit c = ((in[0] & 0x1F) << 6) | (in[1] & 0x3F);
+	const utf8case_record &record = GetUTF8CaseRecord(c);
+	_char32bit mapped = (_char32bit)((std::int32_t)c + record.delta[mapping]);
+
+	if((record.expansion[mapping] != 0) || (mapped < 0x80) || (mapped >= 0x800)) return false;
+
+	out[0] = (_uchar8bit)(0xC0 + (mapped >> 6));
+	out[1] = (_uchar8bit)(0x80 + (mapped & 0x3F));
+
+	return true;
+}
+
+// the part of MapUTF8CaseCharacter() that handles any character. Kept apart so the 2 byte case is small enough to inline
+inline size_t MapUTF8CaseAnyCharacter(const _uchar8bit *&cur, const _uchar8bit *end, _uchar8bit *out, utf8case_mapping mapping)
+{
+	// 3 byte characters are mostly CJK and other scripts that don't have case
+	if(((cur[0] & 0xF0) == 0xE0) && (end - cur >= 3) && ((cur[1] & 0xC0) == 0x80) && ((cur[2] & 0xC0) == 0x80))
+	{
+		_char32bit c = ((cur[0] & 0x0F) << 12) | ((cur[1] & 0x3F) << 6) | (cur[2] & 0x3F);
+		const utf8case_record &record = GetUTF8CaseRecord(c);
+
+		if((record.expansion[mapping] == 0) && (record.delta[mapping] == 0))
+		{
+			out[0] = cur[0];
+			out[1] = cur[1];
+			out[2] = cur[2];
+			cur += 3;
+
+			return 3;
+		}
+	}
+
+	const _uchar8bit *start = cur;
+	_char32bit c = DecodeUTF8Character(cur, end);
+	const utf8case_record &record = GetUTF8CaseRecord(c);
+
+	if(record.expansion[mapping] != 0)
+	{
+		const std::uint32_t *expansion = GetUTF8CaseExpansion(record.expansion[mapping]);
+
+		size_t size = WriteUTF8Character(expansion[0], out);
+		size += WriteUTF8Character(expansion[1], out + size);
+		if(expansion[2] != 0) size += WriteUTF8Character(expansion[2], out + size);
+
+		return size;
+	}
+
+	if(record.delta[mapping] != 0) return WriteUTF8Character((_char32bit)((std::int32_t)c + record.delta[mapping]), out);
+
+	size_t size = (size_t)(cur - start);
+	for(size_t i = 0; i < size; ++i) out[i] = start[i];
+
+	return size;
+}
+
+// maps the character that isn't ASCII at cur into out and moves cur past it. returns the number of bytes written, up to 12
+// characters without a mapping are copied as they are, and so are broken sequences
+inline size_t MapUTF8CaseCharacter(const _uchar8bit *&cur, const _uchar8bit *end, _uchar8bit *out, utf8case_mapping mapping)
+{
+	// most of the letters that have a case are 2 bytes and map to another 2 byte letter
+	if((end - cur >= 2) && MapUTF8CaseTwoBytes(cur, out, mapping))
+	{
+		cur += 2;
+		return 2;
+	}
+
+	return MapUTF8CaseAnyCharacter(cur, end, out, mapping);
+}
+
+// returns the number of bytes [begin, end) takes up after it's case mapped
+inline size_t GetUTF8CaseMappedSize(const _uchar8bit *begin, const _uchar8bit *end, utf8case_mapping mapping)
+{
+	size_t size = 0;
+	const _uchar8bit *cur = begin;
+
+	while(cur < end)
+	{
+		if(*cur < 0x80)
+		{
+			++size;
+			++cur;
+			continue;
+		}
+
+		const _uchar8bit *start = cur;
+		_char32bit c = DecodeUTF8Character(cur, end);
+		const utf8case_record &record = GetUTF8CaseRecord(c);
+
+		if(record.expansion[mapping] != 0)
+		{
+			const std::uint32_t *expansion = GetUTF8CaseExpansion(record.expansion[mapping]);
+
+			size += GetUTF8CharacterSize(expansion[0]) + GetUTF8CharacterSize(expansion[1]);
+			if(expansion[2] != 0) size += GetUTF8CharacterSize(expansion[2]);
+		}
+		else if(record.delta[mapping] != 0)
+		{
+			size += GetUTF8CharacterSize((_char32bit)((std::int32_t)c + record.delta[mapping]));
+		}
+		else
+		{
+			size += (size_t)(cur - start);
+		}
+	}
+
+	return size;
+}
+
+// case maps [begin, end) into out and returns the end of the output
+// out needs GetUTF8CaseMappedSize() bytes, or 3 times the size of the input which is always enough
+// ASCII is mapped a block at a time and the rest one character at a time with the tables
+inline _uchar8bit *MapUTF8Case(const _uchar8bit *begin, const _uchar8bit *end, _uchar8bit *out, utf8case_mapping mapping)
+{
+	const _uchar8bit *cur = begin;
+
+	while(cur < end)
+	{
+		size_t ascii_count = MapASCIICase(cur, end, out, mapping);
+		cur += ascii_count;
+		out += ascii_count;
+
+		// the characters that aren't ASCII usually come together, split by single spaces or punctuation that
+		// aren't worth going back to the block version for
+		while(cur < end)
+		{
+			if(*cur >= 0x80)
+			{
+				out += MapUTF8CaseCharacter(cur, end, out, mapping);
+			}
+			else if((cur + 1 == end) || (cur[1] >= 0x80))
+			{
+				*out++ = MapASCIICharacterCase(*cur++, mapping);
+			}
+			else break;
+		}
+	}
+
+	return out;
+}
+
+// case maps [begin, end) in place for as long as every character's mapping is the same size as the character
+// returns the end of the range, or the first character whose mapping is a different size. Everything before
+// that is mapped and everything from there on isn't changed
+inline _uchar8bit *MapUTF8CaseInPlace(_uchar8bit *begin, _uchar8bit *end, utf8case_mapping mapping)
+{
+	_uchar8bit *cur = begin;
+
+	while(cur < end)
+	{
+		cur += MapASCIICase(cur, end, cur, mapping);
+
+		while(cur < end)
+		{
+			if(*cur < 0x80)
+			{
+				if((cur + 1 < end) && (cur[1] < 0x80)) break;
+
+				*cur = MapASCIICharacterCase(*cur, mapping);
+				++cur;
+				continue;
+			}
+
+			if((end - cur >= 2) && MapUTF8CaseTwoBytes(cur, cur, mapping))
+			{
+				cur += 2;
+				continue;
+			}
+
+			_uchar8bit mapped[12];
+			const _uchar8bit *next = cur;
+			size_t size = MapUTF8CaseAnyCharacter(next, end, mapped, mapping);
+
+			if(size != (size_t)(next - cur)) return cur;
+
+			for(size_t i = 0; i < size; ++i) cur[i] = mapped[i];
+			cur += size;
+		}
+	}
+
+	return end;
+}
+
+}
+
+#endif
@@ -0,0 +1,709 @@
+// utf8casetables.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+// the Unicode 16.0.0 case mappings used by utf8case.h
+// generated from UnicodeData.txt, SpecialCasing.txt (the mappings that don't depend on context or language)
+// and CaseFolding.txt (status C and F). Don't edit the tables by hand
+//
+#pragma once
+
+#ifndef UTF8CASETABLESHEADER
+#define UTF8CASETABLESHEADER
+
+#include <cstdint>
+#include <cstddef>
+
+namespace sd_utf8
+{
+
+// how a group of characters are lowercased, uppercased and case folded, in that order
+// a mapping to one character adds delta to the code point. A mapping to two or three characters has delta 0
+// and the index of the characters in the expansion table
+struct utf8case_record
+{
+	std::int32_t delta[3];
+	std::uint8_t expansion[3];
+};
+
+// returns how c is case mapped
+// the top bits of c pick one of 69 blocks of 64 code points and the block gives the record
+// nothing at or above U+1E944 has a case mapping
+inline const utf8case_record &GetUTF8CaseRecord(std::uint32_t c)
+{
+	static const std::uint8_t blocks[1958] =
+	{
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 0, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 21, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 26, 27, 0, 28, 28, 29, 28, 30, 31, 32, 33,
+		0, 0, 0, 0, 34, 35, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 40, 28, 41, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 0, 45, 46, 47, 48,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 53, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 56, 57, 0, 58, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 61, 0, 62, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 64, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 67, 68
+	};
+
+	static const std::uint16_t records[4416] =
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 4,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 5,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 8, 9, 6, 7, 6, 7, 6, 7, 0, 6, 7, 6, 7, 6, 7, 6,
+		7, 6, 7, 6, 7, 6, 7, 6, 7, 10, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 11, 6, 7, 6, 7, 6, 7, 12,
+		13, 14, 6, 7, 6, 7, 15, 6, 7, 16, 16, 6, 7, 0, 17, 18, 19, 6, 7, 16, 20, 21, 22, 23, 6, 7, 24, 25, 22, 26, 27, 28,
+		6, 7, 6, 7, 6, 7, 29, 6, 7, 29, 0, 0, 6, 7, 29, 6, 7, 30, 30, 6, 7, 6, 7, 31, 6, 7, 0, 0, 6, 7, 0, 32,
+		0, 0, 0, 0, 33, 34, 35, 33, 34, 35, 33, 34, 35, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 36, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 37, 33, 34, 35, 6, 7, 38, 39, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		40, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 41, 6, 7, 42, 43, 44,
+		44, 6, 7, 45, 46, 47, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 48, 49, 50, 51, 52, 0, 53, 53, 0, 54, 0, 55, 56, 0, 0, 0,
+		53, 57, 0, 58, 59, 60, 61, 0, 62, 63, 61, 64, 65, 0, 0, 63, 0, 66, 67, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0,
+		70, 0, 71, 70, 0, 0, 0, 72, 70, 73, 74, 74, 75, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 78, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 0, 0, 6, 7, 0, 0, 0, 27, 27, 27, 0, 80,
+		0, 0, 0, 0, 0, 0, 81, 0, 82, 82, 82, 0, 83, 0, 84, 84, 85, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 86, 87, 87, 87, 88, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 89, 2, 2, 2, 2, 2, 2, 2, 2, 2, 90, 91, 91, 92, 93, 94, 0, 0, 0, 95, 96, 97, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 98, 99, 100, 101, 102, 103, 0, 6, 7, 104, 6, 7, 0, 40, 40, 40,
+		105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		107, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 108, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+		109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+		110, 110, 110, 110, 110, 110, 110, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+		112, 112, 112, 112, 112, 112, 0, 112, 0, 0, 0, 0, 0, 112, 0, 0, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+		113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 0, 0, 113, 113, 113,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+		114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+		114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 115, 115, 115, 115, 115, 115, 0, 0, 116, 116, 116, 116, 116, 116, 0, 0,
+		117, 118, 119, 120, 120, 121, 122, 123, 124, 6, 7, 0, 0, 0, 0, 0, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+		125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 0, 0, 125, 125, 125,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0, 0, 127, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 129, 130, 131, 132, 133, 134, 0, 0, 135, 0,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		136, 136, 136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 136, 136, 136, 136, 136, 136, 0, 0, 137, 137, 137, 137, 137, 137, 0, 0,
+		136, 136, 136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 136, 136, 136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137,
+		136, 136, 136, 136, 136, 136, 0, 0, 137, 137, 137, 137, 137, 137, 0, 0, 138, 136, 139, 136, 140, 136, 141, 136, 0, 137, 0, 137, 0, 137, 0, 137,
+		136, 136, 136, 136, 136, 136, 136, 136, 137, 137, 137, 137, 137, 137, 137, 137, 142, 142, 143, 143, 143, 143, 144, 144, 145, 145, 146, 146, 147, 147, 0, 0,
+		148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+		180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 136, 136, 196, 197, 198, 0, 199, 200, 137, 137, 201, 201, 202, 0, 203, 0,
+		0, 0, 204, 205, 206, 0, 207, 208, 209, 209, 209, 209, 210, 0, 0, 0, 136, 136, 211, 85, 0, 0, 212, 213, 137, 137, 214, 214, 0, 0, 0, 0,
+		136, 136, 215, 88, 216, 100, 217, 218, 137, 137, 219, 219, 104, 0, 0, 0, 0, 0, 220, 221, 222, 0, 223, 224, 225, 225, 226, 226, 227, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 229, 230, 0, 0, 0, 0, 0, 0, 231, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+		0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+		235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+		236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+		109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+		110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+		6, 7, 237, 238, 239, 240, 241, 6, 7, 6, 7, 6, 7, 242, 243, 244, 245, 0, 6, 7, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 246, 246,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+		247, 247, 247, 247, 247, 247, 0, 247, 0, 0, 0, 0, 0, 247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 248, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 6, 7, 249, 0, 0, 6, 7, 6, 7, 250, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 251, 252, 253, 254, 251, 0, 255, 256, 257, 258, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+		6, 7, 6, 7, 259, 260, 261, 6, 7, 6, 7, 262, 6, 7, 0, 0, 6, 7, 0, 0, 0, 0, 6, 7, 6, 7, 6, 7, 263, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		266, 267, 268, 269, 270, 271, 271, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 272, 273, 274, 275, 276, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+		0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+		277, 277, 277, 277, 277, 277, 277, 277, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278,
+		278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+		277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 0, 0, 0, 0, 278, 278, 278, 278, 278, 278, 278, 278,
+		278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 0, 279, 279, 279, 279,
+		279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 0, 279, 279, 279, 279, 279, 279, 279, 0, 279, 279, 0, 280, 280, 280, 280, 280, 280, 280, 280, 280,
+		280, 280, 0, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 0, 280, 280, 280, 280, 280, 280, 280, 0, 280, 280, 0, 0, 0,
+		83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+		83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+		90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281,
+		281, 281, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+		282, 282, 282, 282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+	};
+
+	static const utf8case_record mappings[283] =
+	{
+		{ { 0, 0, 0 }, { 0, 0, 0 } },
+		{ { 32, 0, 32 }, { 0, 0, 0 } },
+		{ { 0, -32, 0 }, { 0, 0, 0 } },
+		{ { 0, 743, 775 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 1, 2 } },
+		{ { 0, 121, 0 }, { 0, 0, 0 } },
+		{ { 1, 0, 1 }, { 0, 0, 0 } },
+		{ { 0, -1, 0 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 3, 0, 3 } },
+		{ { 0, -232, 0 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 4, 5 } },
+		{ { -121, 0, -121 }, { 0, 0, 0 } },
+		{ { 0, -300, -268 }, { 0, 0, 0 } },
+		{ { 0, 195, 0 }, { 0, 0, 0 } },
+		{ { 210, 0, 210 }, { 0, 0, 0 } },
+		{ { 206, 0, 206 }, { 0, 0, 0 } },
+		{ { 205, 0, 205 }, { 0, 0, 0 } },
+		{ { 79, 0, 79 }, { 0, 0, 0 } },
+		{ { 202, 0, 202 }, { 0, 0, 0 } },
+		{ { 203, 0, 203 }, { 0, 0, 0 } },
+		{ { 207, 0, 207 }, { 0, 0, 0 } },
+		{ { 0, 97, 0 }, { 0, 0, 0 } },
+		{ { 211, 0, 211 }, { 0, 0, 0 } },
+		{ { 209, 0, 209 }, { 0, 0, 0 } },
+		{ { 0, 163, 0 }, { 0, 0, 0 } },
+		{ { 0, 42561, 0 }, { 0, 0, 0 } },
+		{ { 213, 0, 213 }, { 0, 0, 0 } },
+		{ { 0, 130, 0 }, { 0, 0, 0 } },
+		{ { 214, 0, 214 }, { 0, 0, 0 } },
+		{ { 218, 0, 218 }, { 0, 0, 0 } },
+		{ { 217, 0, 217 }, { 0, 0, 0 } },
+		{ { 219, 0, 219 }, { 0, 0, 0 } },
+		{ { 0, 56, 0 }, { 0, 0, 0 } },
+		{ { 2, 0, 2 }, { 0, 0, 0 } },
+		{ { 1, -1, 1 }, { 0, 0, 0 } },
+		{ { 0, -2, 0 }, { 0, 0, 0 } },
+		{ { 0, -79, 0 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 6, 7 } },
+		{ { -97, 0, -97 }, { 0, 0, 0 } },
+		{ { -56, 0, -56 }, { 0, 0, 0 } },
+		{ { -130, 0, -130 }, { 0, 0, 0 } },
+		{ { 10795, 0, 10795 }, { 0, 0, 0 } },
+		{ { -163, 0, -163 }, { 0, 0, 0 } },
+		{ { 10792, 0, 10792 }, { 0, 0, 0 } },
+		{ { 0, 10815, 0 }, { 0, 0, 0 } },
+		{ { -195, 0, -195 }, { 0, 0, 0 } },
+		{ { 69, 0, 69 }, { 0, 0, 0 } },
+		{ { 71, 0, 71 }, { 0, 0, 0 } },
+		{ { 0, 10783, 0 }, { 0, 0, 0 } },
+		{ { 0, 10780, 0 }, { 0, 0, 0 } },
+		{ { 0, 10782, 0 }, { 0, 0, 0 } },
+		{ { 0, -210, 0 }, { 0, 0, 0 } },
+		{ { 0, -206, 0 }, { 0, 0, 0 } },
+		{ { 0, -205, 0 }, { 0, 0, 0 } },
+		{ { 0, -202, 0 }, { 0, 0, 0 } },
+		{ { 0, -203, 0 }, { 0, 0, 0 } },
+		{ { 0, 42319, 0 }, { 0, 0, 0 } },
+		{ { 0, 42315, 0 }, { 0, 0, 0 } },
+		{ { 0, -207, 0 }, { 0, 0, 0 } },
+		{ { 0, 42343, 0 }, { 0, 0, 0 } },
+		{ { 0, 42280, 0 }, { 0, 0, 0 } },
+		{ { 0, 42308, 0 }, { 0, 0, 0 } },
+		{ { 0, -209, 0 }, { 0, 0, 0 } },
+		{ { 0, -211, 0 }, { 0, 0, 0 } },
+		{ { 0, 10743, 0 }, { 0, 0, 0 } },
+		{ { 0, 42305, 0 }, { 0, 0, 0 } },
+		{ { 0, 10749, 0 }, { 0, 0, 0 } },
+		{ { 0, -213, 0 }, { 0, 0, 0 } },
+		{ { 0, -214, 0 }, { 0, 0, 0 } },
+		{ { 0, 10727, 0 }, { 0, 0, 0 } },
+		{ { 0, -218, 0 }, { 0, 0, 0 } },
+		{ { 0, 42307, 0 }, { 0, 0, 0 } },
+		{ { 0, 42282, 0 }, { 0, 0, 0 } },
+		{ { 0, -69, 0 }, { 0, 0, 0 } },
+		{ { 0, -217, 0 }, { 0, 0, 0 } },
+		{ { 0, -71, 0 }, { 0, 0, 0 } },
+		{ { 0, -219, 0 }, { 0, 0, 0 } },
+		{ { 0, 42261, 0 }, { 0, 0, 0 } },
+		{ { 0, 42258, 0 }, { 0, 0, 0 } },
+		{ { 0, 84, 116 }, { 0, 0, 0 } },
+		{ { 116, 0, 116 }, { 0, 0, 0 } },
+		{ { 38, 0, 38 }, { 0, 0, 0 } },
+		{ { 37, 0, 37 }, { 0, 0, 0 } },
+		{ { 64, 0, 64 }, { 0, 0, 0 } },
+		{ { 63, 0, 63 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 8, 9 } },
+		{ { 0, -38, 0 }, { 0, 0, 0 } },
+		{ { 0, -37, 0 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 10, 11 } },
+		{ { 0, -31, 1 }, { 0, 0, 0 } },
+		{ { 0, -64, 0 }, { 0, 0, 0 } },
+		{ { 0, -63, 0 }, { 0, 0, 0 } },
+		{ { 8, 0, 8 }, { 0, 0, 0 } },
+		{ { 0, -62, -30 }, { 0, 0, 0 } },
+		{ { 0, -57, -25 }, { 0, 0, 0 } },
+		{ { 0, -47, -15 }, { 0, 0, 0 } },
+		{ { 0, -54, -22 }, { 0, 0, 0 } },
+		{ { 0, -8, 0 }, { 0, 0, 0 } },
+		{ { 0, -86, -54 }, { 0, 0, 0 } },
+		{ { 0, -80, -48 }, { 0, 0, 0 } },
+		{ { 0, 7, 0 }, { 0, 0, 0 } },
+		{ { 0, -116, 0 }, { 0, 0, 0 } },
+		{ { -60, 0, -60 }, { 0, 0, 0 } },
+		{ { 0, -96, -64 }, { 0, 0, 0 } },
+		{ { -7, 0, -7 }, { 0, 0, 0 } },
+		{ { 80, 0, 80 }, { 0, 0, 0 } },
+		{ { 0, -80, 0 }, { 0, 0, 0 } },
+		{ { 15, 0, 15 }, { 0, 0, 0 } },
+		{ { 0, -15, 0 }, { 0, 0, 0 } },
+		{ { 48, 0, 48 }, { 0, 0, 0 } },
+		{ { 0, -48, 0 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 12, 13 } },
+		{ { 7264, 0, 7264 }, { 0, 0, 0 } },
+		{ { 0, 3008, 0 }, { 0, 0, 0 } },
+		{ { 38864, 0, 0 }, { 0, 0, 0 } },
+		{ { 8, 0, 0 }, { 0, 0, 0 } },
+		{ { 0, -8, -8 }, { 0, 0, 0 } },
+		{ { 0, -6254, -6222 }, { 0, 0, 0 } },
+		{ { 0, -6253, -6221 }, { 0, 0, 0 } },
+		{ { 0, -6244, -6212 }, { 0, 0, 0 } },
+		{ { 0, -6242, -6210 }, { 0, 0, 0 } },
+		{ { 0, -6243, -6211 }, { 0, 0, 0 } },
+		{ { 0, -6236, -6204 }, { 0, 0, 0 } },
+		{ { 0, -6181, -6180 }, { 0, 0, 0 } },
+		{ { 0, 35266, 35267 }, { 0, 0, 0 } },
+		{ { -3008, 0, -3008 }, { 0, 0, 0 } },
+		{ { 0, 35332, 0 }, { 0, 0, 0 } },
+		{ { 0, 3814, 0 }, { 0, 0, 0 } },
+		{ { 0, 35384, 0 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 14, 15 } },
+		{ { 0, 0, 0 }, { 0, 16, 17 } },
+		{ { 0, 0, 0 }, { 0, 18, 19 } },
+		{ { 0, 0, 0 }, { 0, 20, 21 } },
+		{ { 0, 0, 0 }, { 0, 22, 23 } },
+		{ { 0, -59, -58 }, { 0, 0, 0 } },
+		{ { -7615, 0, 0 }, { 0, 0, 2 } },
+		{ { 0, 8, 0 }, { 0, 0, 0 } },
+		{ { -8, 0, -8 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 24, 25 } },
+		{ { 0, 0, 0 }, { 0, 26, 27 } },
+		{ { 0, 0, 0 }, { 0, 28, 29 } },
+		{ { 0, 0, 0 }, { 0, 30, 31 } },
+		{ { 0, 74, 0 }, { 0, 0, 0 } },
+		{ { 0, 86, 0 }, { 0, 0, 0 } },
+		{ { 0, 100, 0 }, { 0, 0, 0 } },
+		{ { 0, 128, 0 }, { 0, 0, 0 } },
+		{ { 0, 112, 0 }, { 0, 0, 0 } },
+		{ { 0, 126, 0 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 32, 33 } },
+		{ { 0, 0, 0 }, { 0, 34, 35 } },
+		{ { 0, 0, 0 }, { 0, 36, 37 } },
+		{ { 0, 0, 0 }, { 0, 38, 39 } },
+		{ { 0, 0, 0 }, { 0, 40, 41 } },
+		{ { 0, 0, 0 }, { 0, 42, 43 } },
+		{ { 0, 0, 0 }, { 0, 44, 45 } },
+		{ { 0, 0, 0 }, { 0, 46, 47 } },
+		{ { -8, 0, 0 }, { 0, 32, 33 } },
+		{ { -8, 0, 0 }, { 0, 34, 35 } },
+		{ { -8, 0, 0 }, { 0, 36, 37 } },
+		{ { -8, 0, 0 }, { 0, 38, 39 } },
+		{ { -8, 0, 0 }, { 0, 40, 41 } },
+		{ { -8, 0, 0 }, { 0, 42, 43 } },
+		{ { -8, 0, 0 }, { 0, 44, 45 } },
+		{ { -8, 0, 0 }, { 0, 46, 47 } },
+		{ { 0, 0, 0 }, { 0, 48, 49 } },
+		{ { 0, 0, 0 }, { 0, 50, 51 } },
+		{ { 0, 0, 0 }, { 0, 52, 53 } },
+		{ { 0, 0, 0 }, { 0, 54, 55 } },
+		{ { 0, 0, 0 }, { 0, 56, 57 } },
+		{ { 0, 0, 0 }, { 0, 58, 59 } },
+		{ { 0, 0, 0 }, { 0, 60, 61 } },
+		{ { 0, 0, 0 }, { 0, 62, 63 } },
+		{ { -8, 0, 0 }, { 0, 48, 49 } },
+		{ { -8, 0, 0 }, { 0, 50, 51 } },
+		{ { -8, 0, 0 }, { 0, 52, 53 } },
+		{ { -8, 0, 0 }, { 0, 54, 55 } },
+		{ { -8, 0, 0 }, { 0, 56, 57 } },
+		{ { -8, 0, 0 }, { 0, 58, 59 } },
+		{ { -8, 0, 0 }, { 0, 60, 61 } },
+		{ { -8, 0, 0 }, { 0, 62, 63 } },
+		{ { 0, 0, 0 }, { 0, 64, 65 } },
+		{ { 0, 0, 0 }, { 0, 66, 67 } },
+		{ { 0, 0, 0 }, { 0, 68, 69 } },
+		{ { 0, 0, 0 }, { 0, 70, 71 } },
+		{ { 0, 0, 0 }, { 0, 72, 73 } },
+		{ { 0, 0, 0 }, { 0, 74, 75 } },
+		{ { 0, 0, 0 }, { 0, 76, 77 } },
+		{ { 0, 0, 0 }, { 0, 78, 79 } },
+		{ { -8, 0, 0 }, { 0, 64, 65 } },
+		{ { -8, 0, 0 }, { 0, 66, 67 } },
+		{ { -8, 0, 0 }, { 0, 68, 69 } },
+		{ { -8, 0, 0 }, { 0, 70, 71 } },
+		{ { -8, 0, 0 }, { 0, 72, 73 } },
+		{ { -8, 0, 0 }, { 0, 74, 75 } },
+		{ { -8, 0, 0 }, { 0, 76, 77 } },
+		{ { -8, 0, 0 }, { 0, 78, 79 } },
+		{ { 0, 0, 0 }, { 0, 80, 81 } },
+		{ { 0, 0, 0 }, { 0, 82, 83 } },
+		{ { 0, 0, 0 }, { 0, 84, 85 } },
+		{ { 0, 0, 0 }, { 0, 86, 87 } },
+		{ { 0, 0, 0 }, { 0, 88, 89 } },
+		{ { -74, 0, -74 }, { 0, 0, 0 } },
+		{ { -9, 0, 0 }, { 0, 82, 83 } },
+		{ { 0, -7205, -7173 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 90, 91 } },
+		{ { 0, 0, 0 }, { 0, 92, 93 } },
+		{ { 0, 0, 0 }, { 0, 94, 95 } },
+		{ { 0, 0, 0 }, { 0, 96, 97 } },
+		{ { 0, 0, 0 }, { 0, 98, 99 } },
+		{ { -86, 0, -86 }, { 0, 0, 0 } },
+		{ { -9, 0, 0 }, { 0, 92, 93 } },
+		{ { 0, 0, 0 }, { 0, 100, 101 } },
+		{ { 0, 0, 0 }, { 0, 102, 103 } },
+		{ { 0, 0, 0 }, { 0, 104, 105 } },
+		{ { -100, 0, -100 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 106, 107 } },
+		{ { 0, 0, 0 }, { 0, 108, 109 } },
+		{ { 0, 0, 0 }, { 0, 110, 111 } },
+		{ { 0, 0, 0 }, { 0, 112, 113 } },
+		{ { -112, 0, -112 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 114, 115 } },
+		{ { 0, 0, 0 }, { 0, 116, 117 } },
+		{ { 0, 0, 0 }, { 0, 118, 119 } },
+		{ { 0, 0, 0 }, { 0, 120, 121 } },
+		{ { 0, 0, 0 }, { 0, 122, 123 } },
+		{ { -128, 0, -128 }, { 0, 0, 0 } },
+		{ { -126, 0, -126 }, { 0, 0, 0 } },
+		{ { -9, 0, 0 }, { 0, 116, 117 } },
+		{ { -7517, 0, -7517 }, { 0, 0, 0 } },
+		{ { -8383, 0, -8383 }, { 0, 0, 0 } },
+		{ { -8262, 0, -8262 }, { 0, 0, 0 } },
+		{ { 28, 0, 28 }, { 0, 0, 0 } },
+		{ { 0, -28, 0 }, { 0, 0, 0 } },
+		{ { 16, 0, 16 }, { 0, 0, 0 } },
+		{ { 0, -16, 0 }, { 0, 0, 0 } },
+		{ { 26, 0, 26 }, { 0, 0, 0 } },
+		{ { 0, -26, 0 }, { 0, 0, 0 } },
+		{ { -10743, 0, -10743 }, { 0, 0, 0 } },
+		{ { -3814, 0, -3814 }, { 0, 0, 0 } },
+		{ { -10727, 0, -10727 }, { 0, 0, 0 } },
+		{ { 0, -10795, 0 }, { 0, 0, 0 } },
+		{ { 0, -10792, 0 }, { 0, 0, 0 } },
+		{ { -10780, 0, -10780 }, { 0, 0, 0 } },
+		{ { -10749, 0, -10749 }, { 0, 0, 0 } },
+		{ { -10783, 0, -10783 }, { 0, 0, 0 } },
+		{ { -10782, 0, -10782 }, { 0, 0, 0 } },
+		{ { -10815, 0, -10815 }, { 0, 0, 0 } },
+		{ { 0, -7264, 0 }, { 0, 0, 0 } },
+		{ { -35332, 0, -35332 }, { 0, 0, 0 } },
+		{ { -42280, 0, -42280 }, { 0, 0, 0 } },
+		{ { 0, 48, 0 }, { 0, 0, 0 } },
+		{ { -42308, 0, -42308 }, { 0, 0, 0 } },
+		{ { -42319, 0, -42319 }, { 0, 0, 0 } },
+		{ { -42315, 0, -42315 }, { 0, 0, 0 } },
+		{ { -42305, 0, -42305 }, { 0, 0, 0 } },
+		{ { -42258, 0, -42258 }, { 0, 0, 0 } },
+		{ { -42282, 0, -42282 }, { 0, 0, 0 } },
+		{ { -42261, 0, -42261 }, { 0, 0, 0 } },
+		{ { 928, 0, 928 }, { 0, 0, 0 } },
+		{ { -48, 0, -48 }, { 0, 0, 0 } },
+		{ { -42307, 0, -42307 }, { 0, 0, 0 } },
+		{ { -35384, 0, -35384 }, { 0, 0, 0 } },
+		{ { -42343, 0, -42343 }, { 0, 0, 0 } },
+		{ { -42561, 0, -42561 }, { 0, 0, 0 } },
+		{ { 0, -928, 0 }, { 0, 0, 0 } },
+		{ { 0, -38864, -38864 }, { 0, 0, 0 } },
+		{ { 0, 0, 0 }, { 0, 124, 125 } },
+		{ { 0, 0, 0 }, { 0, 126, 127 } },
+		{ { 0, 0, 0 }, { 0, 128, 129 } },
+		{ { 0, 0, 0 }, { 0, 130, 131 } },
+		{ { 0, 0, 0 }, { 0, 132, 133 } },
+		{ { 0, 0, 0 }, { 0, 134, 135 } },
+		{ { 0, 0, 0 }, { 0, 136, 137 } },
+		{ { 0, 0, 0 }, { 0, 138, 139 } },
+		{ { 0, 0, 0 }, { 0, 140, 141 } },
+		{ { 0, 0, 0 }, { 0, 142, 143 } },
+		{ { 0, 0, 0 }, { 0, 144, 145 } },
+		{ { 40, 0, 40 }, { 0, 0, 0 } },
+		{ { 0, -40, 0 }, { 0, 0, 0 } },
+		{ { 39, 0, 39 }, { 0, 0, 0 } },
+		{ { 0, -39, 0 }, { 0, 0, 0 } },
+		{ { 34, 0, 34 }, { 0, 0, 0 } },
+		{ { 0, -34, 0 }, { 0, 0, 0 } }
+	};
+
+	if(c >= 0x1E944) return mappings[0];
+
+	return mappings[records[((size_t)blocks[c >> 6] << 6) | (c & 0x3F)]];
+}
+
+// returns the characters of a mapping to more than one character. the unused places are 0
+inline const std::uint32_t *GetUTF8CaseExpansion(size_t index)
+{
+	static const std::uint32_t expansions[146][3] =
+	{
+		{ 0x0000, 0x0000, 0x0000 },
+		{ 0x0053, 0x0053, 0x0000 },
+		{ 0x0073, 0x0073, 0x0000 },
+		{ 0x0069, 0x0307, 0x0000 },
+		{ 0x02BC, 0x004E, 0x0000 },
+		{ 0x02BC, 0x006E, 0x0000 },
+		{ 0x004A, 0x030C, 0x0000 },
+		{ 0x006A, 0x030C, 0x0000 },
+		{ 0x0399, 0x0308, 0x0301 },
+		{ 0x03B9, 0x0308, 0x0301 },
+		{ 0x03A5, 0x0308, 0x0301 },
+		{ 0x03C5, 0x0308, 0x0301 },
+		{ 0x0535, 0x0552, 0x0000 },
+		{ 0x0565, 0x0582, 0x0000 },
+		{ 0x0048, 0x0331, 0x0000 },
+		{ 0x0068, 0x0331, 0x0000 },
+		{ 0x0054, 0x0308, 0x0000 },
+		{ 0x0074, 0x0308, 0x0000 },
+		{ 0x0057, 0x030A, 0x0000 },
+		{ 0x0077, 0x030A, 0x0000 },
+		{ 0x0059, 0x030A, 0x0000 },
+		{ 0x0079, 0x030A, 0x0000 },
+		{ 0x0041, 0x02BE, 0x0000 },
+		{ 0x0061, 0x02BE, 0x0000 },
+		{ 0x03A5, 0x0313, 0x0000 },
+		{ 0x03C5, 0x0313, 0x0000 },
+		{ 0x03A5, 0x0313, 0x0300 },
+		{ 0x03C5, 0x0313, 0x0300 },
+		{ 0x03A5, 0x0313, 0x0301 },
+		{ 0x03C5, 0x0313, 0x0301 },
+		{ 0x03A5, 0x0313, 0x0342 },
+		{ 0x03C5, 0x0313, 0x0342 },
+		{ 0x1F08, 0x0399, 0x0000 },
+		{ 0x1F00, 0x03B9, 0x0000 },
+		{ 0x1F09, 0x0399, 0x0000 },
+		{ 0x1F01, 0x03B9, 0x0000 },
+		{ 0x1F0A, 0x0399, 0x0000 },
+		{ 0x1F02, 0x03B9, 0x0000 },
+		{ 0x1F0B, 0x0399, 0x0000 },
+		{ 0x1F03, 0x03B9, 0x0000 },
+		{ 0x1F0C, 0x0399, 0x0000 },
+		{ 0x1F04, 0x03B9, 0x0000 },
+		{ 0x1F0D, 0x0399, 0x0000 },
+		{ 0x1F05, 0x03B9, 0x0000 },
+		{ 0x1F0E, 0x0399, 0x0000 },
+		{ 0x1F06, 0x03B9, 0x0000 },
+		{ 0x1F0F, 0x0399, 0x0000 },
+		{ 0x1F07, 0x03B9, 0x0000 },
+		{ 0x1F28, 0x0399, 0x0000 },
+		{ 0x1F20, 0x03B9, 0x0000 },
+		{ 0x1F29, 0x0399, 0x0000 },
+		{ 0x1F21, 0x03B9, 0x0000 },
+		{ 0x1F2A, 0x0399, 0x0000 },
+		{ 0x1F22, 0x03B9, 0x0000 },
+		{ 0x1F2B, 0x0399, 0x0000 },
+		{ 0x1F23, 0x03B9, 0x0000 },
+		{ 0x1F2C, 0x0399, 0x0000 },
+		{ 0x1F24, 0x03B9, 0x0000 },
+		{ 0x1F2D, 0x0399, 0x0000 },
+		{ 0x1F25, 0x03B9, 0x0000 },
+		{ 0x1F2E, 0x0399, 0x0000 },
+		{ 0x1F26, 0x03B9, 0x0000 },
+		{ 0x1F2F, 0x0399, 0x0000 },
+		{ 0x1F27, 0x03B9, 0x0000 },
+		{ 0x1F68, 0x0399, 0x0000 },
+		{ 0x1F60, 0x03B9, 0x0000 },
+		{ 0x1F69, 0x0399, 0x0000 },
+		{ 0x1F61, 0x03B9, 0x0000 },
+		{ 0x1F6A, 0x0399, 0x0000 },
+		{ 0x1F62, 0x03B9, 0x0000 },
+		{ 0x1F6B, 0x0399, 0x0000 },
+		{ 0x1F63, 0x03B9, 0x0000 },
+		{ 0x1F6C, 0x0399, 0x0000 },
+		{ 0x1F64, 0x03B9, 0x0000 },
+		{ 0x1F6D, 0x0399, 0x0000 },
+		{ 0x1F65, 0x03B9, 0x0000 },
+		{ 0x1F6E, 0x0399, 0x0000 },
+		{ 0x1F66, 0x03B9, 0x0000 },
+		{ 0x1F6F, 0x0399, 0x0000 },
+		{ 0x1F67, 0x03B9, 0x0000 },
+		{ 0x1FBA, 0x0399, 0x0000 },
+		{ 0x1F70, 0x03B9, 0x0000 },
+		{ 0x0391, 0x0399, 0x0000 },
+		{ 0x03B1, 0x03B9, 0x0000 },
+		{ 0x0386, 0x0399, 0x0000 },
+		{ 0x03AC, 0x03B9, 0x0000 },
+		{ 0x0391, 0x0342, 0x0000 },
+		{ 0x03B1, 0x0342, 0x0000 },
+		{ 0x0391, 0x0342, 0x0399 },
+		{ 0x03B1, 0x0342, 0x03B9 },
+		{ 0x1FCA, 0x0399, 0x0000 },
+		{ 0x1F74, 0x03B9, 0x0000 },
+		{ 0x0397, 0x0399, 0x0000 },
+		{ 0x03B7, 0x03B9, 0x0000 },
+		{ 0x0389, 0x0399, 0x0000 },
+		{ 0x03AE, 0x03B9, 0x0000 },
+		{ 0x0397, 0x0342, 0x0000 },
+		{ 0x03B7, 0x0342, 0x0000 },
+		{ 0x0397, 0x0342, 0x0399 },
+		{ 0x03B7, 0x0342, 0x03B9 },
+		{ 0x0399, 0x0308, 0x0300 },
+		{ 0x03B9, 0x0308, 0x0300 },
+		{ 0x0399, 0x0342, 0x0000 },
+		{ 0x03B9, 0x0342, 0x0000 },
+		{ 0x0399, 0x0308, 0x0342 },
+		{ 0x03B9, 0x0308, 0x0342 },
+		{ 0x03A5, 0x0308, 0x0300 },
+		{ 0x03C5, 0x0308, 0x0300 },
+		{ 0x03A1, 0x0313, 0x0000 },
+		{ 0x03C1, 0x0313, 0x0000 },
+		{ 0x03A5, 0x0342, 0x0000 },
+		{ 0x03C5, 0x0342, 0x0000 },
+		{ 0x03A5, 0x0308, 0x0342 },
+		{ 0x03C5, 0x0308, 0x0342 },
+		{ 0x1FFA, 0x0399, 0x0000 },
+		{ 0x1F7C, 0x03B9, 0x0000 },
+		{ 0x03A9, 0x0399, 0x0000 },
+		{ 0x03C9, 0x03B9, 0x0000 },
+		{ 0x038F, 0x0399, 0x0000 },
+		{ 0x03CE, 0x03B9, 0x0000 },
+		{ 0x03A9, 0x0342, 0x0000 },
+		{ 0x03C9, 0x0342, 0x0000 },
+		{ 0x03A9, 0x0342, 0x0399 },
+		{ 0x03C9, 0x0342, 0x03B9 },
+		{ 0x0046, 0x0046, 0x0000 },
+		{ 0x0066, 0x0066, 0x0000 },
+		{ 0x0046, 0x0049, 0x0000 },
+		{ 0x0066, 0x0069, 0x0000 },
+		{ 0x0046, 0x004C, 0x0000 },
+		{ 0x0066, 0x006C, 0x0000 },
+		{ 0x0046, 0x0046, 0x0049 },
+		{ 0x0066, 0x0066, 0x0069 },
+		{ 0x0046, 0x0046, 0x004C },
+		{ 0x0066, 0x0066, 0x006C },
+		{ 0x0053, 0x0054, 0x0000 },
+		{ 0x0073, 0x0074, 0x0000 },
+		{ 0x0544, 0x0546, 0x0000 },
+		{ 0x0574, 0x0576, 0x0000 },
+		{ 0x0544, 0x0535, 0x0000 },
+		{ 0x0574, 0x0565, 0x0000 },
+		{ 0x0544, 0x053B, 0x0000 },
+		{ 0x0574, 0x056B, 0x0000 },
+		{ 0x054E, 0x0546, 0x0000 },
+		{ 0x057E, 0x0576, 0x0000 },
+		{ 0x0544, 0x053D, 0x0000 },
+		{ 0x0574, 0x056D, 0x0000 }
+	};
+
+	return expansions[index];
+}
+
+}
+
+#endif
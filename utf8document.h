@@ -0,0 +1,570 @@
+// utf8document.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8DOCUMENTHEADER
+#define UTF8DOCUMENTHEADER
+
+#include <memory>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+	#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+#include "utf8string.h"
+#include "utf8parallel.h"
+
+namespace sd_utf8
+{
+
+// a read-only UTF-8 file that is mapped into memory instead of being copied into a string
+// pages are only read from disk when they're touched so a large file opens right away. It has the read-only
+// interface of utf8string_view and view() gives a view of the whole file
+// find(), count(), find_all() and size() split the file into pieces with SplitUTF8Pieces() and work on them with a
+// utf8thread_pool, utf8thread_pool::shared() unless another one is set. They give character positions like the
+// other strings do. The file shouldn't be changed while it's open
+class utf8document
+{
+	public:
+		typedef _char32bit			value_type;
+		typedef const _char32bit	*pointer;
+		typedef const _char32bit	*const_pointer;
+		typedef const _char32bit	&reference;
+		typedef const _char32bit	&const_reference;
+		typedef size_t				size_type;
+		typedef ptrdiff_t			difference_type;
+
+		typedef utf8string_view::const_iterator			const_iterator;
+		typedef const_iterator							iterator;
+		typedef utf8string_view::const_reverse_iterator	const_reverse_iterator;
+		typedef const_reverse_iterator					reverse_iterator;
+
+	private:
+		const _uchar8bit *document_data;
+		size_type document_bytes;
+		bool document_open;
+
+		// the pool the work runs on. It's document_own_pool if set_threads() made one
+		utf8thread_pool *document_pool;
+		std::unique_ptr<utf8thread_pool> document_own_pool;
+
+		// a part of the file that one thread works on
+		struct piece
+		{
+			const _uchar8bit *begin;
+			const _uchar8bit *end;
+
+			const _uchar8bit *first_match;		// NULL if nothing was found
+			size_type matches;
+			size_type chars;					// characters before first_match or in the whole piece
+
+			// character positions of the matches counted from begin
+			std::vector<size_type> positions;
+		};
+
+		// the mapping can only be unmapped once
+		utf8document(const utf8document &);
+		utf8document &operator=(const utf8document &);
+
+		// cuts [begin, end) into pieces that start on character boundaries
+		static std::vector<piece> makepieces(const _uchar8bit *begin, const _uchar8bit *end)
+		{
+			std::vector<const _uchar8bit *> cuts;
+			SplitUTF8Pieces(begin, end, cuts);
+
+			std::vector<piece> pieces(cuts.size() - 1);
+			for(size_type i = 0; i < pieces.size(); ++i)
+			{
+				pieces[i].begin = cuts[i];
+				pieces[i].end = cuts[i + 1];
+			}
+
+			return pieces;
+		}
+
+		// finds the matches that start in [p.begin, p.end). The last ones can end after p.end
+		// the character positions are only counted if keep_positions is set
+		void searchpiece(piece &p, utf8string_view str, bool keep_positions) const
+		{
+			const _uchar8bit *finish = document_data + document_bytes;
+			const _uchar8bit *window_end = ((size_type)(finish - p.end) >= str.size_bytes()) ? p.end + str.size_bytes() - 1 : finish;
+
+			p.first_match = NULL;
+			p.matches = 0;
+			p.positions.clear();
+
+			// the characters between begin and counted
+			const _uchar8bit *counted = p.begin;
+			size_type chars = 0;
+
+			for(const _uchar8bit *cur = p.begin; cur < p.end;)
+			{
+				size_type found = FindUTF8Bytes(cur, window_end, str.data(), str.data() + str.size_bytes());
+				if((found == npos) || (found >= (size_type)(p.end - cur))) break;
+
+				cur += found;
+
+				if(keep_positions)
+				{
+					chars += CountUTF8Characters(counted, cur);
+					counted = cur;
+
+					p.positions.push_back(chars);
+				}
+
+				if(p.first_match == NULL) p.first_match = cur;
+				++p.matches;
+
+				// the next match can overlap this one
+				IncToNextCharacter(cur);
+			}
+
+			if(keep_positions) p.chars = chars + CountUTF8Characters(counted, p.end);
+		}
+
+		// finds the matches in every piece
+		// matches can overlap so each piece is searched on its own, including the matches that run into the next one
+		std::vector<piece> searchpieces(utf8string_view str, bool keep_positions) const
+		{
+			std::vector<piece> pieces = makepieces(document_data, document_data + document_bytes);
+
+			document_pool->run(pieces.size(), [&](size_type i)
+			{
+				searchpiece(pieces[i], str, keep_positions);
+			});
+
+			return pieces;
+		}
+
+		void release()
+		{
+			if(document_bytes > 0)
+			{
+#if defined(_WIN32)
+				UnmapViewOfFile(document_data);
+#else
+				munmap((void *)document_data, document_bytes);
+#endif
+			}
+
+			document_data = (const _uchar8bit *)"";
+			document_bytes = 0;
+			document_open = false;
+		}
+
+	public:
+		// default constructor. Nothing is open
+		utf8document()
+			:document_data((const _uchar8bit *)""), document_bytes(0), document_open(false), document_pool(&utf8thread_pool::shared())
+		{
+		}
+
+		// maps the file at path. Check is_open() to see if it worked
+		explicit utf8document(const char *path)
+			:document_data((const _uchar8bit *)""), document_bytes(0), document_open(false), document_pool(&utf8thread_pool::shared())
+		{
+			open(path);
+		}
+
+		utf8document(utf8document &&other)
+			:document_data(other.document_data), document_bytes(other.document_bytes), document_open(other.document_open),
+			 document_pool(other.document_pool), document_own_pool(std::move(other.document_own_pool))
+		{
+			other.document_pool = &utf8thread_pool::shared();
+			other.document_data = (const _uchar8bit *)"";
+			other.document_bytes = 0;
+			other.document_open = false;
+		}
+
+		utf8document &operator=(utf8document &&other)
+		{
+			if(this != &other)
+			{
+				release();
+				swap(other);
+			}
+
+			return *this;
+		}
+
+		~utf8document()
+		{
+			release();
+		}
+
+		// maps the file at path, closing the one that was open
+		// returns false if the file couldn't be opened or mapped. An empty file opens as an empty document
+		bool open(const char *path)
+		{
+			release();
+
+			const void *mapped = NULL;
+			unsigned long long size = 0;
+
+#if defined(_WIN32)
+			HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+			if(file == INVALID_HANDLE_VALUE) return false;
+
+			LARGE_INTEGER file_size;
+			bool ok = (GetFileSizeEx(file, &file_size) != 0) && ((unsigned long long)file_size.QuadPart <= (size_type)-1);
+			size = ok ? (unsigned long long)file_size.QuadPart : 0;
+
+			if(ok && (size > 0))
+			{
+				// the view keeps the mapping and the file open after their handles are closed
+				HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+				if(mapping != NULL)
+				{
+					mapped = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+					CloseHandle(mapping);
+				}
+
+				ok = (mapped != NULL);
+			}
+
+			CloseHandle(file);
+#else
+			int file = ::open(path, O_RDONLY);
+			if(file == -1) return false;
+
+			struct stat info;
+			bool ok = (fstat(file, &info) == 0) && ((unsigned long long)info.st_size <= (size_type)-1);
+			size = ok ? (unsigned long long)info.st_size : 0;
+
+			if(ok && (size > 0))
+			{
+				// the mapping keeps the file open after it's closed
+				void *pages = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, file, 0);
+				ok = (pages != MAP_FAILED);
+
+				if(ok)
+				{
+#if defined(MADV_SEQUENTIAL)
+					// each thread reads its piece from start to finish
+					madvise(pages, (size_t)size, MADV_SEQUENTIAL);
+#endif
+					mapped = pages;
+				}
+			}
+
+			::close(file);
+#endif
+
+			if(!ok) return false;
+
+			if(size > 0)
+			{
+				document_data = (const _uchar8bit *)mapped;
+				document_bytes = (size_type)size;
+			}
+
+			document_open = true;
+
+			return true;
+		}
+
+		// unmaps the file. Views and iterators of it can't be used after this
+		void close()
+		{
+			release();
+		}
+
+		bool is_open() const
+		{
+			return document_open;
+		}
+
+		// makes find(), count(), find_all() and size() use a pool of their own with this many threads
+		// the default is utf8thread_pool::shared() which has one for each core. 1 does the work on the calling thread
+		void set_threads(unsigned threads)
+		{
+			document_own_pool.reset(new utf8thread_pool((threads == 0) ? 1 : threads));
+			document_pool = document_own_pool.get();
+		}
+
+		// makes find(), count(), find_all() and size() run on pool. It has to outlive the document
+		void set_pool(utf8thread_pool &pool)
+		{
+			document_pool = &pool;
+			document_own_pool.reset();
+		}
+
+		// returns the number of threads the work runs on
+		unsigned threads() const
+		{
+			return (unsigned)document_pool->size();
+		}
+
+		void swap(utf8document &other)
+		{
+			std::swap(document_data, other.document_data);
+			std::swap(document_bytes, other.document_bytes);
+			std::swap(document_open, other.document_open);
+			std::swap(document_pool, other.document_pool);
+			std::swap(document_own_pool, other.document_own_pool);
+		}
+
+		// capacity ------------------------------------------------------------
+
+		// returns the number of characters in the file
+		// it's counted by all the threads every time this is called
+		size_type size() const
+		{
+			std::vector<piece> pieces = makepieces(document_data, document_data + document_bytes);
+
+			document_pool->run(pieces.size(), [&pieces](size_type i)
+			{
+				pieces[i].chars = CountUTF8Characters(pieces[i].begin, pieces[i].end);
+			});
+
+			size_type chars = 0;
+			for(const piece &p : pieces) chars += p.chars;
+
+			return chars;
+		}
+
+		// returns the number of characters in the file
+		// synonomous with size()
+		size_type length() const
+		{
+			return size();
+		}
+
+		// returns the size of the file in bytes
+		size_type size_bytes() const
+		{
+			return document_bytes;
+		}
+
+		bool empty() const
+		{
+			return document_bytes == 0;
+		}
+
+		// returns a pointer to the first byte of the file
+		// the data isn't null terminated
+		const _uchar8bit *data() const
+		{
+			return document_data;
+		}
+
+		// a view of the whole file. It's valid until the document is closed
+		utf8string_view view() const
+		{
+			return utf8string_view(document_data, document_bytes);
+		}
+
+		operator utf8string_view () const
+		{
+			return view();
+		}
+
+		// iterators ----------------------------------------------------------------------
+
+		const_iterator cbegin() const
+		{
+			return const_iterator(document_data);
+		}
+
+		const_iterator begin() const
+		{
+			return cbegin();
+		}
+
+		const_iterator cend() const
+		{
+			return const_iterator(document_data + document_bytes);
+		}
+
+		const_iterator end() const
+		{
+			return cend();
+		}
+
+		const_reverse_iterator crbegin() const
+		{
+			return const_reverse_iterator(cend());
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return crbegin();
+		}
+
+		const_reverse_iterator crend() const
+		{
+			return const_reverse_iterator(cbegin());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return crend();
+		}
+
+		// decodes up to max_chars characters starting at pos into out and moves pos to where the next block starts
+		// returns the number of characters written. It's less than max_chars only when pos reaches end()
+		size_type decode_block (const_iterator &pos, _char32bit *out, size_type max_chars) const
+		{
+			return view().decode_block(pos, out, max_chars);
+		}
+
+		// access -------------------------------------------------------------------------------------
+
+		// returns the character at pos
+		// doesn't throw exception. undefined if out of range
+		value_type operator[](size_type pos) const
+		{
+			return view()[pos];
+		}
+
+		// returns the character at pos
+		// will throw an exception if out of range
+		value_type at(size_type pos) const
+		{
+			return view().at(pos);
+		}
+
+		// string operations -----------------------------------------------------------------------------
+
+		// returns a view of part of the file. Nothing is copied
+		utf8string_view substr(size_type pos = 0, size_type len = npos) const
+		{
+			return view().substr(pos, len);
+		}
+
+		// returns the character position of the first match of str at or after pos or npos
+		// the pool hands out the pieces in order and the ones after a match are skipped, so a match near the start
+		// doesn't read the rest of the file
+		size_type find(utf8string_view str, size_type pos = 0) const
+		{
+			const _uchar8bit *start = document_data;
+			const _uchar8bit *finish = document_data + document_bytes;
+
+			size_type start_pos = AdvanceUTF8Characters(start, finish, pos);
+			if(start_pos < pos) return npos;
+			if(str.empty()) return start_pos;
+
+			std::vector<piece> pieces = makepieces(start, finish);
+
+			// the first piece that has a match so far
+			std::atomic<size_type> first_found(npos);
+
+			document_pool->run(pieces.size(), [&](size_type i)
+			{
+				if(i > first_found) return;
+
+				piece &p = pieces[i];
+				const _uchar8bit *window_end = ((size_type)(finish - p.end) >= str.size_bytes()) ? p.end + str.size_bytes() - 1 : finish;
+
+				size_type found = FindUTF8Bytes(p.begin, window_end, str.data(), str.data() + str.size_bytes());
+
+				if((found != npos) && (found < (size_type)(p.end - p.begin)))
+				{
+					p.first_match = p.begin + found;
+					p.chars = CountUTF8Characters(p.begin, p.first_match);
+
+					size_type cur = first_found;
+					while((i < cur) && !first_found.compare_exchange_weak(cur, i));
+
+					return;
+				}
+
+				p.chars = CountUTF8Characters(p.begin, p.end);
+			});
+
+			// every piece before the first one with a match was searched
+			size_type chars = start_pos;
+			for(const piece &p : pieces)
+			{
+				chars += p.chars;
+				if(p.first_match != NULL) return chars;
+			}
+
+			return npos;
+		}
+
+		// returns the number of times str is in the file, including matches that overlap like _utf8string::find_all()
+		// an empty str matches at every character and at the end
+		size_type count(utf8string_view str) const
+		{
+			if(str.empty()) return size() + 1;
+
+			std::vector<piece> pieces = searchpieces(str, false);
+
+			size_type matches = 0;
+			for(const piece &p : pieces) matches += p.matches;
+
+			return matches;
+		}
+
+		// returns the character positions of every match of str in order, including matches that overlap
+		// the same positions as _utf8string::find_all() gives
+		std::vector<size_type> find_all(utf8string_view str) const
+		{
+			std::vector<size_type> found;
+
+			if(str.empty())
+			{
+				size_type chars = size();
+
+				found.reserve(chars + 1);
+				for(size_type i = 0; i <= chars; ++i) found.push_back(i);
+
+				return found;
+			}
+
+			std::vector<piece> pieces = searchpieces(str, true);
+
+			size_type matches = 0;
+			for(const piece &p : pieces) matches += p.matches;
+			found.reserve(matches);
+
+			size_type chars = 0;
+			for(const piece &p : pieces)
+			{
+				for(size_type position : p.positions) found.push_back(chars + position);
+				chars += p.chars;
+			}
+
+			return found;
+		}
+
+		static const size_type npos = -1;
+};
+
+// write the file to a stream
+inline std::ostream& operator<<(std::ostream& os, const utf8document &doc)
+{
+	return os << doc.view();
+}
+
+}
+
+#endif
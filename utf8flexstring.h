@@ -0,0 +1,965 @@
+// utf8flexstring.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8FLEXSTRINGHEADER
+#define UTF8FLEXSTRINGHEADER
+
+#include <vector>
+
+#include "utf8string.h"
+
+namespace sd_utf8
+{
+
+// a string that keeps one code unit per character so getting a character by position is O(1)
+// the units are as narrow as the characters allow, like strings in CPython (PEP 393):
+// 1 byte (Latin-1) if every character is under 0x100, 2 bytes (UCS-2) if they're all under 0x10000 and
+// 4 bytes (UCS-4) otherwise. Surrogate code points from broken input also take 4 bytes so UCS-2 never
+// holds anything that looks like a surrogate pair
+// adding a wider character widens the whole string once. The string isn't narrowed again when the wide characters
+// are replaced so the width can be wider than the characters need. Comparisons and searches go by the characters
+// use this for text that is indexed by position a lot and _utf8string for text that's mostly passed along
+template <class Alloc = std::allocator<_uchar8bit>>
+class _flex_string
+{
+	public:
+		typedef _char32bit			value_type;
+		typedef const _char32bit	*pointer;
+		typedef const _char32bit	*const_pointer;
+		typedef const _char32bit	&reference;
+		typedef const _char32bit	&const_reference;
+		typedef size_t				size_type;
+		typedef ptrdiff_t			difference_type;
+
+		typedef std::uint16_t		ucs2_type;
+		typedef std::uint32_t		ucs4_type;
+
+	private:
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<ucs2_type> ucs2_allocator;
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<ucs4_type> ucs4_allocator;
+
+		// only the buffer for the current width holds anything. Empty vectors don't allocate
+		std::vector<_uchar8bit, Alloc> flex_latin1;
+		std::vector<ucs2_type, ucs2_allocator> flex_ucs2;
+		std::vector<ucs4_type, ucs4_allocator> flex_ucs4;
+
+		// 1, 2 or 4
+		size_type flex_width;
+
+		// the number of characters decoded at a time when reading UTF-8
+		enum { decode_block_size = 256 };
+
+		// returns the character at pos in a buffer of units of the given width
+		static value_type loadunit(const void *units, size_type width, size_type pos)
+		{
+			switch(width)
+			{
+				case 1: return ((const _uchar8bit *)units)[pos];
+				case 2: return ((const ucs2_type *)units)[pos];
+				default: return ((const ucs4_type *)units)[pos];
+			}
+		}
+
+	public:
+		// iterates over the characters of a flex_string
+		// it's a position and a pointer to the units so it can move any distance at once
+		// the iterator is invalidated by any change to the string
+		class flex_string_iterator : public std::iterator<std::random_access_iterator_tag, const value_type>
+		{
+			private:
+				const void *units;
+				size_type width;
+				size_type pos;
+
+			public:
+				flex_string_iterator()
+					:units(NULL), width(1), pos(0)
+				{
+				}
+
+				flex_string_iterator(const void *u, size_type w, size_type p)
+					:units(u), width(w), pos(p)
+				{
+				}
+
+				_char32bit operator*() const
+				{
+					return loadunit(units, width, pos);
+				}
+
+				_char32bit operator[](difference_type n) const
+				{
+					return loadunit(units, width, pos + n);
+				}
+
+				// returns the position of the character the iterator points to
+				size_type position() const
+				{
+					return pos;
+				}
+
+				// does not check to see if it goes past the end
+				// iterating past the end is undefined
+				flex_string_iterator &operator++()
+				{
+					++pos;
+					return *this;
+				}
+
+				flex_string_iterator operator++(int)
+				{
+					flex_string_iterator copy(*this);
+					++pos;
+					return copy;
+				}
+
+				// does not check to see if it goes past the end
+				// iterating past begin is undefined
+				flex_string_iterator &operator--()
+				{
+					--pos;
+					return *this;
+				}
+
+				flex_string_iterator operator--(int)
+				{
+					flex_string_iterator copy(*this);
+					--pos;
+					return copy;
+				}
+
+				flex_string_iterator &operator+=(difference_type n)
+				{
+					pos += n;
+					return *this;
+				}
+
+				flex_string_iterator &operator-=(difference_type n)
+				{
+					pos -= n;
+					return *this;
+				}
+
+				flex_string_iterator operator+(difference_type n) const
+				{
+					return flex_string_iterator(units, width, pos + n);
+				}
+
+				flex_string_iterator operator-(difference_type n) const
+				{
+					return flex_string_iterator(units, width, pos - n);
+				}
+
+				difference_type operator-(const flex_string_iterator &other) const
+				{
+					return (difference_type)pos - (difference_type)other.pos;
+				}
+
+				// the programmer is responsible for making both iterators are for the same string
+				bool operator == (const flex_string_iterator &other) const
+				{
+					return pos == other.pos;
+				}
+
+				bool operator != (const flex_string_iterator &other) const
+				{
+					return pos != other.pos;
+				}
+
+				bool operator < (const flex_string_iterator &other) const
+				{
+					return pos < other.pos;
+				}
+
+				bool operator > (const flex_string_iterator &other) const
+				{
+					return pos > other.pos;
+				}
+
+				bool operator <= (const flex_string_iterator &other) const
+				{
+					return pos <= other.pos;
+				}
+
+				bool operator >= (const flex_string_iterator &other) const
+				{
+					return pos >= other.pos;
+				}
+		};
+
+		// all iterators are const. Use set() to change a character
+		typedef flex_string_iterator							const_iterator;
+		typedef flex_string_iterator							iterator;
+		typedef value_reverse_iterator<const_iterator>		const_reverse_iterator;
+		typedef const_reverse_iterator							reverse_iterator;
+
+	private:
+		// returns the narrowest width for a set of characters
+		// bits is all of the characters or'd together. The limits are powers of 2 so it's under a limit only if
+		// every character is
+		static size_type widthfor(_char32bit bits, bool has_surrogates)
+		{
+			if(bits < 0x100) return 1;
+			if((bits < 0x10000) && !has_surrogates) return 2;
+
+			return 4;
+		}
+
+		// returns the narrowest width for the characters in [begin, end)
+		template <typename unit_type>
+		static size_type widthof(const unit_type *begin, const unit_type *end)
+		{
+			_char32bit bits = 0;
+			for(const unit_type *cur = begin; cur < end; ++cur) bits |= *cur;
+
+			// only look for surrogates if they could be there
+			bool has_surrogates = false;
+			if((sizeof(unit_type) > 1) && (bits >= 0xD800))
+			{
+				for(const unit_type *cur = begin; cur < end; ++cur)
+				{
+					if((*cur & 0xFFFFF800) == 0xD800)
+					{
+						has_surrogates = true;
+						break;
+					}
+				}
+			}
+
+			return widthfor(bits, has_surrogates);
+		}
+
+		// the narrowest width the characters fit in. It can be less than flex_width
+		size_type neededwidth() const
+		{
+			switch(flex_width)
+			{
+				case 1: return 1;
+				case 2: return widthof(flex_ucs2.data(), flex_ucs2.data() + flex_ucs2.size());
+				default: return widthof(flex_ucs4.data(), flex_ucs4.data() + flex_ucs4.size());
+			}
+		}
+
+		const void *units() const
+		{
+			switch(flex_width)
+			{
+				case 1: return flex_latin1.data();
+				case 2: return flex_ucs2.data();
+				default: return flex_ucs4.data();
+			}
+		}
+
+		// copies the units to a wider buffer
+		template <typename from_type, class FromAlloc, typename to_type, class ToAlloc>
+		static void copyunits(std::vector<from_type, FromAlloc> &from, std::vector<to_type, ToAlloc> &to, size_type extra)
+		{
+			to.reserve(from.size() + extra);
+			to.assign(from.begin(), from.end());
+
+			std::vector<from_type, FromAlloc> empty(from.get_allocator());
+			from.swap(empty);
+		}
+
+		// makes the units at least width wide and leaves room for extra more characters
+		void widen(size_type width, size_type extra)
+		{
+			if(width <= flex_width) return;
+
+			if(flex_width == 1)
+			{
+				if(width == 2) copyunits(flex_latin1, flex_ucs2, extra);
+				else copyunits(flex_latin1, flex_ucs4, extra);
+			}
+			else
+			{
+				copyunits(flex_ucs2, flex_ucs4, extra);
+			}
+
+			flex_width = width;
+		}
+
+		// adds characters to the end. They must fit in the current width
+		template <typename unit_type>
+		void appendunits(const unit_type *begin, const unit_type *end)
+		{
+			switch(flex_width)
+			{
+				case 1: flex_latin1.insert(flex_latin1.end(), begin, end); break;
+				case 2: flex_ucs2.insert(flex_ucs2.end(), begin, end); break;
+				default: flex_ucs4.insert(flex_ucs4.end(), begin, end); break;
+			}
+		}
+
+		// widens the string if it has to and adds the characters to the end
+		template <typename unit_type>
+		void appendwidened(const unit_type *begin, const unit_type *end, size_type width)
+		{
+			widen(width, (size_type)(end - begin));
+			appendunits(begin, end);
+		}
+
+		// decodes UTF-8 and adds it to the end
+		void appendutf8(const _uchar8bit *cur, const _uchar8bit *finish)
+		{
+			if(cur == finish) return;
+
+			if(flex_width == 1)
+			{
+				// ASCII is already Latin-1
+				_uchar8bit bits = 0;
+				for(const _uchar8bit *c = cur; c < finish; ++c) bits |= *c;
+
+				if(bits < 0x80)
+				{
+					flex_latin1.insert(flex_latin1.end(), cur, finish);
+					return;
+				}
+			}
+
+			// every character gets one unit so the count is the room needed at this width
+			size_type chars = CountUTF8Characters(cur, finish);
+			switch(flex_width)
+			{
+				case 1: flex_latin1.reserve(flex_latin1.size() + chars); break;
+				case 2: flex_ucs2.reserve(flex_ucs2.size() + chars); break;
+				default: flex_ucs4.reserve(flex_ucs4.size() + chars); break;
+			}
+
+			_char32bit block[decode_block_size];
+
+			while(size_type count = DecodeUTF8Block(cur, finish, block, decode_block_size))
+			{
+				// keep the room for what's left if the string has to be widened
+				chars -= count;
+
+				size_type width = widthof(block, block + count);
+				widen(width, count + chars);
+
+				appendunits(block, block + count);
+			}
+		}
+
+		// encodes [begin, end) of a Latin-1 buffer as UTF-8 and adds it to out
+		// short pieces are gathered in a buffer so out isn't appended to for every word. Long ASCII runs are added as they are
+		static void encodelatin1(const _uchar8bit *begin, const _uchar8bit *end, _utf8string<Alloc> &out)
+		{
+			const size_type buffer_size = 512;
+			const size_type long_run = 64;
+
+			_uchar8bit buffer[buffer_size];
+			size_type n = 0;
+
+			const _uchar8bit *cur = begin;
+			while(cur < end)
+			{
+				const _uchar8bit *run = cur;
+				while((cur < end) && (*cur < 0x80)) ++cur;
+
+				size_type run_length = (size_type)(cur - run);
+				if((run_length >= long_run) || (n + run_length > buffer_size))
+				{
+					if(n > 0) out += utf8string_view(buffer, n);
+					n = 0;
+
+					if(run_length >= long_run) out += utf8string_view(run, run_length);
+					else
+					{
+						memcpy(buffer, run, run_length);
+						n = run_length;
+					}
+				}
+				else
+				{
+					memcpy(buffer + n, run, run_length);
+					n += run_length;
+				}
+
+				// 2 bytes each
+				while((cur < end) && (*cur >= 0x80))
+				{
+					if(n + 2 > buffer_size)
+					{
+						out += utf8string_view(buffer, n);
+						n = 0;
+					}
+
+					n += WriteUTF8Character(*cur++, buffer + n);
+				}
+			}
+
+			if(n > 0) out += utf8string_view(buffer, n);
+		}
+
+		// encodes [begin, end) of a UCS-2 or UCS-4 buffer as UTF-8 and adds it to out
+		// UCS-2 has no surrogates so it can go through EncodeUTF8(). UCS-4 is done a character at a time so
+		// surrogate code points are written back as they were read instead of being paired up
+		template <typename unit_type>
+		static void encodewide(const unit_type *begin, const unit_type *end, _utf8string<Alloc> &out)
+		{
+			// each unit takes at most 3 bytes in UCS-2 and 4 bytes in UCS-4
+			const size_type block_units = 128;
+			_uchar8bit buffer[block_units * 4];
+
+			for(const unit_type *cur = begin; cur < end;)
+			{
+				const unit_type *block_end = ((size_type)(end - cur) > block_units) ? cur + block_units : end;
+
+				_uchar8bit *written;
+				if(sizeof(unit_type) == 2)
+				{
+					written = EncodeUTF8(cur, block_end, buffer);
+				}
+				else
+				{
+					written = buffer;
+					for(const unit_type *c = cur; c < block_end; ++c) written += WriteUTF8Character(*c, written);
+				}
+
+				out += utf8string_view(buffer, (size_type)(written - buffer));
+				cur = block_end;
+			}
+		}
+
+		// gets len characters from pos in the current width
+		template <typename unit_type>
+		static _flex_string makesub(const unit_type *begin, const unit_type *end, const Alloc &alloc)
+		{
+			_flex_string out(alloc);
+			out.appendwidened(begin, end, widthof(begin, end));
+
+			return out;
+		}
+
+		// finds needle in [begin, end). Both are in the same width
+		// returns the position of the first match or npos
+		template <typename unit_type>
+		static size_type findunits(const unit_type *begin, const unit_type *end, const unit_type *needle, size_type needle_len)
+		{
+			if(needle_len == 0) return 0;
+
+			const _uchar8bit *bytes = (const _uchar8bit *)begin;
+			const _uchar8bit *bytes_end = (const _uchar8bit *)end;
+			const _uchar8bit *needle_bytes = (const _uchar8bit *)needle;
+			const _uchar8bit *needle_end = needle_bytes + needle_len * sizeof(unit_type);
+
+			// the byte search can find a match that starts in the middle of a unit. Look again after it
+			for(const _uchar8bit *cur = bytes;;)
+			{
+				size_type found = FindUTF8Bytes(cur, bytes_end, needle_bytes, needle_end);
+				if(found == (size_type)npos) return npos;
+
+				size_type byte_pos = (size_type)(cur - bytes) + found;
+				if((byte_pos % sizeof(unit_type)) == 0) return byte_pos / sizeof(unit_type);
+
+				cur = bytes + byte_pos + 1;
+			}
+		}
+
+		// finds the last match of needle that starts at or before last
+		template <typename unit_type>
+		static size_type rfindunits(const unit_type *begin, size_type len, const unit_type *needle, size_type needle_len, size_type last)
+		{
+			if(needle_len > len) return npos;
+			if(last > len - needle_len) last = len - needle_len;
+
+			if(needle_len == 0) return last;
+
+			for(size_type pos = last + 1; pos-- > 0;)
+			{
+				if((begin[pos] == needle[0]) && (memcmp(begin + pos, needle, needle_len * sizeof(unit_type)) == 0)) return pos;
+			}
+
+			return npos;
+		}
+
+		// searches with str narrowed or widened to the width of this string
+		template <typename unit_type>
+		size_type findin(const unit_type *haystack, const _flex_string &str, size_type pos, bool reverse) const
+		{
+			size_type len = size();
+			size_type needle_len = str.size();
+
+			// keep a copy in this string's width
+			std::vector<unit_type> converted;
+			const unit_type *needle;
+
+			if(str.flex_width == flex_width)
+			{
+				needle = (const unit_type *)str.units();
+			}
+			else
+			{
+				converted.assign(str.cbegin(), str.cend());
+				needle = converted.data();
+			}
+
+			if(reverse) return rfindunits(haystack, len, needle, needle_len, pos);
+
+			size_type found = findunits(haystack + pos, haystack + len, needle, needle_len);
+
+			return (found == (size_type)npos) ? npos : pos + found;
+		}
+
+		size_type findstr(const _flex_string &str, size_type pos, bool reverse) const
+		{
+			if(!reverse && (pos > size())) return npos;
+
+			// a character that needs more room than this string has can't be in it. str can be wider than its
+			// characters need so only its characters are looked at
+			if((str.flex_width > flex_width) && (str.neededwidth() > flex_width)) return npos;
+
+			switch(flex_width)
+			{
+				case 1: return findin(flex_latin1.data(), str, pos, reverse);
+				case 2: return findin(flex_ucs2.data(), str, pos, reverse);
+				default: return findin(flex_ucs4.data(), str, pos, reverse);
+			}
+		}
+
+	public:
+		// default constructor
+		_flex_string()
+			:flex_width(1)
+		{
+		}
+
+		// makes an empty string that gets its memory from alloc
+		explicit _flex_string(const Alloc &alloc)
+			:flex_latin1(alloc), flex_ucs2(ucs2_allocator(alloc)), flex_ucs4(ucs4_allocator(alloc)), flex_width(1)
+		{
+		}
+
+		// decodes UTF-8. A _utf8string, a c string or a view can be passed in
+		// broken sequences become U+FFFD
+		_flex_string(utf8string_view str, const Alloc &alloc = Alloc())
+			:flex_latin1(alloc), flex_ucs2(ucs2_allocator(alloc)), flex_ucs4(ucs4_allocator(alloc)), flex_width(1)
+		{
+			appendutf8(str.data(), str.data() + str.size_bytes());
+		}
+
+		// n copies of c
+		_flex_string(size_type n, value_type c, const Alloc &alloc = Alloc())
+			:flex_latin1(alloc), flex_ucs2(ucs2_allocator(alloc)), flex_ucs4(ucs4_allocator(alloc)), flex_width(1)
+		{
+			if(n == 0) return;
+
+			widen(widthfor(c, (c & 0xFFFFF800) == 0xD800), 0);
+
+			switch(flex_width)
+			{
+				case 1: flex_latin1.assign(n, (_uchar8bit)c); break;
+				case 2: flex_ucs2.assign(n, (ucs2_type)c); break;
+				default: flex_ucs4.assign(n, (ucs4_type)c); break;
+			}
+		}
+
+		// capacity ------------------------------------------------------------
+
+		// returns the number of characters
+		size_type size() const
+		{
+			switch(flex_width)
+			{
+				case 1: return flex_latin1.size();
+				case 2: return flex_ucs2.size();
+				default: return flex_ucs4.size();
+			}
+		}
+
+		// synonomous with size()
+		size_type length() const
+		{
+			return size();
+		}
+
+		bool empty() const
+		{
+			return size() == 0;
+		}
+
+		// returns the number of bytes each character takes. 1, 2 or 4
+		size_type width() const
+		{
+			return flex_width;
+		}
+
+		// returns the number of bytes used by the characters, not counting any spare capacity
+		size_type size_bytes() const
+		{
+			return size() * flex_width;
+		}
+
+		// makes room for n characters at the current width
+		void reserve(size_type n)
+		{
+			switch(flex_width)
+			{
+				case 1: flex_latin1.reserve(n); break;
+				case 2: flex_ucs2.reserve(n); break;
+				default: flex_ucs4.reserve(n); break;
+			}
+		}
+
+		// empties the string and makes it Latin-1 again
+		void clear()
+		{
+			flex_latin1.clear();
+			flex_ucs2.clear();
+			flex_ucs4.clear();
+			flex_width = 1;
+		}
+
+		Alloc get_allocator() const
+		{
+			return flex_latin1.get_allocator();
+		}
+
+		// iterators ----------------------------------------------------------------------
+
+		const_iterator cbegin() const
+		{
+			return const_iterator(units(), flex_width, 0);
+		}
+
+		const_iterator begin() const
+		{
+			return cbegin();
+		}
+
+		const_iterator cend() const
+		{
+			return const_iterator(units(), flex_width, size());
+		}
+
+		const_iterator end() const
+		{
+			return cend();
+		}
+
+		const_reverse_iterator crbegin() const
+		{
+			return const_reverse_iterator(cend());
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return crbegin();
+		}
+
+		const_reverse_iterator crend() const
+		{
+			return const_reverse_iterator(cbegin());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return crend();
+		}
+
+		// access -------------------------------------------------------------------------------------
+
+		// returns the character at pos
+		// doesn't throw exception. undefined if out of range
+		value_type operator[](size_type pos) const
+		{
+			return loadunit(units(), flex_width, pos);
+		}
+
+		// returns the character at pos
+		// will throw an exception if out of range
+		value_type at(size_type pos) const
+		{
+			if(pos >= size())
+			{
+				throw std::out_of_range("subscript out of range");
+			}
+
+			return (*this)[pos];
+		}
+
+		// the units. Only the one for width() holds the characters
+		const _uchar8bit *latin1_data() const
+		{
+			return flex_latin1.data();
+		}
+
+		const ucs2_type *ucs2_data() const
+		{
+			return flex_ucs2.data();
+		}
+
+		const ucs4_type *ucs4_data() const
+		{
+			return flex_ucs4.data();
+		}
+
+		// modifiers -------------------------------------------------------------------------------------
+
+		// changes the character at pos. The string is widened if c doesn't fit
+		// will throw an exception if out of range
+		void set(size_type pos, value_type c)
+		{
+			if(pos >= size())
+			{
+				throw std::out_of_range("subscript out of range");
+			}
+
+			widen(widthfor(c, (c & 0xFFFFF800) == 0xD800), 0);
+
+			switch(flex_width)
+			{
+				case 1: flex_latin1[pos] = (_uchar8bit)c; break;
+				case 2: flex_ucs2[pos] = (ucs2_type)c; break;
+				default: flex_ucs4[pos] = (ucs4_type)c; break;
+			}
+		}
+
+		void push_back(value_type c)
+		{
+			appendwidened(&c, &c + 1, widthfor(c, (c & 0xFFFFF800) == 0xD800));
+		}
+
+		// adds UTF-8 to the end. A _utf8string, a c string or a view can be passed in
+		_flex_string &append(utf8string_view str)
+		{
+			appendutf8(str.data(), str.data() + str.size_bytes());
+			return *this;
+		}
+
+		_flex_string &append(const _flex_string &str)
+		{
+			if(&str == this)
+			{
+				_flex_string copy(str);
+				return append(copy);
+			}
+
+			switch(str.flex_width)
+			{
+				case 1: appendwidened(str.flex_latin1.data(), str.flex_latin1.data() + str.size(), 1); break;
+				case 2: appendwidened(str.flex_ucs2.data(), str.flex_ucs2.data() + str.size(), 2); break;
+				default: appendwidened(str.flex_ucs4.data(), str.flex_ucs4.data() + str.size(), 4); break;
+			}
+
+			return *this;
+		}
+
+		_flex_string &operator+= (utf8string_view str)
+		{
+			return append(str);
+		}
+
+		_flex_string &operator+= (const _flex_string &str)
+		{
+			return append(str);
+		}
+
+		_flex_string &operator+= (value_type c)
+		{
+			push_back(c);
+			return *this;
+		}
+
+		// the strings must have equal allocators. The allocators aren't swapped
+		void swap(_flex_string &other)
+		{
+			flex_latin1.swap(other.flex_latin1);
+			flex_ucs2.swap(other.flex_ucs2);
+			flex_ucs4.swap(other.flex_ucs4);
+			std::swap(flex_width, other.flex_width);
+		}
+
+		// string operations -----------------------------------------------------------------------------
+
+		// copies len characters starting at pos. The copy is narrowed if its characters allow it
+		_flex_string substr(size_type pos = 0, size_type len = npos) const
+		{
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
+			}
+
+			if((len == npos) || (len > size() - pos)) len = size() - pos;
+
+			switch(flex_width)
+			{
+				case 1: return makesub(flex_latin1.data() + pos, flex_latin1.data() + pos + len, get_allocator());
+				case 2: return makesub(flex_ucs2.data() + pos, flex_ucs2.data() + pos + len, get_allocator());
+				default: return makesub(flex_ucs4.data() + pos, flex_ucs4.data() + pos + len, get_allocator());
+			}
+		}
+
+		// encodes the string as UTF-8
+		_utf8string<Alloc> str() const
+		{
+			_utf8string<Alloc> out(get_allocator());
+
+			switch(flex_width)
+			{
+				case 1:
+					out.reserve(size() * 2);
+					encodelatin1(flex_latin1.data(), flex_latin1.data() + size(), out);
+					break;
+				case 2:
+					out.reserve(size() * 3);
+					encodewide(flex_ucs2.data(), flex_ucs2.data() + size(), out);
+					break;
+				default:
+					out.reserve(size() * 4);
+					encodewide(flex_ucs4.data(), flex_ucs4.data() + size(), out);
+					break;
+			}
+
+			return out;
+		}
+
+		// returns the position of the first match at or after pos or npos if there isn't one
+		// the search runs on the units so there's no counting to get the position
+		size_type find (const _flex_string &str, size_type pos = 0) const
+		{
+			return findstr(str, pos, false);
+		}
+
+		size_type find (utf8string_view str, size_type pos = 0) const
+		{
+			return findstr(_flex_string(str, get_allocator()), pos, false);
+		}
+
+		size_type find (value_type c, size_type pos = 0) const
+		{
+			for(size_type i = pos; i < size(); ++i)
+			{
+				if((*this)[i] == c) return i;
+			}
+
+			return npos;
+		}
+
+		// returns the position of the last match that starts at or before pos or npos if there isn't one
+		size_type rfind (const _flex_string &str, size_type pos = npos) const
+		{
+			return findstr(str, pos, true);
+		}
+
+		size_type rfind (utf8string_view str, size_type pos = npos) const
+		{
+			return findstr(_flex_string(str, get_allocator()), pos, true);
+		}
+
+		// compares the strings character by character
+		// returns 0 if they're equal, < 0 if this string comes first and > 0 if str comes first
+		int compare (const _flex_string &str) const
+		{
+			size_type len = (size() < str.size()) ? size() : str.size();
+
+			if((flex_width == 1) && (str.flex_width == 1))
+			{
+				int result = (len == 0) ? 0 : memcmp(flex_latin1.data(), str.flex_latin1.data(), len);
+				if(result != 0) return result;
+			}
+			else
+			{
+				for(size_type i = 0; i < len; ++i)
+				{
+					value_type a = (*this)[i];
+					value_type b = str[i];
+
+					if(a != b) return (a < b) ? -1 : 1;
+				}
+			}
+
+			if(size() == str.size()) return 0;
+
+			return (size() < str.size()) ? -1 : 1;
+		}
+
+		// comparison operators ---------------------------------------------------------------------------
+
+		// strings with the same width are compared a block at a time. Strings with different widths can still be
+		// equal because a string isn't narrowed when its wide characters are replaced
+		bool operator == (const _flex_string &other) const
+		{
+			if(size() != other.size()) return false;
+			if(flex_width != other.flex_width) return compare(other) == 0;
+
+			return empty() || (memcmp(units(), other.units(), size_bytes()) == 0);
+		}
+
+		bool operator != (const _flex_string &other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator < (const _flex_string &other) const
+		{
+			return compare(other) < 0;
+		}
+
+		bool operator > (const _flex_string &other) const
+		{
+			return compare(other) > 0;
+		}
+
+		bool operator <= (const _flex_string &other) const
+		{
+			return compare(other) <= 0;
+		}
+
+		bool operator >= (const _flex_string &other) const
+		{
+			return compare(other) >= 0;
+		}
+
+		friend _flex_string operator + (const _flex_string &lhs, const _flex_string &rhs)
+		{
+			_flex_string out(lhs);
+			out += rhs;
+
+			return out;
+		}
+
+		// overload stream insertion so we can write to streams
+		friend std::ostream& operator<<(std::ostream& os, const _flex_string &string)
+		{
+			return os << string.str();
+		}
+
+		static const size_type npos = -1;
+};
+
+typedef _flex_string<> flex_string;
+
+#if defined(UTF8STRING_HAS_PMR)
+namespace pmr
+{
+
+// a flex_string that gets its memory from a std::pmr::memory_resource
+typedef _flex_string<std::pmr::polymorphic_allocator<_uchar8bit>> flex_string;
+
+}
+#endif
+
+}
+
+#endif
@@ -0,0 +1,388 @@
+// utf8intern.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8INTERNHEADER
+#define UTF8INTERNHEADER
+
+#include <mutex>
+#include <new>
+#include <functional>
+
+#include "utf8string.h"
+
+// number of independently locked parts of a utf8intern_pool
+// threads only wait on each other when their strings hash to the same shard
+#ifndef UTF8INTERN_SHARDS
+#define UTF8INTERN_SHARDS 64
+#endif
+
+// largest size of the blocks the pool copies the strings into
+// each shard starts with a 1KB block and doubles the size of every new block up to this
+// strings bigger than a quarter of the next block get a block of their own
+#ifndef UTF8INTERN_BLOCK_SIZE
+#define UTF8INTERN_BLOCK_SIZE 65536
+#endif
+
+namespace sd_utf8
+{
+
+class utf8intern_pool;
+
+// a string that was interned in a utf8intern_pool
+// it's only a pointer so it's cheap to copy and store. Two handles from the same pool are equal only if
+// they point to the same entry, so == is a pointer compare. The length, size in bytes and hash were worked
+// out when the string was interned. A handle is valid until its pool is destroyed
+class utf8interned
+{
+	private:
+		friend class utf8intern_pool;
+
+		// the bytes and a null terminator follow the entry in memory
+		struct entry
+		{
+			size_t hash;
+			size_t bytes;
+			size_t chars;
+
+			const _uchar8bit *data() const
+			{
+				return (const _uchar8bit *)(this + 1);
+			}
+		};
+
+		// NULL for the empty string
+		const entry *interned_entry;
+
+		explicit utf8interned(const entry *e)
+			:interned_entry(e)
+		{
+		}
+
+	public:
+		typedef size_t size_type;
+
+		// the empty string. Interning an empty string also gives this
+		utf8interned()
+			:interned_entry(NULL)
+		{
+		}
+
+		// returns the number of characters
+		size_type size() const
+		{
+			return (interned_entry == NULL) ? 0 : interned_entry->chars;
+		}
+
+		// returns the number of characters
+		// synonomous with size()
+		size_type length() const
+		{
+			return size();
+		}
+
+		// returns the number of bytes not counting the null terminator
+		size_type size_bytes() const
+		{
+			return (interned_entry == NULL) ? 0 : interned_entry->bytes;
+		}
+
+		bool empty() const
+		{
+			return interned_entry == NULL;
+		}
+
+		// the data is always null terminated
+		const _uchar8bit *data() const
+		{
+			return (interned_entry == NULL) ? (const _uchar8bit *)"" : interned_entry->data();
+		}
+
+		const _char8bit *c_str() const
+		{
+			return (const _char8bit *)data();
+		}
+
+		// the hash of the bytes. the same as utf8string_view::hash() for the same characters
+		size_t hash() const
+		{
+			return (interned_entry == NULL) ? GetUTF8Hash(data(), data()) : interned_entry->hash;
+		}
+
+		utf8string_view view() const
+		{
+			return utf8string_view(data(), size_bytes());
+		}
+
+		operator utf8string_view () const
+		{
+			return view();
+		}
+
+		// only compares handles from the same pool correctly
+		bool operator == (const utf8interned &other) const
+		{
+			return interned_entry == other.interned_entry;
+		}
+
+		bool operator != (const utf8interned &other) const
+		{
+			return interned_entry != other.interned_entry;
+		}
+
+		// orders by address, not alphabetically. Lets handles be used as keys in std::map and std::set
+		bool operator < (const utf8interned &other) const
+		{
+			return std::less<const entry *>()(interned_entry, other.interned_entry);
+		}
+};
+
+// write an interned string to a stream
+inline std::ostream& operator<<(std::ostream& os, const utf8interned &str)
+{
+	return os << str.view();
+}
+
+// keeps one copy of each distinct string and hands out utf8interned handles to it
+// safe to call from many threads at once. The strings are split between UTF8INTERN_SHARDS shards by hash and
+// each shard has its own lock, hash table and memory blocks, so threads interning different strings rarely wait
+// strings are never removed. Everything is freed when the pool is destroyed
+class utf8intern_pool
+{
+	private:
+		typedef utf8interned::entry entry;
+
+		// padded to a cache line so shards used by different threads don't share one
+		struct alignas(64) shard
+		{
+			std::mutex lock;
+
+			// open addressing with linear probing. the size is a power of two and it's never more than half full
+			std::vector<const entry *> table;
+			size_t count;
+
+			// the strings are copied into these
+			std::vector<_uchar8bit *> blocks;
+			_uchar8bit *block_cur;
+			_uchar8bit *block_end;
+			size_t next_block;
+			size_t bytes_used;
+
+			shard()
+				:count(0), block_cur(NULL), block_end(NULL), next_block(1024), bytes_used(0)
+			{
+			}
+		};
+
+		shard pool_shards[UTF8INTERN_SHARDS];
+
+		// the strings point into the blocks
+		utf8intern_pool(const utf8intern_pool &);
+		utf8intern_pool &operator=(const utf8intern_pool &);
+
+		// the low bits of the hash pick the slot in a shard's table so the shard is picked with the high bits
+		static shard &shardfor(utf8intern_pool *pool, size_t hash)
+		{
+			return pool->pool_shards[(hash >> (sizeof(size_t) * 8 - 16)) % UTF8INTERN_SHARDS];
+		}
+
+		// returns the slot that holds str or the empty slot where it would go
+		// the shard must be locked
+		static size_t findslot(const shard &s, size_t hash, const _uchar8bit *str, size_t n)
+		{
+			size_t mask = s.table.size() - 1;
+
+			for(size_t slot = hash & mask;; slot = (slot + 1) & mask)
+			{
+				const entry *e = s.table[slot];
+
+				if(e == NULL) return slot;
+				if((e->hash == hash) && (e->bytes == n) && (memcmp(e->data(), str, n) == 0)) return slot;
+			}
+		}
+
+		// makes the table big enough for one more string
+		// the shard must be locked
+		static void grow(shard &s)
+		{
+			if((s.count + 1) * 2 <= s.table.size()) return;
+
+			std::vector<const entry *> bigger(s.table.empty() ? 64 : s.table.size() * 2, NULL);
+			size_t mask = bigger.size() - 1;
+
+			for(const entry *e : s.table)
+			{
+				if(e == NULL) continue;
+
+				size_t slot = e->hash & mask;
+				while(bigger[slot] != NULL) slot = (slot + 1) & mask;
+
+				bigger[slot] = e;
+			}
+
+			s.table.swap(bigger);
+		}
+
+		// gets memory for an entry from the shard's blocks
+		// the shard must be locked
+		static _uchar8bit *allocate(shard &s, size_t n)
+		{
+			// keep every entry aligned
+			n = (n + alignof(entry) - 1) & ~(alignof(entry) - 1);
+
+			if(n > (size_t)(s.block_end - s.block_cur))
+			{
+				size_t block_size = (n > s.next_block / 4) ? n : s.next_block;
+
+				s.blocks.reserve(s.blocks.size() + 1);
+				_uchar8bit *block = (_uchar8bit *)::operator new(block_size);
+				s.blocks.push_back(block);
+				s.bytes_used += block_size;
+
+				// a big string's block is used up right away. keep filling the old block
+				if(block_size == n) return block;
+
+				if(s.next_block < UTF8INTERN_BLOCK_SIZE) s.next_block *= 2;
+				s.block_cur = block;
+				s.block_end = block + block_size;
+			}
+
+			_uchar8bit *out = s.block_cur;
+			s.block_cur += n;
+
+			return out;
+		}
+
+	public:
+		utf8intern_pool()
+		{
+		}
+
+		~utf8intern_pool()
+		{
+			for(shard &s : pool_shards)
+			{
+				for(_uchar8bit *block : s.blocks) ::operator delete(block);
+			}
+		}
+
+		// returns the handle for str, copying it into the pool the first time it's seen
+		// a _utf8string, a c string or a view can be passed in
+		utf8interned intern(utf8string_view str)
+		{
+			if(str.empty()) return utf8interned();
+
+			const _uchar8bit *bytes = str.data();
+			size_t n = str.size_bytes();
+			size_t hash = GetUTF8Hash(bytes, bytes + n);
+
+			shard &s = shardfor(this, hash);
+			std::lock_guard<std::mutex> guard(s.lock);
+
+			// make room first so an exception leaves the shard as it was
+			grow(s);
+
+			size_t slot = findslot(s, hash, bytes, n);
+			if(s.table[slot] != NULL) return utf8interned(s.table[slot]);
+
+			_uchar8bit *memory = allocate(s, sizeof(entry) + n + 1);
+
+			entry *e = new(memory) entry;
+			e->hash = hash;
+			e->bytes = n;
+			e->chars = CountUTF8Characters(bytes, bytes + n);
+
+			_uchar8bit *data = (_uchar8bit *)(e + 1);
+			memcpy(data, bytes, n);
+			data[n] = 0;
+
+			s.table[slot] = e;
+			++s.count;
+
+			return utf8interned(e);
+		}
+
+		// returns the handle for str if it's already in the pool or an empty handle if it isn't
+		// nothing is added
+		utf8interned find(utf8string_view str)
+		{
+			if(str.empty()) return utf8interned();
+
+			const _uchar8bit *bytes = str.data();
+			size_t n = str.size_bytes();
+			size_t hash = GetUTF8Hash(bytes, bytes + n);
+
+			shard &s = shardfor(this, hash);
+			std::lock_guard<std::mutex> guard(s.lock);
+
+			if(s.table.empty()) return utf8interned();
+
+			return utf8interned(s.table[findslot(s, hash, bytes, n)]);
+		}
+
+		// returns the number of distinct strings in the pool
+		size_t size()
+		{
+			size_t total = 0;
+
+			for(shard &s : pool_shards)
+			{
+				std::lock_guard<std::mutex> guard(s.lock);
+				total += s.count;
+			}
+
+			return total;
+		}
+
+		// returns the number of bytes the pool has allocated for strings and hash tables
+		size_t memory_used()
+		{
+			size_t total = sizeof(*this);
+
+			for(shard &s : pool_shards)
+			{
+				std::lock_guard<std::mutex> guard(s.lock);
+				total += s.bytes_used + s.table.capacity() * sizeof(const entry *) + s.blocks.capacity() * sizeof(_uchar8bit *);
+			}
+
+			return total;
+		}
+};
+
+}
+
+namespace std
+{
+
+// the hash was worked out when the string was interned
+template <>
+struct hash<sd_utf8::utf8interned>
+{
+	size_t operator()(const sd_utf8::utf8interned &str) const
+	{
+		return str.hash();
+	}
+};
+
+}
+
+#endif
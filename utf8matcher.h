@@ -0,0 +1,459 @@
+// utf8matcher.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8MATCHERHEADER
+#define UTF8MATCHERHEADER
+
+#include "utf8string.h"
+
+// the most bytes utf8matcher uses for full transition rows
+// the states closest to the root get a row each so following a byte there is one lookup. Deeper states search
+// their own edges and follow fail links
+#ifndef UTF8MATCHER_DENSE_SIZE
+#define UTF8MATCHER_DENSE_SIZE (4 * 1024 * 1024)
+#endif
+
+namespace sd_utf8
+{
+
+// one match found by utf8matcher
+// positions and lengths are given both in characters and in bytes
+struct utf8match
+{
+	size_t pattern;		// the number add() returned for the pattern
+
+	size_t pos;			// position of the first character of the match
+	size_t len;			// number of characters in the match
+
+	size_t byte_pos;	// position in the buffer of the first byte of the match
+	size_t byte_len;	// number of bytes in the match
+};
+
+// finds every occurrence of many patterns with one pass over the text (Aho-Corasick)
+// add the patterns, call compile() and then scan as many strings as needed. Scanning doesn't change the matcher
+// so one compiled matcher can be used from many threads
+// the automaton works on the UTF-8 bytes. Valid UTF-8 patterns can only match whole characters of valid UTF-8
+// text, so the character positions are counted during the same pass instead of being worked out for each match
+class utf8matcher
+{
+	private:
+		typedef std::uint32_t state_type;
+		// match_flag is set in the transitions that lead to a state where a pattern ends, so scanning only
+		// has to look up the outputs when something matched
+		enum : state_type { root = 0, no_state = 0xFFFFFFFF, match_flag = 0x80000000 };
+
+		struct pattern_info
+		{
+			size_t chars;
+			size_t bytes;
+
+			// next pattern with the same bytes
+			size_t same_next;
+		};
+
+		// the trie is built as child/sibling lists. compile() turns it into sorted edge arrays
+		struct trie_node
+		{
+			state_type first_child;
+			state_type next_sibling;
+			_uchar8bit byte;
+		};
+
+		bool matcher_ignore_case;
+		bool matcher_compiled;
+
+		std::vector<pattern_info> matcher_patterns;
+		std::vector<trie_node> matcher_trie;
+
+		// for each trie node, the first pattern that ends there or npos
+		std::vector<size_t> trie_output;
+
+		// the compiled automaton. the states are numbered breadth first so shallower states have smaller numbers
+		// and the root is 0. the same pattern numbers as trie_output but by compiled state
+		std::vector<size_t> state_output;
+
+		// where to go when there's no edge for the next byte: the longest proper suffix that is also in the trie
+		std::vector<state_type> state_fail;
+
+		// the next state along the fail links that has an output
+		std::vector<state_type> state_dict;
+
+		// the edges of state s are [edge_begin[s], edge_begin[s + 1]) sorted by byte
+		std::vector<state_type> edge_begin;
+		std::vector<_uchar8bit> edge_bytes;
+		std::vector<state_type> edge_targets;
+
+		// the first dense_count states have a full row of transitions with the fail links already followed
+		// bytes that lead to the same places share a class so a row only has class_count entries
+		// the rows are for the states near the root, which most of the text passes through
+		std::vector<state_type> dense_rows;
+		size_t dense_count;
+		size_t class_count;
+		std::uint16_t byte_class[256];
+
+		// the byte each byte is read as. A-Z become a-z when ignoring case
+		_uchar8bit fold_table[256];
+
+		_uchar8bit fold(_uchar8bit c) const
+		{
+			return fold_table[c];
+		}
+
+		// the child of a trie node while the patterns are being added
+		state_type trie_child(state_type s, _uchar8bit c) const
+		{
+			for(state_type child = matcher_trie[s].first_child; child != no_state; child = matcher_trie[child].next_sibling)
+			{
+				if(matcher_trie[child].byte == c) return child;
+			}
+
+			return no_state;
+		}
+
+		// the edge out of s for c in the compiled automaton or no_state
+		state_type edge(state_type s, _uchar8bit c) const
+		{
+			const _uchar8bit *first = edge_bytes.data() + edge_begin[s];
+			const _uchar8bit *last = edge_bytes.data() + edge_begin[s + 1];
+
+			if(last - first <= 8)
+			{
+				for(const _uchar8bit *cur = first; cur < last; ++cur)
+				{
+					if(*cur == c) return edge_targets[cur - edge_bytes.data()];
+				}
+
+				return no_state;
+			}
+
+			const _uchar8bit *found = std::lower_bound(first, last, c);
+			if((found == last) || (*found != c)) return no_state;
+
+			return edge_targets[found - edge_bytes.data()];
+		}
+
+		bool hasmatch(state_type s) const
+		{
+			return (state_output[s] != npos) || (state_dict[s] != no_state);
+		}
+
+		// the state after reading c in state s. c has already been folded
+		// after compile() the result has match_flag set if a pattern ends there
+		state_type next(state_type s, _uchar8bit c) const
+		{
+			while(s >= dense_count)
+			{
+				state_type t = edge(s, c);
+				if(t != no_state) return t;
+
+				s = state_fail[s];
+			}
+
+			return dense_rows[s * class_count + byte_class[c]];
+		}
+
+	public:
+		// make a matcher. With ignore_case, A-Z match a-z
+		// only ASCII letters are folded. Other characters have to match exactly
+		explicit utf8matcher(bool ignore_case = false)
+			:matcher_ignore_case(ignore_case), matcher_compiled(false)
+		{
+			for(size_t c = 0; c < 256; ++c)
+			{
+				fold_table[c] = (_uchar8bit)((matcher_ignore_case && (c >= 'A') && (c <= 'Z')) ? c + ('a' - 'A') : c);
+			}
+
+			clear();
+		}
+
+		// removes all of the patterns
+		void clear()
+		{
+			matcher_patterns.clear();
+			matcher_trie.assign(1, trie_node());
+			matcher_trie[root].first_child = no_state;
+			matcher_trie[root].next_sibling = no_state;
+			matcher_trie[root].byte = 0;
+
+			trie_output.assign(1, (size_t)npos);
+			matcher_compiled = false;
+		}
+
+		// adds a pattern and returns the number that identifies it in matches
+		// adding the same pattern twice gives two numbers and both are reported for each match
+		// compile() has to be called again before scanning. throws std::invalid_argument if the pattern is empty
+		size_t add(utf8string_view pattern)
+		{
+			if(pattern.empty()) throw std::invalid_argument("empty pattern");
+
+			const _uchar8bit *bytes = pattern.data();
+			size_t n = pattern.size_bytes();
+
+			// if an exception is thrown part way, the new trie nodes are left without an output and never match
+			state_type s = root;
+			for(size_t i = 0; i < n; ++i)
+			{
+				_uchar8bit c = fold(bytes[i]);
+				state_type child = trie_child(s, c);
+
+				if(child == no_state)
+				{
+					child = (state_type)matcher_trie.size();
+
+					trie_node node;
+					node.first_child = no_state;
+					node.next_sibling = matcher_trie[s].first_child;
+					node.byte = c;
+
+					matcher_trie.push_back(node);
+					trie_output.push_back((size_t)npos);
+					matcher_trie[s].first_child = child;
+				}
+
+				s = child;
+			}
+
+			pattern_info info;
+			info.chars = CountUTF8Characters(bytes, bytes + n);
+			info.bytes = n;
+			info.same_next = trie_output[s];
+
+			size_t id = matcher_patterns.size();
+			matcher_patterns.push_back(info);
+			trie_output[s] = id;
+
+			matcher_compiled = false;
+
+			return id;
+		}
+
+		// builds the automaton from the patterns that have been added
+		void compile()
+		{
+			matcher_compiled = false;
+
+			size_t count = matcher_trie.size();
+
+			// number the trie nodes breadth first
+			std::vector<state_type> order;
+			std::vector<state_type> number(count);
+			order.reserve(count);
+			order.push_back(root);
+
+			for(size_t i = 0; i < order.size(); ++i)
+			{
+				number[order[i]] = (state_type)i;
+
+				for(state_type child = matcher_trie[order[i]].first_child; child != no_state; child = matcher_trie[child].next_sibling)
+				{
+					order.push_back(child);
+				}
+			}
+
+			// sorted edge arrays in the new order
+			std::vector<state_type> begin(count + 1);
+			std::vector<_uchar8bit> bytes;
+			std::vector<state_type> targets;
+			std::vector<size_t> output(count);
+			bytes.reserve(count - 1);
+			targets.reserve(count - 1);
+
+			bool used[256] = {};
+
+			for(size_t s = 0; s < count; ++s)
+			{
+				size_t first = bytes.size();
+				begin[s] = (state_type)first;
+				output[s] = trie_output[order[s]];
+
+				for(state_type child = matcher_trie[order[s]].first_child; child != no_state; child = matcher_trie[child].next_sibling)
+				{
+					bytes.push_back(matcher_trie[child].byte);
+					targets.push_back(number[child]);
+					used[matcher_trie[child].byte] = true;
+
+					for(size_t k = bytes.size() - 1; (k > first) && (bytes[k - 1] > bytes[k]); --k)
+					{
+						std::swap(bytes[k - 1], bytes[k]);
+						std::swap(targets[k - 1], targets[k]);
+					}
+				}
+			}
+			begin[count] = (state_type)bytes.size();
+
+			// every byte that's in a pattern gets its own class. the rest share class 0 and always go back to the root
+			class_count = 1;
+			for(size_t c = 0; c < 256; ++c)
+			{
+				byte_class[c] = used[c] ? (std::uint16_t)class_count++ : 0;
+			}
+
+			dense_count = UTF8MATCHER_DENSE_SIZE / (class_count * sizeof(state_type));
+			if(dense_count < 1) dense_count = 1;
+			if(dense_count > count) dense_count = count;
+
+			edge_begin.swap(begin);
+			edge_bytes.swap(bytes);
+			edge_targets.swap(targets);
+			state_output.swap(output);
+			dense_rows.assign(dense_count * class_count, root);
+			state_fail.assign(count, root);
+			state_dict.assign(count, no_state);
+
+			// the fail links and rows of shallower states are finished before a state needs them
+			for(size_t s = 0; s < count; ++s)
+			{
+				if(s < dense_count)
+				{
+					state_type *row = dense_rows.data() + s * class_count;
+
+					// start with where the fail state goes and then put in this state's own edges
+					if(s != root)
+					{
+						const state_type *fail_row = dense_rows.data() + state_fail[s] * class_count;
+						std::copy(fail_row, fail_row + class_count, row);
+					}
+
+					for(size_t j = edge_begin[s]; j < edge_begin[s + 1]; ++j)
+					{
+						row[byte_class[edge_bytes[j]]] = edge_targets[j];
+					}
+				}
+
+				for(size_t j = edge_begin[s]; j < edge_begin[s + 1]; ++j)
+				{
+					state_type child = edge_targets[j];
+					if(s == root) continue;
+
+					state_type link = next(state_fail[s], edge_bytes[j]);
+					state_fail[child] = link;
+					state_dict[child] = (state_output[link] != npos) ? link : state_dict[link];
+				}
+			}
+
+			// the links are done. flag the transitions into states with matches
+			for(state_type &target : dense_rows)
+			{
+				if(hasmatch(target)) target |= match_flag;
+			}
+			for(state_type &target : edge_targets)
+			{
+				if(hasmatch(target)) target |= match_flag;
+			}
+
+			matcher_compiled = true;
+		}
+
+		bool ignore_case() const
+		{
+			return matcher_ignore_case;
+		}
+
+		// the number of patterns that have been added
+		size_t size() const
+		{
+			return matcher_patterns.size();
+		}
+
+		// the number of states in the automaton
+		size_t states() const
+		{
+			return matcher_trie.size();
+		}
+
+		// the number of bytes the compiled automaton uses
+		size_t memory_used() const
+		{
+			return dense_rows.size() * sizeof(state_type) + edge_begin.size() * sizeof(state_type) + edge_bytes.size() +
+				edge_targets.size() * sizeof(state_type) + state_output.size() * sizeof(size_t) +
+				(state_fail.size() + state_dict.size()) * sizeof(state_type);
+		}
+
+		// calls on_match(const utf8match &) for every match in text in the order the matches end
+		// overlapping matches are all reported. on_match returns false to stop the scan
+		// throws std::logic_error if compile() hasn't been called since the last add()
+		template <class Func>
+		void scan(utf8string_view text, Func on_match) const
+		{
+			if(!matcher_compiled) throw std::logic_error("utf8matcher wasn't compiled");
+
+			const _uchar8bit *data = text.data();
+			size_t n = text.size_bytes();
+
+			state_type s = root;
+			size_t chars = 0;
+
+			for(size_t i = 0; i < n; ++i)
+			{
+				_uchar8bit c = data[i];
+
+				// the bytes that start a character are counted so the position of each match is known
+				chars += ((c & 0xC0) != 0x80);
+
+				s = next(s, fold(c));
+				if(!(s & match_flag)) continue;
+
+				s &= ~match_flag;
+
+				state_type hit = (state_output[s] != npos) ? s : state_dict[s];
+				for(; hit != no_state; hit = state_dict[hit])
+				{
+					for(size_t p = state_output[hit]; p != npos; p = matcher_patterns[p].same_next)
+					{
+						utf8match match;
+						match.pattern = p;
+						match.len = matcher_patterns[p].chars;
+						match.pos = chars - match.len;
+						match.byte_len = matcher_patterns[p].bytes;
+						match.byte_pos = i + 1 - match.byte_len;
+
+						if(!on_match(match)) return;
+					}
+				}
+			}
+		}
+
+		// returns every match in text in the order the matches end
+		std::vector<utf8match> find_all(utf8string_view text) const
+		{
+			std::vector<utf8match> matches;
+			scan(text, [&matches](const utf8match &match) { matches.push_back(match); return true; });
+
+			return matches;
+		}
+
+		// checks to see if any pattern is in text. stops at the first match
+		bool contains_any(utf8string_view text) const
+		{
+			bool found = false;
+			scan(text, [&found](const utf8match &) { found = true; return false; });
+
+			return found;
+		}
+
+		static const size_t npos = -1;
+};
+
+}
+
+#endif
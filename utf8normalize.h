@@ -0,0 +1,611 @@
+// utf8normalize.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8NORMALIZEHEADER
+#define UTF8NORMALIZEHEADER
+
+#include "utf8string.h"
+#include "utf8normalizetables.h"
+
+// the most characters with a combining class other than 0 that the normalizer keeps in a row. A longer run gets
+// U+034F COMBINING GRAPHEME JOINER put in it the way UAX #15's Stream-Safe Text Format says, so the normalizer only
+// needs a small fixed buffer. Real text never has runs anywhere near this long
+#ifndef UTF8NORMALIZE_MAX_NONSTARTERS
+#define UTF8NORMALIZE_MAX_NONSTARTERS 30
+#endif
+
+namespace sd_utf8
+{
+
+// the Unicode normalization forms
+// NFD takes every character apart and NFC puts them back together where it can, so "é" as one character and as
+// "e" followed by a combining accent become the same. NFKD and NFKC also replace compatibility characters like
+// "ﬁ", "①" and full width letters with the plain ones
+enum utf8normalization_form
+{
+	utf8normalization_nfc,
+	utf8normalization_nfd,
+	utf8normalization_nfkc,
+	utf8normalization_nfkd
+};
+
+// Hangul syllables are taken apart and put together by arithmetic instead of with the tables
+namespace hangul
+{
+	const _char32bit s_base = 0xAC00;
+	const _char32bit l_base = 0x1100;
+	const _char32bit v_base = 0x1161;
+	const _char32bit t_base = 0x11A7;
+	const _char32bit l_count = 19;
+	const _char32bit v_count = 21;
+	const _char32bit t_count = 28;
+	const _char32bit n_count = v_count * t_count;
+	const _char32bit s_count = l_count * n_count;
+}
+
+// true for NFC and NFKC
+inline bool IsComposedNormalization(utf8normalization_form form)
+{
+	return (form == utf8normalization_nfc) || (form == utf8normalization_nfkc);
+}
+
+// returns the character a and b combine into, or 0 if they don't
+inline _char32bit ComposeUnicodeCharacters(_char32bit a, _char32bit b)
+{
+	if((a - hangul::l_base < hangul::l_count) && (b - hangul::v_base < hangul::v_count))
+	{
+		return hangul::s_base + ((a - hangul::l_base) * hangul::v_count + (b - hangul::v_base)) * hangul::t_count;
+	}
+
+	if((a - hangul::s_base < hangul::s_count) && ((a - hangul::s_base) % hangul::t_count == 0) && (b - hangul::t_base - 1 < hangul::t_count - 1))
+	{
+		return a + (b - hangul::t_base);
+	}
+
+	const utf8normalization_record &record = GetUTF8NormalizationRecord(a);
+	if(record.composition == 0) return 0;
+
+	const std::uint32_t *pairs = GetUTF8Compositions(record.composition);
+	for(std::uint32_t i = 0; i < pairs[0]; ++i)
+	{
+		if(pairs[1 + i * 2] == b) return pairs[2 + i * 2];
+	}
+
+	return 0;
+}
+
+// text that starts with a byte below this is never changed by normalizing to the form
+// everything before the first character with a decomposition or a combining class
+inline _uchar8bit GetUTF8NormalizationLead(utf8normalization_form form)
+{
+	// U+0300 for NFC, U+00C0 for NFD and U+00A0 for NFKC and NFKD
+	static const _uchar8bit leads[4] = { 0xCC, 0xC3, 0xC2, 0xC2 };
+
+	return leads[form];
+}
+
+// the quick check from UAX #15
+// scans [begin, end) and returns where the text stops being certainly normalized, which is end if all of it is.
+// boundary is set to the start of the last character before that which the text after it can't change, a starter
+// whose quick check is Yes, or to begin if there isn't one. Normalizing from boundary on gives the same result as
+// normalizing all of it
+inline const _uchar8bit *ScanNormalizedUTF8(const _uchar8bit *begin, const _uchar8bit *end, utf8normalization_form form, const _uchar8bit *&boundary)
+{
+	const _uchar8bit lead = GetUTF8NormalizationLead(form);
+	const _uchar8bit *cur = begin;
+
+	boundary = begin;
+	std::uint8_t last_ccc = 0;
+	size_t nonstarters = 0;
+
+	while(cur < end)
+	{
+		// bytes below the lead are ASCII, continuation bytes or the start of a character that's always left alone
+		if(*cur < lead)
+		{
+			const _uchar8bit *run = cur;
+
+#if defined(UTF8_USE_AVX2)
+			const __m256i limit256 = _mm256_set1_epi8((char)(lead - 1));
+			while(end - run >= 32)
+			{
+				__m256i bytes = _mm256_loadu_si256((const __m256i *)run);
+				if(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(bytes, limit256), limit256)) != -1) break;
+
+				run += 32;
+			}
+#endif
+
+#if defined(UTF8_USE_SSE2)
+			const __m128i limit = _mm_set1_epi8((char)(lead - 1));
+			while(end - run >= 16)
+			{
+				__m128i bytes = _mm_loadu_si128((const __m128i *)run);
+				if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(bytes, limit), limit)) != 0xFFFF) break;
+
+				run += 16;
+			}
+#endif
+
+			while((run < end) && (*run < lead)) ++run;
+
+			// the last character in the run is the new boundary. Continuation bytes at the start of the run
+			// belong to a character that was already checked
+			const _uchar8bit *last = run - 1;
+			while((last > cur) && ((*last & 0xC0) == 0x80)) --last;
+			if((*last & 0xC0) != 0x80) boundary = last;
+
+			last_ccc = 0;
+			nonstarters = 0;
+			cur = run;
+			continue;
+		}
+
+		const _uchar8bit *start = cur;
+		_char32bit c = DecodeUTF8Character(cur, end);
+
+		// broken and overlong sequences are changed by decoding so they have to go through the normalizer
+		if(GetUTF8CharacterSize(c) != (size_t)(cur - start)) return start;
+
+		const utf8normalization_record &record = GetUTF8NormalizationRecord(c);
+		if((record.quick_check >> form) & 1) return start;
+
+		if(record.ccc == 0)
+		{
+			boundary = start;
+			last_ccc = 0;
+			nonstarters = 0;
+		}
+		else
+		{
+			if((record.ccc < last_ccc) || (++nonstarters > UTF8NORMALIZE_MAX_NONSTARTERS)) return start;
+			last_ccc = record.ccc;
+		}
+	}
+
+	return end;
+}
+
+// finds the first part of [begin, end) that might not be normalized and returns where normalizing has to start
+// returns end if the range is already normalized. This is quick for text that is, most text is
+inline const _uchar8bit *FindUnnormalizedUTF8(const _uchar8bit *begin, const _uchar8bit *end, utf8normalization_form form)
+{
+	const _uchar8bit *boundary;
+	if(ScanNormalizedUTF8(begin, end, form, boundary) == end) return end;
+
+	return boundary;
+}
+
+// normalizes UTF-8 that comes in chunks that can be split anywhere, even in the middle of a character
+// text that passes the quick check is copied straight through. The rest is taken apart, put in order and put back
+// together a segment at a time in a buffer that never holds more than UTF8NORMALIZE_MAX_NONSTARTERS + 1 characters.
+// The characters at the end of a chunk that the next one could change are held until it comes.
+// The text should be valid UTF-8. Broken sequences in the parts that get normalized become U+FFFD and the ones in
+// parts that are copied are left as they are
+class utf8normalizer
+{
+	private:
+		enum
+		{
+			buffer_capacity = UTF8NORMALIZE_MAX_NONSTARTERS + 1
+		};
+
+		utf8normalization_form normalizer_form;
+
+		// the segment that's being worked on. buffer_starter is the index of the starter it begins with, or
+		// buffer_capacity if it began with characters that aren't starters
+		_char32bit buffer_chars[buffer_capacity];
+		std::uint8_t buffer_ccc[buffer_capacity];
+		size_t buffer_size;
+		size_t buffer_starter;
+
+		// the start of a character that was cut off by the end of the last chunk
+		_uchar8bit pending_bytes[4];
+		size_t pending_size;
+
+		static size_t sequencelength(_uchar8bit lead)
+		{
+			return (lead < 0xE0) ? 2 : ((lead < 0xF0) ? 3 : 4);
+		}
+
+		// true if the character doesn't change and nothing after it changes anything before it
+		bool isboundary(const utf8normalization_record &record) const
+		{
+			return (record.ccc == 0) && (((record.quick_check >> normalizer_form) & 1) == 0);
+		}
+
+		// combines the characters after the starter with it where the rules allow
+		// a character is blocked from the starter by a character between them with the same or a higher combining
+		// class. The segment is in order so that's only ever the last one kept
+		void composesegment()
+		{
+			if(buffer_starter == buffer_capacity) return;
+
+			size_t kept = buffer_starter + 1;
+			for(size_t i = buffer_starter + 1; i < buffer_size; ++i)
+			{
+				bool blocked = (kept > buffer_starter + 1) && (buffer_ccc[kept - 1] >= buffer_ccc[i]);
+
+				_char32bit composite = blocked ? 0 : ComposeUnicodeCharacters(buffer_chars[buffer_starter], buffer_chars[i]);
+				if(composite != 0)
+				{
+					buffer_chars[buffer_starter] = composite;
+					continue;
+				}
+
+				buffer_chars[kept] = buffer_chars[i];
+				buffer_ccc[kept] = buffer_ccc[i];
+				++kept;
+			}
+
+			buffer_size = kept;
+		}
+
+		// writes out the segment and empties the buffer
+		void flush(_uchar8bit *&out)
+		{
+			if(IsComposedNormalization(normalizer_form)) composesegment();
+
+			for(size_t i = 0; i < buffer_size; ++i) out += WriteUTF8Character(buffer_chars[i], out);
+
+			buffer_size = 0;
+			buffer_starter = buffer_capacity;
+		}
+
+		void addstarter(_char32bit c, _uchar8bit *&out)
+		{
+			// when nothing gets put back together, nothing after a starter can change it or move in front of it
+			if(!IsComposedNormalization(normalizer_form))
+			{
+				flush(out);
+				out += WriteUTF8Character(c, out);
+
+				return;
+			}
+
+			if(buffer_starter != buffer_capacity)
+			{
+				// a starter can only combine with the one before it if nothing is left between them
+				composesegment();
+
+				if(buffer_size == buffer_starter + 1)
+				{
+					_char32bit composite = ComposeUnicodeCharacters(buffer_chars[buffer_starter], c);
+					if(composite != 0)
+					{
+						buffer_chars[buffer_starter] = composite;
+						return;
+					}
+				}
+			}
+
+			flush(out);
+
+			buffer_chars[0] = c;
+			buffer_ccc[0] = 0;
+			buffer_size = 1;
+			buffer_starter = 0;
+		}
+
+		// puts c in the segment after the characters with the same or a lower combining class
+		void addnonstarter(_char32bit c, std::uint8_t ccc, _uchar8bit *&out)
+		{
+			size_t first = (buffer_starter == buffer_capacity) ? 0 : buffer_starter + 1;
+
+			if(buffer_size - first >= UTF8NORMALIZE_MAX_NONSTARTERS)
+			{
+				addstarter(0x034F, out);
+				first = 1;
+			}
+
+			size_t pos = buffer_size;
+			for(; (pos > first) && (buffer_ccc[pos - 1] > ccc); --pos)
+			{
+				buffer_chars[pos] = buffer_chars[pos - 1];
+				buffer_ccc[pos] = buffer_ccc[pos - 1];
+			}
+
+			buffer_chars[pos] = c;
+			buffer_ccc[pos] = ccc;
+			++buffer_size;
+		}
+
+		void add(_char32bit c, std::uint8_t ccc, _uchar8bit *&out)
+		{
+			if(ccc == 0) addstarter(c, out);
+			else addnonstarter(c, ccc, out);
+		}
+
+		// takes the character apart and adds the pieces to the segment
+		void addcharacter(_char32bit c, const utf8normalization_record &record, _uchar8bit *&out)
+		{
+			if(c - hangul::s_base < hangul::s_count)
+			{
+				// taking a syllable apart and putting it back together gives the same syllable
+				if(IsComposedNormalization(normalizer_form))
+				{
+					addstarter(c, out);
+					return;
+				}
+
+				// the pieces are all starters so they go straight out
+				_char32bit index = c - hangul::s_base;
+				flush(out);
+
+				out += WriteUTF8Character(hangul::l_base + index / hangul::n_count, out);
+				out += WriteUTF8Character(hangul::v_base + (index % hangul::n_count) / hangul::t_count, out);
+				if(index % hangul::t_count != 0) out += WriteUTF8Character(hangul::t_base + index % hangul::t_count, out);
+
+				return;
+			}
+
+			bool compatibility = (normalizer_form == utf8normalization_nfkc) || (normalizer_form == utf8normalization_nfkd);
+			std::uint16_t offset = compatibility ? record.compatibility : record.canonical;
+
+			if(offset == 0)
+			{
+				add(c, record.ccc, out);
+				return;
+			}
+
+			const std::uint32_t *pieces = GetUTF8Decomposition(offset);
+			for(std::uint32_t i = 1; i <= pieces[0]; ++i) add(pieces[i] & 0xFFFFFF, (std::uint8_t)(pieces[i] >> 24), out);
+		}
+
+		void addcharacter(_char32bit c, _uchar8bit *&out)
+		{
+			addcharacter(c, GetUTF8NormalizationRecord(c), out);
+		}
+
+		// normalizes [cur, end), which has to end with a whole character
+		// switches between copying what passes the quick check and going through the characters one at a time.
+		// It goes back to copying at the next character that nothing before or after it can change
+		void normalizerange(const _uchar8bit *cur, const _uchar8bit *end, _uchar8bit *&out)
+		{
+			bool copying = (buffer_size == 0);
+
+			while(cur < end)
+			{
+				if(copying)
+				{
+					// the last starter could still combine with what comes after so it's left for below
+					const _uchar8bit *boundary;
+					ScanNormalizedUTF8(cur, end, normalizer_form, boundary);
+
+					memcpy(out, cur, (size_t)(boundary - cur));
+					out += boundary - cur;
+					cur = boundary;
+
+					addcharacter(DecodeUTF8Character(cur, end), out);
+				}
+
+				while(cur < end)
+				{
+					const _uchar8bit *next = cur;
+					_char32bit c = DecodeUTF8Character(next, end);
+					const utf8normalization_record &record = GetUTF8NormalizationRecord(c);
+
+					if(isboundary(record) && (GetUTF8CharacterSize(c) == (size_t)(next - cur)))
+					{
+						flush(out);
+						break;
+					}
+
+					addcharacter(c, record, out);
+					cur = next;
+				}
+
+				copying = true;
+			}
+		}
+
+	public:
+		explicit utf8normalizer(utf8normalization_form form = utf8normalization_nfc)
+			:normalizer_form(form), buffer_size(0), buffer_starter(buffer_capacity), pending_size(0)
+		{
+		}
+
+		utf8normalization_form form() const
+		{
+			return normalizer_form;
+		}
+
+		// the most bytes normalize() can write for a chunk of n bytes
+		// NFC and NFD make text at most 3 times longer and NFKC and NFKD 11 times. The characters held from the
+		// last chunk are added to that
+		size_t max_normalized_size(size_t n) const
+		{
+			size_t ratio = ((normalizer_form == utf8normalization_nfkc) || (normalizer_form == utf8normalization_nfkd)) ? 11 : 3;
+
+			return (n + 4) * ratio + (buffer_capacity + 1) * 8;
+		}
+
+		/// \brief Normalizes a chunk of UTF-8
+		/// out must have room for max_normalized_size(end - begin) bytes. Returns the number of bytes written.
+		size_t normalize(const _uchar8bit *begin, const _uchar8bit *end, _uchar8bit *out)
+		{
+			_uchar8bit *out_start = out;
+			const _uchar8bit *cur = begin;
+
+			// finish the character the last chunk ended in
+			while((pending_size > 0) && (cur < end))
+			{
+				if((*cur & 0xC0) != 0x80)
+				{
+					// cut short. The byte that cut it off is normalized with the rest of the chunk
+					addcharacter(0xFFFD, out);
+					pending_size = 0;
+					break;
+				}
+
+				pending_bytes[pending_size++] = *cur++;
+
+				if(pending_size == sequencelength(pending_bytes[0]))
+				{
+					const _uchar8bit *pending = pending_bytes;
+					addcharacter(DecodeUTF8Character(pending, pending_bytes + pending_size), out);
+					pending_size = 0;
+				}
+			}
+
+			if(cur == end) return (size_t)(out - out_start);
+
+			// keep a character that runs past the end for the next chunk
+			const _uchar8bit *tail = FindIncompleteUTF8Tail(cur, end);
+			normalizerange(cur, tail, out);
+
+			pending_size = (size_t)(end - tail);
+			if(pending_size > 0) memcpy(pending_bytes, tail, pending_size);
+
+			return (size_t)(out - out_start);
+		}
+
+		/// \brief Ends the text
+		/// Writes the characters that were held and U+FFFD for a character that was cut off. out must have room for
+		/// max_normalized_size(0) bytes. Returns the number of bytes written. The normalizer can be used for new
+		/// text afterwards.
+		size_t finish(_uchar8bit *out)
+		{
+			_uchar8bit *out_start = out;
+
+			if(pending_size > 0)
+			{
+				addcharacter(0xFFFD, out);
+				pending_size = 0;
+			}
+
+			flush(out);
+
+			return (size_t)(out - out_start);
+		}
+
+		void reset()
+		{
+			buffer_size = 0;
+			buffer_starter = buffer_capacity;
+			pending_size = 0;
+		}
+};
+
+// normalizes [begin, end) and passes the result to f(const _uchar8bit *bytes, size_t size) a piece at a time
+// the part at the start that passes the quick check is passed straight from the input. Only the rest is normalized
+template <class Function>
+inline void NormalizeUTF8(const _uchar8bit *begin, const _uchar8bit *end, utf8normalization_form form, Function f)
+{
+	const _uchar8bit *start = FindUnnormalizedUTF8(begin, end, form);
+	if(start > begin) f(begin, (size_t)(start - begin));
+	if(start == end) return;
+
+	utf8normalizer normalizer(form);
+	_uchar8bit out[4096];
+	const size_t piece_size = (sizeof(out) - normalizer.max_normalized_size(0)) / 11;
+
+	while(start < end)
+	{
+		const _uchar8bit *piece_end = ((size_t)(end - start) > piece_size) ? start + piece_size : end;
+
+		size_t size = normalizer.normalize(start, piece_end, out);
+		if(size > 0) f(out, size);
+
+		start = piece_end;
+	}
+
+	size_t size = normalizer.finish(out);
+	if(size > 0) f(out, size);
+}
+
+// returns a normalized copy of str
+// when str is already normalized, which is quick to find out, it's just copied
+template <class Alloc>
+inline _utf8string<Alloc> NormalizeUTF8(const _utf8string<Alloc> &str, utf8normalization_form form = utf8normalization_nfc)
+{
+	utf8string_view view(str);
+	const _uchar8bit *begin = view.data();
+	const _uchar8bit *end = begin + view.size_bytes();
+
+	if(FindUnnormalizedUTF8(begin, end, form) == end) return _utf8string<Alloc>(str, str.get_allocator());
+
+	_utf8string<Alloc> out(str.get_allocator());
+	out.reserve(view.size_bytes() + view.size_bytes() / 8);
+
+	NormalizeUTF8(begin, end, form, [&out](const _uchar8bit *bytes, size_t size) { out += utf8string_view(bytes, size); });
+
+	return out;
+}
+
+// normalizes str in place and returns true if it had to be changed
+template <class Alloc>
+inline bool MakeNormalizedUTF8(_utf8string<Alloc> &str, utf8normalization_form form = utf8normalization_nfc)
+{
+	utf8string_view view(str);
+	if(FindUnnormalizedUTF8(view.data(), view.data() + view.size_bytes(), form) == view.data() + view.size_bytes()) return false;
+
+	_utf8string<Alloc> out = NormalizeUTF8(str, form);
+	if(out == str) return false;
+
+	str.swap(out);
+
+	return true;
+}
+
+// returns true if str is normalized
+// the quick check answers for most text. Where it can't, the rest is normalized and compared as it goes
+inline bool IsNormalizedUTF8(utf8string_view str, utf8normalization_form form = utf8normalization_nfc)
+{
+	const _uchar8bit *begin = str.data();
+	const _uchar8bit *end = begin + str.size_bytes();
+	const _uchar8bit *compare = begin;
+	bool same = true;
+
+	NormalizeUTF8(begin, end, form, [&](const _uchar8bit *bytes, size_t size)
+	{
+		if(same && (bytes != compare)) same = ((size_t)(end - compare) >= size) && (memcmp(bytes, compare, size) == 0);
+		compare += size;
+	});
+
+	return same && (compare == end);
+}
+
+// returns true if a and b are the same text once they're normalized
+// the default, NFC, makes precomposed and decomposed letters equal. NFKC also makes compatibility characters equal
+// to the characters they stand for
+inline bool EqualNormalizedUTF8(utf8string_view a, utf8string_view b, utf8normalization_form form = utf8normalization_nfc)
+{
+	if(a == b) return true;
+
+	const _uchar8bit *a_end = a.data() + a.size_bytes();
+	const _uchar8bit *b_end = b.data() + b.size_bytes();
+
+	// two different strings that are both normalized can't be equal
+	if((FindUnnormalizedUTF8(a.data(), a_end, form) == a_end) && (FindUnnormalizedUTF8(b.data(), b_end, form) == b_end)) return false;
+
+	std::basic_string<_uchar8bit> normalized_a, normalized_b;
+	NormalizeUTF8(a.data(), a_end, form, [&normalized_a](const _uchar8bit *bytes, size_t size) { normalized_a.append(bytes, size); });
+	NormalizeUTF8(b.data(), b_end, form, [&normalized_b](const _uchar8bit *bytes, size_t size) { normalized_b.append(bytes, size); });
+
+	return normalized_a == normalized_b;
+}
+
+}
+
+#endif
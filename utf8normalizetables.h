@@ -0,0 +1,2168 @@
+// utf8normalizetables.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+// the Unicode 16.0.0 data used by utf8normalize.h
+// generated from UnicodeData.txt (combining classes and decompositions), CompositionExclusions.txt and
+// DerivedNormalizationProps.txt (the quick check properties). Don't edit the tables by hand
+//
+#pragma once
+
+#ifndef UTF8NORMALIZETABLESHEADER
+#define UTF8NORMALIZETABLESHEADER
+
+#include <cstdint>
+#include <cstddef>
+
+namespace sd_utf8
+{
+
+// the normalization properties of a group of characters
+// bit n of quick_check is set if the quick check property isn't Yes for the form with the value n in
+// utf8normalization_form. The decompositions are offsets into the table GetUTF8Decomposition() returns and are 0
+// if the character doesn't decompose. compatibility is the same as canonical for characters that only have a
+// canonical decomposition. composition is the offset of the list of characters this one combines with in the table
+// GetUTF8Compositions() returns, or 0. Hangul syllables aren't in the tables because they're worked out
+struct utf8normalization_record
+{
+	std::uint8_t ccc;
+	std::uint8_t quick_check;
+	std::uint16_t canonical;
+	std::uint16_t compatibility;
+	std::uint16_t composition;
+};
+
+// returns the normalization properties of c
+// the top bits of c pick one of 175 blocks of 128 code points and the block gives the record
+// nothing at or above U+2FA1E has any
+inline const utf8normalization_record &GetUTF8NormalizationRecord(std::uint32_t c)
+{
+	static const std::uint8_t blocks[1525] =
+	{
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+		32, 33, 34, 35, 10, 10, 36, 10, 10, 10, 10, 10, 10, 10, 37, 38, 10, 39, 40, 10, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+		53, 54, 55, 56, 57, 58, 59, 10, 60, 61, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 62, 63, 10, 10, 64, 65, 66, 67, 10, 68, 69, 70,
+		71, 72, 73, 74, 75, 76, 77, 78, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 79, 80, 81, 82, 83, 84, 85, 86, 10, 87, 88, 89, 90, 90, 90, 90, 90, 90, 90, 90,
+		90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+		90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+		90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 91, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+		10, 10, 10, 106, 10, 107, 108, 10, 10, 10, 10, 109, 10, 10, 10, 110, 10, 10, 10, 10, 111, 112, 10, 10, 10, 10, 113, 10, 10, 114, 115, 116,
+		117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 10, 127, 128, 129, 130, 10, 131, 10, 132, 133, 134, 135, 10, 10, 128, 10, 136, 137, 10, 10, 138, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 139, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 140, 141, 10, 10, 10, 142, 10, 10, 10, 10, 143,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 144, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 145, 10, 10, 10, 10, 10, 10,
+		10, 10, 146, 147, 148, 10, 10, 10, 149, 150, 151, 152, 153, 154, 155, 156, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		157, 158, 141, 10, 10, 159, 10, 10, 10, 160, 10, 161, 10, 10, 10, 10, 10, 162, 163, 10, 10, 10, 10, 10, 10, 10, 10, 10, 164, 165, 10, 10,
+		10, 10, 166, 167, 168, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 169, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 170, 171, 172, 173, 174
+	};
+
+	static const std::uint16_t records[22400] =
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 0,
+		0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0, 0, 0, 0, 0,
+		0, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 0, 45, 46, 47, 48, 49, 50, 51, 52, 53, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		54, 0, 0, 0, 0, 0, 0, 0, 55, 0, 56, 0, 0, 0, 0, 57, 0, 0, 58, 59, 60, 61, 0, 0, 62, 63, 64, 0, 65, 66, 67, 0,
+		68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 0, 84, 85, 86, 87, 88, 89, 0, 90, 91, 92, 93, 94, 95, 0, 0,
+		96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 0, 112, 113, 114, 115, 116, 117, 0, 118, 119, 120, 121, 122, 123, 0, 124,
+		125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 0, 0, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154,
+		155, 156, 157, 158, 159, 160, 0, 0, 161, 162, 163, 164, 165, 166, 167, 168, 169, 0, 170, 171, 172, 173, 174, 175, 0, 176, 177, 178, 179, 180, 181, 182,
+		183, 0, 0, 184, 185, 186, 187, 188, 189, 190, 0, 0, 191, 192, 193, 194, 195, 196, 0, 0, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+		209, 210, 211, 212, 213, 214, 0, 0, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		239, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 241, 242, 0, 0, 0, 0, 0, 0, 243, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 269, 270,
+		271, 272, 273, 274, 0, 0, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 0, 0, 291, 292, 293, 294, 295, 296, 297, 298,
+		299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 0, 0, 327, 328,
+		0, 0, 0, 0, 0, 0, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 344, 345, 346, 347, 348, 349, 350, 351, 352, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 354, 355, 356, 357, 358, 0, 0,
+		359, 360, 361, 362, 363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		364, 364, 364, 364, 364, 365, 364, 364, 364, 364, 364, 364, 364, 365, 365, 364, 365, 364, 365, 364, 364, 366, 367, 367, 367, 367, 366, 368, 367, 367, 367, 367,
+		367, 369, 369, 370, 370, 370, 370, 371, 371, 367, 367, 367, 367, 370, 370, 367, 370, 370, 367, 367, 372, 372, 372, 372, 373, 367, 367, 367, 367, 365, 365, 365,
+		374, 375, 364, 376, 377, 378, 365, 367, 367, 367, 365, 365, 365, 367, 367, 0, 365, 365, 365, 367, 367, 367, 367, 365, 366, 367, 367, 365, 379, 380, 380, 379,
+		380, 380, 379, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 0, 0, 0, 0, 381, 0, 0, 0, 0, 0, 382, 0, 0, 0, 383, 0,
+		0, 0, 0, 0, 60, 384, 385, 386, 387, 388, 389, 0, 390, 0, 391, 392, 393, 394, 0, 0, 0, 395, 0, 396, 0, 397, 0, 0, 0, 0, 0, 398,
+		0, 399, 0, 0, 0, 400, 0, 0, 0, 401, 402, 403, 404, 405, 406, 407, 408, 409, 0, 0, 0, 410, 0, 411, 0, 412, 0, 0, 0, 0, 0, 413,
+		0, 414, 0, 0, 0, 415, 0, 0, 0, 416, 417, 418, 419, 420, 421, 0, 422, 423, 424, 425, 426, 427, 428, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 429, 430, 431, 0, 432, 433, 0, 0, 0, 434, 0, 0, 0, 0, 0, 0,
+		435, 436, 0, 437, 0, 0, 438, 439, 0, 0, 0, 0, 440, 441, 442, 0, 443, 0, 0, 444, 0, 445, 446, 447, 448, 449, 450, 0, 0, 0, 451, 0,
+		0, 0, 0, 452, 0, 0, 0, 453, 0, 0, 0, 454, 0, 455, 0, 0, 456, 0, 0, 457, 0, 458, 459, 460, 461, 462, 463, 0, 0, 0, 464, 0,
+		0, 0, 0, 465, 0, 0, 0, 466, 0, 0, 0, 467, 0, 468, 0, 0, 469, 470, 0, 471, 0, 0, 472, 473, 0, 0, 0, 0, 474, 475, 476, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 477, 478, 479, 480, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 483, 484, 485, 486, 0, 0, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+		0, 0, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 0, 0, 517, 518, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 365, 365, 365, 365, 367, 365, 365, 365, 520, 367, 365, 365, 365, 365,
+		365, 365, 367, 367, 367, 367, 367, 367, 365, 365, 367, 365, 365, 520, 521, 365, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 531, 532, 533, 534, 0, 535,
+		0, 536, 537, 0, 365, 367, 0, 530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 365, 365, 538, 539, 540, 0, 0, 0, 0, 0,
+		0, 0, 541, 542, 543, 544, 545, 546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 547, 0, 548, 549, 550, 551, 538, 539, 540, 552, 553, 364, 364, 370, 367, 365, 365, 365, 365, 365, 367, 365, 365, 367,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 554, 0, 0, 0, 0, 555, 556, 557, 558, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		559, 560, 561, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 562, 563, 0, 564, 365, 365, 365, 365, 365, 365, 365, 0, 0, 365,
+		365, 365, 365, 367, 365, 0, 0, 365, 365, 0, 367, 365, 365, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 565, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 367, 365, 365, 367, 365, 365, 367, 367, 367, 365, 367, 367, 365, 367, 365,
+		365, 365, 367, 365, 367, 365, 367, 365, 367, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 365, 367, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 0, 365, 365, 365, 365, 365,
+		365, 365, 365, 365, 0, 365, 365, 365, 0, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 367, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 367, 367, 367, 365, 365, 365, 365,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 367, 367, 367, 367, 367, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+		365, 365, 0, 367, 365, 365, 367, 365, 365, 367, 365, 365, 365, 367, 367, 367, 549, 550, 551, 365, 365, 365, 367, 365, 365, 367, 367, 365, 365, 365, 365, 365,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 566, 567, 0, 0, 0, 0, 0, 0, 568, 569, 0, 570, 571, 0, 0, 0, 0, 0, 0, 0, 572, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 365, 367, 365, 365, 0, 0, 0, 574, 575, 576, 577, 578, 579, 580, 581,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 583, 0,
+		0, 0, 0, 0, 0, 0, 0, 584, 0, 0, 0, 585, 586, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 587, 588, 0, 589,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 590, 0, 0, 591, 0, 0, 0, 0, 0, 582, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 592, 593, 594, 0, 0, 595, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 583, 0,
+		0, 0, 0, 0, 0, 0, 0, 596, 597, 0, 0, 598, 599, 573, 0, 0, 0, 0, 0, 0, 0, 0, 583, 583, 0, 0, 0, 0, 600, 601, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 602, 0, 603, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0,
+		0, 0, 0, 0, 0, 0, 604, 605, 0, 0, 606, 607, 608, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 609, 0, 610, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 611, 612, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 613,
+		614, 0, 583, 0, 0, 0, 615, 616, 617, 0, 618, 619, 0, 573, 0, 0, 0, 0, 0, 0, 0, 583, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 573, 0, 583, 0,
+		0, 0, 0, 0, 0, 0, 620, 621, 0, 0, 622, 623, 624, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 625, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 626, 627, 0, 628, 629, 630, 583,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 631, 0, 0, 0, 0, 632, 632, 573, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 633, 633, 633, 633, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 634, 0, 0, 0, 0, 635, 635, 573, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 636, 636, 636, 636, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 637, 638, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 367, 0, 640, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 0, 0, 0, 0, 643, 0, 0, 0, 0, 644, 0, 0, 0, 0, 645, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 646, 0, 0, 0, 0, 0, 0, 0, 647, 648, 649, 650, 651, 652, 653, 654, 655, 648, 648, 648, 648, 0, 0,
+		648, 656, 365, 365, 573, 0, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 658, 0, 0,
+		0, 0, 659, 0, 0, 0, 0, 660, 0, 0, 0, 0, 661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 662, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 663, 664, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 573, 573, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 665, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		583, 583, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 520, 365, 367, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 367, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 365, 365, 0, 0, 367,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 367, 367, 367, 367, 367, 367, 365, 365, 367, 0, 367,
+		367, 365, 365, 367, 367, 365, 365, 365, 365, 365, 367, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 0, 0, 676, 677, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 583, 0, 0, 0, 0, 678, 679, 680, 681, 682, 683,
+		684, 685, 686, 687, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 367, 365, 365, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 0, 372, 367, 367, 367, 367, 367, 365, 365, 367, 367, 367, 367,
+		365, 0, 372, 372, 372, 372, 372, 372, 372, 0, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 365, 0, 0, 0, 365, 365, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 688, 689, 690, 0, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 0, 702, 703, 704, 705,
+		706, 707, 708, 56, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 0, 719, 720, 721, 64, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 422, 732, 733,
+		427, 734, 735, 347, 727, 730, 422, 732, 430, 427, 734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 736, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 737, 738, 739, 740, 717,
+		741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 423,
+		365, 365, 367, 365, 365, 365, 365, 365, 365, 365, 367, 365, 365, 380, 772, 367, 369, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+		365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 366, 521, 521, 367, 773, 365, 379, 367, 365, 367,
+		774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805,
+		806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837,
+		838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869,
+		870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901,
+		902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 0, 0, 0, 0,
+		930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961,
+		962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993,
+		994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 0, 0, 0, 0, 0, 0,
+		1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 0, 0, 1042, 1043, 1044, 1045, 1046, 1047, 0, 0,
+		1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
+		1080, 1081, 1082, 1083, 1084, 1085, 0, 0, 1086, 1087, 1088, 1089, 1090, 1091, 0, 0, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 0, 1100, 0, 1101, 0, 1102, 0, 1103,
+		1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 0, 0,
+		1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
+		1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 0, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196,
+		1197, 1198, 1199, 1200, 1201, 0, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 0, 0, 1216, 1217, 1218, 1219, 1220, 1221, 0, 1222, 1223, 1224,
+		1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 0, 0, 1241, 1242, 1243, 0, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 0,
+		1253, 1254, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0, 0, 1255, 0, 0, 0, 0, 0, 1256, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1257, 1258, 1259, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 1260, 1261, 0, 1262, 1263, 0, 0, 0, 0, 1264, 0, 1265, 0,
+		0, 0, 0, 0, 0, 0, 0, 1266, 1267, 1268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1269, 0, 0, 0, 0, 0, 0, 0, 54,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1270, 735, 0, 0, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282,
+		1270, 63, 58, 59, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 0, 56, 714, 64, 362, 715, 344, 719, 360, 720, 1282, 725, 361, 726, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 372, 372, 365, 365, 365, 365, 372, 372, 372, 365, 365, 0, 0, 0,
+		0, 365, 0, 0, 0, 372, 372, 365, 367, 365, 372, 372, 367, 367, 367, 367, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1284, 1285, 1286, 1287, 0, 1288, 1289, 1290, 0, 1291, 718, 695, 695, 695, 344, 1292, 696, 696, 699, 360, 0, 701, 1293, 0, 0, 704, 1294, 705, 705, 705, 0, 0,
+		1295, 1296, 1297, 0, 1298, 0, 1299, 0, 1298, 0, 1300, 1301, 690, 1286, 0, 714, 692, 1302, 0, 700, 64, 1303, 1304, 1305, 1306, 735, 0, 1307, 428, 732, 1308, 1309,
+		1310, 0, 0, 0, 0, 691, 713, 714, 735, 346, 0, 0, 0, 0, 0, 0, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326,
+		696, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 699, 1286, 691, 700, 735, 1338, 1339, 1340, 730, 1341, 1342, 1343, 1344, 362, 1345, 1346, 360, 738, 713, 720,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1347, 0, 0, 0, 0, 0, 0, 1348, 0, 1349, 0, 1350, 0, 0, 0, 0, 0, 1351, 1352, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1354, 1355, 1356, 1357, 0, 1358, 0, 1359, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1360, 1361, 0, 0, 0, 1362, 1363, 0, 1364, 1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1366, 1367, 1368, 1369, 0, 0, 0, 0, 0, 1370, 1371, 0, 1372, 1373, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1374, 0, 0, 0,
+		0, 1375, 0, 1376, 1377, 1378, 0, 1379, 1380, 1381, 0, 0, 0, 1382, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1383, 1384, 1385, 0, 1386, 1387, 0, 0, 0, 0, 0, 0, 0, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 0, 0,
+		1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 0, 0, 0, 0, 0, 0, 0, 1415, 1416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1417, 0, 0, 0, 0, 0, 1418, 1419, 0, 1420, 1421, 1422, 1423, 1424, 0, 0, 1425, 1426, 1427, 1428, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1429, 1430, 1431, 1432, 0, 0, 0, 0, 0, 0, 1433, 1434, 1435, 1436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1437, 1438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		63, 58, 59, 1271, 1272, 1273, 1274, 1275, 1276, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461,
+		1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493,
+		1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697,
+		698, 699, 700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282, 64, 725,
+		1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 1270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1520, 1521, 1522, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1523, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 346, 1330, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1525,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1526, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558,
+		1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590,
+		1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622,
+		1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654,
+		1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686,
+		1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718,
+		1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 773, 521, 366, 520, 1741, 1741, 0, 0, 0, 0, 0, 0, 1742, 0, 1550, 1743, 1744, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1745, 0, 0, 0, 0, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766,
+		1767, 1768, 1769, 0, 1770, 1771, 1772, 1773, 1774, 1775, 0, 0, 0, 0, 0, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1791, 0, 0, 0, 0, 1792, 1792, 1793, 1794, 1795, 1796, 1797,
+		0, 0, 0, 0, 0, 0, 1798, 0, 0, 0, 0, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819,
+		1820, 1821, 1822, 0, 1823, 1824, 1825, 1826, 1827, 1828, 0, 0, 0, 0, 0, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1844, 1845, 1846, 1847, 0, 1848, 0, 0, 1849, 1850, 1851, 1852, 0, 0, 1853, 1854, 1855,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870,
+		1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902,
+		1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
+		1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 0, 0, 0, 1527, 1533, 1950, 1951, 1952, 1953, 1954, 1955, 1531, 1956, 1957, 1958, 1959, 1535,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 0,
+		1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022,
+		2023, 2024, 2025, 2026, 2027, 2028, 1593, 2029, 0, 0, 0, 0, 0, 0, 0, 0, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045,
+		1856, 1859, 1862, 1864, 1872, 1873, 1876, 1878, 1879, 1881, 1882, 1883, 1884, 1885, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 0,
+		1527, 1533, 1950, 1951, 2063, 2064, 2065, 1538, 2066, 1550, 1600, 1612, 1611, 1601, 1693, 1558, 1598, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 1564, 2077, 2078, 2079, 2080,
+		2081, 2082, 2083, 2084, 1952, 1953, 1954, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109,
+		2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141,
+		2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173,
+		2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205,
+		2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237,
+		2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269,
+		2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301,
+		2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333,
+		2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365,
+		2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397,
+		2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2430, 2431, 365, 365,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2432, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1286, 1302, 1294, 0, 0, 0, 2433, 2434, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0, 365, 365, 367, 0, 0, 365, 365, 0, 0, 0, 0, 0, 365, 365,
+		0, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2435, 2436, 2437, 2438,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2439, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440,
+		2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440,
+		2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440,
+		2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440,
+		2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440, 2440,
+		2440, 2440, 2440, 2440, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471,
+		2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503,
+		2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2460, 2532, 2533, 2534,
+		2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565, 2566,
+		2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598,
+		2599, 2550, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2534, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2460,
+		2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2536, 2655, 2656, 2657, 2658,
+		2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690,
+		2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 0, 0, 2705, 0, 2706, 0, 0, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 0,
+		2717, 0, 2718, 0, 0, 2719, 2720, 0, 0, 0, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742,
+		2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2589, 2766, 2767, 2768, 2769, 2770, 2771, 2771, 2772,
+		2773, 2774, 2775, 2776, 2777, 2778, 2779, 2719, 2780, 2781, 2782, 2783, 2784, 2785, 0, 0, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2733, 2794, 2795, 2796, 2705, 2797, 2798, 2799,
+		2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2742, 2809, 2743, 2810, 2811, 2812, 2813, 2814, 2706, 2481, 2815, 2816, 2817, 2551, 2638, 2818, 2819, 2750, 2820, 2751, 2821, 2822, 2823,
+		2708, 2824, 2825, 2826, 2827, 2828, 2709, 2829, 2830, 2831, 2832, 2833, 2834, 2765, 2835, 2836, 2589, 2837, 2769, 2838, 2839, 2840, 2841, 2842, 2774, 2843, 2718, 2844, 2775, 2532, 2845, 2776,
+		2846, 2778, 2847, 2848, 2849, 2850, 2851, 2780, 2714, 2852, 2781, 2853, 2782, 2854, 2448, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2866, 2867, 2868, 2869, 2870, 2871, 2871, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2872, 2873, 2874, 2875, 2876, 0, 0, 0, 0, 0, 2877, 2878, 2879,
+		2880, 1303, 1306, 2881, 2882, 2883, 2884, 2885, 2886, 1277, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 0, 2900, 2901, 2902, 2903, 2904, 0, 2905, 0,
+		2906, 2907, 0, 2908, 2909, 0, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2920, 2921, 2921, 2921, 2921, 2922, 2922, 2922, 2922, 2923, 2923, 2923, 2923, 2924, 2924,
+		2924, 2924, 2925, 2925, 2925, 2925, 2926, 2926, 2926, 2926, 2927, 2927, 2927, 2927, 2928, 2928, 2928, 2928, 2929, 2929, 2929, 2929, 2930, 2930, 2930, 2930, 2931, 2931, 2931, 2931, 2932, 2932,
+		2932, 2932, 2933, 2933, 2934, 2934, 2935, 2935, 2936, 2936, 2937, 2937, 2938, 2938, 2939, 2939, 2939, 2939, 2940, 2940, 2940, 2940, 2941, 2941, 2941, 2941, 2942, 2942, 2942, 2942, 2943, 2943,
+		2944, 2944, 2944, 2944, 2945, 2945, 2946, 2946, 2946, 2946, 2947, 2947, 2947, 2947, 2948, 2948, 2949, 2949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2950, 2950, 2950, 2950, 2951, 2951, 2952, 2952, 2953, 2953, 557, 2954, 2954,
+		2955, 2955, 2956, 2956, 2957, 2957, 2957, 2957, 2958, 2958, 2959, 2959, 2960, 2960, 2961, 2961, 2962, 2962, 2963, 2963, 2964, 2964, 2965, 2965, 2965, 2966, 2966, 2966, 2967, 2967, 2967, 2967,
+		2968, 2969, 2970, 2966, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998,
+		2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030,
+		3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062,
+		3063, 3064, 3065, 3066, 3067, 3068, 2970, 3069, 2966, 2971, 3070, 3071, 2975, 3072, 2976, 2977, 3073, 3074, 2981, 3075, 2982, 2983, 3076, 3077, 2985, 3078, 2986, 2987, 3016, 3017, 3020, 3021,
+		3022, 3026, 3027, 3028, 3029, 3033, 3034, 3035, 3079, 3039, 3080, 3081, 3045, 3082, 3046, 3047, 3060, 3083, 3084, 3055, 3085, 3056, 3057, 2968, 2969, 3086, 2970, 3087, 2972, 2973, 2974, 2975,
+		3088, 2978, 2979, 2980, 2981, 3089, 2985, 2988, 2989, 2990, 2991, 2992, 2994, 2995, 2996, 2997, 2998, 2999, 3090, 3000, 3001, 3002, 3003, 3004, 3005, 3007, 3008, 3009, 3010, 3011, 3012, 3013,
+		3014, 3015, 3018, 3019, 3023, 3024, 3025, 3026, 3027, 3030, 3031, 3032, 3033, 3091, 3036, 3037, 3038, 3039, 3042, 3043, 3044, 3045, 3092, 3048, 3049, 3093, 3052, 3053, 3054, 3055, 3094, 2970,
+		3087, 2975, 3088, 2981, 3089, 2985, 3095, 2998, 3096, 3097, 3098, 3026, 3027, 3033, 3045, 3092, 3055, 3094, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112,
+		3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3097, 3125, 3126, 3127, 3128, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116,
+		3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3097, 3125, 3126, 3127, 3128, 3122, 3123, 3124, 3097, 3096, 3098, 3006, 2995, 2996, 2997, 3122, 3123, 3124, 3006, 3007, 3129, 3129, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3130, 3131, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3137, 3138, 3139, 3140, 3141, 3142, 3143,
+		3143, 3144, 3145, 3145, 3146, 3146, 3147, 3148, 3148, 3149, 3150, 3150, 3151, 3151, 3152, 3153, 3153, 3154, 3154, 3155, 3156, 3157, 3158, 3158, 3159, 3160, 3161, 3162, 3163, 3163, 3164, 3165,
+		3166, 3167, 3168, 3169, 3169, 3170, 3170, 3171, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 0, 0, 3179, 3180, 3181, 3182, 3183, 3184, 3184, 3185, 3186, 3187, 3188, 3188, 3189, 3190,
+		3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3164, 3166, 3211, 3212, 3213, 3214, 3215, 3216, 3215, 3213, 3217, 3218,
+		3219, 3220, 3221, 3216, 3157, 3147, 3222, 3223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 1259, 0, 0, 0, 0, 0, 0,
+		365, 365, 365, 365, 365, 365, 365, 367, 367, 367, 367, 367, 367, 367, 365, 365, 1258, 3246, 3247, 3248, 3248, 1280, 1281, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257,
+		3258, 3259, 3260, 3261, 3262, 0, 0, 3263, 3264, 1265, 1265, 1265, 1265, 3248, 3248, 3248, 3237, 3238, 1257, 0, 3241, 3240, 3243, 3242, 3246, 1280, 1281, 3249, 3250, 3251, 3252, 3265,
+		3266, 3267, 1277, 3268, 3269, 3270, 1279, 0, 3271, 3272, 3273, 3274, 0, 0, 0, 0, 3275, 3276, 3277, 0, 3278, 0, 3279, 3280, 3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288,
+		3289, 3290, 3290, 3291, 3291, 3292, 3292, 3293, 3293, 3294, 3294, 3294, 3294, 3295, 3295, 3296, 3296, 3296, 3296, 3297, 3297, 3298, 3298, 3298, 3298, 3299, 3299, 3299, 3299, 3300, 3300, 3300,
+		3300, 3301, 3301, 3301, 3301, 3302, 3302, 3302, 3302, 3303, 3303, 3304, 3304, 3305, 3305, 3306, 3306, 3307, 3307, 3307, 3307, 3308, 3308, 3308, 3308, 3309, 3309, 3309, 3309, 3310, 3310, 3310,
+		3310, 3311, 3311, 3311, 3311, 3312, 3312, 3312, 3312, 3313, 3313, 3313, 3313, 3314, 3314, 3314, 3314, 3315, 3315, 3315, 3315, 3316, 3316, 3316, 3316, 3317, 3317, 3317, 3317, 3318, 3318, 3318,
+		3318, 3319, 3319, 3319, 3319, 3320, 3320, 3320, 3320, 3321, 3321, 3321, 3321, 3322, 3322, 2958, 2958, 3323, 3323, 3323, 3323, 3324, 3324, 3325, 3325, 3326, 3326, 3327, 3327, 0, 0, 0,
+		0, 3242, 3328, 3265, 3272, 3273, 3266, 3329, 1280, 1281, 3267, 1277, 3237, 3268, 1257, 3330, 1270, 63, 58, 59, 1271, 1272, 1273, 1274, 1275, 1276, 3240, 3241, 3269, 1279, 3270, 3243,
+		3274, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 3263, 3271, 3264, 3331, 3248,
+		3332, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 3249, 3333, 3250, 3334, 3335,
+		3336, 3239, 3259, 3260, 3238, 3337, 2172, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140,
+		2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 3348, 3349, 3350,
+		1907, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 0,
+		0, 0, 1886, 1887, 1888, 1889, 1890, 1891, 0, 0, 1892, 1893, 1894, 1895, 1896, 1897, 0, 0, 1898, 1899, 1900, 1901, 1902, 1903, 0, 0, 1904, 1905, 1906, 0, 0, 0,
+		3351, 3352, 3353, 57, 3354, 3355, 3356, 0, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 3364, 0, 0, 0, 0, 0, 0, 0, 0, 3365, 0, 0, 0, 0, 0, 0, 0, 3366, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 3367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 3368, 3369, 3370, 3371, 3372, 0, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 1292, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3394, 3395, 3396,
+		3397, 3398, 3399, 3400, 3401, 1518, 3402, 3403, 3404, 3405, 3406, 3407, 3408, 3409, 3410, 3411, 3412, 0, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 372, 367, 0, 0, 0, 0, 573,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 365, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 367,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 367, 367, 365, 365, 365, 367, 365, 367, 367, 367, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 365, 367, 365, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3422, 3423, 3424, 3425, 0, 0, 0,
+		0, 0, 0, 0, 0, 3426, 0, 0, 0, 0, 0, 3427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 572, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 3428, 3429, 0, 3430, 3431, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 582, 0, 583, 0,
+		0, 0, 0, 0, 0, 0, 0, 3432, 0, 0, 0, 3433, 3434, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 365, 0, 0, 0, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 3435, 3436, 3437, 3438, 0, 0, 0, 0, 0, 3439, 0, 0, 3440, 0, 3441, 3442, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 583, 0, 0, 0, 0,
+		0, 0, 3443, 0, 0, 3444, 0, 3445, 3446, 583, 0, 0, 0, 0, 573, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 573, 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0, 3447, 583, 3448, 3449, 583, 3450, 0,
+		0, 0, 573, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0, 3451, 3452, 3453, 3454, 0, 0, 0, 573,
+		582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 582, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 582, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 3455, 0, 0, 3456, 0, 0, 0, 0, 573, 573, 0,
+		0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 582, 0, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3457, 583,
+		583, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 372, 372, 372, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 3467, 0, 0, 0, 3468, 3469, 3470, 3471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3472, 3472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697,
+		698, 699, 700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 1270, 63, 58, 59, 1271, 1272, 1273, 1274, 1275, 1276, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3473, 3474,
+		3475, 3476, 3477, 3478, 3479, 640, 640, 372, 372, 372, 0, 0, 0, 3480, 640, 640, 640, 640, 640, 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 367, 367, 367,
+		367, 367, 367, 0, 0, 365, 365, 365, 365, 365, 367, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3481, 3482, 3483, 3484, 3485,
+		3486, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 714, 741,
+		718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699,
+		700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 714, 741, 718, 0, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347,
+		361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335,
+		1517, 1298, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 0, 1286, 691,
+		0, 0, 694, 0, 0, 697, 698, 0, 0, 701, 702, 704, 1294, 0, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 0, 741, 0, 344, 735, 346,
+		719, 360, 720, 1282, 0, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704,
+		1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730,
+		351, 362, 352, 768, 688, 690, 0, 691, 692, 1302, 694, 0, 0, 697, 698, 699, 700, 701, 702, 704, 1294, 0, 1516, 706, 707, 1330, 708, 1335, 1517, 0, 56, 712,
+		738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 0, 691, 692, 1302, 694, 0,
+		696, 697, 698, 699, 700, 0, 702, 0, 0, 0, 1516, 706, 707, 1330, 708, 1335, 1517, 0, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282,
+		64, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704, 1294, 705, 1516, 706,
+		707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768,
+		688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 714, 741,
+		718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699,
+		700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347,
+		361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335,
+		1517, 1298, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1286, 691,
+		692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704, 1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346,
+		719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704,
+		1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1282, 64, 725, 1518, 347, 361, 726, 727, 730,
+		351, 362, 352, 768, 3487, 3488, 0, 0, 3489, 3490, 1308, 3491, 3492, 3493, 3494, 432, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 1309, 3502, 432, 434, 3503, 3504, 3505, 3506, 3507,
+		3508, 3509, 3510, 422, 732, 733, 433, 3511, 3512, 423, 3513, 429, 3514, 61, 3515, 3516, 3517, 428, 430, 431, 3518, 3519, 3520, 427, 734, 3521, 3522, 3523, 433, 423, 429, 427,
+		430, 428, 3489, 3490, 1308, 3491, 3492, 3493, 3494, 432, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 1309, 3502, 432, 434, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 422, 732, 733,
+		433, 3511, 3512, 423, 3513, 429, 3514, 61, 3515, 3516, 3517, 428, 430, 431, 3518, 3519, 3520, 427, 734, 3521, 3522, 3523, 433, 423, 429, 427, 430, 428, 3489, 3490, 1308, 3491,
+		3492, 3493, 3494, 432, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 1309, 3502, 432, 434, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 422, 732, 733, 433, 3511, 3512, 423, 3513, 429,
+		3514, 61, 3515, 3516, 3517, 428, 430, 431, 3518, 3519, 3520, 427, 734, 3521, 3522, 3523, 433, 423, 429, 427, 430, 428, 3489, 3490, 1308, 3491, 3492, 3493, 3494, 432, 3495, 3496,
+		3497, 3498, 3499, 3500, 3501, 1309, 3502, 432, 434, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 422, 732, 733, 433, 3511, 3512, 423, 3513, 429, 3514, 61, 3515, 3516, 3517, 428,
+		430, 431, 3518, 3519, 3520, 427, 734, 3521, 3522, 3523, 433, 423, 429, 427, 430, 428, 3489, 3490, 1308, 3491, 3492, 3493, 3494, 432, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 1309,
+		3502, 432, 434, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 422, 732, 733, 433, 3511, 3512, 423, 3513, 429, 3514, 61, 3515, 3516, 3517, 428, 430, 431, 3518, 3519, 3520, 427,
+		734, 3521, 3522, 3523, 433, 423, 429, 427, 430, 428, 3524, 3525, 0, 0, 1270, 63, 58, 59, 1271, 1272, 1273, 1274, 1275, 1276, 1270, 63, 58, 59, 1271, 1272, 1273, 1274,
+		1275, 1276, 1270, 63, 58, 59, 1271, 1272, 1273, 1274, 1275, 1276, 1270, 63, 58, 59, 1271, 1272, 1273, 1274, 1275, 1276, 1270, 63, 58, 59, 1271, 1272, 1273, 1274, 1275, 1276,
+		365, 365, 365, 365, 365, 365, 365, 0, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 0, 0, 365, 365, 365, 365, 365,
+		365, 365, 0, 365, 365, 0, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541,
+		3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3538, 3539, 3541, 3543,
+		3544, 3545, 3546, 3547, 3548, 2430, 3549, 3559, 3554, 3560, 3561, 3562, 3563, 3564, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 366, 366, 367, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 367, 367, 367, 367, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3295, 3296, 3300, 3303, 0, 3322, 3306, 3301, 3311, 3323, 3317, 3318, 3319, 3320, 3307, 3313, 3315, 3309, 3316, 3305, 3308, 3298, 3299, 3302, 3304, 3310, 3312, 3314, 3565, 2943, 3566, 3567,
+		0, 3296, 3300, 0, 3321, 0, 0, 3301, 0, 3323, 3317, 3318, 3319, 3320, 3307, 3313, 3315, 3309, 3316, 0, 3308, 3298, 3299, 3302, 0, 3310, 0, 3314, 0, 0, 0, 0,
+		0, 0, 3300, 0, 0, 0, 0, 3301, 0, 3323, 0, 3318, 0, 3320, 3307, 3313, 0, 3309, 3316, 0, 3308, 0, 0, 3302, 0, 3310, 0, 3314, 0, 2943, 0, 3567,
+		0, 3296, 3300, 0, 3321, 0, 0, 3301, 3311, 3323, 3317, 0, 3319, 3320, 3307, 3313, 3315, 3309, 3316, 0, 3308, 3298, 3299, 3302, 0, 3310, 3312, 3314, 3565, 0, 3566, 0,
+		3295, 3296, 3300, 3303, 3321, 3322, 3306, 3301, 3311, 3323, 0, 3318, 3319, 3320, 3307, 3313, 3315, 3309, 3316, 3305, 3308, 3298, 3299, 3302, 3304, 3310, 3312, 3314, 0, 0, 0, 0,
+		0, 3296, 3300, 3303, 0, 3322, 3306, 3301, 3311, 3323, 0, 3318, 3319, 3320, 3307, 3313, 3315, 3309, 3316, 3305, 3308, 3298, 3299, 3302, 3304, 3310, 3312, 3314, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 0, 0, 0, 0, 0, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594,
+		3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605, 1286, 705, 3606, 3607, 0, 688, 690, 1286, 691, 692, 1302, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704,
+		1294, 705, 1516, 706, 707, 1330, 708, 1335, 1517, 1298, 3608, 2359, 3609, 3610, 3611, 3612, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3613, 3614, 3615, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3616, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3617, 3618, 2136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1590, 3619, 3620, 3621, 1533, 3622, 3623, 1958, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631,
+		3632, 3633, 1626, 3634, 3635, 3636, 3637, 3638, 3639, 1527, 1950, 3640, 2085, 1953, 2086, 3641, 1682, 3642, 3643, 3644, 3645, 3646, 2068, 1600, 3647, 3648, 3649, 3650, 0, 0, 0, 0,
+		3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 0, 0, 0, 0, 0, 0, 0, 3660, 3661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1270, 63, 58, 59, 1271, 1272, 1273, 1274, 1275, 1276, 0, 0, 0, 0, 0, 0,
+		3662, 3663, 3664, 3665, 3666, 2727, 3667, 3668, 3669, 3670, 2728, 3671, 3672, 3673, 2729, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685, 2787, 3686, 3687, 3688, 3689,
+		3690, 3691, 3692, 3693, 3694, 2792, 2730, 2731, 2793, 3695, 3696, 2538, 3697, 2732, 3698, 3699, 3700, 3701, 3701, 3701, 3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713,
+		3714, 3715, 3716, 3717, 3718, 3719, 3719, 2795, 3720, 3721, 3722, 3723, 2734, 3724, 3725, 3726, 2691, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 3741,
+		3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3752, 3753, 3754, 3755, 2534, 3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 2739, 3764, 3765, 3766, 3767, 3768, 3769, 3770,
+		3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 2480, 3785, 3786, 3787, 3787, 3788, 3789, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797, 3798, 3799,
+		3800, 3801, 3802, 2740, 3803, 3804, 3805, 3806, 2807, 3806, 3807, 2742, 3808, 3809, 3810, 3811, 2743, 2453, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825,
+		3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 2744, 3834, 3835, 3836, 3837, 3838, 3839, 2746, 3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847, 2481, 2815, 3848, 3849, 3850, 3851, 3852, 3853,
+		3854, 3855, 2747, 3856, 3857, 3858, 3859, 2858, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872, 2551, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882,
+		3883, 2748, 2638, 3884, 3885, 3886, 3887, 3888, 3889, 3890, 3891, 2819, 3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 2820, 3900, 3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910,
+		3911, 2822, 3912, 3913, 3914, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 3922, 3922, 3923, 3924, 2824, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 2537, 3932, 3933, 3934, 3935, 3936, 3937, 3938,
+		2830, 3939, 3940, 3941, 3942, 3943, 3944, 3944, 2831, 2860, 3945, 3946, 3947, 3948, 3949, 2499, 2833, 3950, 3951, 2759, 3952, 3953, 2713, 3954, 3955, 2763, 3956, 3957, 3958, 3959, 3959, 3960,
+		3961, 3962, 3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 2769, 3987, 3988, 3989, 3990, 3991,
+		3992, 3993, 3994, 3995, 3996, 3997, 3998, 3999, 4000, 4001, 4002, 3788, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 2555, 4015, 4016, 4017, 4018, 4019, 4020, 2772,
+		4021, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030, 4031, 4032, 4033, 4034, 4035, 4036, 4037, 4038, 4039, 4040, 2494, 4041, 4042, 4043, 4044, 4045, 4046, 2840, 4047, 4048, 4049, 4050,
+		4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066, 2845, 2846, 4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079, 2847,
+		4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096, 4097, 4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 2853, 2853,
+		4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 2854, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127, 4128, 4129, 4130, 4131, 4132, 4133, 4134, 4135, 4136, 4137, 4138, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+	};
+
+	static const utf8normalization_record properties[4139] =
+	{
+		{ 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 4 }, { 0, 0, 0, 0, 7 }, { 0, 0, 0, 0, 10 }, { 0, 0, 0, 0, 43 }, { 0, 0, 0, 0, 50 }, { 0, 0, 0, 0, 61 },
+		{ 0, 0, 0, 0, 74 }, { 0, 0, 0, 0, 109 }, { 0, 0, 0, 0, 112 }, { 0, 0, 0, 0, 127 }, { 0, 0, 0, 0, 142 }, { 0, 0, 0, 0, 173 }, { 0, 0, 0, 0, 176 }, { 0, 0, 0, 0, 187 },
+		{ 0, 0, 0, 0, 200 }, { 0, 0, 0, 0, 207 }, { 0, 0, 0, 0, 226 }, { 0, 0, 0, 0, 259 }, { 0, 0, 0, 0, 264 }, { 0, 0, 0, 0, 281 }, { 0, 0, 0, 0, 296 }, { 0, 0, 0, 0, 311 },
+		{ 0, 0, 0, 0, 350 }, { 0, 0, 0, 0, 355 }, { 0, 0, 0, 0, 368 }, { 0, 0, 0, 0, 373 }, { 0, 0, 0, 0, 392 }, { 0, 0, 0, 0, 405 }, { 0, 0, 0, 0, 438 }, { 0, 0, 0, 0, 445 },
+		{ 0, 0, 0, 0, 456 }, { 0, 0, 0, 0, 469 }, { 0, 0, 0, 0, 504 }, { 0, 0, 0, 0, 507 }, { 0, 0, 0, 0, 522 }, { 0, 0, 0, 0, 539 }, { 0, 0, 0, 0, 568 }, { 0, 0, 0, 0, 573 },
+		{ 0, 0, 0, 0, 584 }, { 0, 0, 0, 0, 597 }, { 0, 0, 0, 0, 604 }, { 0, 0, 0, 0, 623 }, { 0, 0, 0, 0, 656 }, { 0, 0, 0, 0, 661 }, { 0, 0, 0, 0, 678 }, { 0, 0, 0, 0, 693 },
+		{ 0, 0, 0, 0, 710 }, { 0, 0, 0, 0, 749 }, { 0, 0, 0, 0, 754 }, { 0, 0, 0, 0, 769 }, { 0, 0, 0, 0, 774 }, { 0, 0, 0, 0, 795 }, { 0, 12, 0, 1, 0 }, { 0, 12, 0, 3, 808 },
+		{ 0, 12, 0, 6, 0 }, { 0, 12, 0, 8, 0 }, { 0, 12, 0, 11, 0 }, { 0, 12, 0, 13, 0 }, { 0, 12, 0, 15, 0 }, { 0, 12, 0, 18, 0 }, { 0, 12, 0, 20, 0 }, { 0, 12, 0, 23, 0 },
+		{ 0, 12, 0, 25, 0 }, { 0, 12, 0, 27, 0 }, { 0, 12, 0, 31, 0 }, { 0, 12, 0, 35, 0 }, { 0, 10, 39, 39, 0 }, { 0, 10, 42, 42, 0 }, { 0, 10, 45, 45, 815 }, { 0, 10, 48, 48, 0 },
+		{ 0, 10, 51, 51, 824 }, { 0, 10, 54, 54, 827 }, { 0, 0, 0, 0, 830 }, { 0, 10, 57, 57, 835 }, { 0, 10, 60, 60, 0 }, { 0, 10, 63, 63, 0 }, { 0, 10, 66, 66, 838 }, { 0, 10, 69, 69, 0 },
+		{ 0, 10, 72, 72, 0 }, { 0, 10, 75, 75, 0 }, { 0, 10, 78, 78, 0 }, { 0, 10, 81, 81, 847 }, { 0, 10, 84, 84, 0 }, { 0, 10, 87, 87, 0 }, { 0, 10, 90, 90, 0 }, { 0, 10, 93, 93, 850 },
+		{ 0, 10, 96, 96, 859 }, { 0, 10, 99, 99, 866 }, { 0, 0, 0, 0, 869 }, { 0, 10, 102, 102, 0 }, { 0, 10, 105, 105, 0 }, { 0, 10, 108, 108, 0 }, { 0, 10, 111, 111, 872 }, { 0, 10, 114, 114, 0 },
+		{ 0, 10, 117, 117, 0 }, { 0, 10, 120, 120, 0 }, { 0, 10, 123, 123, 881 }, { 0, 10, 126, 126, 0 }, { 0, 10, 129, 129, 890 }, { 0, 10, 132, 132, 893 }, { 0, 0, 0, 0, 896 }, { 0, 10, 135, 135, 901 },
+		{ 0, 10, 138, 138, 0 }, { 0, 10, 141, 141, 0 }, { 0, 10, 144, 144, 904 }, { 0, 10, 147, 147, 0 }, { 0, 10, 150, 150, 0 }, { 0, 10, 153, 153, 0 }, { 0, 10, 156, 156, 0 }, { 0, 10, 159, 159, 913 },
+		{ 0, 10, 162, 162, 0 }, { 0, 10, 165, 165, 0 }, { 0, 10, 168, 168, 0 }, { 0, 10, 171, 171, 916 }, { 0, 10, 174, 174, 925 }, { 0, 10, 177, 177, 932 }, { 0, 0, 0, 0, 935 }, { 0, 10, 180, 180, 0 },
+		{ 0, 10, 183, 183, 0 }, { 0, 10, 186, 186, 0 }, { 0, 10, 189, 189, 938 }, { 0, 10, 192, 192, 0 }, { 0, 10, 195, 195, 0 }, { 0, 10, 198, 198, 0 }, { 0, 10, 201, 201, 0 }, { 0, 10, 204, 204, 947 },
+		{ 0, 10, 207, 207, 956 }, { 0, 10, 210, 210, 0 }, { 0, 10, 213, 213, 0 }, { 0, 10, 216, 216, 0 }, { 0, 10, 219, 219, 0 }, { 0, 10, 222, 222, 0 }, { 0, 10, 225, 225, 0 }, { 0, 10, 228, 228, 0 },
+		{ 0, 10, 231, 231, 0 }, { 0, 10, 234, 234, 0 }, { 0, 10, 237, 237, 0 }, { 0, 10, 240, 240, 0 }, { 0, 10, 243, 243, 0 }, { 0, 10, 246, 246, 965 }, { 0, 10, 249, 249, 970 }, { 0, 10, 252, 252, 0 },
+		{ 0, 10, 255, 255, 0 }, { 0, 10, 258, 258, 0 }, { 0, 10, 261, 261, 0 }, { 0, 10, 264, 264, 0 }, { 0, 10, 267, 267, 0 }, { 0, 10, 270, 270, 0 }, { 0, 10, 273, 273, 0 }, { 0, 10, 276, 276, 0 },
+		{ 0, 10, 279, 279, 0 }, { 0, 10, 282, 282, 0 }, { 0, 10, 285, 285, 0 }, { 0, 10, 288, 288, 0 }, { 0, 10, 291, 291, 0 }, { 0, 10, 294, 294, 0 }, { 0, 10, 297, 297, 0 }, { 0, 10, 300, 300, 0 },
+		{ 0, 10, 303, 303, 0 }, { 0, 10, 306, 306, 0 }, { 0, 10, 309, 309, 0 }, { 0, 10, 312, 312, 0 }, { 0, 10, 315, 315, 0 }, { 0, 10, 318, 318, 0 }, { 0, 10, 321, 321, 0 }, { 0, 10, 324, 324, 0 },
+		{ 0, 10, 327, 327, 0 }, { 0, 10, 330, 330, 0 }, { 0, 12, 0, 333, 0 }, { 0, 12, 0, 336, 0 }, { 0, 10, 339, 339, 0 }, { 0, 10, 342, 342, 0 }, { 0, 10, 345, 345, 0 }, { 0, 10, 348, 348, 0 },
+		{ 0, 10, 351, 351, 0 }, { 0, 10, 354, 354, 0 }, { 0, 10, 357, 357, 0 }, { 0, 10, 360, 360, 0 }, { 0, 10, 363, 363, 0 }, { 0, 10, 366, 366, 0 }, { 0, 12, 0, 369, 0 }, { 0, 12, 0, 372, 0 },
+		{ 0, 10, 375, 375, 0 }, { 0, 10, 378, 378, 0 }, { 0, 10, 381, 381, 0 }, { 0, 10, 384, 384, 0 }, { 0, 10, 387, 387, 0 }, { 0, 10, 390, 390, 0 }, { 0, 12, 0, 393, 0 }, { 0, 10, 396, 396, 975 },
+		{ 0, 10, 399, 399, 980 }, { 0, 10, 402, 402, 0 }, { 0, 10, 405, 405, 0 }, { 0, 10, 408, 408, 0 }, { 0, 10, 411, 411, 0 }, { 0, 10, 414, 414, 0 }, { 0, 10, 417, 417, 0 }, { 0, 10, 420, 420, 0 },
+		{ 0, 10, 423, 423, 0 }, { 0, 10, 426, 426, 0 }, { 0, 10, 429, 429, 0 }, { 0, 10, 432, 432, 985 }, { 0, 10, 435, 435, 988 }, { 0, 10, 438, 438, 0 }, { 0, 10, 441, 441, 0 }, { 0, 10, 444, 444, 0 },
+		{ 0, 10, 447, 447, 0 }, { 0, 10, 450, 450, 991 }, { 0, 10, 453, 453, 994 }, { 0, 10, 456, 456, 0 }, { 0, 10, 459, 459, 0 }, { 0, 10, 462, 462, 0 }, { 0, 10, 465, 465, 0 }, { 0, 10, 468, 468, 997 },
+		{ 0, 10, 471, 471, 1000 }, { 0, 10, 474, 474, 1003 }, { 0, 10, 477, 477, 1006 }, { 0, 10, 480, 480, 0 }, { 0, 10, 483, 483, 0 }, { 0, 10, 486, 486, 0 }, { 0, 10, 489, 489, 0 }, { 0, 10, 492, 492, 0 },
+		{ 0, 10, 495, 495, 0 }, { 0, 10, 498, 498, 0 }, { 0, 10, 501, 501, 0 }, { 0, 10, 504, 504, 0 }, { 0, 10, 507, 507, 0 }, { 0, 10, 510, 510, 0 }, { 0, 10, 513, 513, 0 }, { 0, 10, 516, 516, 0 },
+		{ 0, 10, 519, 519, 0 }, { 0, 10, 522, 522, 0 }, { 0, 10, 525, 525, 0 }, { 0, 10, 528, 528, 0 }, { 0, 10, 531, 531, 0 }, { 0, 10, 534, 534, 0 }, { 0, 12, 0, 537, 1009 }, { 0, 10, 539, 539, 1012 },
+		{ 0, 10, 542, 542, 1023 }, { 0, 10, 545, 545, 1034 }, { 0, 10, 548, 548, 1045 }, { 0, 0, 0, 0, 1056 }, { 0, 12, 0, 551, 0 }, { 0, 12, 0, 555, 0 }, { 0, 12, 0, 559, 0 }, { 0, 12, 0, 563, 0 },
+		{ 0, 12, 0, 566, 0 }, { 0, 12, 0, 569, 0 }, { 0, 12, 0, 572, 0 }, { 0, 12, 0, 575, 0 }, { 0, 12, 0, 578, 0 }, { 0, 10, 581, 581, 0 }, { 0, 10, 584, 584, 0 }, { 0, 10, 587, 587, 0 },
+		{ 0, 10, 590, 590, 0 }, { 0, 10, 593, 593, 0 }, { 0, 10, 596, 596, 0 }, { 0, 10, 599, 599, 0 }, { 0, 10, 602, 602, 0 }, { 0, 10, 605, 605, 0 }, { 0, 10, 609, 609, 0 }, { 0, 10, 613, 613, 0 },
+		{ 0, 10, 617, 617, 0 }, { 0, 10, 621, 621, 0 }, { 0, 10, 625, 625, 0 }, { 0, 10, 629, 629, 0 }, { 0, 10, 633, 633, 0 }, { 0, 10, 637, 637, 0 }, { 0, 10, 641, 641, 0 }, { 0, 10, 645, 645, 0 },
+		{ 0, 10, 649, 649, 0 }, { 0, 10, 653, 653, 0 }, { 0, 10, 656, 656, 0 }, { 0, 10, 659, 659, 0 }, { 0, 10, 662, 662, 0 }, { 0, 10, 665, 665, 0 }, { 0, 10, 668, 668, 0 }, { 0, 10, 671, 671, 1059 },
+		{ 0, 10, 674, 674, 1062 }, { 0, 10, 677, 677, 0 }, { 0, 10, 681, 681, 0 }, { 0, 10, 685, 685, 0 }, { 0, 10, 688, 688, 0 }, { 0, 10, 691, 691, 0 }, { 0, 12, 0, 694, 0 }, { 0, 12, 0, 697, 0 },
+		{ 0, 12, 0, 700, 0 }, { 0, 10, 703, 703, 0 }, { 0, 10, 706, 706, 0 }, { 0, 10, 709, 709, 0 }, { 0, 10, 712, 712, 0 }, { 0, 10, 715, 715, 0 }, { 0, 10, 719, 719, 0 }, { 0, 10, 723, 723, 0 },
+		{ 0, 10, 726, 726, 0 }, { 0, 10, 729, 729, 0 }, { 0, 10, 732, 732, 0 }, { 0, 10, 735, 735, 0 }, { 0, 10, 738, 738, 0 }, { 0, 10, 741, 741, 0 }, { 0, 10, 744, 744, 0 }, { 0, 10, 747, 747, 0 },
+		{ 0, 10, 750, 750, 0 }, { 0, 10, 753, 753, 0 }, { 0, 10, 756, 756, 0 }, { 0, 10, 759, 759, 0 }, { 0, 10, 762, 762, 0 }, { 0, 10, 765, 765, 0 }, { 0, 10, 768, 768, 0 }, { 0, 10, 771, 771, 0 },
+		{ 0, 10, 774, 774, 0 }, { 0, 10, 777, 777, 0 }, { 0, 10, 780, 780, 0 }, { 0, 10, 783, 783, 0 }, { 0, 10, 786, 786, 0 }, { 0, 10, 789, 789, 0 }, { 0, 10, 792, 792, 0 }, { 0, 10, 795, 795, 0 },
+		{ 0, 10, 798, 798, 0 }, { 0, 10, 801, 801, 0 }, { 0, 10, 804, 804, 0 }, { 0, 10, 807, 807, 0 }, { 0, 10, 810, 810, 0 }, { 0, 10, 813, 813, 0 }, { 0, 10, 816, 816, 0 }, { 0, 10, 819, 819, 0 },
+		{ 0, 10, 822, 822, 0 }, { 0, 10, 825, 825, 1065 }, { 0, 10, 828, 828, 1068 }, { 0, 10, 831, 831, 1071 }, { 0, 10, 834, 834, 1074 }, { 0, 10, 837, 837, 0 }, { 0, 10, 841, 841, 0 }, { 0, 10, 845, 845, 0 },
+		{ 0, 10, 849, 849, 0 }, { 0, 10, 853, 853, 1077 }, { 0, 10, 856, 856, 1080 }, { 0, 10, 859, 859, 0 }, { 0, 10, 863, 863, 0 }, { 0, 10, 867, 867, 0 }, { 0, 10, 870, 870, 0 }, { 0, 0, 0, 0, 1083 },
+		{ 0, 12, 0, 873, 0 }, { 0, 12, 0, 875, 0 }, { 0, 12, 0, 877, 0 }, { 0, 12, 0, 879, 0 }, { 0, 12, 0, 881, 0 }, { 0, 12, 0, 883, 0 }, { 0, 12, 0, 885, 0 }, { 0, 12, 0, 887, 0 },
+		{ 0, 12, 0, 889, 0 }, { 0, 12, 0, 891, 0 }, { 0, 12, 0, 894, 0 }, { 0, 12, 0, 897, 0 }, { 0, 12, 0, 900, 0 }, { 0, 12, 0, 903, 0 }, { 0, 12, 0, 906, 0 }, { 0, 12, 0, 909, 0 },
+		{ 0, 12, 0, 911, 0 }, { 0, 12, 0, 537, 0 }, { 0, 12, 0, 913, 0 }, { 0, 12, 0, 915, 0 }, { 230, 5, 0, 0, 0 }, { 230, 0, 0, 0, 0 }, { 232, 0, 0, 0, 0 }, { 220, 0, 0, 0, 0 },
+		{ 216, 5, 0, 0, 0 }, { 202, 0, 0, 0, 0 }, { 220, 5, 0, 0, 0 }, { 202, 5, 0, 0, 0 }, { 1, 0, 0, 0, 0 }, { 1, 5, 0, 0, 0 }, { 230, 15, 917, 917, 0 }, { 230, 15, 919, 919, 0 },
+		{ 230, 15, 921, 921, 0 }, { 230, 15, 923, 923, 0 }, { 240, 5, 0, 0, 0 }, { 233, 0, 0, 0, 0 }, { 234, 0, 0, 0, 0 }, { 0, 15, 926, 926, 0 }, { 0, 12, 0, 928, 0 }, { 0, 15, 931, 931, 0 },
+		{ 0, 14, 933, 936, 0 }, { 0, 10, 940, 940, 0 }, { 0, 15, 943, 943, 0 }, { 0, 10, 945, 945, 0 }, { 0, 10, 948, 948, 0 }, { 0, 10, 951, 951, 0 }, { 0, 10, 954, 954, 0 }, { 0, 10, 957, 957, 0 },
+		{ 0, 10, 960, 960, 0 }, { 0, 10, 963, 963, 0 }, { 0, 0, 0, 0, 1086 }, { 0, 0, 0, 0, 1101 }, { 0, 0, 0, 0, 1110 }, { 0, 0, 0, 0, 1121 }, { 0, 0, 0, 0, 1136 }, { 0, 0, 0, 0, 1145 },
+		{ 0, 0, 0, 0, 1148 }, { 0, 0, 0, 0, 1161 }, { 0, 10, 967, 967, 0 }, { 0, 10, 970, 970, 0 }, { 0, 10, 973, 973, 1172 }, { 0, 10, 976, 976, 0 }, { 0, 10, 979, 979, 1175 }, { 0, 10, 982, 982, 0 },
+		{ 0, 10, 985, 985, 0 }, { 0, 0, 0, 0, 1178 }, { 0, 0, 0, 0, 1195 }, { 0, 0, 0, 0, 1204 }, { 0, 0, 0, 0, 1217 }, { 0, 0, 0, 0, 1234 }, { 0, 0, 0, 0, 1243 }, { 0, 0, 0, 0, 1248 },
+		{ 0, 0, 0, 0, 1265 }, { 0, 10, 989, 989, 1278 }, { 0, 10, 992, 992, 1285 }, { 0, 10, 995, 995, 0 }, { 0, 10, 998, 998, 0 }, { 0, 10, 1001, 1001, 1292 }, { 0, 12, 0, 1004, 0 }, { 0, 12, 0, 1006, 0 },
+		{ 0, 12, 0, 1008, 1295 }, { 0, 14, 1010, 957, 0 }, { 0, 14, 1013, 970, 0 }, { 0, 12, 0, 1016, 0 }, { 0, 12, 0, 1018, 0 }, { 0, 12, 0, 1020, 0 }, { 0, 12, 0, 1022, 0 }, { 0, 12, 0, 1024, 0 },
+		{ 0, 12, 0, 1026, 0 }, { 0, 12, 0, 1028, 0 }, { 0, 12, 0, 1030, 0 }, { 0, 10, 1032, 1032, 0 }, { 0, 10, 1035, 1035, 0 }, { 0, 10, 1038, 1038, 0 }, { 0, 0, 0, 0, 1300 }, { 0, 10, 1041, 1041, 0 },
+		{ 0, 10, 1044, 1044, 0 }, { 0, 10, 1047, 1047, 0 }, { 0, 10, 1050, 1050, 0 }, { 0, 0, 0, 0, 1303 }, { 0, 0, 0, 0, 1308 }, { 0, 0, 0, 0, 1311 }, { 0, 0, 0, 0, 1318 }, { 0, 0, 0, 0, 1323 },
+		{ 0, 0, 0, 0, 1326 }, { 0, 10, 1053, 1053, 0 }, { 0, 0, 0, 0, 1335 }, { 0, 0, 0, 0, 1338 }, { 0, 0, 0, 0, 1341 }, { 0, 0, 0, 0, 1350 }, { 0, 0, 0, 0, 1353 }, { 0, 0, 0, 0, 1356 },
+		{ 0, 0, 0, 0, 1359 }, { 0, 0, 0, 0, 1364 }, { 0, 0, 0, 0, 1367 }, { 0, 0, 0, 0, 1374 }, { 0, 0, 0, 0, 1379 }, { 0, 0, 0, 0, 1382 }, { 0, 10, 1056, 1056, 0 }, { 0, 0, 0, 0, 1391 },
+		{ 0, 0, 0, 0, 1394 }, { 0, 0, 0, 0, 1397 }, { 0, 0, 0, 0, 1406 }, { 0, 0, 0, 0, 1409 }, { 0, 0, 0, 0, 1412 }, { 0, 10, 1059, 1059, 0 }, { 0, 10, 1062, 1062, 0 }, { 0, 10, 1065, 1065, 0 },
+		{ 0, 0, 0, 0, 1415 }, { 0, 10, 1068, 1068, 0 }, { 0, 10, 1071, 1071, 0 }, { 0, 10, 1074, 1074, 0 }, { 0, 10, 1077, 1077, 0 }, { 0, 0, 0, 0, 1418 }, { 0, 0, 0, 0, 1421 }, { 0, 10, 1080, 1080, 0 },
+		{ 0, 10, 1083, 1083, 0 }, { 0, 10, 1086, 1086, 0 }, { 0, 10, 1089, 1089, 0 }, { 0, 10, 1092, 1092, 0 }, { 0, 10, 1095, 1095, 0 }, { 0, 10, 1098, 1098, 0 }, { 0, 10, 1101, 1101, 0 }, { 0, 10, 1104, 1104, 0 },
+		{ 0, 10, 1107, 1107, 0 }, { 0, 0, 0, 0, 1424 }, { 0, 0, 0, 0, 1427 }, { 0, 10, 1110, 1110, 0 }, { 0, 10, 1113, 1113, 0 }, { 0, 10, 1116, 1116, 0 }, { 0, 10, 1119, 1119, 0 }, { 0, 10, 1122, 1122, 0 },
+		{ 0, 10, 1125, 1125, 0 }, { 0, 10, 1128, 1128, 0 }, { 0, 10, 1131, 1131, 0 }, { 0, 10, 1134, 1134, 0 }, { 0, 10, 1137, 1137, 0 }, { 0, 10, 1140, 1140, 0 }, { 0, 10, 1143, 1143, 0 }, { 0, 0, 0, 0, 1430 },
+		{ 0, 0, 0, 0, 1433 }, { 0, 10, 1146, 1146, 0 }, { 0, 10, 1149, 1149, 0 }, { 0, 10, 1152, 1152, 0 }, { 0, 10, 1155, 1155, 0 }, { 0, 10, 1158, 1158, 0 }, { 0, 10, 1161, 1161, 0 }, { 0, 10, 1164, 1164, 0 },
+		{ 0, 10, 1167, 1167, 0 }, { 0, 10, 1170, 1170, 0 }, { 0, 10, 1173, 1173, 0 }, { 0, 10, 1176, 1176, 0 }, { 0, 10, 1179, 1179, 0 }, { 0, 10, 1182, 1182, 0 }, { 0, 10, 1185, 1185, 0 }, { 0, 12, 0, 1188, 0 },
+		{ 222, 0, 0, 0, 0 }, { 228, 0, 0, 0, 0 }, { 10, 0, 0, 0, 0 }, { 11, 0, 0, 0, 0 }, { 12, 0, 0, 0, 0 }, { 13, 0, 0, 0, 0 }, { 14, 0, 0, 0, 0 }, { 15, 0, 0, 0, 0 },
+		{ 16, 0, 0, 0, 0 }, { 17, 0, 0, 0, 0 }, { 18, 0, 0, 0, 0 }, { 19, 0, 0, 0, 0 }, { 20, 0, 0, 0, 0 }, { 21, 0, 0, 0, 0 }, { 22, 0, 0, 0, 0 }, { 23, 0, 0, 0, 0 },
+		{ 24, 0, 0, 0, 0 }, { 25, 0, 0, 0, 0 }, { 30, 0, 0, 0, 0 }, { 31, 0, 0, 0, 0 }, { 32, 0, 0, 0, 0 }, { 0, 10, 1191, 1191, 0 }, { 0, 10, 1194, 1194, 0 }, { 0, 10, 1197, 1197, 0 },
+		{ 0, 10, 1200, 1200, 0 }, { 0, 10, 1203, 1203, 0 }, { 0, 0, 0, 0, 1436 }, { 0, 0, 0, 0, 1443 }, { 0, 0, 0, 0, 1446 }, { 27, 0, 0, 0, 0 }, { 28, 0, 0, 0, 0 }, { 29, 0, 0, 0, 0 },
+		{ 33, 0, 0, 0, 0 }, { 34, 0, 0, 0, 0 }, { 35, 0, 0, 0, 0 }, { 0, 12, 0, 1206, 0 }, { 0, 12, 0, 1209, 0 }, { 0, 12, 0, 1212, 0 }, { 0, 12, 0, 1215, 0 }, { 0, 10, 1218, 1218, 0 },
+		{ 0, 0, 0, 0, 1449 }, { 0, 10, 1221, 1221, 0 }, { 0, 0, 0, 0, 1452 }, { 0, 10, 1224, 1224, 0 }, { 0, 0, 0, 0, 1455 }, { 36, 0, 0, 0, 0 }, { 0, 0, 0, 0, 1458 }, { 0, 10, 1227, 1227, 0 },
+		{ 0, 0, 0, 0, 1461 }, { 0, 10, 1230, 1230, 0 }, { 0, 0, 0, 0, 1464 }, { 0, 10, 1233, 1233, 0 }, { 7, 5, 0, 0, 0 }, { 9, 0, 0, 0, 0 }, { 0, 15, 1236, 1236, 0 }, { 0, 15, 1239, 1239, 0 },
+		{ 0, 15, 1242, 1242, 0 }, { 0, 15, 1245, 1245, 0 }, { 0, 15, 1248, 1248, 0 }, { 0, 15, 1251, 1251, 0 }, { 0, 15, 1254, 1254, 0 }, { 0, 15, 1257, 1257, 0 }, { 7, 0, 0, 0, 0 }, { 0, 5, 0, 0, 0 },
+		{ 0, 0, 0, 0, 1467 }, { 0, 10, 1260, 1260, 0 }, { 0, 10, 1263, 1263, 0 }, { 0, 15, 1266, 1266, 0 }, { 0, 15, 1269, 1269, 0 }, { 0, 15, 1272, 1272, 0 }, { 0, 15, 1275, 1275, 0 }, { 0, 15, 1278, 1278, 0 },
+		{ 0, 15, 1281, 1281, 0 }, { 0, 15, 1284, 1284, 0 }, { 0, 15, 1287, 1287, 0 }, { 0, 15, 1290, 1290, 0 }, { 0, 0, 0, 0, 1472 }, { 0, 10, 1293, 1293, 0 }, { 0, 10, 1296, 1296, 0 }, { 0, 10, 1299, 1299, 0 },
+		{ 0, 15, 1302, 1302, 0 }, { 0, 15, 1305, 1305, 0 }, { 0, 0, 0, 0, 1479 }, { 0, 10, 1308, 1308, 0 }, { 0, 0, 0, 0, 1482 }, { 0, 0, 0, 0, 1487 }, { 0, 10, 1311, 1311, 0 }, { 0, 10, 1314, 1314, 0 },
+		{ 0, 10, 1317, 1317, 0 }, { 0, 0, 0, 0, 1490 }, { 0, 10, 1320, 1320, 0 }, { 84, 0, 0, 0, 0 }, { 91, 5, 0, 0, 0 }, { 0, 0, 0, 0, 1493 }, { 0, 10, 1323, 1323, 0 }, { 0, 0, 0, 0, 1496 },
+		{ 0, 10, 1326, 1326, 0 }, { 0, 10, 1329, 1329, 0 }, { 0, 10, 1332, 1332, 1503 }, { 0, 10, 1335, 1335, 0 }, { 0, 0, 0, 0, 1506 }, { 0, 0, 0, 0, 1511 }, { 0, 10, 1339, 1339, 0 }, { 0, 10, 1342, 1342, 0 },
+		{ 0, 10, 1345, 1345, 0 }, { 9, 5, 0, 0, 0 }, { 0, 0, 0, 0, 1514 }, { 0, 10, 1348, 1348, 0 }, { 0, 10, 1351, 1351, 1521 }, { 0, 10, 1354, 1354, 0 }, { 0, 10, 1358, 1358, 0 }, { 0, 12, 0, 1361, 0 },
+		{ 103, 0, 0, 0, 0 }, { 107, 0, 0, 0, 0 }, { 0, 12, 0, 1364, 0 }, { 118, 0, 0, 0, 0 }, { 122, 0, 0, 0, 0 }, { 0, 12, 0, 1367, 0 }, { 0, 12, 0, 1370, 0 }, { 0, 12, 0, 1373, 0 },
+		{ 216, 0, 0, 0, 0 }, { 0, 15, 1375, 1375, 0 }, { 0, 15, 1378, 1378, 0 }, { 0, 15, 1381, 1381, 0 }, { 0, 15, 1384, 1384, 0 }, { 0, 15, 1387, 1387, 0 }, { 0, 15, 1390, 1390, 0 }, { 129, 0, 0, 0, 0 },
+		{ 130, 0, 0, 0, 0 }, { 0, 15, 1393, 1393, 0 }, { 132, 0, 0, 0, 0 }, { 0, 15, 1396, 1396, 0 }, { 0, 15, 1399, 1399, 0 }, { 0, 12, 0, 1402, 0 }, { 0, 15, 1406, 1406, 0 }, { 0, 12, 0, 1409, 0 },
+		{ 0, 15, 1413, 1413, 0 }, { 0, 15, 1416, 1416, 0 }, { 0, 15, 1419, 1419, 0 }, { 0, 15, 1422, 1422, 0 }, { 0, 15, 1425, 1425, 0 }, { 0, 15, 1428, 1428, 0 }, { 0, 15, 1431, 1431, 0 }, { 0, 0, 0, 0, 1524 },
+		{ 0, 10, 1434, 1434, 0 }, { 0, 12, 0, 1437, 0 }, { 0, 0, 0, 0, 1527 }, { 0, 10, 1439, 1439, 0 }, { 0, 0, 0, 0, 1530 }, { 0, 10, 1442, 1442, 0 }, { 0, 0, 0, 0, 1533 }, { 0, 10, 1445, 1445, 0 },
+		{ 0, 0, 0, 0, 1536 }, { 0, 10, 1448, 1448, 0 }, { 0, 0, 0, 0, 1539 }, { 0, 10, 1451, 1451, 0 }, { 0, 0, 0, 0, 1542 }, { 0, 10, 1454, 1454, 0 }, { 0, 0, 0, 0, 1545 }, { 0, 10, 1457, 1457, 0 },
+		{ 0, 0, 0, 0, 1548 }, { 0, 10, 1460, 1460, 0 }, { 0, 0, 0, 0, 1551 }, { 0, 0, 0, 0, 1554 }, { 0, 10, 1463, 1463, 0 }, { 0, 10, 1466, 1466, 0 }, { 0, 0, 0, 0, 1557 }, { 0, 10, 1469, 1469, 0 },
+		{ 0, 12, 0, 1472, 0 }, { 0, 12, 0, 1474, 0 }, { 0, 12, 0, 1476, 0 }, { 0, 12, 0, 1478, 0 }, { 0, 12, 0, 1480, 0 }, { 0, 12, 0, 1482, 0 }, { 0, 12, 0, 1484, 0 }, { 0, 12, 0, 1486, 0 },
+		{ 0, 12, 0, 1488, 0 }, { 0, 12, 0, 1490, 0 }, { 0, 12, 0, 1492, 0 }, { 0, 12, 0, 1494, 0 }, { 0, 12, 0, 1496, 0 }, { 0, 12, 0, 1498, 0 }, { 0, 12, 0, 1500, 0 }, { 0, 12, 0, 1502, 0 },
+		{ 0, 12, 0, 1504, 0 }, { 0, 12, 0, 1506, 0 }, { 0, 12, 0, 1508, 0 }, { 0, 12, 0, 1510, 0 }, { 0, 12, 0, 1512, 0 }, { 0, 12, 0, 1514, 0 }, { 0, 12, 0, 1516, 0 }, { 0, 12, 0, 1518, 0 },
+		{ 0, 12, 0, 1520, 0 }, { 0, 12, 0, 1522, 0 }, { 0, 12, 0, 1524, 0 }, { 0, 12, 0, 1526, 0 }, { 0, 12, 0, 1528, 0 }, { 0, 12, 0, 1530, 0 }, { 0, 12, 0, 1532, 0 }, { 0, 12, 0, 1534, 0 },
+		{ 0, 12, 0, 1536, 0 }, { 0, 12, 0, 1538, 0 }, { 0, 12, 0, 1540, 0 }, { 0, 12, 0, 1542, 0 }, { 0, 12, 0, 1544, 0 }, { 0, 12, 0, 1546, 0 }, { 0, 12, 0, 1548, 0 }, { 0, 12, 0, 1550, 0 },
+		{ 0, 12, 0, 1552, 0 }, { 0, 12, 0, 1554, 0 }, { 0, 12, 0, 1556, 0 }, { 0, 12, 0, 1558, 0 }, { 0, 12, 0, 1560, 0 }, { 0, 12, 0, 1562, 0 }, { 0, 12, 0, 1564, 0 }, { 0, 12, 0, 1566, 0 },
+		{ 0, 12, 0, 1568, 0 }, { 0, 12, 0, 1570, 0 }, { 0, 12, 0, 1572, 0 }, { 0, 12, 0, 1574, 0 }, { 0, 12, 0, 1576, 0 }, { 0, 12, 0, 1578, 0 }, { 0, 12, 0, 1580, 0 }, { 0, 12, 0, 1582, 0 },
+		{ 0, 12, 0, 1584, 0 }, { 0, 12, 0, 1586, 0 }, { 0, 12, 0, 1588, 0 }, { 0, 12, 0, 1590, 0 }, { 0, 12, 0, 1592, 0 }, { 0, 12, 0, 1594, 0 }, { 0, 12, 0, 1596, 0 }, { 0, 12, 0, 1598, 0 },
+		{ 0, 12, 0, 1600, 0 }, { 0, 12, 0, 1602, 0 }, { 0, 12, 0, 1604, 0 }, { 0, 12, 0, 1606, 0 }, { 0, 12, 0, 1608, 0 }, { 0, 12, 0, 1610, 0 }, { 0, 12, 0, 1612, 0 }, { 0, 12, 0, 1614, 0 },
+		{ 0, 12, 0, 1616, 0 }, { 0, 12, 0, 1618, 0 }, { 0, 12, 0, 1620, 0 }, { 0, 12, 0, 1622, 0 }, { 0, 12, 0, 1624, 0 }, { 0, 12, 0, 1626, 0 }, { 0, 12, 0, 1628, 0 }, { 0, 12, 0, 1630, 0 },
+		{ 0, 12, 0, 1632, 0 }, { 0, 12, 0, 1634, 0 }, { 0, 12, 0, 1636, 0 }, { 0, 12, 0, 1638, 0 }, { 214, 0, 0, 0, 0 }, { 218, 0, 0, 0, 0 }, { 0, 10, 1640, 1640, 0 }, { 0, 10, 1643, 1643, 0 },
+		{ 0, 10, 1646, 1646, 0 }, { 0, 10, 1649, 1649, 0 }, { 0, 10, 1652, 1652, 0 }, { 0, 10, 1655, 1655, 0 }, { 0, 10, 1658, 1658, 0 }, { 0, 10, 1661, 1661, 0 }, { 0, 10, 1664, 1664, 0 }, { 0, 10, 1668, 1668, 0 },
+		{ 0, 10, 1672, 1672, 0 }, { 0, 10, 1675, 1675, 0 }, { 0, 10, 1678, 1678, 0 }, { 0, 10, 1681, 1681, 0 }, { 0, 10, 1684, 1684, 0 }, { 0, 10, 1687, 1687, 0 }, { 0, 10, 1690, 1690, 0 }, { 0, 10, 1693, 1693, 0 },
+		{ 0, 10, 1696, 1696, 0 }, { 0, 10, 1699, 1699, 0 }, { 0, 10, 1702, 1702, 0 }, { 0, 10, 1706, 1706, 0 }, { 0, 10, 1710, 1710, 0 }, { 0, 10, 1714, 1714, 0 }, { 0, 10, 1718, 1718, 0 }, { 0, 10, 1721, 1721, 0 },
+		{ 0, 10, 1724, 1724, 0 }, { 0, 10, 1727, 1727, 0 }, { 0, 10, 1730, 1730, 0 }, { 0, 10, 1734, 1734, 0 }, { 0, 10, 1738, 1738, 0 }, { 0, 10, 1741, 1741, 0 }, { 0, 10, 1744, 1744, 0 }, { 0, 10, 1747, 1747, 0 },
+		{ 0, 10, 1750, 1750, 0 }, { 0, 10, 1753, 1753, 0 }, { 0, 10, 1756, 1756, 0 }, { 0, 10, 1759, 1759, 0 }, { 0, 10, 1762, 1762, 0 }, { 0, 10, 1765, 1765, 0 }, { 0, 10, 1768, 1768, 0 }, { 0, 10, 1771, 1771, 0 },
+		{ 0, 10, 1774, 1774, 0 }, { 0, 10, 1777, 1777, 0 }, { 0, 10, 1780, 1780, 0 }, { 0, 10, 1783, 1783, 0 }, { 0, 10, 1786, 1786, 0 }, { 0, 10, 1790, 1790, 0 }, { 0, 10, 1794, 1794, 0 }, { 0, 10, 1797, 1797, 0 },
+		{ 0, 10, 1800, 1800, 0 }, { 0, 10, 1803, 1803, 0 }, { 0, 10, 1806, 1806, 0 }, { 0, 10, 1809, 1809, 0 }, { 0, 10, 1812, 1812, 1560 }, { 0, 10, 1815, 1815, 1563 }, { 0, 10, 1818, 1818, 0 }, { 0, 10, 1822, 1822, 0 },
+		{ 0, 10, 1826, 1826, 0 }, { 0, 10, 1829, 1829, 0 }, { 0, 10, 1832, 1832, 0 }, { 0, 10, 1835, 1835, 0 }, { 0, 10, 1838, 1838, 0 }, { 0, 10, 1841, 1841, 0 }, { 0, 10, 1844, 1844, 0 }, { 0, 10, 1847, 1847, 0 },
+		{ 0, 10, 1850, 1850, 0 }, { 0, 10, 1853, 1853, 0 }, { 0, 10, 1856, 1856, 0 }, { 0, 10, 1859, 1859, 0 }, { 0, 10, 1862, 1862, 0 }, { 0, 10, 1865, 1865, 0 }, { 0, 10, 1868, 1868, 0 }, { 0, 10, 1871, 1871, 0 },
+		{ 0, 10, 1874, 1874, 0 }, { 0, 10, 1877, 1877, 0 }, { 0, 10, 1880, 1880, 0 }, { 0, 10, 1884, 1884, 0 }, { 0, 10, 1888, 1888, 0 }, { 0, 10, 1892, 1892, 0 }, { 0, 10, 1896, 1896, 0 }, { 0, 10, 1900, 1900, 0 },
+		{ 0, 10, 1904, 1904, 0 }, { 0, 10, 1908, 1908, 0 }, { 0, 10, 1912, 1912, 0 }, { 0, 10, 1915, 1915, 0 }, { 0, 10, 1918, 1918, 0 }, { 0, 10, 1921, 1921, 0 }, { 0, 10, 1924, 1924, 0 }, { 0, 10, 1927, 1927, 0 },
+		{ 0, 10, 1930, 1930, 1566 }, { 0, 10, 1933, 1933, 1569 }, { 0, 10, 1936, 1936, 0 }, { 0, 10, 1940, 1940, 0 }, { 0, 10, 1944, 1944, 0 }, { 0, 10, 1947, 1947, 0 }, { 0, 10, 1950, 1950, 0 }, { 0, 10, 1953, 1953, 0 },
+		{ 0, 10, 1956, 1956, 1572 }, { 0, 10, 1959, 1959, 1575 }, { 0, 10, 1962, 1962, 0 }, { 0, 10, 1966, 1966, 0 }, { 0, 10, 1970, 1970, 0 }, { 0, 10, 1974, 1974, 0 }, { 0, 10, 1978, 1978, 0 }, { 0, 10, 1982, 1982, 0 },
+		{ 0, 10, 1986, 1986, 0 }, { 0, 10, 1989, 1989, 0 }, { 0, 10, 1992, 1992, 0 }, { 0, 10, 1995, 1995, 0 }, { 0, 10, 1998, 1998, 0 }, { 0, 10, 2001, 2001, 0 }, { 0, 10, 2004, 2004, 0 }, { 0, 10, 2007, 2007, 0 },
+		{ 0, 10, 2010, 2010, 0 }, { 0, 10, 2013, 2013, 0 }, { 0, 10, 2016, 2016, 0 }, { 0, 10, 2019, 2019, 0 }, { 0, 10, 2022, 2022, 0 }, { 0, 10, 2025, 2025, 0 }, { 0, 10, 2028, 2028, 0 }, { 0, 10, 2032, 2032, 0 },
+		{ 0, 10, 2036, 2036, 0 }, { 0, 10, 2040, 2040, 0 }, { 0, 10, 2044, 2044, 0 }, { 0, 10, 2047, 2047, 0 }, { 0, 10, 2050, 2050, 0 }, { 0, 10, 2053, 2053, 0 }, { 0, 10, 2056, 2056, 0 }, { 0, 10, 2059, 2059, 0 },
+		{ 0, 10, 2062, 2062, 0 }, { 0, 10, 2065, 2065, 0 }, { 0, 10, 2068, 2068, 0 }, { 0, 10, 2071, 2071, 0 }, { 0, 10, 2074, 2074, 0 }, { 0, 10, 2077, 2077, 0 }, { 0, 10, 2080, 2080, 0 }, { 0, 10, 2083, 2083, 0 },
+		{ 0, 10, 2086, 2086, 0 }, { 0, 10, 2089, 2089, 0 }, { 0, 10, 2092, 2092, 0 }, { 0, 10, 2095, 2095, 0 }, { 0, 10, 2098, 2098, 0 }, { 0, 10, 2101, 2101, 0 }, { 0, 10, 2104, 2104, 0 }, { 0, 10, 2107, 2107, 0 },
+		{ 0, 10, 2110, 2110, 0 }, { 0, 10, 2113, 2113, 0 }, { 0, 10, 2116, 2116, 0 }, { 0, 10, 2119, 2119, 0 }, { 0, 10, 2122, 2122, 0 }, { 0, 10, 2125, 2125, 0 }, { 0, 10, 2128, 2128, 0 }, { 0, 10, 2131, 2131, 0 },
+		{ 0, 12, 0, 2134, 0 }, { 0, 14, 2137, 1953, 0 }, { 0, 10, 2140, 2140, 1578 }, { 0, 10, 2143, 2143, 1583 }, { 0, 10, 2146, 2146, 0 }, { 0, 10, 2149, 2149, 0 }, { 0, 10, 2152, 2152, 0 }, { 0, 10, 2156, 2156, 0 },
+		{ 0, 10, 2160, 2160, 0 }, { 0, 10, 2164, 2164, 0 }, { 0, 10, 2168, 2168, 0 }, { 0, 10, 2172, 2172, 0 }, { 0, 10, 2176, 2176, 0 }, { 0, 10, 2180, 2180, 0 }, { 0, 10, 2184, 2184, 0 }, { 0, 10, 2188, 2188, 0 },
+		{ 0, 10, 2192, 2192, 0 }, { 0, 10, 2196, 2196, 0 }, { 0, 10, 2200, 2200, 0 }, { 0, 10, 2204, 2204, 0 }, { 0, 10, 2208, 2208, 0 }, { 0, 10, 2212, 2212, 0 }, { 0, 10, 2216, 2216, 0 }, { 0, 10, 2220, 2220, 0 },
+		{ 0, 10, 2224, 2224, 0 }, { 0, 10, 2228, 2228, 0 }, { 0, 10, 2232, 2232, 1588 }, { 0, 10, 2235, 2235, 1591 }, { 0, 10, 2238, 2238, 0 }, { 0, 10, 2241, 2241, 0 }, { 0, 10, 2244, 2244, 0 }, { 0, 10, 2247, 2247, 0 },
+		{ 0, 10, 2250, 2250, 0 }, { 0, 10, 2254, 2254, 0 }, { 0, 10, 2258, 2258, 0 }, { 0, 10, 2262, 2262, 0 }, { 0, 10, 2266, 2266, 0 }, { 0, 10, 2270, 2270, 0 }, { 0, 10, 2274, 2274, 0 }, { 0, 10, 2278, 2278, 0 },
+		{ 0, 10, 2282, 2282, 0 }, { 0, 10, 2286, 2286, 0 }, { 0, 10, 2290, 2290, 0 }, { 0, 10, 2293, 2293, 0 }, { 0, 10, 2296, 2296, 0 }, { 0, 10, 2299, 2299, 0 }, { 0, 10, 2302, 2302, 1594 }, { 0, 10, 2305, 2305, 1597 },
+		{ 0, 10, 2308, 2308, 0 }, { 0, 10, 2311, 2311, 0 }, { 0, 10, 2314, 2314, 0 }, { 0, 10, 2318, 2318, 0 }, { 0, 10, 2322, 2322, 0 }, { 0, 10, 2326, 2326, 0 }, { 0, 10, 2330, 2330, 0 }, { 0, 10, 2334, 2334, 0 },
+		{ 0, 10, 2338, 2338, 0 }, { 0, 10, 2342, 2342, 0 }, { 0, 10, 2346, 2346, 0 }, { 0, 10, 2350, 2350, 0 }, { 0, 10, 2354, 2354, 0 }, { 0, 10, 2358, 2358, 0 }, { 0, 10, 2362, 2362, 0 }, { 0, 10, 2366, 2366, 0 },
+		{ 0, 10, 2370, 2370, 0 }, { 0, 10, 2374, 2374, 0 }, { 0, 10, 2378, 2378, 0 }, { 0, 10, 2382, 2382, 0 }, { 0, 10, 2386, 2386, 0 }, { 0, 10, 2390, 2390, 0 }, { 0, 10, 2394, 2394, 0 }, { 0, 10, 2397, 2397, 0 },
+		{ 0, 10, 2400, 2400, 0 }, { 0, 10, 2403, 2403, 0 }, { 0, 10, 2406, 2406, 0 }, { 0, 10, 2410, 2410, 0 }, { 0, 10, 2414, 2414, 0 }, { 0, 10, 2418, 2418, 0 }, { 0, 10, 2422, 2422, 0 }, { 0, 10, 2426, 2426, 0 },
+		{ 0, 10, 2430, 2430, 0 }, { 0, 10, 2434, 2434, 0 }, { 0, 10, 2438, 2438, 0 }, { 0, 10, 2442, 2442, 0 }, { 0, 10, 2446, 2446, 0 }, { 0, 10, 2449, 2449, 0 }, { 0, 10, 2452, 2452, 0 }, { 0, 10, 2455, 2455, 0 },
+		{ 0, 10, 2458, 2458, 0 }, { 0, 10, 2461, 2461, 0 }, { 0, 10, 2464, 2464, 0 }, { 0, 10, 2467, 2467, 0 }, { 0, 10, 2470, 2470, 1600 }, { 0, 10, 2473, 2473, 1609 }, { 0, 10, 2476, 2476, 1618 }, { 0, 10, 2480, 2480, 1621 },
+		{ 0, 10, 2484, 2484, 1624 }, { 0, 10, 2488, 2488, 1627 }, { 0, 10, 2492, 2492, 1630 }, { 0, 10, 2496, 2496, 1633 }, { 0, 10, 2500, 2500, 1636 }, { 0, 10, 2503, 2503, 1645 }, { 0, 10, 2506, 2506, 1654 }, { 0, 10, 2510, 2510, 1657 },
+		{ 0, 10, 2514, 2514, 1660 }, { 0, 10, 2518, 2518, 1663 }, { 0, 10, 2522, 2522, 1666 }, { 0, 10, 2526, 2526, 1669 }, { 0, 10, 2530, 2530, 1672 }, { 0, 10, 2533, 2533, 1677 }, { 0, 10, 2536, 2536, 0 }, { 0, 10, 2540, 2540, 0 },
+		{ 0, 10, 2544, 2544, 0 }, { 0, 10, 2548, 2548, 0 }, { 0, 10, 2552, 2552, 1682 }, { 0, 10, 2555, 2555, 1687 }, { 0, 10, 2558, 2558, 0 }, { 0, 10, 2562, 2562, 0 }, { 0, 10, 2566, 2566, 0 }, { 0, 10, 2570, 2570, 0 },
+		{ 0, 10, 2574, 2574, 1692 }, { 0, 10, 2577, 2577, 1701 }, { 0, 10, 2580, 2580, 1710 }, { 0, 10, 2584, 2584, 1713 }, { 0, 10, 2588, 2588, 1716 }, { 0, 10, 2592, 2592, 1719 }, { 0, 10, 2596, 2596, 1722 }, { 0, 10, 2600, 2600, 1725 },
+		{ 0, 10, 2604, 2604, 1728 }, { 0, 10, 2607, 2607, 1737 }, { 0, 10, 2610, 2610, 1746 }, { 0, 10, 2614, 2614, 1749 }, { 0, 10, 2618, 2618, 1752 }, { 0, 10, 2622, 2622, 1755 }, { 0, 10, 2626, 2626, 1758 }, { 0, 10, 2630, 2630, 1761 },
+		{ 0, 10, 2634, 2634, 1764 }, { 0, 10, 2637, 2637, 1771 }, { 0, 10, 2640, 2640, 0 }, { 0, 10, 2644, 2644, 0 }, { 0, 10, 2648, 2648, 0 }, { 0, 10, 2652, 2652, 0 }, { 0, 10, 2656, 2656, 0 }, { 0, 10, 2660, 2660, 0 },
+		{ 0, 10, 2664, 2664, 1778 }, { 0, 10, 2667, 2667, 1785 }, { 0, 10, 2670, 2670, 0 }, { 0, 10, 2674, 2674, 0 }, { 0, 10, 2678, 2678, 0 }, { 0, 10, 2682, 2682, 0 }, { 0, 10, 2686, 2686, 0 }, { 0, 10, 2690, 2690, 0 },
+		{ 0, 10, 2694, 2694, 1792 }, { 0, 10, 2697, 2697, 1797 }, { 0, 10, 2700, 2700, 0 }, { 0, 10, 2704, 2704, 0 }, { 0, 10, 2708, 2708, 0 }, { 0, 10, 2712, 2712, 0 }, { 0, 10, 2716, 2716, 1802 }, { 0, 10, 2719, 2719, 1807 },
+		{ 0, 10, 2722, 2722, 0 }, { 0, 10, 2726, 2726, 0 }, { 0, 10, 2730, 2730, 0 }, { 0, 10, 2734, 2734, 0 }, { 0, 10, 2738, 2738, 1812 }, { 0, 10, 2741, 2741, 1819 }, { 0, 10, 2744, 2744, 0 }, { 0, 10, 2748, 2748, 0 },
+		{ 0, 10, 2752, 2752, 0 }, { 0, 10, 2756, 2756, 0 }, { 0, 10, 2760, 2760, 0 }, { 0, 10, 2764, 2764, 0 }, { 0, 10, 2768, 2768, 1826 }, { 0, 10, 2771, 2771, 0 }, { 0, 10, 2775, 2775, 0 }, { 0, 10, 2779, 2779, 0 },
+		{ 0, 10, 2783, 2783, 1833 }, { 0, 10, 2786, 2786, 1842 }, { 0, 10, 2789, 2789, 1851 }, { 0, 10, 2793, 2793, 1854 }, { 0, 10, 2797, 2797, 1857 }, { 0, 10, 2801, 2801, 1860 }, { 0, 10, 2805, 2805, 1863 }, { 0, 10, 2809, 2809, 1866 },
+		{ 0, 10, 2813, 2813, 1869 }, { 0, 10, 2816, 2816, 1878 }, { 0, 10, 2819, 2819, 1887 }, { 0, 10, 2823, 2823, 1890 }, { 0, 10, 2827, 2827, 1893 }, { 0, 10, 2831, 2831, 1896 }, { 0, 10, 2835, 2835, 1899 }, { 0, 10, 2839, 2839, 1902 },
+		{ 0, 10, 2843, 2843, 1905 }, { 0, 15, 973, 973, 0 }, { 0, 10, 2846, 2846, 0 }, { 0, 15, 976, 976, 0 }, { 0, 10, 2849, 2849, 1908 }, { 0, 15, 979, 979, 0 }, { 0, 10, 2852, 2852, 0 }, { 0, 15, 982, 982, 0 },
+		{ 0, 10, 2855, 2855, 0 }, { 0, 15, 995, 995, 0 }, { 0, 10, 2858, 2858, 0 }, { 0, 15, 998, 998, 0 }, { 0, 10, 2861, 2861, 1911 }, { 0, 15, 1001, 1001, 0 }, { 0, 10, 2864, 2864, 0 }, { 0, 10, 2868, 2868, 0 },
+		{ 0, 10, 2872, 2872, 0 }, { 0, 10, 2877, 2877, 0 }, { 0, 10, 2882, 2882, 0 }, { 0, 10, 2887, 2887, 0 }, { 0, 10, 2892, 2892, 0 }, { 0, 10, 2897, 2897, 0 }, { 0, 10, 2902, 2902, 0 }, { 0, 10, 2906, 2906, 0 },
+		{ 0, 10, 2910, 2910, 0 }, { 0, 10, 2915, 2915, 0 }, { 0, 10, 2920, 2920, 0 }, { 0, 10, 2925, 2925, 0 }, { 0, 10, 2930, 2930, 0 }, { 0, 10, 2935, 2935, 0 }, { 0, 10, 2940, 2940, 0 }, { 0, 10, 2944, 2944, 0 },
+		{ 0, 10, 2948, 2948, 0 }, { 0, 10, 2953, 2953, 0 }, { 0, 10, 2958, 2958, 0 }, { 0, 10, 2963, 2963, 0 }, { 0, 10, 2968, 2968, 0 }, { 0, 10, 2973, 2973, 0 }, { 0, 10, 2978, 2978, 0 }, { 0, 10, 2982, 2982, 0 },
+		{ 0, 10, 2986, 2986, 0 }, { 0, 10, 2991, 2991, 0 }, { 0, 10, 2996, 2996, 0 }, { 0, 10, 3001, 3001, 0 }, { 0, 10, 3006, 3006, 0 }, { 0, 10, 3011, 3011, 0 }, { 0, 10, 3016, 3016, 0 }, { 0, 10, 3020, 3020, 0 },
+		{ 0, 10, 3024, 3024, 0 }, { 0, 10, 3029, 3029, 0 }, { 0, 10, 3034, 3034, 0 }, { 0, 10, 3039, 3039, 0 }, { 0, 10, 3044, 3044, 0 }, { 0, 10, 3049, 3049, 0 }, { 0, 10, 3054, 3054, 0 }, { 0, 10, 3058, 3058, 0 },
+		{ 0, 10, 3062, 3062, 0 }, { 0, 10, 3067, 3067, 0 }, { 0, 10, 3072, 3072, 0 }, { 0, 10, 3077, 3077, 0 }, { 0, 10, 3082, 3082, 0 }, { 0, 10, 3087, 3087, 0 }, { 0, 10, 3092, 3092, 0 }, { 0, 10, 3095, 3095, 0 },
+		{ 0, 10, 3098, 3098, 0 }, { 0, 10, 3102, 3102, 0 }, { 0, 10, 3105, 3105, 0 }, { 0, 10, 3109, 3109, 1914 }, { 0, 10, 3112, 3112, 0 }, { 0, 10, 3116, 3116, 0 }, { 0, 10, 3119, 3119, 0 }, { 0, 10, 3122, 3122, 0 },
+		{ 0, 15, 940, 940, 0 }, { 0, 10, 3125, 3125, 0 }, { 0, 12, 0, 3128, 0 }, { 0, 15, 3131, 3131, 0 }, { 0, 12, 0, 3128, 1917 }, { 0, 12, 0, 3133, 0 }, { 0, 14, 3136, 3139, 0 }, { 0, 10, 3143, 3143, 0 },
+		{ 0, 10, 3147, 3147, 0 }, { 0, 10, 3150, 3150, 0 }, { 0, 10, 3154, 3154, 1924 }, { 0, 10, 3157, 3157, 0 }, { 0, 10, 3161, 3161, 0 }, { 0, 15, 945, 945, 0 }, { 0, 10, 3164, 3164, 0 }, { 0, 15, 948, 948, 0 },
+		{ 0, 10, 3167, 3167, 0 }, { 0, 14, 3170, 3173, 0 }, { 0, 14, 3177, 3180, 0 }, { 0, 14, 3184, 3187, 0 }, { 0, 10, 3191, 3191, 0 }, { 0, 10, 3194, 3194, 0 }, { 0, 10, 3197, 3197, 0 }, { 0, 15, 963, 963, 0 },
+		{ 0, 10, 3201, 3201, 0 }, { 0, 10, 3204, 3204, 0 }, { 0, 10, 3208, 3208, 0 }, { 0, 10, 3211, 3211, 0 }, { 0, 10, 3214, 3214, 0 }, { 0, 15, 951, 951, 0 }, { 0, 14, 3217, 3220, 0 }, { 0, 14, 3224, 3227, 0 },
+		{ 0, 14, 3231, 3234, 0 }, { 0, 10, 3238, 3238, 0 }, { 0, 10, 3241, 3241, 0 }, { 0, 10, 3244, 3244, 0 }, { 0, 15, 985, 985, 0 }, { 0, 10, 3248, 3248, 0 }, { 0, 10, 3251, 3251, 0 }, { 0, 10, 3254, 3254, 0 },
+		{ 0, 10, 3257, 3257, 0 }, { 0, 10, 3261, 3261, 0 }, { 0, 10, 3264, 3264, 0 }, { 0, 10, 3267, 3267, 0 }, { 0, 15, 957, 957, 0 }, { 0, 10, 3270, 3270, 0 }, { 0, 14, 3273, 3276, 0 }, { 0, 15, 933, 936, 0 },
+		{ 0, 15, 3280, 3280, 0 }, { 0, 10, 3282, 3282, 0 }, { 0, 10, 3286, 3286, 0 }, { 0, 10, 3289, 3289, 0 }, { 0, 10, 3293, 3293, 1927 }, { 0, 10, 3296, 3296, 0 }, { 0, 10, 3300, 3300, 0 }, { 0, 15, 954, 954, 0 },
+		{ 0, 10, 3303, 3303, 0 }, { 0, 15, 960, 960, 0 }, { 0, 10, 3306, 3306, 0 }, { 0, 15, 3309, 15, 0 }, { 0, 12, 0, 3311, 1930 }, { 0, 15, 3314, 1, 0 }, { 0, 15, 3316, 1, 0 }, { 0, 12, 0, 3318, 0 },
+		{ 0, 12, 0, 3320, 0 }, { 0, 12, 0, 3323, 0 }, { 0, 12, 0, 3325, 0 }, { 0, 12, 0, 3328, 0 }, { 0, 12, 0, 3332, 0 }, { 0, 12, 0, 3335, 0 }, { 0, 12, 0, 3339, 0 }, { 0, 12, 0, 3342, 0 },
+		{ 0, 12, 0, 3346, 0 }, { 0, 12, 0, 3349, 0 }, { 0, 12, 0, 3352, 0 }, { 0, 12, 0, 3355, 0 }, { 0, 12, 0, 3358, 0 }, { 0, 12, 0, 3361, 0 }, { 0, 12, 0, 3366, 0 }, { 0, 12, 0, 3368, 0 },
+		{ 0, 12, 0, 3370, 0 }, { 0, 12, 0, 3372, 0 }, { 0, 12, 0, 3374, 0 }, { 0, 12, 0, 3376, 0 }, { 0, 12, 0, 3378, 0 }, { 0, 12, 0, 3380, 0 }, { 0, 12, 0, 3382, 0 }, { 0, 12, 0, 3384, 0 },
+		{ 0, 12, 0, 3386, 0 }, { 0, 12, 0, 3388, 0 }, { 0, 12, 0, 3390, 0 }, { 0, 12, 0, 3392, 0 }, { 0, 12, 0, 3395, 0 }, { 0, 12, 0, 3399, 0 }, { 0, 12, 0, 3403, 0 }, { 0, 12, 0, 3405, 0 },
+		{ 0, 12, 0, 3408, 0 }, { 0, 12, 0, 3412, 0 }, { 0, 12, 0, 3416, 0 }, { 0, 12, 0, 3418, 0 }, { 0, 12, 0, 3421, 0 }, { 0, 12, 0, 3423, 0 }, { 0, 12, 0, 3426, 0 }, { 0, 12, 0, 3428, 0 },
+		{ 0, 12, 0, 3431, 0 }, { 0, 12, 0, 3435, 0 }, { 0, 12, 0, 3438, 0 }, { 0, 15, 3440, 3440, 0 }, { 0, 15, 1492, 1492, 0 }, { 0, 15, 54, 54, 0 }, { 0, 12, 0, 3442, 0 }, { 0, 12, 0, 3444, 0 },
+		{ 0, 12, 0, 3446, 0 }, { 0, 12, 0, 3448, 0 }, { 0, 12, 0, 3450, 0 }, { 0, 12, 0, 3452, 0 }, { 0, 12, 0, 3456, 0 }, { 0, 12, 0, 3458, 0 }, { 0, 12, 0, 3460, 0 }, { 0, 12, 0, 3462, 0 },
+		{ 0, 12, 0, 3466, 0 }, { 0, 12, 0, 3470, 0 }, { 0, 12, 0, 3475, 0 }, { 0, 12, 0, 3479, 0 }, { 0, 12, 0, 3483, 0 }, { 0, 12, 0, 3487, 0 }, { 0, 12, 0, 3491, 0 }, { 0, 12, 0, 3495, 0 },
+		{ 0, 12, 0, 3499, 0 }, { 0, 12, 0, 3503, 0 }, { 0, 12, 0, 3507, 0 }, { 0, 12, 0, 3511, 0 }, { 0, 12, 0, 3515, 0 }, { 0, 12, 0, 3519, 0 }, { 0, 12, 0, 3523, 0 }, { 0, 12, 0, 3526, 0 },
+		{ 0, 12, 0, 3529, 0 }, { 0, 12, 0, 3533, 0 }, { 0, 12, 0, 3536, 0 }, { 0, 12, 0, 3538, 0 }, { 0, 12, 0, 3541, 0 }, { 0, 12, 0, 3545, 0 }, { 0, 12, 0, 3550, 0 }, { 0, 12, 0, 3553, 0 },
+		{ 0, 12, 0, 3555, 0 }, { 0, 12, 0, 3558, 0 }, { 0, 12, 0, 3562, 0 }, { 0, 12, 0, 3565, 0 }, { 0, 12, 0, 3569, 0 }, { 0, 12, 0, 3572, 0 }, { 0, 12, 0, 3575, 0 }, { 0, 12, 0, 3579, 0 },
+		{ 0, 12, 0, 3584, 0 }, { 0, 12, 0, 3587, 0 }, { 0, 12, 0, 3590, 0 }, { 0, 12, 0, 3594, 0 }, { 0, 0, 0, 0, 1937 }, { 0, 0, 0, 0, 1940 }, { 0, 0, 0, 0, 1943 }, { 0, 10, 3598, 3598, 0 },
+		{ 0, 10, 3601, 3601, 0 }, { 0, 10, 3604, 3604, 0 }, { 0, 10, 3607, 3607, 0 }, { 0, 10, 3610, 3610, 0 }, { 0, 10, 3613, 3613, 0 }, { 0, 0, 0, 0, 1946 }, { 0, 0, 0, 0, 1949 }, { 0, 0, 0, 0, 1952 },
+		{ 0, 0, 0, 0, 1955 }, { 0, 10, 3616, 3616, 0 }, { 0, 0, 0, 0, 1958 }, { 0, 10, 3619, 3619, 0 }, { 0, 0, 0, 0, 1961 }, { 0, 10, 3622, 3622, 0 }, { 0, 0, 0, 0, 1964 }, { 0, 10, 3625, 3625, 0 },
+		{ 0, 0, 0, 0, 1967 }, { 0, 10, 3628, 3628, 0 }, { 0, 12, 0, 3631, 0 }, { 0, 12, 0, 3634, 0 }, { 0, 12, 0, 3638, 0 }, { 0, 12, 0, 3641, 0 }, { 0, 0, 0, 0, 1970 }, { 0, 10, 3645, 3645, 0 },
+		{ 0, 0, 0, 0, 1973 }, { 0, 10, 3648, 3648, 0 }, { 0, 0, 0, 0, 1976 }, { 0, 10, 3651, 3651, 0 }, { 0, 0, 0, 0, 1979 }, { 0, 10, 3654, 3654, 0 }, { 0, 0, 0, 0, 1982 }, { 0, 10, 3657, 3657, 0 },
+		{ 0, 0, 0, 0, 1985 }, { 0, 10, 3660, 3660, 0 }, { 0, 0, 0, 0, 1988 }, { 0, 0, 0, 0, 1991 }, { 0, 10, 3663, 3663, 0 }, { 0, 10, 3666, 3666, 0 }, { 0, 10, 3669, 3669, 0 }, { 0, 10, 3672, 3672, 0 },
+		{ 0, 10, 3675, 3675, 0 }, { 0, 0, 0, 0, 1994 }, { 0, 0, 0, 0, 1997 }, { 0, 10, 3678, 3678, 0 }, { 0, 10, 3681, 3681, 0 }, { 0, 0, 0, 0, 2000 }, { 0, 0, 0, 0, 2003 }, { 0, 10, 3684, 3684, 0 },
+		{ 0, 10, 3687, 3687, 0 }, { 0, 0, 0, 0, 2006 }, { 0, 0, 0, 0, 2009 }, { 0, 0, 0, 0, 2012 }, { 0, 0, 0, 0, 2015 }, { 0, 10, 3690, 3690, 0 }, { 0, 10, 3693, 3693, 0 }, { 0, 0, 0, 0, 2018 },
+		{ 0, 0, 0, 0, 2021 }, { 0, 10, 3696, 3696, 0 }, { 0, 10, 3699, 3699, 0 }, { 0, 0, 0, 0, 2024 }, { 0, 0, 0, 0, 2027 }, { 0, 10, 3702, 3702, 0 }, { 0, 10, 3705, 3705, 0 }, { 0, 0, 0, 0, 2030 },
+		{ 0, 0, 0, 0, 2033 }, { 0, 0, 0, 0, 2036 }, { 0, 0, 0, 0, 2039 }, { 0, 0, 0, 0, 2042 }, { 0, 0, 0, 0, 2045 }, { 0, 10, 3708, 3708, 0 }, { 0, 10, 3711, 3711, 0 }, { 0, 10, 3714, 3714, 0 },
+		{ 0, 10, 3717, 3717, 0 }, { 0, 0, 0, 0, 2048 }, { 0, 0, 0, 0, 2051 }, { 0, 0, 0, 0, 2054 }, { 0, 0, 0, 0, 2057 }, { 0, 10, 3720, 3720, 0 }, { 0, 10, 3723, 3723, 0 }, { 0, 10, 3726, 3726, 0 },
+		{ 0, 10, 3729, 3729, 0 }, { 0, 10, 3732, 3732, 0 }, { 0, 10, 3735, 3735, 0 }, { 0, 10, 3738, 3738, 0 }, { 0, 10, 3741, 3741, 0 }, { 0, 15, 3744, 3744, 0 }, { 0, 15, 3746, 3746, 0 }, { 0, 12, 0, 3748, 0 },
+		{ 0, 12, 0, 3751, 0 }, { 0, 12, 0, 3754, 0 }, { 0, 12, 0, 3757, 0 }, { 0, 12, 0, 3760, 0 }, { 0, 12, 0, 3763, 0 }, { 0, 12, 0, 3766, 0 }, { 0, 12, 0, 3769, 0 }, { 0, 12, 0, 3772, 0 },
+		{ 0, 12, 0, 3775, 0 }, { 0, 12, 0, 3778, 0 }, { 0, 12, 0, 3781, 0 }, { 0, 12, 0, 3785, 0 }, { 0, 12, 0, 3789, 0 }, { 0, 12, 0, 3793, 0 }, { 0, 12, 0, 3797, 0 }, { 0, 12, 0, 3801, 0 },
+		{ 0, 12, 0, 3805, 0 }, { 0, 12, 0, 3809, 0 }, { 0, 12, 0, 3813, 0 }, { 0, 12, 0, 3817, 0 }, { 0, 12, 0, 3822, 0 }, { 0, 12, 0, 3827, 0 }, { 0, 12, 0, 3832, 0 }, { 0, 12, 0, 3837, 0 },
+		{ 0, 12, 0, 3842, 0 }, { 0, 12, 0, 3847, 0 }, { 0, 12, 0, 3852, 0 }, { 0, 12, 0, 3857, 0 }, { 0, 12, 0, 3862, 0 }, { 0, 12, 0, 3867, 0 }, { 0, 12, 0, 3872, 0 }, { 0, 12, 0, 3875, 0 },
+		{ 0, 12, 0, 3878, 0 }, { 0, 12, 0, 3881, 0 }, { 0, 12, 0, 3884, 0 }, { 0, 12, 0, 3887, 0 }, { 0, 12, 0, 3890, 0 }, { 0, 12, 0, 3893, 0 }, { 0, 12, 0, 3896, 0 }, { 0, 12, 0, 3899, 0 },
+		{ 0, 12, 0, 3903, 0 }, { 0, 12, 0, 3907, 0 }, { 0, 12, 0, 3911, 0 }, { 0, 12, 0, 3915, 0 }, { 0, 12, 0, 3919, 0 }, { 0, 12, 0, 3923, 0 }, { 0, 12, 0, 3927, 0 }, { 0, 12, 0, 3931, 0 },
+		{ 0, 12, 0, 3935, 0 }, { 0, 12, 0, 3939, 0 }, { 0, 12, 0, 3943, 0 }, { 0, 12, 0, 3947, 0 }, { 0, 12, 0, 3951, 0 }, { 0, 12, 0, 3955, 0 }, { 0, 12, 0, 3959, 0 }, { 0, 12, 0, 3963, 0 },
+		{ 0, 12, 0, 3967, 0 }, { 0, 12, 0, 3971, 0 }, { 0, 12, 0, 3975, 0 }, { 0, 12, 0, 3979, 0 }, { 0, 12, 0, 3983, 0 }, { 0, 12, 0, 3987, 0 }, { 0, 12, 0, 3991, 0 }, { 0, 12, 0, 3995, 0 },
+		{ 0, 12, 0, 3999, 0 }, { 0, 12, 0, 4003, 0 }, { 0, 12, 0, 4007, 0 }, { 0, 12, 0, 4011, 0 }, { 0, 12, 0, 4015, 0 }, { 0, 12, 0, 4019, 0 }, { 0, 12, 0, 4023, 0 }, { 0, 12, 0, 4027, 0 },
+		{ 0, 12, 0, 4031, 0 }, { 0, 12, 0, 4035, 0 }, { 0, 12, 0, 4039, 0 }, { 0, 12, 0, 4043, 0 }, { 0, 12, 0, 4047, 0 }, { 0, 12, 0, 4049, 0 }, { 0, 12, 0, 4051, 0 }, { 0, 12, 0, 4053, 0 },
+		{ 0, 12, 0, 4058, 0 }, { 0, 12, 0, 4062, 0 }, { 0, 12, 0, 4065, 0 }, { 0, 15, 4069, 4069, 0 }, { 0, 12, 0, 4072, 0 }, { 0, 12, 0, 4074, 0 }, { 0, 12, 0, 4076, 0 }, { 0, 12, 0, 4078, 0 },
+		{ 0, 12, 0, 4080, 0 }, { 0, 12, 0, 4082, 0 }, { 0, 12, 0, 4084, 0 }, { 0, 12, 0, 4086, 0 }, { 0, 12, 0, 4088, 0 }, { 0, 12, 0, 4090, 0 }, { 0, 12, 0, 4092, 0 }, { 0, 12, 0, 4094, 0 },
+		{ 0, 12, 0, 4096, 0 }, { 0, 12, 0, 4098, 0 }, { 0, 12, 0, 4100, 0 }, { 0, 12, 0, 4102, 0 }, { 0, 12, 0, 4104, 0 }, { 0, 12, 0, 4106, 0 }, { 0, 12, 0, 4108, 0 }, { 0, 12, 0, 4110, 0 },
+		{ 0, 12, 0, 4112, 0 }, { 0, 12, 0, 4114, 0 }, { 0, 12, 0, 4116, 0 }, { 0, 12, 0, 4118, 0 }, { 0, 12, 0, 4120, 0 }, { 0, 12, 0, 4122, 0 }, { 0, 12, 0, 4124, 0 }, { 0, 12, 0, 4126, 0 },
+		{ 0, 12, 0, 4128, 0 }, { 0, 12, 0, 4130, 0 }, { 0, 12, 0, 4132, 0 }, { 0, 12, 0, 4134, 0 }, { 0, 12, 0, 4136, 0 }, { 0, 12, 0, 4138, 0 }, { 0, 12, 0, 4140, 0 }, { 0, 12, 0, 4142, 0 },
+		{ 0, 12, 0, 4144, 0 }, { 0, 12, 0, 4146, 0 }, { 0, 12, 0, 4148, 0 }, { 0, 12, 0, 4150, 0 }, { 0, 12, 0, 4152, 0 }, { 0, 12, 0, 4154, 0 }, { 0, 12, 0, 4156, 0 }, { 0, 12, 0, 4158, 0 },
+		{ 0, 12, 0, 4160, 0 }, { 0, 12, 0, 4162, 0 }, { 0, 12, 0, 4164, 0 }, { 0, 12, 0, 4166, 0 }, { 0, 12, 0, 4168, 0 }, { 0, 12, 0, 4170, 0 }, { 0, 12, 0, 4172, 0 }, { 0, 12, 0, 4174, 0 },
+		{ 0, 12, 0, 4176, 0 }, { 0, 12, 0, 4178, 0 }, { 0, 12, 0, 4180, 0 }, { 0, 12, 0, 4182, 0 }, { 0, 12, 0, 4184, 0 }, { 0, 12, 0, 4186, 0 }, { 0, 12, 0, 4188, 0 }, { 0, 12, 0, 4190, 0 },
+		{ 0, 12, 0, 4192, 0 }, { 0, 12, 0, 4194, 0 }, { 0, 12, 0, 4196, 0 }, { 0, 12, 0, 4198, 0 }, { 0, 12, 0, 4200, 0 }, { 0, 12, 0, 4202, 0 }, { 0, 12, 0, 4204, 0 }, { 0, 12, 0, 4206, 0 },
+		{ 0, 12, 0, 4208, 0 }, { 0, 12, 0, 4210, 0 }, { 0, 12, 0, 4212, 0 }, { 0, 12, 0, 4214, 0 }, { 0, 12, 0, 4216, 0 }, { 0, 12, 0, 4218, 0 }, { 0, 12, 0, 4220, 0 }, { 0, 12, 0, 4222, 0 },
+		{ 0, 12, 0, 4224, 0 }, { 0, 12, 0, 4226, 0 }, { 0, 12, 0, 4228, 0 }, { 0, 12, 0, 4230, 0 }, { 0, 12, 0, 4232, 0 }, { 0, 12, 0, 4234, 0 }, { 0, 12, 0, 4236, 0 }, { 0, 12, 0, 4238, 0 },
+		{ 0, 12, 0, 4240, 0 }, { 0, 12, 0, 4242, 0 }, { 0, 12, 0, 4244, 0 }, { 0, 12, 0, 4246, 0 }, { 0, 12, 0, 4248, 0 }, { 0, 12, 0, 4250, 0 }, { 0, 12, 0, 4252, 0 }, { 0, 12, 0, 4254, 0 },
+		{ 0, 12, 0, 4256, 0 }, { 0, 12, 0, 4258, 0 }, { 0, 12, 0, 4260, 0 }, { 0, 12, 0, 4262, 0 }, { 0, 12, 0, 4264, 0 }, { 0, 12, 0, 4266, 0 }, { 0, 12, 0, 4268, 0 }, { 0, 12, 0, 4270, 0 },
+		{ 0, 12, 0, 4272, 0 }, { 0, 12, 0, 4274, 0 }, { 0, 12, 0, 4276, 0 }, { 0, 12, 0, 4278, 0 }, { 0, 12, 0, 4280, 0 }, { 0, 12, 0, 4282, 0 }, { 0, 12, 0, 4284, 0 }, { 0, 12, 0, 4286, 0 },
+		{ 0, 12, 0, 4288, 0 }, { 0, 12, 0, 4290, 0 }, { 0, 12, 0, 4292, 0 }, { 0, 12, 0, 4294, 0 }, { 0, 12, 0, 4296, 0 }, { 0, 12, 0, 4298, 0 }, { 0, 12, 0, 4300, 0 }, { 0, 12, 0, 4302, 0 },
+		{ 0, 12, 0, 4304, 0 }, { 0, 12, 0, 4306, 0 }, { 0, 12, 0, 4308, 0 }, { 0, 12, 0, 4310, 0 }, { 0, 12, 0, 4312, 0 }, { 0, 12, 0, 4314, 0 }, { 0, 12, 0, 4316, 0 }, { 0, 12, 0, 4318, 0 },
+		{ 0, 12, 0, 4320, 0 }, { 0, 12, 0, 4322, 0 }, { 0, 12, 0, 4324, 0 }, { 0, 12, 0, 4326, 0 }, { 0, 12, 0, 4328, 0 }, { 0, 12, 0, 4330, 0 }, { 0, 12, 0, 4332, 0 }, { 0, 12, 0, 4334, 0 },
+		{ 0, 12, 0, 4336, 0 }, { 0, 12, 0, 4338, 0 }, { 0, 12, 0, 4340, 0 }, { 0, 12, 0, 4342, 0 }, { 0, 12, 0, 4344, 0 }, { 0, 12, 0, 4346, 0 }, { 0, 12, 0, 4348, 0 }, { 0, 12, 0, 4350, 0 },
+		{ 0, 12, 0, 4352, 0 }, { 0, 12, 0, 4354, 0 }, { 0, 12, 0, 4356, 0 }, { 0, 12, 0, 4358, 0 }, { 0, 12, 0, 4360, 0 }, { 0, 12, 0, 4362, 0 }, { 0, 12, 0, 4364, 0 }, { 0, 12, 0, 4366, 0 },
+		{ 0, 12, 0, 4368, 0 }, { 0, 12, 0, 4370, 0 }, { 0, 12, 0, 4372, 0 }, { 0, 12, 0, 4374, 0 }, { 0, 12, 0, 4376, 0 }, { 0, 12, 0, 4378, 0 }, { 0, 12, 0, 4380, 0 }, { 0, 12, 0, 4382, 0 },
+		{ 0, 12, 0, 4384, 0 }, { 0, 12, 0, 4386, 0 }, { 0, 12, 0, 4388, 0 }, { 0, 12, 0, 4390, 0 }, { 0, 12, 0, 4392, 0 }, { 0, 12, 0, 4394, 0 }, { 0, 12, 0, 4396, 0 }, { 0, 12, 0, 4398, 0 },
+		{ 0, 12, 0, 4400, 0 }, { 0, 12, 0, 4402, 0 }, { 0, 12, 0, 4404, 0 }, { 0, 12, 0, 4406, 0 }, { 0, 12, 0, 4408, 0 }, { 0, 12, 0, 4410, 0 }, { 0, 12, 0, 4412, 0 }, { 0, 12, 0, 4414, 0 },
+		{ 0, 12, 0, 4416, 0 }, { 0, 12, 0, 4418, 0 }, { 0, 12, 0, 4420, 0 }, { 0, 12, 0, 4422, 0 }, { 0, 12, 0, 4424, 0 }, { 0, 12, 0, 4426, 0 }, { 0, 12, 0, 4428, 0 }, { 0, 12, 0, 4430, 0 },
+		{ 0, 12, 0, 4432, 0 }, { 0, 12, 0, 4434, 0 }, { 0, 12, 0, 4436, 0 }, { 0, 12, 0, 4438, 0 }, { 0, 12, 0, 4440, 0 }, { 0, 12, 0, 4442, 0 }, { 0, 12, 0, 4444, 0 }, { 0, 12, 0, 4446, 0 },
+		{ 0, 12, 0, 4448, 0 }, { 0, 12, 0, 4450, 0 }, { 0, 12, 0, 4452, 0 }, { 0, 12, 0, 4454, 0 }, { 0, 12, 0, 4456, 0 }, { 0, 12, 0, 4458, 0 }, { 0, 12, 0, 4460, 0 }, { 0, 12, 0, 4462, 0 },
+		{ 0, 12, 0, 4464, 0 }, { 0, 12, 0, 4466, 0 }, { 0, 12, 0, 4468, 0 }, { 0, 12, 0, 4470, 0 }, { 0, 12, 0, 4472, 0 }, { 0, 12, 0, 4474, 0 }, { 0, 12, 0, 4476, 0 }, { 0, 12, 0, 4478, 0 },
+		{ 0, 12, 0, 4480, 0 }, { 0, 12, 0, 4482, 0 }, { 0, 12, 0, 4484, 0 }, { 0, 12, 0, 4486, 0 }, { 0, 12, 0, 4488, 0 }, { 0, 12, 0, 4490, 0 }, { 0, 12, 0, 4492, 0 }, { 0, 12, 0, 4494, 0 },
+		{ 0, 12, 0, 4496, 0 }, { 0, 12, 0, 4498, 0 }, { 0, 12, 0, 4500, 0 }, { 0, 12, 0, 4502, 0 }, { 0, 12, 0, 4504, 0 }, { 224, 0, 0, 0, 0 }, { 0, 12, 0, 4506, 0 }, { 0, 12, 0, 4508, 0 },
+		{ 0, 12, 0, 4510, 0 }, { 0, 0, 0, 0, 2060 }, { 0, 0, 0, 0, 2063 }, { 0, 10, 4512, 4512, 0 }, { 0, 0, 0, 0, 2066 }, { 0, 10, 4515, 4515, 0 }, { 0, 0, 0, 0, 2069 }, { 0, 10, 4518, 4518, 0 },
+		{ 0, 0, 0, 0, 2072 }, { 0, 10, 4521, 4521, 0 }, { 0, 0, 0, 0, 2075 }, { 0, 10, 4524, 4524, 0 }, { 0, 0, 0, 0, 2078 }, { 0, 10, 4527, 4527, 0 }, { 0, 0, 0, 0, 2081 }, { 0, 10, 4530, 4530, 0 },
+		{ 0, 0, 0, 0, 2084 }, { 0, 10, 4533, 4533, 0 }, { 0, 0, 0, 0, 2087 }, { 0, 10, 4536, 4536, 0 }, { 0, 0, 0, 0, 2090 }, { 0, 10, 4539, 4539, 0 }, { 0, 0, 0, 0, 2093 }, { 0, 10, 4542, 4542, 0 },
+		{ 0, 0, 0, 0, 2096 }, { 0, 10, 4545, 4545, 0 }, { 0, 0, 0, 0, 2099 }, { 0, 10, 4548, 4548, 0 }, { 0, 0, 0, 0, 2102 }, { 0, 10, 4551, 4551, 0 }, { 0, 0, 0, 0, 2105 }, { 0, 10, 4554, 4554, 0 },
+		{ 0, 0, 0, 0, 2108 }, { 0, 10, 4557, 4557, 0 }, { 0, 10, 4560, 4560, 0 }, { 0, 0, 0, 0, 2113 }, { 0, 10, 4563, 4563, 0 }, { 0, 10, 4566, 4566, 0 }, { 0, 0, 0, 0, 2118 }, { 0, 10, 4569, 4569, 0 },
+		{ 0, 10, 4572, 4572, 0 }, { 0, 0, 0, 0, 2123 }, { 0, 10, 4575, 4575, 0 }, { 0, 10, 4578, 4578, 0 }, { 0, 0, 0, 0, 2128 }, { 0, 10, 4581, 4581, 0 }, { 0, 10, 4584, 4584, 0 }, { 0, 10, 4587, 4587, 0 },
+		{ 8, 5, 0, 0, 0 }, { 0, 12, 0, 4590, 0 }, { 0, 12, 0, 4593, 0 }, { 0, 0, 0, 0, 2133 }, { 0, 10, 4596, 4596, 0 }, { 0, 12, 0, 4599, 0 }, { 0, 0, 0, 0, 2136 }, { 0, 0, 0, 0, 2139 },
+		{ 0, 10, 4602, 4602, 0 }, { 0, 0, 0, 0, 2142 }, { 0, 10, 4605, 4605, 0 }, { 0, 0, 0, 0, 2145 }, { 0, 10, 4608, 4608, 0 }, { 0, 0, 0, 0, 2148 }, { 0, 10, 4611, 4611, 0 }, { 0, 0, 0, 0, 2151 },
+		{ 0, 10, 4614, 4614, 0 }, { 0, 0, 0, 0, 2154 }, { 0, 10, 4617, 4617, 0 }, { 0, 0, 0, 0, 2157 }, { 0, 10, 4620, 4620, 0 }, { 0, 0, 0, 0, 2160 }, { 0, 10, 4623, 4623, 0 }, { 0, 0, 0, 0, 2163 },
+		{ 0, 10, 4626, 4626, 0 }, { 0, 0, 0, 0, 2166 }, { 0, 10, 4629, 4629, 0 }, { 0, 0, 0, 0, 2169 }, { 0, 10, 4632, 4632, 0 }, { 0, 0, 0, 0, 2172 }, { 0, 10, 4635, 4635, 0 }, { 0, 0, 0, 0, 2175 },
+		{ 0, 10, 4638, 4638, 0 }, { 0, 0, 0, 0, 2178 }, { 0, 10, 4641, 4641, 0 }, { 0, 0, 0, 0, 2181 }, { 0, 10, 4644, 4644, 0 }, { 0, 0, 0, 0, 2184 }, { 0, 10, 4647, 4647, 0 }, { 0, 10, 4650, 4650, 0 },
+		{ 0, 0, 0, 0, 2189 }, { 0, 10, 4653, 4653, 0 }, { 0, 10, 4656, 4656, 0 }, { 0, 0, 0, 0, 2194 }, { 0, 10, 4659, 4659, 0 }, { 0, 10, 4662, 4662, 0 }, { 0, 0, 0, 0, 2199 }, { 0, 10, 4665, 4665, 0 },
+		{ 0, 10, 4668, 4668, 0 }, { 0, 0, 0, 0, 2204 }, { 0, 10, 4671, 4671, 0 }, { 0, 10, 4674, 4674, 0 }, { 0, 0, 0, 0, 2209 }, { 0, 0, 0, 0, 2212 }, { 0, 0, 0, 0, 2215 }, { 0, 0, 0, 0, 2218 },
+		{ 0, 10, 4677, 4677, 0 }, { 0, 10, 4680, 4680, 0 }, { 0, 10, 4683, 4683, 0 }, { 0, 10, 4686, 4686, 0 }, { 0, 10, 4689, 4689, 0 }, { 0, 0, 0, 0, 2221 }, { 0, 10, 4692, 4692, 0 }, { 0, 12, 0, 4695, 0 },
+		{ 0, 12, 0, 4698, 0 }, { 0, 12, 0, 4700, 0 }, { 0, 12, 0, 4702, 0 }, { 0, 12, 0, 4704, 0 }, { 0, 12, 0, 4706, 0 }, { 0, 12, 0, 4708, 0 }, { 0, 12, 0, 4710, 0 }, { 0, 12, 0, 4712, 0 },
+		{ 0, 12, 0, 4714, 0 }, { 0, 12, 0, 4716, 0 }, { 0, 12, 0, 4718, 0 }, { 0, 12, 0, 4720, 0 }, { 0, 12, 0, 4722, 0 }, { 0, 12, 0, 4724, 0 }, { 0, 12, 0, 4726, 0 }, { 0, 12, 0, 4728, 0 },
+		{ 0, 12, 0, 4730, 0 }, { 0, 12, 0, 4732, 0 }, { 0, 12, 0, 4734, 0 }, { 0, 12, 0, 4736, 0 }, { 0, 12, 0, 4738, 0 }, { 0, 12, 0, 4740, 0 }, { 0, 12, 0, 4742, 0 }, { 0, 12, 0, 4744, 0 },
+		{ 0, 12, 0, 4746, 0 }, { 0, 12, 0, 4748, 0 }, { 0, 12, 0, 4750, 0 }, { 0, 12, 0, 4752, 0 }, { 0, 12, 0, 4754, 0 }, { 0, 12, 0, 4756, 0 }, { 0, 12, 0, 4758, 0 }, { 0, 12, 0, 4760, 0 },
+		{ 0, 12, 0, 4762, 0 }, { 0, 12, 0, 4764, 0 }, { 0, 12, 0, 4766, 0 }, { 0, 12, 0, 4768, 0 }, { 0, 12, 0, 4770, 0 }, { 0, 12, 0, 4772, 0 }, { 0, 12, 0, 4774, 0 }, { 0, 12, 0, 4776, 0 },
+		{ 0, 12, 0, 4778, 0 }, { 0, 12, 0, 4780, 0 }, { 0, 12, 0, 4782, 0 }, { 0, 12, 0, 4784, 0 }, { 0, 12, 0, 4786, 0 }, { 0, 12, 0, 4788, 0 }, { 0, 12, 0, 4790, 0 }, { 0, 12, 0, 4792, 0 },
+		{ 0, 12, 0, 4794, 0 }, { 0, 12, 0, 4796, 0 }, { 0, 12, 0, 4798, 0 }, { 0, 12, 0, 4800, 0 }, { 0, 12, 0, 4802, 0 }, { 0, 12, 0, 4804, 0 }, { 0, 12, 0, 4806, 0 }, { 0, 12, 0, 4808, 0 },
+		{ 0, 12, 0, 4810, 0 }, { 0, 12, 0, 4812, 0 }, { 0, 12, 0, 4814, 0 }, { 0, 12, 0, 4816, 0 }, { 0, 12, 0, 4818, 0 }, { 0, 12, 0, 4820, 0 }, { 0, 12, 0, 4822, 0 }, { 0, 12, 0, 4824, 0 },
+		{ 0, 12, 0, 4826, 0 }, { 0, 12, 0, 4828, 0 }, { 0, 12, 0, 4830, 0 }, { 0, 12, 0, 4832, 0 }, { 0, 12, 0, 4834, 0 }, { 0, 12, 0, 4836, 0 }, { 0, 12, 0, 4838, 0 }, { 0, 12, 0, 4840, 0 },
+		{ 0, 12, 0, 4842, 0 }, { 0, 12, 0, 4844, 0 }, { 0, 12, 0, 4846, 0 }, { 0, 12, 0, 4848, 0 }, { 0, 12, 0, 4850, 0 }, { 0, 12, 0, 4852, 0 }, { 0, 12, 0, 4854, 0 }, { 0, 12, 0, 4856, 0 },
+		{ 0, 12, 0, 4858, 0 }, { 0, 12, 0, 4860, 0 }, { 0, 12, 0, 4862, 0 }, { 0, 12, 0, 4864, 0 }, { 0, 12, 0, 4866, 0 }, { 0, 12, 0, 4868, 0 }, { 0, 12, 0, 4870, 0 }, { 0, 12, 0, 4872, 0 },
+		{ 0, 12, 0, 4874, 0 }, { 0, 12, 0, 4876, 0 }, { 0, 12, 0, 4878, 0 }, { 0, 12, 0, 4880, 0 }, { 0, 12, 0, 4882, 0 }, { 0, 12, 0, 4884, 0 }, { 0, 12, 0, 4886, 0 }, { 0, 12, 0, 4888, 0 },
+		{ 0, 12, 0, 4890, 0 }, { 0, 12, 0, 4892, 0 }, { 0, 12, 0, 4894, 0 }, { 0, 12, 0, 4896, 0 }, { 0, 12, 0, 4898, 0 }, { 0, 12, 0, 4900, 0 }, { 0, 12, 0, 4902, 0 }, { 0, 12, 0, 4904, 0 },
+		{ 0, 12, 0, 4906, 0 }, { 0, 12, 0, 4910, 0 }, { 0, 12, 0, 4914, 0 }, { 0, 12, 0, 4918, 0 }, { 0, 12, 0, 4922, 0 }, { 0, 12, 0, 4926, 0 }, { 0, 12, 0, 4930, 0 }, { 0, 12, 0, 4934, 0 },
+		{ 0, 12, 0, 4938, 0 }, { 0, 12, 0, 4942, 0 }, { 0, 12, 0, 4946, 0 }, { 0, 12, 0, 4950, 0 }, { 0, 12, 0, 4954, 0 }, { 0, 12, 0, 4958, 0 }, { 0, 12, 0, 4962, 0 }, { 0, 12, 0, 4967, 0 },
+		{ 0, 12, 0, 4972, 0 }, { 0, 12, 0, 4977, 0 }, { 0, 12, 0, 4982, 0 }, { 0, 12, 0, 4987, 0 }, { 0, 12, 0, 4992, 0 }, { 0, 12, 0, 4997, 0 }, { 0, 12, 0, 5002, 0 }, { 0, 12, 0, 5007, 0 },
+		{ 0, 12, 0, 5012, 0 }, { 0, 12, 0, 5017, 0 }, { 0, 12, 0, 5022, 0 }, { 0, 12, 0, 5027, 0 }, { 0, 12, 0, 5032, 0 }, { 0, 12, 0, 5037, 0 }, { 0, 12, 0, 5045, 0 }, { 0, 12, 0, 5052, 0 },
+		{ 0, 12, 0, 5056, 0 }, { 0, 12, 0, 5060, 0 }, { 0, 12, 0, 5064, 0 }, { 0, 12, 0, 5068, 0 }, { 0, 12, 0, 5072, 0 }, { 0, 12, 0, 5076, 0 }, { 0, 12, 0, 5080, 0 }, { 0, 12, 0, 5084, 0 },
+		{ 0, 12, 0, 5088, 0 }, { 0, 12, 0, 5092, 0 }, { 0, 12, 0, 5096, 0 }, { 0, 12, 0, 5100, 0 }, { 0, 12, 0, 5104, 0 }, { 0, 12, 0, 5108, 0 }, { 0, 12, 0, 5112, 0 }, { 0, 12, 0, 5116, 0 },
+		{ 0, 12, 0, 5120, 0 }, { 0, 12, 0, 5124, 0 }, { 0, 12, 0, 5128, 0 }, { 0, 12, 0, 5132, 0 }, { 0, 12, 0, 5136, 0 }, { 0, 12, 0, 5140, 0 }, { 0, 12, 0, 5144, 0 }, { 0, 12, 0, 5148, 0 },
+		{ 0, 12, 0, 5152, 0 }, { 0, 12, 0, 5156, 0 }, { 0, 12, 0, 5160, 0 }, { 0, 12, 0, 5164, 0 }, { 0, 12, 0, 5168, 0 }, { 0, 12, 0, 5172, 0 }, { 0, 12, 0, 5176, 0 }, { 0, 12, 0, 5180, 0 },
+		{ 0, 12, 0, 5184, 0 }, { 0, 12, 0, 5188, 0 }, { 0, 12, 0, 5192, 0 }, { 0, 12, 0, 5196, 0 }, { 0, 12, 0, 5198, 0 }, { 0, 12, 0, 5200, 0 }, { 0, 12, 0, 5202, 0 }, { 0, 12, 0, 5206, 0 },
+		{ 0, 12, 0, 5209, 0 }, { 0, 12, 0, 5212, 0 }, { 0, 12, 0, 5215, 0 }, { 0, 12, 0, 5218, 0 }, { 0, 12, 0, 5221, 0 }, { 0, 12, 0, 5224, 0 }, { 0, 12, 0, 5227, 0 }, { 0, 12, 0, 5230, 0 },
+		{ 0, 12, 0, 5233, 0 }, { 0, 12, 0, 5236, 0 }, { 0, 12, 0, 5239, 0 }, { 0, 12, 0, 5242, 0 }, { 0, 12, 0, 5245, 0 }, { 0, 12, 0, 5248, 0 }, { 0, 12, 0, 5251, 0 }, { 0, 12, 0, 5254, 0 },
+		{ 0, 12, 0, 5257, 0 }, { 0, 12, 0, 5260, 0 }, { 0, 12, 0, 5263, 0 }, { 0, 12, 0, 5266, 0 }, { 0, 12, 0, 5269, 0 }, { 0, 12, 0, 5272, 0 }, { 0, 12, 0, 5275, 0 }, { 0, 12, 0, 5278, 0 },
+		{ 0, 12, 0, 5281, 0 }, { 0, 12, 0, 5284, 0 }, { 0, 12, 0, 5287, 0 }, { 0, 12, 0, 5290, 0 }, { 0, 12, 0, 5293, 0 }, { 0, 12, 0, 5299, 0 }, { 0, 12, 0, 5304, 0 }, { 0, 12, 0, 5307, 0 },
+		{ 0, 12, 0, 5309, 0 }, { 0, 12, 0, 5311, 0 }, { 0, 12, 0, 5313, 0 }, { 0, 12, 0, 5315, 0 }, { 0, 12, 0, 5317, 0 }, { 0, 12, 0, 5319, 0 }, { 0, 12, 0, 5321, 0 }, { 0, 12, 0, 5323, 0 },
+		{ 0, 12, 0, 5325, 0 }, { 0, 12, 0, 5327, 0 }, { 0, 12, 0, 5329, 0 }, { 0, 12, 0, 5331, 0 }, { 0, 12, 0, 5333, 0 }, { 0, 12, 0, 5335, 0 }, { 0, 12, 0, 5337, 0 }, { 0, 12, 0, 5339, 0 },
+		{ 0, 12, 0, 5341, 0 }, { 0, 12, 0, 5343, 0 }, { 0, 12, 0, 5345, 0 }, { 0, 12, 0, 5347, 0 }, { 0, 12, 0, 5349, 0 }, { 0, 12, 0, 5351, 0 }, { 0, 12, 0, 5353, 0 }, { 0, 12, 0, 5355, 0 },
+		{ 0, 12, 0, 5357, 0 }, { 0, 12, 0, 5359, 0 }, { 0, 12, 0, 5361, 0 }, { 0, 12, 0, 5363, 0 }, { 0, 12, 0, 5365, 0 }, { 0, 12, 0, 5367, 0 }, { 0, 12, 0, 5369, 0 }, { 0, 12, 0, 5371, 0 },
+		{ 0, 12, 0, 5374, 0 }, { 0, 12, 0, 5377, 0 }, { 0, 12, 0, 5380, 0 }, { 0, 12, 0, 5383, 0 }, { 0, 12, 0, 5386, 0 }, { 0, 12, 0, 5389, 0 }, { 0, 12, 0, 5392, 0 }, { 0, 12, 0, 5395, 0 },
+		{ 0, 12, 0, 5398, 0 }, { 0, 12, 0, 5401, 0 }, { 0, 12, 0, 5404, 0 }, { 0, 12, 0, 5407, 0 }, { 0, 12, 0, 5410, 0 }, { 0, 12, 0, 5413, 0 }, { 0, 12, 0, 5416, 0 }, { 0, 12, 0, 5419, 0 },
+		{ 0, 12, 0, 5422, 0 }, { 0, 12, 0, 5425, 0 }, { 0, 12, 0, 5428, 0 }, { 0, 12, 0, 5431, 0 }, { 0, 12, 0, 5434, 0 }, { 0, 12, 0, 5437, 0 }, { 0, 12, 0, 5440, 0 }, { 0, 12, 0, 5443, 0 },
+		{ 0, 12, 0, 5447, 0 }, { 0, 12, 0, 5451, 0 }, { 0, 12, 0, 5455, 0 }, { 0, 12, 0, 5458, 0 }, { 0, 12, 0, 5462, 0 }, { 0, 12, 0, 5465, 0 }, { 0, 12, 0, 5469, 0 }, { 0, 12, 0, 5471, 0 },
+		{ 0, 12, 0, 5473, 0 }, { 0, 12, 0, 5475, 0 }, { 0, 12, 0, 5477, 0 }, { 0, 12, 0, 5479, 0 }, { 0, 12, 0, 5481, 0 }, { 0, 12, 0, 5483, 0 }, { 0, 12, 0, 5485, 0 }, { 0, 12, 0, 5487, 0 },
+		{ 0, 12, 0, 5489, 0 }, { 0, 12, 0, 5491, 0 }, { 0, 12, 0, 5493, 0 }, { 0, 12, 0, 5495, 0 }, { 0, 12, 0, 5497, 0 }, { 0, 12, 0, 5499, 0 }, { 0, 12, 0, 5501, 0 }, { 0, 12, 0, 5503, 0 },
+		{ 0, 12, 0, 5505, 0 }, { 0, 12, 0, 5507, 0 }, { 0, 12, 0, 5509, 0 }, { 0, 12, 0, 5511, 0 }, { 0, 12, 0, 5513, 0 }, { 0, 12, 0, 5515, 0 }, { 0, 12, 0, 5517, 0 }, { 0, 12, 0, 5519, 0 },
+		{ 0, 12, 0, 5521, 0 }, { 0, 12, 0, 5523, 0 }, { 0, 12, 0, 5525, 0 }, { 0, 12, 0, 5527, 0 }, { 0, 12, 0, 5529, 0 }, { 0, 12, 0, 5531, 0 }, { 0, 12, 0, 5533, 0 }, { 0, 12, 0, 5535, 0 },
+		{ 0, 12, 0, 5537, 0 }, { 0, 12, 0, 5539, 0 }, { 0, 12, 0, 5541, 0 }, { 0, 12, 0, 5543, 0 }, { 0, 12, 0, 5545, 0 }, { 0, 12, 0, 5547, 0 }, { 0, 12, 0, 5549, 0 }, { 0, 12, 0, 5551, 0 },
+		{ 0, 12, 0, 5553, 0 }, { 0, 12, 0, 5555, 0 }, { 0, 12, 0, 5557, 0 }, { 0, 12, 0, 5559, 0 }, { 0, 12, 0, 5561, 0 }, { 0, 12, 0, 5563, 0 }, { 0, 12, 0, 5566, 0 }, { 0, 12, 0, 5572, 0 },
+		{ 0, 12, 0, 5577, 0 }, { 0, 12, 0, 5583, 0 }, { 0, 12, 0, 5587, 0 }, { 0, 12, 0, 5593, 0 }, { 0, 12, 0, 5597, 0 }, { 0, 12, 0, 5601, 0 }, { 0, 12, 0, 5608, 0 }, { 0, 12, 0, 5613, 0 },
+		{ 0, 12, 0, 5617, 0 }, { 0, 12, 0, 5621, 0 }, { 0, 12, 0, 5625, 0 }, { 0, 12, 0, 5630, 0 }, { 0, 12, 0, 5635, 0 }, { 0, 12, 0, 5640, 0 }, { 0, 12, 0, 5645, 0 }, { 0, 12, 0, 5650, 0 },
+		{ 0, 12, 0, 5655, 0 }, { 0, 12, 0, 5660, 0 }, { 0, 12, 0, 5667, 0 }, { 0, 12, 0, 5670, 0 }, { 0, 12, 0, 5677, 0 }, { 0, 12, 0, 5684, 0 }, { 0, 12, 0, 5690, 0 }, { 0, 12, 0, 5695, 0 },
+		{ 0, 12, 0, 5702, 0 }, { 0, 12, 0, 5709, 0 }, { 0, 12, 0, 5714, 0 }, { 0, 12, 0, 5718, 0 }, { 0, 12, 0, 5722, 0 }, { 0, 12, 0, 5727, 0 }, { 0, 12, 0, 5732, 0 }, { 0, 12, 0, 5738, 0 },
+		{ 0, 12, 0, 5744, 0 }, { 0, 12, 0, 5748, 0 }, { 0, 12, 0, 5752, 0 }, { 0, 12, 0, 5757, 0 }, { 0, 12, 0, 5761, 0 }, { 0, 12, 0, 5765, 0 }, { 0, 12, 0, 5768, 0 }, { 0, 12, 0, 5771, 0 },
+		{ 0, 12, 0, 5775, 0 }, { 0, 12, 0, 5779, 0 }, { 0, 12, 0, 5786, 0 }, { 0, 12, 0, 5791, 0 }, { 0, 12, 0, 5797, 0 }, { 0, 12, 0, 5804, 0 }, { 0, 12, 0, 5809, 0 }, { 0, 12, 0, 5813, 0 },
+		{ 0, 12, 0, 5817, 0 }, { 0, 12, 0, 5824, 0 }, { 0, 12, 0, 5829, 0 }, { 0, 12, 0, 5836, 0 }, { 0, 12, 0, 5840, 0 }, { 0, 12, 0, 5846, 0 }, { 0, 12, 0, 5850, 0 }, { 0, 12, 0, 5855, 0 },
+		{ 0, 12, 0, 5859, 0 }, { 0, 12, 0, 5864, 0 }, { 0, 12, 0, 5870, 0 }, { 0, 12, 0, 5875, 0 }, { 0, 12, 0, 5881, 0 }, { 0, 12, 0, 5886, 0 }, { 0, 12, 0, 5889, 0 }, { 0, 12, 0, 5895, 0 },
+		{ 0, 12, 0, 5899, 0 }, { 0, 12, 0, 5903, 0 }, { 0, 12, 0, 5908, 0 }, { 0, 12, 0, 5912, 0 }, { 0, 12, 0, 5916, 0 }, { 0, 12, 0, 5920, 0 }, { 0, 12, 0, 5926, 0 }, { 0, 12, 0, 5931, 0 },
+		{ 0, 12, 0, 5934, 0 }, { 0, 12, 0, 5941, 0 }, { 0, 12, 0, 5945, 0 }, { 0, 12, 0, 5951, 0 }, { 0, 12, 0, 5956, 0 }, { 0, 12, 0, 5961, 0 }, { 0, 12, 0, 5965, 0 }, { 0, 12, 0, 5969, 0 },
+		{ 0, 12, 0, 5974, 0 }, { 0, 12, 0, 5977, 0 }, { 0, 12, 0, 5982, 0 }, { 0, 12, 0, 5988, 0 }, { 0, 12, 0, 5991, 0 }, { 0, 12, 0, 5998, 0 }, { 0, 12, 0, 6002, 0 }, { 0, 12, 0, 6005, 0 },
+		{ 0, 12, 0, 6008, 0 }, { 0, 12, 0, 6011, 0 }, { 0, 12, 0, 6014, 0 }, { 0, 12, 0, 6017, 0 }, { 0, 12, 0, 6020, 0 }, { 0, 12, 0, 6023, 0 }, { 0, 12, 0, 6026, 0 }, { 0, 12, 0, 6029, 0 },
+		{ 0, 12, 0, 6032, 0 }, { 0, 12, 0, 6036, 0 }, { 0, 12, 0, 6040, 0 }, { 0, 12, 0, 6044, 0 }, { 0, 12, 0, 6048, 0 }, { 0, 12, 0, 6052, 0 }, { 0, 12, 0, 6056, 0 }, { 0, 12, 0, 6060, 0 },
+		{ 0, 12, 0, 6064, 0 }, { 0, 12, 0, 6068, 0 }, { 0, 12, 0, 6072, 0 }, { 0, 12, 0, 6076, 0 }, { 0, 12, 0, 6080, 0 }, { 0, 12, 0, 6084, 0 }, { 0, 12, 0, 6088, 0 }, { 0, 12, 0, 6092, 0 },
+		{ 0, 12, 0, 6096, 0 }, { 0, 12, 0, 6099, 0 }, { 0, 12, 0, 6102, 0 }, { 0, 12, 0, 6106, 0 }, { 0, 12, 0, 6109, 0 }, { 0, 12, 0, 6112, 0 }, { 0, 12, 0, 6115, 0 }, { 0, 12, 0, 6119, 0 },
+		{ 0, 12, 0, 6123, 0 }, { 0, 12, 0, 6126, 0 }, { 0, 12, 0, 6129, 0 }, { 0, 12, 0, 6132, 0 }, { 0, 12, 0, 6135, 0 }, { 0, 12, 0, 6138, 0 }, { 0, 12, 0, 6143, 0 }, { 0, 12, 0, 6146, 0 },
+		{ 0, 12, 0, 6149, 0 }, { 0, 12, 0, 6152, 0 }, { 0, 12, 0, 6155, 0 }, { 0, 12, 0, 6158, 0 }, { 0, 12, 0, 6161, 0 }, { 0, 12, 0, 6164, 0 }, { 0, 12, 0, 6167, 0 }, { 0, 12, 0, 6171, 0 },
+		{ 0, 12, 0, 6176, 0 }, { 0, 12, 0, 6179, 0 }, { 0, 12, 0, 6182, 0 }, { 0, 12, 0, 6185, 0 }, { 0, 12, 0, 6188, 0 }, { 0, 12, 0, 6191, 0 }, { 0, 12, 0, 6194, 0 }, { 0, 12, 0, 6197, 0 },
+		{ 0, 12, 0, 6201, 0 }, { 0, 12, 0, 6205, 0 }, { 0, 12, 0, 6209, 0 }, { 0, 12, 0, 6213, 0 }, { 0, 12, 0, 6216, 0 }, { 0, 12, 0, 6219, 0 }, { 0, 12, 0, 6222, 0 }, { 0, 12, 0, 6225, 0 },
+		{ 0, 12, 0, 6228, 0 }, { 0, 12, 0, 6231, 0 }, { 0, 12, 0, 6234, 0 }, { 0, 12, 0, 6237, 0 }, { 0, 12, 0, 6240, 0 }, { 0, 12, 0, 6243, 0 }, { 0, 12, 0, 6247, 0 }, { 0, 12, 0, 6251, 0 },
+		{ 0, 12, 0, 6254, 0 }, { 0, 12, 0, 6258, 0 }, { 0, 12, 0, 6262, 0 }, { 0, 12, 0, 6266, 0 }, { 0, 12, 0, 6269, 0 }, { 0, 12, 0, 6273, 0 }, { 0, 12, 0, 6277, 0 }, { 0, 12, 0, 6282, 0 },
+		{ 0, 12, 0, 6285, 0 }, { 0, 12, 0, 6289, 0 }, { 0, 12, 0, 6293, 0 }, { 0, 12, 0, 6297, 0 }, { 0, 12, 0, 6301, 0 }, { 0, 12, 0, 6307, 0 }, { 0, 12, 0, 6314, 0 }, { 0, 12, 0, 6317, 0 },
+		{ 0, 12, 0, 6320, 0 }, { 0, 12, 0, 6323, 0 }, { 0, 12, 0, 6326, 0 }, { 0, 12, 0, 6329, 0 }, { 0, 12, 0, 6332, 0 }, { 0, 12, 0, 6335, 0 }, { 0, 12, 0, 6338, 0 }, { 0, 12, 0, 6341, 0 },
+		{ 0, 12, 0, 6344, 0 }, { 0, 12, 0, 6347, 0 }, { 0, 12, 0, 6350, 0 }, { 0, 12, 0, 6353, 0 }, { 0, 12, 0, 6356, 0 }, { 0, 12, 0, 6359, 0 }, { 0, 12, 0, 6362, 0 }, { 0, 12, 0, 6365, 0 },
+		{ 0, 12, 0, 6368, 0 }, { 0, 12, 0, 6373, 0 }, { 0, 12, 0, 6376, 0 }, { 0, 12, 0, 6379, 0 }, { 0, 12, 0, 6382, 0 }, { 0, 12, 0, 6387, 0 }, { 0, 12, 0, 6391, 0 }, { 0, 12, 0, 6394, 0 },
+		{ 0, 12, 0, 6397, 0 }, { 0, 12, 0, 6400, 0 }, { 0, 12, 0, 6403, 0 }, { 0, 12, 0, 6406, 0 }, { 0, 12, 0, 6409, 0 }, { 0, 12, 0, 6412, 0 }, { 0, 12, 0, 6415, 0 }, { 0, 12, 0, 6418, 0 },
+		{ 0, 12, 0, 6421, 0 }, { 0, 12, 0, 6425, 0 }, { 0, 12, 0, 6428, 0 }, { 0, 12, 0, 6431, 0 }, { 0, 12, 0, 6435, 0 }, { 0, 12, 0, 6439, 0 }, { 0, 12, 0, 6442, 0 }, { 0, 12, 0, 6447, 0 },
+		{ 0, 12, 0, 6451, 0 }, { 0, 12, 0, 6454, 0 }, { 0, 12, 0, 6457, 0 }, { 0, 12, 0, 6460, 0 }, { 0, 12, 0, 6463, 0 }, { 0, 12, 0, 6467, 0 }, { 0, 12, 0, 6471, 0 }, { 0, 12, 0, 6474, 0 },
+		{ 0, 12, 0, 6477, 0 }, { 0, 12, 0, 6480, 0 }, { 0, 12, 0, 6483, 0 }, { 0, 12, 0, 6486, 0 }, { 0, 12, 0, 6489, 0 }, { 0, 12, 0, 6492, 0 }, { 0, 12, 0, 6495, 0 }, { 0, 12, 0, 6498, 0 },
+		{ 0, 12, 0, 6502, 0 }, { 0, 12, 0, 6506, 0 }, { 0, 12, 0, 6510, 0 }, { 0, 12, 0, 6514, 0 }, { 0, 12, 0, 6518, 0 }, { 0, 12, 0, 6522, 0 }, { 0, 12, 0, 6526, 0 }, { 0, 12, 0, 6530, 0 },
+		{ 0, 12, 0, 6534, 0 }, { 0, 12, 0, 6538, 0 }, { 0, 12, 0, 6542, 0 }, { 0, 12, 0, 6546, 0 }, { 0, 12, 0, 6550, 0 }, { 0, 12, 0, 6554, 0 }, { 0, 12, 0, 6558, 0 }, { 0, 12, 0, 6562, 0 },
+		{ 0, 12, 0, 6566, 0 }, { 0, 12, 0, 6570, 0 }, { 0, 12, 0, 6574, 0 }, { 0, 12, 0, 6578, 0 }, { 0, 12, 0, 6582, 0 }, { 0, 12, 0, 6586, 0 }, { 0, 12, 0, 6590, 0 }, { 0, 12, 0, 6592, 0 },
+		{ 0, 12, 0, 6594, 0 }, { 0, 12, 0, 6596, 0 }, { 0, 12, 0, 6598, 0 }, { 0, 12, 0, 6600, 0 }, { 0, 12, 0, 6602, 0 }, { 0, 12, 0, 6604, 0 }, { 0, 12, 0, 6606, 0 }, { 0, 12, 0, 6608, 0 },
+		{ 0, 10, 0, 0, 0 }, { 0, 15, 6610, 6610, 0 }, { 0, 15, 6612, 6612, 0 }, { 0, 15, 4394, 4394, 0 }, { 0, 15, 6614, 6614, 0 }, { 0, 15, 6616, 6616, 0 }, { 0, 15, 6618, 6618, 0 }, { 0, 15, 6620, 6620, 0 },
+		{ 0, 15, 4502, 4502, 0 }, { 0, 15, 6622, 6622, 0 }, { 0, 15, 4410, 4410, 0 }, { 0, 15, 6624, 6624, 0 }, { 0, 15, 6626, 6626, 0 }, { 0, 15, 6628, 6628, 0 }, { 0, 15, 6630, 6630, 0 }, { 0, 15, 6632, 6632, 0 },
+		{ 0, 15, 6634, 6634, 0 }, { 0, 15, 6636, 6636, 0 }, { 0, 15, 6638, 6638, 0 }, { 0, 15, 6640, 6640, 0 }, { 0, 15, 6642, 6642, 0 }, { 0, 15, 6644, 6644, 0 }, { 0, 15, 6646, 6646, 0 }, { 0, 15, 6648, 6648, 0 },
+		{ 0, 15, 6650, 6650, 0 }, { 0, 15, 6652, 6652, 0 }, { 0, 15, 6654, 6654, 0 }, { 0, 15, 6656, 6656, 0 }, { 0, 15, 6658, 6658, 0 }, { 0, 15, 6660, 6660, 0 }, { 0, 15, 6662, 6662, 0 }, { 0, 15, 6664, 6664, 0 },
+		{ 0, 15, 6666, 6666, 0 }, { 0, 15, 6668, 6668, 0 }, { 0, 15, 6670, 6670, 0 }, { 0, 15, 6672, 6672, 0 }, { 0, 15, 6674, 6674, 0 }, { 0, 15, 6676, 6676, 0 }, { 0, 15, 6678, 6678, 0 }, { 0, 15, 6680, 6680, 0 },
+		{ 0, 15, 6682, 6682, 0 }, { 0, 15, 6684, 6684, 0 }, { 0, 15, 6686, 6686, 0 }, { 0, 15, 6688, 6688, 0 }, { 0, 15, 6690, 6690, 0 }, { 0, 15, 6692, 6692, 0 }, { 0, 15, 6694, 6694, 0 }, { 0, 15, 6696, 6696, 0 },
+		{ 0, 15, 6698, 6698, 0 }, { 0, 15, 6700, 6700, 0 }, { 0, 15, 6702, 6702, 0 }, { 0, 15, 6704, 6704, 0 }, { 0, 15, 4326, 4326, 0 }, { 0, 15, 6706, 6706, 0 }, { 0, 15, 6708, 6708, 0 }, { 0, 15, 6710, 6710, 0 },
+		{ 0, 15, 6712, 6712, 0 }, { 0, 15, 6714, 6714, 0 }, { 0, 15, 6716, 6716, 0 }, { 0, 15, 6718, 6718, 0 }, { 0, 15, 6720, 6720, 0 }, { 0, 15, 6722, 6722, 0 }, { 0, 15, 6724, 6724, 0 }, { 0, 15, 6726, 6726, 0 },
+		{ 0, 15, 4472, 4472, 0 }, { 0, 15, 6728, 6728, 0 }, { 0, 15, 6730, 6730, 0 }, { 0, 15, 6732, 6732, 0 }, { 0, 15, 6734, 6734, 0 }, { 0, 15, 6736, 6736, 0 }, { 0, 15, 6738, 6738, 0 }, { 0, 15, 6740, 6740, 0 },
+		{ 0, 15, 6742, 6742, 0 }, { 0, 15, 6744, 6744, 0 }, { 0, 15, 6746, 6746, 0 }, { 0, 15, 6748, 6748, 0 }, { 0, 15, 6750, 6750, 0 }, { 0, 15, 6752, 6752, 0 }, { 0, 15, 6754, 6754, 0 }, { 0, 15, 6756, 6756, 0 },
+		{ 0, 15, 6758, 6758, 0 }, { 0, 15, 6760, 6760, 0 }, { 0, 15, 6762, 6762, 0 }, { 0, 15, 6764, 6764, 0 }, { 0, 15, 6766, 6766, 0 }, { 0, 15, 6768, 6768, 0 }, { 0, 15, 6770, 6770, 0 }, { 0, 15, 6772, 6772, 0 },
+		{ 0, 15, 6774, 6774, 0 }, { 0, 15, 6776, 6776, 0 }, { 0, 15, 6778, 6778, 0 }, { 0, 15, 6780, 6780, 0 }, { 0, 15, 6782, 6782, 0 }, { 0, 15, 6784, 6784, 0 }, { 0, 15, 6786, 6786, 0 }, { 0, 15, 6788, 6788, 0 },
+		{ 0, 15, 6790, 6790, 0 }, { 0, 15, 6792, 6792, 0 }, { 0, 15, 6794, 6794, 0 }, { 0, 15, 6796, 6796, 0 }, { 0, 15, 6798, 6798, 0 }, { 0, 15, 6800, 6800, 0 }, { 0, 15, 6802, 6802, 0 }, { 0, 15, 6804, 6804, 0 },
+		{ 0, 15, 6806, 6806, 0 }, { 0, 15, 6808, 6808, 0 }, { 0, 15, 6810, 6810, 0 }, { 0, 15, 6812, 6812, 0 }, { 0, 15, 6814, 6814, 0 }, { 0, 15, 6816, 6816, 0 }, { 0, 15, 6818, 6818, 0 }, { 0, 15, 6820, 6820, 0 },
+		{ 0, 15, 4398, 4398, 0 }, { 0, 15, 6822, 6822, 0 }, { 0, 15, 6824, 6824, 0 }, { 0, 15, 6826, 6826, 0 }, { 0, 15, 6828, 6828, 0 }, { 0, 15, 6830, 6830, 0 }, { 0, 15, 6832, 6832, 0 }, { 0, 15, 6834, 6834, 0 },
+		{ 0, 15, 6836, 6836, 0 }, { 0, 15, 6838, 6838, 0 }, { 0, 15, 6840, 6840, 0 }, { 0, 15, 6842, 6842, 0 }, { 0, 15, 6844, 6844, 0 }, { 0, 15, 6846, 6846, 0 }, { 0, 15, 6848, 6848, 0 }, { 0, 15, 6850, 6850, 0 },
+		{ 0, 15, 4152, 4152, 0 }, { 0, 15, 6852, 6852, 0 }, { 0, 15, 6854, 6854, 0 }, { 0, 15, 6856, 6856, 0 }, { 0, 15, 6858, 6858, 0 }, { 0, 15, 6860, 6860, 0 }, { 0, 15, 6862, 6862, 0 }, { 0, 15, 6864, 6864, 0 },
+		{ 0, 15, 6866, 6866, 0 }, { 0, 15, 4114, 4114, 0 }, { 0, 15, 6868, 6868, 0 }, { 0, 15, 6870, 6870, 0 }, { 0, 15, 6872, 6872, 0 }, { 0, 15, 6874, 6874, 0 }, { 0, 15, 6876, 6876, 0 }, { 0, 15, 6878, 6878, 0 },
+		{ 0, 15, 6880, 6880, 0 }, { 0, 15, 6882, 6882, 0 }, { 0, 15, 6884, 6884, 0 }, { 0, 15, 6886, 6886, 0 }, { 0, 15, 6888, 6888, 0 }, { 0, 15, 6890, 6890, 0 }, { 0, 15, 6892, 6892, 0 }, { 0, 15, 6894, 6894, 0 },
+		{ 0, 15, 6896, 6896, 0 }, { 0, 15, 6898, 6898, 0 }, { 0, 15, 6900, 6900, 0 }, { 0, 15, 6902, 6902, 0 }, { 0, 15, 6904, 6904, 0 }, { 0, 15, 6906, 6906, 0 }, { 0, 15, 6908, 6908, 0 }, { 0, 15, 6910, 6910, 0 },
+		{ 0, 15, 6912, 6912, 0 }, { 0, 15, 6914, 6914, 0 }, { 0, 15, 6916, 6916, 0 }, { 0, 15, 6918, 6918, 0 }, { 0, 15, 6920, 6920, 0 }, { 0, 15, 6922, 6922, 0 }, { 0, 15, 6924, 6924, 0 }, { 0, 15, 6926, 6926, 0 },
+		{ 0, 15, 6928, 6928, 0 }, { 0, 15, 6930, 6930, 0 }, { 0, 15, 6932, 6932, 0 }, { 0, 15, 6934, 6934, 0 }, { 0, 15, 6936, 6936, 0 }, { 0, 15, 6938, 6938, 0 }, { 0, 15, 6940, 6940, 0 }, { 0, 15, 6942, 6942, 0 },
+		{ 0, 15, 6944, 6944, 0 }, { 0, 15, 6946, 6946, 0 }, { 0, 15, 6948, 6948, 0 }, { 0, 15, 6950, 6950, 0 }, { 0, 15, 6952, 6952, 0 }, { 0, 15, 6954, 6954, 0 }, { 0, 15, 6956, 6956, 0 }, { 0, 15, 6958, 6958, 0 },
+		{ 0, 15, 6960, 6960, 0 }, { 0, 15, 6962, 6962, 0 }, { 0, 15, 6964, 6964, 0 }, { 0, 15, 6966, 6966, 0 }, { 0, 15, 6968, 6968, 0 }, { 0, 15, 6970, 6970, 0 }, { 0, 15, 6972, 6972, 0 }, { 0, 15, 6974, 6974, 0 },
+		{ 0, 15, 4500, 4500, 0 }, { 0, 15, 6976, 6976, 0 }, { 0, 15, 6978, 6978, 0 }, { 0, 15, 6980, 6980, 0 }, { 0, 15, 6982, 6982, 0 }, { 0, 15, 6984, 6984, 0 }, { 0, 15, 6986, 6986, 0 }, { 0, 15, 6988, 6988, 0 },
+		{ 0, 15, 6990, 6990, 0 }, { 0, 15, 6992, 6992, 0 }, { 0, 15, 6994, 6994, 0 }, { 0, 15, 6996, 6996, 0 }, { 0, 15, 6998, 6998, 0 }, { 0, 15, 5309, 5309, 0 }, { 0, 15, 7000, 7000, 0 }, { 0, 15, 7002, 7002, 0 },
+		{ 0, 15, 7004, 7004, 0 }, { 0, 15, 7006, 7006, 0 }, { 0, 15, 7008, 7008, 0 }, { 0, 15, 7010, 7010, 0 }, { 0, 15, 7012, 7012, 0 }, { 0, 15, 7014, 7014, 0 }, { 0, 15, 7016, 7016, 0 }, { 0, 15, 7018, 7018, 0 },
+		{ 0, 15, 7020, 7020, 0 }, { 0, 15, 7022, 7022, 0 }, { 0, 15, 7024, 7024, 0 }, { 0, 15, 7026, 7026, 0 }, { 0, 15, 7028, 7028, 0 }, { 0, 15, 7030, 7030, 0 }, { 0, 15, 7032, 7032, 0 }, { 0, 15, 7034, 7034, 0 },
+		{ 0, 15, 7036, 7036, 0 }, { 0, 15, 7038, 7038, 0 }, { 0, 15, 7040, 7040, 0 }, { 0, 15, 7042, 7042, 0 }, { 0, 15, 4408, 4408, 0 }, { 0, 15, 7044, 7044, 0 }, { 0, 15, 7046, 7046, 0 }, { 0, 15, 7048, 7048, 0 },
+		{ 0, 15, 7050, 7050, 0 }, { 0, 15, 7052, 7052, 0 }, { 0, 15, 7054, 7054, 0 }, { 0, 15, 7056, 7056, 0 }, { 0, 15, 7058, 7058, 0 }, { 0, 15, 7060, 7060, 0 }, { 0, 15, 7062, 7062, 0 }, { 0, 15, 7064, 7064, 0 },
+		{ 0, 15, 7066, 7066, 0 }, { 0, 15, 7068, 7068, 0 }, { 0, 15, 4310, 4310, 0 }, { 0, 15, 7070, 7070, 0 }, { 0, 15, 7072, 7072, 0 }, { 0, 15, 7074, 7074, 0 }, { 0, 15, 7076, 7076, 0 }, { 0, 15, 7078, 7078, 0 },
+		{ 0, 15, 7080, 7080, 0 }, { 0, 15, 7082, 7082, 0 }, { 0, 15, 7084, 7084, 0 }, { 0, 15, 7086, 7086, 0 }, { 0, 15, 7088, 7088, 0 }, { 0, 15, 7090, 7090, 0 }, { 0, 15, 7092, 7092, 0 }, { 0, 15, 7094, 7094, 0 },
+		{ 0, 15, 7096, 7096, 0 }, { 0, 15, 7098, 7098, 0 }, { 0, 15, 7100, 7100, 0 }, { 0, 15, 4364, 4364, 0 }, { 0, 15, 7102, 7102, 0 }, { 0, 15, 4370, 4370, 0 }, { 0, 15, 7104, 7104, 0 }, { 0, 15, 7106, 7106, 0 },
+		{ 0, 15, 7108, 7108, 0 }, { 0, 15, 7110, 7110, 0 }, { 0, 15, 7112, 7112, 0 }, { 0, 15, 7114, 7114, 0 }, { 0, 15, 7116, 7116, 0 }, { 0, 15, 7118, 7118, 0 }, { 0, 15, 7120, 7120, 0 }, { 0, 15, 7122, 7122, 0 },
+		{ 0, 15, 7124, 7124, 0 }, { 0, 15, 7126, 7126, 0 }, { 0, 15, 7128, 7128, 0 }, { 0, 15, 7130, 7130, 0 }, { 0, 15, 4324, 4324, 0 }, { 0, 15, 7132, 7132, 0 }, { 0, 15, 7134, 7134, 0 }, { 0, 15, 7136, 7136, 0 },
+		{ 0, 15, 7138, 7138, 0 }, { 0, 15, 7140, 7140, 0 }, { 0, 15, 7142, 7142, 0 }, { 0, 15, 7144, 7144, 0 }, { 0, 15, 7146, 7146, 0 }, { 0, 15, 7148, 7148, 0 }, { 0, 15, 7150, 7150, 0 }, { 0, 15, 7152, 7152, 0 },
+		{ 0, 15, 7154, 7154, 0 }, { 0, 15, 7156, 7156, 0 }, { 0, 15, 7158, 7158, 0 }, { 0, 15, 7160, 7160, 0 }, { 0, 15, 7162, 7162, 0 }, { 0, 15, 7164, 7164, 0 }, { 0, 15, 7166, 7166, 0 }, { 0, 15, 7168, 7168, 0 },
+		{ 0, 15, 7170, 7170, 0 }, { 0, 15, 7172, 7172, 0 }, { 0, 15, 7174, 7174, 0 }, { 0, 15, 4166, 4166, 0 }, { 0, 15, 7176, 7176, 0 }, { 0, 15, 7178, 7178, 0 }, { 0, 15, 7180, 7180, 0 }, { 0, 15, 7182, 7182, 0 },
+		{ 0, 15, 7184, 7184, 0 }, { 0, 15, 7186, 7186, 0 }, { 0, 15, 7188, 7188, 0 }, { 0, 15, 7190, 7190, 0 }, { 0, 15, 7192, 7192, 0 }, { 0, 15, 7194, 7194, 0 }, { 0, 15, 7196, 7196, 0 }, { 0, 15, 7198, 7198, 0 },
+		{ 0, 15, 7200, 7200, 0 }, { 0, 15, 7202, 7202, 0 }, { 0, 15, 7204, 7204, 0 }, { 0, 15, 5319, 5319, 0 }, { 0, 15, 7206, 7206, 0 }, { 0, 15, 7208, 7208, 0 }, { 0, 15, 7210, 7210, 0 }, { 0, 15, 7212, 7212, 0 },
+		{ 0, 15, 5327, 5327, 0 }, { 0, 15, 7214, 7214, 0 }, { 0, 15, 7216, 7216, 0 }, { 0, 15, 7218, 7218, 0 }, { 0, 15, 7220, 7220, 0 }, { 0, 15, 7222, 7222, 0 }, { 0, 15, 7224, 7224, 0 }, { 0, 15, 7226, 7226, 0 },
+		{ 0, 15, 7228, 7228, 0 }, { 0, 15, 7230, 7230, 0 }, { 0, 15, 7232, 7232, 0 }, { 0, 15, 7234, 7234, 0 }, { 0, 15, 7236, 7236, 0 }, { 0, 15, 7238, 7238, 0 }, { 0, 15, 7240, 7240, 0 }, { 0, 15, 7242, 7242, 0 },
+		{ 0, 15, 7244, 7244, 0 }, { 0, 15, 7246, 7246, 0 }, { 0, 15, 7248, 7248, 0 }, { 0, 15, 7250, 7250, 0 }, { 0, 15, 7252, 7252, 0 }, { 0, 15, 7254, 7254, 0 }, { 0, 15, 7256, 7256, 0 }, { 0, 15, 7258, 7258, 0 },
+		{ 0, 15, 7260, 7260, 0 }, { 0, 15, 7262, 7262, 0 }, { 0, 15, 7264, 7264, 0 }, { 0, 15, 7266, 7266, 0 }, { 0, 15, 7268, 7268, 0 }, { 0, 15, 7270, 7270, 0 }, { 0, 15, 7272, 7272, 0 }, { 0, 15, 7274, 7274, 0 },
+		{ 0, 15, 7276, 7276, 0 }, { 0, 15, 7278, 7278, 0 }, { 0, 15, 7280, 7280, 0 }, { 0, 15, 7282, 7282, 0 }, { 0, 15, 7284, 7284, 0 }, { 0, 15, 7286, 7286, 0 }, { 0, 15, 7288, 7288, 0 }, { 0, 15, 7290, 7290, 0 },
+		{ 0, 15, 7292, 7292, 0 }, { 0, 15, 7294, 7294, 0 }, { 0, 15, 7296, 7296, 0 }, { 0, 15, 7298, 7298, 0 }, { 0, 15, 7300, 7300, 0 }, { 0, 15, 7302, 7302, 0 }, { 0, 15, 7304, 7304, 0 }, { 0, 15, 7306, 7306, 0 },
+		{ 0, 15, 7308, 7308, 0 }, { 0, 15, 7310, 7310, 0 }, { 0, 15, 7312, 7312, 0 }, { 0, 15, 7314, 7314, 0 }, { 0, 15, 7316, 7316, 0 }, { 0, 15, 7318, 7318, 0 }, { 0, 15, 7320, 7320, 0 }, { 0, 15, 7322, 7322, 0 },
+		{ 0, 15, 7324, 7324, 0 }, { 0, 15, 4232, 4232, 0 }, { 0, 15, 7326, 7326, 0 }, { 0, 15, 7328, 7328, 0 }, { 0, 15, 7330, 7330, 0 }, { 0, 15, 7332, 7332, 0 }, { 0, 15, 7334, 7334, 0 }, { 0, 15, 7336, 7336, 0 },
+		{ 0, 15, 7338, 7338, 0 }, { 0, 15, 7340, 7340, 0 }, { 0, 15, 7342, 7342, 0 }, { 0, 15, 7344, 7344, 0 }, { 0, 15, 7346, 7346, 0 }, { 0, 15, 7348, 7348, 0 }, { 0, 15, 7350, 7350, 0 }, { 0, 15, 7352, 7352, 0 },
+		{ 0, 15, 7354, 7354, 0 }, { 0, 15, 7356, 7356, 0 }, { 0, 15, 7358, 7358, 0 }, { 0, 15, 7360, 7360, 0 }, { 0, 15, 7362, 7362, 0 }, { 0, 15, 7364, 7364, 0 }, { 0, 15, 7366, 7366, 0 }, { 0, 15, 7368, 7368, 0 },
+		{ 0, 15, 7370, 7370, 0 }, { 0, 15, 7372, 7372, 0 }, { 0, 15, 7374, 7374, 0 }, { 0, 15, 7376, 7376, 0 }, { 0, 15, 7378, 7378, 0 }, { 0, 15, 7380, 7380, 0 }, { 0, 15, 7382, 7382, 0 }, { 0, 15, 7384, 7384, 0 },
+		{ 0, 15, 7386, 7386, 0 }, { 0, 15, 7388, 7388, 0 }, { 0, 15, 7390, 7390, 0 }, { 0, 15, 7392, 7392, 0 }, { 0, 15, 7394, 7394, 0 }, { 0, 15, 7396, 7396, 0 }, { 0, 15, 7398, 7398, 0 }, { 0, 15, 7400, 7400, 0 },
+		{ 0, 15, 7402, 7402, 0 }, { 0, 15, 7404, 7404, 0 }, { 0, 15, 7406, 7406, 0 }, { 0, 15, 7408, 7408, 0 }, { 0, 15, 7410, 7410, 0 }, { 0, 15, 7412, 7412, 0 }, { 0, 15, 7414, 7414, 0 }, { 0, 15, 7416, 7416, 0 },
+		{ 0, 15, 7418, 7418, 0 }, { 0, 15, 7420, 7420, 0 }, { 0, 12, 0, 7422, 0 }, { 0, 12, 0, 7425, 0 }, { 0, 12, 0, 7428, 0 }, { 0, 12, 0, 7431, 0 }, { 0, 12, 0, 7435, 0 }, { 0, 12, 0, 7439, 0 },
+		{ 0, 12, 0, 7442, 0 }, { 0, 12, 0, 7445, 0 }, { 0, 12, 0, 7448, 0 }, { 0, 12, 0, 7451, 0 }, { 0, 12, 0, 7454, 0 }, { 0, 15, 7457, 7457, 0 }, { 26, 0, 0, 0, 0 }, { 0, 15, 7460, 7460, 0 },
+		{ 0, 12, 0, 7463, 0 }, { 0, 12, 0, 7465, 0 }, { 0, 12, 0, 7467, 0 }, { 0, 12, 0, 7469, 0 }, { 0, 12, 0, 7471, 0 }, { 0, 12, 0, 7473, 0 }, { 0, 12, 0, 7475, 0 }, { 0, 15, 7477, 7477, 0 },
+		{ 0, 15, 7480, 7480, 0 }, { 0, 15, 7483, 7483, 0 }, { 0, 15, 7487, 7487, 0 }, { 0, 15, 7491, 7491, 0 }, { 0, 15, 7494, 7494, 0 }, { 0, 15, 7497, 7497, 0 }, { 0, 15, 7500, 7500, 0 }, { 0, 15, 7503, 7503, 0 },
+		{ 0, 15, 7506, 7506, 0 }, { 0, 15, 7509, 7509, 0 }, { 0, 15, 7512, 7512, 0 }, { 0, 15, 7515, 7515, 0 }, { 0, 15, 7518, 7518, 0 }, { 0, 15, 7521, 7521, 0 }, { 0, 15, 7524, 7524, 0 }, { 0, 15, 7527, 7527, 0 },
+		{ 0, 15, 7530, 7530, 0 }, { 0, 15, 7533, 7533, 0 }, { 0, 15, 7536, 7536, 0 }, { 0, 15, 7539, 7539, 0 }, { 0, 15, 7542, 7542, 0 }, { 0, 15, 7545, 7545, 0 }, { 0, 15, 7548, 7548, 0 }, { 0, 15, 7551, 7551, 0 },
+		{ 0, 15, 7554, 7554, 0 }, { 0, 15, 7557, 7557, 0 }, { 0, 15, 7560, 7560, 0 }, { 0, 15, 7563, 7563, 0 }, { 0, 15, 7566, 7566, 0 }, { 0, 15, 7569, 7569, 0 }, { 0, 15, 7572, 7572, 0 }, { 0, 12, 0, 7575, 0 },
+		{ 0, 12, 0, 7578, 0 }, { 0, 12, 0, 7580, 0 }, { 0, 12, 0, 7582, 0 }, { 0, 12, 0, 7584, 0 }, { 0, 12, 0, 7586, 0 }, { 0, 12, 0, 7588, 0 }, { 0, 12, 0, 7590, 0 }, { 0, 12, 0, 7592, 0 },
+		{ 0, 12, 0, 7594, 0 }, { 0, 12, 0, 7596, 0 }, { 0, 12, 0, 7598, 0 }, { 0, 12, 0, 7600, 0 }, { 0, 12, 0, 7602, 0 }, { 0, 12, 0, 7604, 0 }, { 0, 12, 0, 7606, 0 }, { 0, 12, 0, 7608, 0 },
+		{ 0, 12, 0, 7610, 0 }, { 0, 12, 0, 7612, 0 }, { 0, 12, 0, 7614, 0 }, { 0, 12, 0, 7616, 0 }, { 0, 12, 0, 7618, 0 }, { 0, 12, 0, 7620, 0 }, { 0, 12, 0, 7622, 0 }, { 0, 12, 0, 7624, 0 },
+		{ 0, 12, 0, 7626, 0 }, { 0, 12, 0, 1218, 0 }, { 0, 12, 0, 7628, 0 }, { 0, 12, 0, 7630, 0 }, { 0, 12, 0, 7632, 0 }, { 0, 12, 0, 1224, 0 }, { 0, 12, 0, 7634, 0 }, { 0, 12, 0, 7636, 0 },
+		{ 0, 12, 0, 7638, 0 }, { 0, 12, 0, 7640, 0 }, { 0, 12, 0, 7642, 0 }, { 0, 12, 0, 7644, 0 }, { 0, 12, 0, 7646, 0 }, { 0, 12, 0, 7648, 0 }, { 0, 12, 0, 7650, 0 }, { 0, 12, 0, 7652, 0 },
+		{ 0, 12, 0, 7656, 0 }, { 0, 12, 0, 7660, 0 }, { 0, 12, 0, 7664, 0 }, { 0, 12, 0, 7668, 0 }, { 0, 12, 0, 7672, 0 }, { 0, 12, 0, 7676, 0 }, { 0, 12, 0, 7680, 0 }, { 0, 12, 0, 7684, 0 },
+		{ 0, 12, 0, 7686, 0 }, { 0, 12, 0, 7690, 0 }, { 0, 12, 0, 7694, 0 }, { 0, 12, 0, 7698, 0 }, { 0, 12, 0, 7702, 0 }, { 0, 12, 0, 7705, 0 }, { 0, 12, 0, 7708, 0 }, { 0, 12, 0, 7711, 0 },
+		{ 0, 12, 0, 7714, 0 }, { 0, 12, 0, 7717, 0 }, { 0, 12, 0, 7720, 0 }, { 0, 12, 0, 7723, 0 }, { 0, 12, 0, 7726, 0 }, { 0, 12, 0, 7729, 0 }, { 0, 12, 0, 7732, 0 }, { 0, 12, 0, 7735, 0 },
+		{ 0, 12, 0, 7738, 0 }, { 0, 12, 0, 7741, 0 }, { 0, 12, 0, 7744, 0 }, { 0, 12, 0, 7747, 0 }, { 0, 12, 0, 7750, 0 }, { 0, 12, 0, 7753, 0 }, { 0, 12, 0, 7756, 0 }, { 0, 12, 0, 7759, 0 },
+		{ 0, 12, 0, 7762, 0 }, { 0, 12, 0, 7765, 0 }, { 0, 12, 0, 7768, 0 }, { 0, 12, 0, 7771, 0 }, { 0, 12, 0, 7774, 0 }, { 0, 12, 0, 7777, 0 }, { 0, 12, 0, 7780, 0 }, { 0, 12, 0, 7783, 0 },
+		{ 0, 12, 0, 7786, 0 }, { 0, 12, 0, 7789, 0 }, { 0, 12, 0, 7792, 0 }, { 0, 12, 0, 7795, 0 }, { 0, 12, 0, 7798, 0 }, { 0, 12, 0, 7801, 0 }, { 0, 12, 0, 7804, 0 }, { 0, 12, 0, 7807, 0 },
+		{ 0, 12, 0, 7810, 0 }, { 0, 12, 0, 7813, 0 }, { 0, 12, 0, 7816, 0 }, { 0, 12, 0, 7819, 0 }, { 0, 12, 0, 7822, 0 }, { 0, 12, 0, 7825, 0 }, { 0, 12, 0, 7828, 0 }, { 0, 12, 0, 7831, 0 },
+		{ 0, 12, 0, 7834, 0 }, { 0, 12, 0, 7837, 0 }, { 0, 12, 0, 7840, 0 }, { 0, 12, 0, 7843, 0 }, { 0, 12, 0, 7846, 0 }, { 0, 12, 0, 7849, 0 }, { 0, 12, 0, 7852, 0 }, { 0, 12, 0, 7855, 0 },
+		{ 0, 12, 0, 7858, 0 }, { 0, 12, 0, 7861, 0 }, { 0, 12, 0, 7864, 0 }, { 0, 12, 0, 7867, 0 }, { 0, 12, 0, 7870, 0 }, { 0, 12, 0, 7873, 0 }, { 0, 12, 0, 7876, 0 }, { 0, 12, 0, 7879, 0 },
+		{ 0, 12, 0, 7882, 0 }, { 0, 12, 0, 7885, 0 }, { 0, 12, 0, 7888, 0 }, { 0, 12, 0, 7891, 0 }, { 0, 12, 0, 7894, 0 }, { 0, 12, 0, 7897, 0 }, { 0, 12, 0, 7900, 0 }, { 0, 12, 0, 7903, 0 },
+		{ 0, 12, 0, 7906, 0 }, { 0, 12, 0, 7909, 0 }, { 0, 12, 0, 7912, 0 }, { 0, 12, 0, 7915, 0 }, { 0, 12, 0, 7918, 0 }, { 0, 12, 0, 7921, 0 }, { 0, 12, 0, 7924, 0 }, { 0, 12, 0, 7927, 0 },
+		{ 0, 12, 0, 7930, 0 }, { 0, 12, 0, 7933, 0 }, { 0, 12, 0, 7936, 0 }, { 0, 12, 0, 7939, 0 }, { 0, 12, 0, 7942, 0 }, { 0, 12, 0, 7945, 0 }, { 0, 12, 0, 7948, 0 }, { 0, 12, 0, 7951, 0 },
+		{ 0, 12, 0, 7954, 0 }, { 0, 12, 0, 7957, 0 }, { 0, 12, 0, 7960, 0 }, { 0, 12, 0, 7963, 0 }, { 0, 12, 0, 7966, 0 }, { 0, 12, 0, 7969, 0 }, { 0, 12, 0, 7973, 0 }, { 0, 12, 0, 7977, 0 },
+		{ 0, 12, 0, 7981, 0 }, { 0, 12, 0, 7985, 0 }, { 0, 12, 0, 7989, 0 }, { 0, 12, 0, 7993, 0 }, { 0, 12, 0, 7997, 0 }, { 0, 12, 0, 8001, 0 }, { 0, 12, 0, 8005, 0 }, { 0, 12, 0, 8008, 0 },
+		{ 0, 12, 0, 8011, 0 }, { 0, 12, 0, 8014, 0 }, { 0, 12, 0, 8017, 0 }, { 0, 12, 0, 8020, 0 }, { 0, 12, 0, 8023, 0 }, { 0, 12, 0, 8026, 0 }, { 0, 12, 0, 8029, 0 }, { 0, 12, 0, 8032, 0 },
+		{ 0, 12, 0, 8035, 0 }, { 0, 12, 0, 8038, 0 }, { 0, 12, 0, 8041, 0 }, { 0, 12, 0, 8044, 0 }, { 0, 12, 0, 8047, 0 }, { 0, 12, 0, 8050, 0 }, { 0, 12, 0, 8053, 0 }, { 0, 12, 0, 8057, 0 },
+		{ 0, 12, 0, 8061, 0 }, { 0, 12, 0, 8064, 0 }, { 0, 12, 0, 8067, 0 }, { 0, 12, 0, 8070, 0 }, { 0, 12, 0, 8073, 0 }, { 0, 12, 0, 8076, 0 }, { 0, 12, 0, 8079, 0 }, { 0, 12, 0, 8082, 0 },
+		{ 0, 12, 0, 8085, 0 }, { 0, 12, 0, 8088, 0 }, { 0, 12, 0, 8091, 0 }, { 0, 12, 0, 8094, 0 }, { 0, 12, 0, 8098, 0 }, { 0, 12, 0, 8102, 0 }, { 0, 12, 0, 8106, 0 }, { 0, 12, 0, 8109, 0 },
+		{ 0, 12, 0, 8112, 0 }, { 0, 12, 0, 8115, 0 }, { 0, 12, 0, 8118, 0 }, { 0, 12, 0, 8121, 0 }, { 0, 12, 0, 8124, 0 }, { 0, 12, 0, 8127, 0 }, { 0, 12, 0, 8130, 0 }, { 0, 12, 0, 8133, 0 },
+		{ 0, 12, 0, 8136, 0 }, { 0, 12, 0, 8139, 0 }, { 0, 12, 0, 8142, 0 }, { 0, 12, 0, 8145, 0 }, { 0, 12, 0, 8148, 0 }, { 0, 12, 0, 8151, 0 }, { 0, 12, 0, 8154, 0 }, { 0, 12, 0, 8157, 0 },
+		{ 0, 12, 0, 8160, 0 }, { 0, 12, 0, 8163, 0 }, { 0, 12, 0, 8166, 0 }, { 0, 12, 0, 8169, 0 }, { 0, 12, 0, 8172, 0 }, { 0, 12, 0, 8175, 0 }, { 0, 12, 0, 8178, 0 }, { 0, 12, 0, 8181, 0 },
+		{ 0, 12, 0, 8184, 0 }, { 0, 12, 0, 8187, 0 }, { 0, 12, 0, 8190, 0 }, { 0, 12, 0, 8194, 0 }, { 0, 12, 0, 8198, 0 }, { 0, 12, 0, 8202, 0 }, { 0, 12, 0, 8206, 0 }, { 0, 12, 0, 8210, 0 },
+		{ 0, 12, 0, 8214, 0 }, { 0, 12, 0, 8218, 0 }, { 0, 12, 0, 8222, 0 }, { 0, 12, 0, 8226, 0 }, { 0, 12, 0, 8230, 0 }, { 0, 12, 0, 8234, 0 }, { 0, 12, 0, 8238, 0 }, { 0, 12, 0, 8242, 0 },
+		{ 0, 12, 0, 8246, 0 }, { 0, 12, 0, 8250, 0 }, { 0, 12, 0, 8254, 0 }, { 0, 12, 0, 8258, 0 }, { 0, 12, 0, 8262, 0 }, { 0, 12, 0, 8266, 0 }, { 0, 12, 0, 8270, 0 }, { 0, 12, 0, 8274, 0 },
+		{ 0, 12, 0, 8278, 0 }, { 0, 12, 0, 8282, 0 }, { 0, 12, 0, 8286, 0 }, { 0, 12, 0, 8290, 0 }, { 0, 12, 0, 8294, 0 }, { 0, 12, 0, 8298, 0 }, { 0, 12, 0, 8302, 0 }, { 0, 12, 0, 8306, 0 },
+		{ 0, 12, 0, 8310, 0 }, { 0, 12, 0, 8314, 0 }, { 0, 12, 0, 8318, 0 }, { 0, 12, 0, 8322, 0 }, { 0, 12, 0, 8326, 0 }, { 0, 12, 0, 8330, 0 }, { 0, 12, 0, 8334, 0 }, { 0, 12, 0, 8338, 0 },
+		{ 0, 12, 0, 8342, 0 }, { 0, 12, 0, 8346, 0 }, { 0, 12, 0, 8350, 0 }, { 0, 12, 0, 8354, 0 }, { 0, 12, 0, 8358, 0 }, { 0, 12, 0, 8362, 0 }, { 0, 12, 0, 8366, 0 }, { 0, 12, 0, 8370, 0 },
+		{ 0, 12, 0, 8374, 0 }, { 0, 12, 0, 8378, 0 }, { 0, 12, 0, 8382, 0 }, { 0, 12, 0, 8386, 0 }, { 0, 12, 0, 8390, 0 }, { 0, 12, 0, 8394, 0 }, { 0, 12, 0, 8398, 0 }, { 0, 12, 0, 8402, 0 },
+		{ 0, 12, 0, 8406, 0 }, { 0, 12, 0, 8410, 0 }, { 0, 12, 0, 8414, 0 }, { 0, 12, 0, 8418, 0 }, { 0, 12, 0, 8422, 0 }, { 0, 12, 0, 8426, 0 }, { 0, 12, 0, 8430, 0 }, { 0, 12, 0, 8434, 0 },
+		{ 0, 12, 0, 8438, 0 }, { 0, 12, 0, 8442, 0 }, { 0, 12, 0, 8446, 0 }, { 0, 12, 0, 8450, 0 }, { 0, 12, 0, 8454, 0 }, { 0, 12, 0, 8458, 0 }, { 0, 12, 0, 8462, 0 }, { 0, 12, 0, 8466, 0 },
+		{ 0, 12, 0, 8470, 0 }, { 0, 12, 0, 8474, 0 }, { 0, 12, 0, 8478, 0 }, { 0, 12, 0, 8482, 0 }, { 0, 12, 0, 8486, 0 }, { 0, 12, 0, 8490, 0 }, { 0, 12, 0, 8494, 0 }, { 0, 12, 0, 8498, 0 },
+		{ 0, 12, 0, 8502, 0 }, { 0, 12, 0, 8506, 0 }, { 0, 12, 0, 8510, 0 }, { 0, 12, 0, 8514, 0 }, { 0, 12, 0, 8518, 0 }, { 0, 12, 0, 8522, 0 }, { 0, 12, 0, 8526, 0 }, { 0, 12, 0, 8530, 0 },
+		{ 0, 12, 0, 8534, 0 }, { 0, 12, 0, 8538, 0 }, { 0, 12, 0, 8542, 0 }, { 0, 12, 0, 8546, 0 }, { 0, 12, 0, 8550, 0 }, { 0, 12, 0, 8554, 0 }, { 0, 12, 0, 8558, 0 }, { 0, 12, 0, 8562, 0 },
+		{ 0, 12, 0, 8566, 0 }, { 0, 12, 0, 8570, 0 }, { 0, 12, 0, 8574, 0 }, { 0, 12, 0, 8579, 0 }, { 0, 12, 0, 8584, 0 }, { 0, 12, 0, 8589, 0 }, { 0, 12, 0, 8594, 0 }, { 0, 12, 0, 8599, 0 },
+		{ 0, 12, 0, 8604, 0 }, { 0, 12, 0, 8609, 0 }, { 0, 12, 0, 8613, 0 }, { 0, 12, 0, 8632, 0 }, { 0, 12, 0, 8641, 0 }, { 0, 12, 0, 8646, 0 }, { 0, 12, 0, 8648, 0 }, { 0, 12, 0, 8650, 0 },
+		{ 0, 12, 0, 8652, 0 }, { 0, 12, 0, 931, 0 }, { 0, 12, 0, 8654, 0 }, { 0, 12, 0, 8656, 0 }, { 0, 12, 0, 8658, 0 }, { 0, 12, 0, 8660, 0 }, { 0, 12, 0, 8662, 0 }, { 0, 12, 0, 8664, 0 },
+		{ 0, 12, 0, 8666, 0 }, { 0, 12, 0, 8668, 0 }, { 0, 12, 0, 8670, 0 }, { 0, 12, 0, 8672, 0 }, { 0, 12, 0, 8674, 0 }, { 0, 12, 0, 8676, 0 }, { 0, 12, 0, 8678, 0 }, { 0, 12, 0, 8680, 0 },
+		{ 0, 12, 0, 8682, 0 }, { 0, 12, 0, 3744, 0 }, { 0, 12, 0, 3746, 0 }, { 0, 12, 0, 8684, 0 }, { 0, 12, 0, 8686, 0 }, { 0, 12, 0, 8688, 0 }, { 0, 12, 0, 8690, 0 }, { 0, 12, 0, 8692, 0 },
+		{ 0, 12, 0, 8694, 0 }, { 0, 12, 0, 8696, 0 }, { 0, 12, 0, 8698, 0 }, { 0, 12, 0, 8700, 0 }, { 0, 12, 0, 8702, 0 }, { 0, 12, 0, 8704, 0 }, { 0, 12, 0, 8706, 0 }, { 0, 12, 0, 8708, 0 },
+		{ 0, 12, 0, 8710, 0 }, { 0, 12, 0, 8712, 0 }, { 0, 12, 0, 8714, 0 }, { 0, 12, 0, 8716, 0 }, { 0, 12, 0, 8719, 0 }, { 0, 12, 0, 8722, 0 }, { 0, 12, 0, 8725, 0 }, { 0, 12, 0, 8728, 0 },
+		{ 0, 12, 0, 8731, 0 }, { 0, 12, 0, 8734, 0 }, { 0, 12, 0, 8737, 0 }, { 0, 12, 0, 8740, 0 }, { 0, 12, 0, 8743, 0 }, { 0, 12, 0, 8746, 0 }, { 0, 12, 0, 8749, 0 }, { 0, 12, 0, 8752, 0 },
+		{ 0, 12, 0, 8755, 0 }, { 0, 12, 0, 8758, 0 }, { 0, 12, 0, 1191, 0 }, { 0, 12, 0, 1194, 0 }, { 0, 12, 0, 1197, 0 }, { 0, 12, 0, 1200, 0 }, { 0, 12, 0, 1203, 0 }, { 0, 12, 0, 8760, 0 },
+		{ 0, 12, 0, 8762, 0 }, { 0, 12, 0, 8764, 0 }, { 0, 12, 0, 8766, 0 }, { 0, 12, 0, 8768, 0 }, { 0, 12, 0, 8770, 0 }, { 0, 12, 0, 8772, 0 }, { 0, 12, 0, 8774, 0 }, { 0, 12, 0, 8776, 0 },
+		{ 0, 12, 0, 8778, 0 }, { 0, 12, 0, 8780, 0 }, { 0, 12, 0, 8782, 0 }, { 0, 12, 0, 8784, 0 }, { 0, 12, 0, 8786, 0 }, { 0, 12, 0, 8788, 0 }, { 0, 12, 0, 8790, 0 }, { 0, 12, 0, 8792, 0 },
+		{ 0, 12, 0, 8794, 0 }, { 0, 12, 0, 8796, 0 }, { 0, 12, 0, 8798, 0 }, { 0, 12, 0, 8800, 0 }, { 0, 12, 0, 8802, 0 }, { 0, 12, 0, 8804, 0 }, { 0, 12, 0, 8806, 0 }, { 0, 12, 0, 8808, 0 },
+		{ 0, 12, 0, 8810, 0 }, { 0, 12, 0, 8812, 0 }, { 0, 12, 0, 8814, 0 }, { 0, 12, 0, 8816, 0 }, { 0, 12, 0, 8818, 0 }, { 0, 12, 0, 8822, 0 }, { 0, 12, 0, 8826, 0 }, { 0, 12, 0, 8830, 0 },
+		{ 0, 12, 0, 8833, 0 }, { 0, 12, 0, 8835, 0 }, { 0, 12, 0, 8837, 0 }, { 0, 12, 0, 8839, 0 }, { 0, 12, 0, 3280, 0 }, { 0, 12, 0, 8841, 0 }, { 0, 12, 0, 8843, 0 }, { 0, 12, 0, 8845, 0 },
+		{ 0, 12, 0, 8847, 0 }, { 0, 12, 0, 8849, 0 }, { 0, 12, 0, 8851, 0 }, { 0, 12, 0, 8853, 0 }, { 0, 12, 0, 8855, 0 }, { 0, 12, 0, 8857, 0 }, { 0, 12, 0, 8859, 0 }, { 0, 12, 0, 8861, 0 },
+		{ 0, 12, 0, 8863, 0 }, { 0, 12, 0, 8865, 0 }, { 0, 12, 0, 8867, 0 }, { 0, 12, 0, 8869, 0 }, { 0, 12, 0, 8871, 0 }, { 0, 12, 0, 8873, 0 }, { 0, 12, 0, 8875, 0 }, { 0, 12, 0, 8877, 0 },
+		{ 0, 12, 0, 8879, 0 }, { 0, 12, 0, 8881, 0 }, { 0, 12, 0, 8883, 0 }, { 0, 12, 0, 8885, 0 }, { 0, 12, 0, 8887, 0 }, { 0, 12, 0, 8889, 0 }, { 0, 12, 0, 8891, 0 }, { 0, 12, 0, 8893, 0 },
+		{ 0, 12, 0, 8895, 0 }, { 0, 12, 0, 8897, 0 }, { 0, 12, 0, 8899, 0 }, { 0, 12, 0, 8901, 0 }, { 0, 10, 8903, 8903, 0 }, { 0, 0, 0, 0, 2224 }, { 0, 0, 0, 0, 2227 }, { 0, 10, 8906, 8906, 0 },
+		{ 0, 12, 0, 8909, 0 }, { 0, 12, 0, 8911, 0 }, { 0, 12, 0, 8913, 0 }, { 0, 12, 0, 8915, 0 }, { 0, 12, 0, 8917, 0 }, { 0, 12, 0, 8919, 0 }, { 0, 12, 0, 8921, 0 }, { 0, 12, 0, 8923, 0 },
+		{ 0, 12, 0, 8925, 0 }, { 0, 12, 0, 8927, 0 }, { 0, 12, 0, 8929, 0 }, { 0, 12, 0, 8931, 0 }, { 0, 12, 0, 8933, 0 }, { 0, 12, 0, 8935, 0 }, { 0, 12, 0, 8937, 0 }, { 0, 12, 0, 8939, 0 },
+		{ 0, 12, 0, 8941, 0 }, { 0, 12, 0, 8943, 0 }, { 0, 12, 0, 8945, 0 }, { 0, 12, 0, 8947, 0 }, { 0, 12, 0, 8949, 0 }, { 0, 12, 0, 8951, 0 }, { 0, 12, 0, 8953, 0 }, { 0, 12, 0, 8955, 0 },
+		{ 0, 12, 0, 8957, 0 }, { 0, 12, 0, 8959, 0 }, { 0, 12, 0, 8961, 0 }, { 0, 12, 0, 8963, 0 }, { 0, 12, 0, 8965, 0 }, { 0, 12, 0, 8967, 0 }, { 0, 12, 0, 8969, 0 }, { 0, 12, 0, 8971, 0 },
+		{ 0, 12, 0, 8973, 0 }, { 0, 12, 0, 8975, 0 }, { 0, 12, 0, 8977, 0 }, { 0, 12, 0, 8979, 0 }, { 0, 12, 0, 8981, 0 }, { 0, 12, 0, 8983, 0 }, { 0, 12, 0, 8985, 0 }, { 0, 12, 0, 8987, 0 },
+		{ 0, 12, 0, 8989, 0 }, { 0, 12, 0, 8991, 0 }, { 0, 12, 0, 8993, 0 }, { 0, 12, 0, 8995, 0 }, { 0, 12, 0, 8997, 0 }, { 0, 12, 0, 8999, 0 }, { 0, 12, 0, 9001, 0 }, { 0, 12, 0, 9003, 0 },
+		{ 0, 12, 0, 9005, 0 }, { 0, 12, 0, 9007, 0 }, { 0, 12, 0, 9009, 0 }, { 0, 12, 0, 9011, 0 }, { 0, 12, 0, 9013, 0 }, { 0, 12, 0, 9015, 0 }, { 0, 0, 0, 0, 2230 }, { 0, 10, 9017, 9017, 0 },
+		{ 0, 0, 0, 0, 2233 }, { 0, 10, 9020, 9020, 0 }, { 0, 0, 0, 0, 2236 }, { 0, 10, 9023, 9023, 0 }, { 0, 10, 9026, 9026, 0 }, { 0, 10, 9029, 9029, 0 }, { 0, 0, 0, 0, 2239 }, { 0, 0, 0, 0, 2242 },
+		{ 0, 0, 0, 0, 2245 }, { 0, 10, 9032, 9032, 0 }, { 0, 10, 9035, 9035, 0 }, { 0, 0, 0, 0, 2250 }, { 0, 10, 9038, 9038, 0 }, { 0, 0, 0, 0, 2253 }, { 0, 10, 9041, 9041, 0 }, { 0, 0, 0, 0, 2256 },
+		{ 0, 10, 9044, 9044, 0 }, { 0, 0, 0, 0, 2259 }, { 0, 10, 9047, 9047, 0 }, { 0, 5, 0, 0, 2262 }, { 0, 15, 9050, 9050, 0 }, { 0, 15, 9053, 9053, 0 }, { 0, 15, 9056, 9056, 0 }, { 0, 0, 0, 0, 2269 },
+		{ 0, 10, 9059, 9059, 0 }, { 0, 10, 9062, 9062, 0 }, { 0, 10, 9065, 9065, 0 }, { 0, 0, 0, 0, 2276 }, { 0, 0, 0, 0, 2279 }, { 0, 10, 9068, 9068, 0 }, { 0, 10, 9071, 9071, 0 }, { 0, 0, 0, 0, 2282 },
+		{ 0, 10, 9074, 9074, 0 }, { 0, 5, 0, 0, 2285 }, { 0, 15, 9077, 9077, 2294 }, { 0, 15, 9080, 9080, 2299 }, { 0, 15, 9083, 9083, 0 }, { 0, 15, 9086, 9086, 0 }, { 0, 15, 9089, 9089, 0 }, { 0, 15, 9092, 9092, 0 },
+		{ 0, 15, 9096, 9096, 0 }, { 0, 15, 9100, 9100, 0 }, { 0, 5, 0, 0, 2302 }, { 0, 0, 0, 0, 2305 }, { 0, 5, 0, 0, 2308 }, { 0, 15, 9104, 9104, 0 }, { 0, 10, 9107, 9107, 2311 }, { 0, 10, 9110, 9110, 0 },
+		{ 6, 0, 0, 0, 0 }, { 0, 15, 9114, 9114, 0 }, { 0, 15, 9117, 9117, 0 }, { 0, 15, 9120, 9120, 0 }, { 0, 15, 9124, 9124, 0 }, { 0, 15, 9128, 9128, 0 }, { 0, 15, 9132, 9132, 0 }, { 0, 15, 9136, 9136, 0 },
+		{ 226, 0, 0, 0, 0 }, { 0, 15, 9140, 9140, 0 }, { 0, 15, 9143, 9143, 0 }, { 0, 15, 9146, 9146, 0 }, { 0, 15, 9150, 9150, 0 }, { 0, 15, 9154, 9154, 0 }, { 0, 15, 9158, 9158, 0 }, { 0, 12, 0, 9162, 0 },
+		{ 0, 12, 0, 9164, 0 }, { 0, 12, 0, 9166, 0 }, { 0, 12, 0, 9168, 0 }, { 0, 12, 0, 9170, 0 }, { 0, 12, 0, 9172, 0 }, { 0, 12, 0, 9174, 0 }, { 0, 12, 0, 9176, 0 }, { 0, 12, 0, 9178, 0 },
+		{ 0, 12, 0, 9180, 0 }, { 0, 12, 0, 9182, 0 }, { 0, 12, 0, 9184, 0 }, { 0, 12, 0, 9186, 0 }, { 0, 12, 0, 9188, 0 }, { 0, 12, 0, 9190, 0 }, { 0, 12, 0, 9192, 0 }, { 0, 12, 0, 9194, 0 },
+		{ 0, 12, 0, 1008, 0 }, { 0, 12, 0, 9196, 0 }, { 0, 12, 0, 9198, 0 }, { 0, 12, 0, 9200, 0 }, { 0, 12, 0, 3440, 0 }, { 0, 12, 0, 9202, 0 }, { 0, 12, 0, 9204, 0 }, { 0, 12, 0, 9206, 0 },
+		{ 0, 12, 0, 9208, 0 }, { 0, 12, 0, 3131, 0 }, { 0, 12, 0, 9210, 0 }, { 0, 12, 0, 9212, 0 }, { 0, 12, 0, 9214, 0 }, { 0, 12, 0, 9216, 0 }, { 0, 12, 0, 9218, 0 }, { 0, 12, 0, 9220, 0 },
+		{ 0, 12, 0, 9222, 0 }, { 0, 12, 0, 9224, 0 }, { 0, 12, 0, 9226, 0 }, { 0, 12, 0, 9228, 0 }, { 0, 12, 0, 9230, 0 }, { 0, 12, 0, 9232, 0 }, { 0, 12, 0, 9234, 0 }, { 0, 12, 0, 9236, 0 },
+		{ 0, 12, 0, 9238, 0 }, { 0, 12, 0, 9240, 0 }, { 0, 12, 0, 9242, 0 }, { 0, 12, 0, 9244, 0 }, { 0, 12, 0, 9246, 0 }, { 0, 12, 0, 9248, 0 }, { 0, 12, 0, 9250, 0 }, { 0, 12, 0, 9252, 0 },
+		{ 0, 12, 0, 9254, 0 }, { 0, 12, 0, 9256, 0 }, { 0, 12, 0, 9258, 0 }, { 0, 12, 0, 9260, 0 }, { 0, 12, 0, 9262, 0 }, { 0, 12, 0, 9264, 0 }, { 0, 12, 0, 9266, 0 }, { 0, 12, 0, 9268, 0 },
+		{ 0, 12, 0, 9270, 0 }, { 0, 12, 0, 9272, 0 }, { 0, 12, 0, 9274, 0 }, { 0, 12, 0, 9276, 0 }, { 0, 12, 0, 9278, 0 }, { 0, 12, 0, 9280, 0 }, { 0, 12, 0, 9282, 0 }, { 0, 12, 0, 9284, 0 },
+		{ 0, 12, 0, 9286, 0 }, { 0, 12, 0, 9288, 0 }, { 0, 12, 0, 9290, 0 }, { 0, 12, 0, 9292, 0 }, { 0, 12, 0, 9294, 0 }, { 0, 12, 0, 9296, 0 }, { 0, 12, 0, 9298, 0 }, { 0, 12, 0, 9300, 0 },
+		{ 0, 12, 0, 9302, 0 }, { 0, 12, 0, 9304, 0 }, { 0, 12, 0, 9306, 0 }, { 0, 12, 0, 9308, 0 }, { 0, 12, 0, 9310, 0 }, { 0, 12, 0, 9312, 0 }, { 0, 12, 0, 9314, 0 }, { 0, 12, 0, 9316, 0 },
+		{ 0, 12, 0, 9318, 0 }, { 0, 12, 0, 9321, 0 }, { 0, 12, 0, 9324, 0 }, { 0, 12, 0, 9327, 0 }, { 0, 12, 0, 9330, 0 }, { 0, 12, 0, 9333, 0 }, { 0, 12, 0, 9336, 0 }, { 0, 12, 0, 9339, 0 },
+		{ 0, 12, 0, 9342, 0 }, { 0, 12, 0, 9345, 0 }, { 0, 12, 0, 9348, 0 }, { 0, 12, 0, 9351, 0 }, { 0, 12, 0, 9355, 0 }, { 0, 12, 0, 9359, 0 }, { 0, 12, 0, 9363, 0 }, { 0, 12, 0, 9367, 0 },
+		{ 0, 12, 0, 9371, 0 }, { 0, 12, 0, 9375, 0 }, { 0, 12, 0, 9379, 0 }, { 0, 12, 0, 9383, 0 }, { 0, 12, 0, 9387, 0 }, { 0, 12, 0, 9391, 0 }, { 0, 12, 0, 9395, 0 }, { 0, 12, 0, 9399, 0 },
+		{ 0, 12, 0, 9403, 0 }, { 0, 12, 0, 9407, 0 }, { 0, 12, 0, 9411, 0 }, { 0, 12, 0, 9415, 0 }, { 0, 12, 0, 9419, 0 }, { 0, 12, 0, 9423, 0 }, { 0, 12, 0, 9427, 0 }, { 0, 12, 0, 9431, 0 },
+		{ 0, 12, 0, 9435, 0 }, { 0, 12, 0, 9439, 0 }, { 0, 12, 0, 9443, 0 }, { 0, 12, 0, 9447, 0 }, { 0, 12, 0, 9451, 0 }, { 0, 12, 0, 9455, 0 }, { 0, 12, 0, 9459, 0 }, { 0, 12, 0, 9462, 0 },
+		{ 0, 12, 0, 9465, 0 }, { 0, 12, 0, 9468, 0 }, { 0, 12, 0, 9471, 0 }, { 0, 12, 0, 9474, 0 }, { 0, 12, 0, 9478, 0 }, { 0, 12, 0, 9481, 0 }, { 0, 12, 0, 9484, 0 }, { 0, 12, 0, 9487, 0 },
+		{ 0, 12, 0, 9490, 0 }, { 0, 12, 0, 9493, 0 }, { 0, 12, 0, 9496, 0 }, { 0, 12, 0, 9499, 0 }, { 0, 12, 0, 9501, 0 }, { 0, 12, 0, 4641, 0 }, { 0, 12, 0, 9503, 0 }, { 0, 12, 0, 9505, 0 },
+		{ 0, 12, 0, 9507, 0 }, { 0, 12, 0, 9509, 0 }, { 0, 12, 0, 9511, 0 }, { 0, 12, 0, 6966, 0 }, { 0, 12, 0, 9513, 0 }, { 0, 12, 0, 9515, 0 }, { 0, 12, 0, 9517, 0 }, { 0, 12, 0, 9519, 0 },
+		{ 0, 12, 0, 9521, 0 }, { 0, 12, 0, 9523, 0 }, { 0, 12, 0, 9525, 0 }, { 0, 12, 0, 9527, 0 }, { 0, 12, 0, 9529, 0 }, { 0, 12, 0, 9531, 0 }, { 0, 12, 0, 9533, 0 }, { 0, 12, 0, 9535, 0 },
+		{ 0, 12, 0, 9537, 0 }, { 0, 12, 0, 9539, 0 }, { 0, 12, 0, 9541, 0 }, { 0, 12, 0, 9543, 0 }, { 0, 12, 0, 9545, 0 }, { 0, 12, 0, 9547, 0 }, { 0, 12, 0, 9549, 0 }, { 0, 12, 0, 9551, 0 },
+		{ 0, 12, 0, 9553, 0 }, { 0, 12, 0, 9555, 0 }, { 0, 12, 0, 9557, 0 }, { 0, 12, 0, 9559, 0 }, { 0, 12, 0, 9563, 0 }, { 0, 12, 0, 9567, 0 }, { 0, 12, 0, 9571, 0 }, { 0, 12, 0, 9575, 0 },
+		{ 0, 12, 0, 9579, 0 }, { 0, 12, 0, 9583, 0 }, { 0, 12, 0, 9587, 0 }, { 0, 12, 0, 9591, 0 }, { 0, 12, 0, 9595, 0 }, { 0, 12, 0, 9597, 0 }, { 0, 15, 9599, 9599, 0 }, { 0, 15, 9601, 9601, 0 },
+		{ 0, 15, 9603, 9603, 0 }, { 0, 15, 9605, 9605, 0 }, { 0, 15, 9607, 9607, 0 }, { 0, 15, 9609, 9609, 0 }, { 0, 15, 9611, 9611, 0 }, { 0, 15, 9613, 9613, 0 }, { 0, 15, 9615, 9615, 0 }, { 0, 15, 9617, 9617, 0 },
+		{ 0, 15, 9619, 9619, 0 }, { 0, 15, 9621, 9621, 0 }, { 0, 15, 9623, 9623, 0 }, { 0, 15, 9625, 9625, 0 }, { 0, 15, 9627, 9627, 0 }, { 0, 15, 9629, 9629, 0 }, { 0, 15, 9631, 9631, 0 }, { 0, 15, 9633, 9633, 0 },
+		{ 0, 15, 9517, 9517, 0 }, { 0, 15, 9635, 9635, 0 }, { 0, 15, 9637, 9637, 0 }, { 0, 15, 9639, 9639, 0 }, { 0, 15, 9641, 9641, 0 }, { 0, 15, 9643, 9643, 0 }, { 0, 15, 9645, 9645, 0 }, { 0, 15, 4110, 4110, 0 },
+		{ 0, 15, 9647, 9647, 0 }, { 0, 15, 9649, 9649, 0 }, { 0, 15, 9651, 9651, 0 }, { 0, 15, 9653, 9653, 0 }, { 0, 15, 9553, 9553, 0 }, { 0, 15, 9655, 9655, 0 }, { 0, 15, 9657, 9657, 0 }, { 0, 15, 9659, 9659, 0 },
+		{ 0, 15, 9661, 9661, 0 }, { 0, 15, 9663, 9663, 0 }, { 0, 15, 9665, 9665, 0 }, { 0, 15, 9667, 9667, 0 }, { 0, 15, 9669, 9669, 0 }, { 0, 15, 9671, 9671, 0 }, { 0, 15, 9673, 9673, 0 }, { 0, 15, 9675, 9675, 0 },
+		{ 0, 15, 9677, 9677, 0 }, { 0, 15, 9679, 9679, 0 }, { 0, 15, 9681, 9681, 0 }, { 0, 15, 9683, 9683, 0 }, { 0, 15, 9685, 9685, 0 }, { 0, 15, 9687, 9687, 0 }, { 0, 15, 9689, 9689, 0 }, { 0, 15, 9691, 9691, 0 },
+		{ 0, 15, 9693, 9693, 0 }, { 0, 15, 9695, 9695, 0 }, { 0, 15, 9697, 9697, 0 }, { 0, 15, 9699, 9699, 0 }, { 0, 15, 9701, 9701, 0 }, { 0, 15, 9703, 9703, 0 }, { 0, 15, 9705, 9705, 0 }, { 0, 15, 9707, 9707, 0 },
+		{ 0, 15, 9709, 9709, 0 }, { 0, 15, 9711, 9711, 0 }, { 0, 15, 9713, 9713, 0 }, { 0, 15, 9715, 9715, 0 }, { 0, 15, 9717, 9717, 0 }, { 0, 15, 9719, 9719, 0 }, { 0, 15, 9721, 9721, 0 }, { 0, 15, 9723, 9723, 0 },
+		{ 0, 15, 9725, 9725, 0 }, { 0, 15, 9727, 9727, 0 }, { 0, 15, 9729, 9729, 0 }, { 0, 15, 9731, 9731, 0 }, { 0, 15, 9733, 9733, 0 }, { 0, 15, 9735, 9735, 0 }, { 0, 15, 9737, 9737, 0 }, { 0, 15, 9739, 9739, 0 },
+		{ 0, 15, 9741, 9741, 0 }, { 0, 15, 9743, 9743, 0 }, { 0, 15, 9745, 9745, 0 }, { 0, 15, 9503, 9503, 0 }, { 0, 15, 9747, 9747, 0 }, { 0, 15, 9749, 9749, 0 }, { 0, 15, 9751, 9751, 0 }, { 0, 15, 9753, 9753, 0 },
+		{ 0, 15, 9755, 9755, 0 }, { 0, 15, 9757, 9757, 0 }, { 0, 15, 9759, 9759, 0 }, { 0, 15, 9761, 9761, 0 }, { 0, 15, 9763, 9763, 0 }, { 0, 15, 9765, 9765, 0 }, { 0, 15, 9767, 9767, 0 }, { 0, 15, 9769, 9769, 0 },
+		{ 0, 15, 9771, 9771, 0 }, { 0, 15, 9773, 9773, 0 }, { 0, 15, 9775, 9775, 0 }, { 0, 15, 9777, 9777, 0 }, { 0, 15, 9779, 9779, 0 }, { 0, 15, 9781, 9781, 0 }, { 0, 15, 9783, 9783, 0 }, { 0, 15, 9785, 9785, 0 },
+		{ 0, 15, 9787, 9787, 0 }, { 0, 15, 4162, 4162, 0 }, { 0, 15, 9789, 9789, 0 }, { 0, 15, 9791, 9791, 0 }, { 0, 15, 9793, 9793, 0 }, { 0, 15, 9795, 9795, 0 }, { 0, 15, 9797, 9797, 0 }, { 0, 15, 9799, 9799, 0 },
+		{ 0, 15, 9801, 9801, 0 }, { 0, 15, 9803, 9803, 0 }, { 0, 15, 9805, 9805, 0 }, { 0, 15, 9807, 9807, 0 }, { 0, 15, 9809, 9809, 0 }, { 0, 15, 9811, 9811, 0 }, { 0, 15, 9813, 9813, 0 }, { 0, 15, 9815, 9815, 0 },
+		{ 0, 15, 9817, 9817, 0 }, { 0, 15, 9819, 9819, 0 }, { 0, 15, 9821, 9821, 0 }, { 0, 15, 9823, 9823, 0 }, { 0, 15, 9825, 9825, 0 }, { 0, 15, 9827, 9827, 0 }, { 0, 15, 9829, 9829, 0 }, { 0, 15, 9831, 9831, 0 },
+		{ 0, 15, 9833, 9833, 0 }, { 0, 15, 9835, 9835, 0 }, { 0, 15, 4186, 4186, 0 }, { 0, 15, 9837, 9837, 0 }, { 0, 15, 9839, 9839, 0 }, { 0, 15, 9841, 9841, 0 }, { 0, 15, 9843, 9843, 0 }, { 0, 15, 9845, 9845, 0 },
+		{ 0, 15, 9847, 9847, 0 }, { 0, 15, 9849, 9849, 0 }, { 0, 15, 9851, 9851, 0 }, { 0, 15, 9853, 9853, 0 }, { 0, 15, 9855, 9855, 0 }, { 0, 15, 9857, 9857, 0 }, { 0, 15, 9859, 9859, 0 }, { 0, 15, 9861, 9861, 0 },
+		{ 0, 15, 9863, 9863, 0 }, { 0, 15, 9865, 9865, 0 }, { 0, 15, 9867, 9867, 0 }, { 0, 15, 9869, 9869, 0 }, { 0, 15, 9871, 9871, 0 }, { 0, 15, 9873, 9873, 0 }, { 0, 15, 9875, 9875, 0 }, { 0, 15, 9877, 9877, 0 },
+		{ 0, 15, 9879, 9879, 0 }, { 0, 15, 9881, 9881, 0 }, { 0, 15, 9883, 9883, 0 }, { 0, 15, 9885, 9885, 0 }, { 0, 15, 9887, 9887, 0 }, { 0, 15, 9889, 9889, 0 }, { 0, 15, 9891, 9891, 0 }, { 0, 15, 9893, 9893, 0 },
+		{ 0, 15, 9895, 9895, 0 }, { 0, 15, 9897, 9897, 0 }, { 0, 15, 9899, 9899, 0 }, { 0, 15, 9901, 9901, 0 }, { 0, 15, 9903, 9903, 0 }, { 0, 15, 9905, 9905, 0 }, { 0, 15, 9907, 9907, 0 }, { 0, 15, 9909, 9909, 0 },
+		{ 0, 15, 9911, 9911, 0 }, { 0, 15, 9913, 9913, 0 }, { 0, 15, 9915, 9915, 0 }, { 0, 15, 9917, 9917, 0 }, { 0, 15, 9919, 9919, 0 }, { 0, 15, 9921, 9921, 0 }, { 0, 15, 9923, 9923, 0 }, { 0, 15, 9925, 9925, 0 },
+		{ 0, 15, 9927, 9927, 0 }, { 0, 15, 9929, 9929, 0 }, { 0, 15, 9931, 9931, 0 }, { 0, 15, 9933, 9933, 0 }, { 0, 15, 9935, 9935, 0 }, { 0, 15, 9937, 9937, 0 }, { 0, 15, 9939, 9939, 0 }, { 0, 15, 9941, 9941, 0 },
+		{ 0, 15, 9943, 9943, 0 }, { 0, 15, 9945, 9945, 0 }, { 0, 15, 9947, 9947, 0 }, { 0, 15, 9949, 9949, 0 }, { 0, 15, 9951, 9951, 0 }, { 0, 15, 9953, 9953, 0 }, { 0, 15, 9955, 9955, 0 }, { 0, 15, 9957, 9957, 0 },
+		{ 0, 15, 9959, 9959, 0 }, { 0, 15, 9961, 9961, 0 }, { 0, 15, 9963, 9963, 0 }, { 0, 15, 9965, 9965, 0 }, { 0, 15, 9967, 9967, 0 }, { 0, 15, 9969, 9969, 0 }, { 0, 15, 9971, 9971, 0 }, { 0, 15, 9973, 9973, 0 },
+		{ 0, 15, 9975, 9975, 0 }, { 0, 15, 9977, 9977, 0 }, { 0, 15, 9979, 9979, 0 }, { 0, 15, 9981, 9981, 0 }, { 0, 15, 9983, 9983, 0 }, { 0, 15, 9985, 9985, 0 }, { 0, 15, 9987, 9987, 0 }, { 0, 15, 9989, 9989, 0 },
+		{ 0, 15, 9991, 9991, 0 }, { 0, 15, 9993, 9993, 0 }, { 0, 15, 9995, 9995, 0 }, { 0, 15, 9997, 9997, 0 }, { 0, 15, 9999, 9999, 0 }, { 0, 15, 10001, 10001, 0 }, { 0, 15, 10003, 10003, 0 }, { 0, 15, 10005, 10005, 0 },
+		{ 0, 15, 10007, 10007, 0 }, { 0, 15, 10009, 10009, 0 }, { 0, 15, 10011, 10011, 0 }, { 0, 15, 10013, 10013, 0 }, { 0, 15, 10015, 10015, 0 }, { 0, 15, 10017, 10017, 0 }, { 0, 15, 10019, 10019, 0 }, { 0, 15, 10021, 10021, 0 },
+		{ 0, 15, 10023, 10023, 0 }, { 0, 15, 10025, 10025, 0 }, { 0, 15, 10027, 10027, 0 }, { 0, 15, 10029, 10029, 0 }, { 0, 15, 10031, 10031, 0 }, { 0, 15, 10033, 10033, 0 }, { 0, 15, 10035, 10035, 0 }, { 0, 15, 10037, 10037, 0 },
+		{ 0, 15, 10039, 10039, 0 }, { 0, 15, 10041, 10041, 0 }, { 0, 15, 10043, 10043, 0 }, { 0, 15, 10045, 10045, 0 }, { 0, 15, 10047, 10047, 0 }, { 0, 15, 10049, 10049, 0 }, { 0, 15, 10051, 10051, 0 }, { 0, 15, 10053, 10053, 0 },
+		{ 0, 15, 10055, 10055, 0 }, { 0, 15, 10057, 10057, 0 }, { 0, 15, 10059, 10059, 0 }, { 0, 15, 10061, 10061, 0 }, { 0, 15, 10063, 10063, 0 }, { 0, 15, 10065, 10065, 0 }, { 0, 15, 10067, 10067, 0 }, { 0, 15, 10069, 10069, 0 },
+		{ 0, 15, 10071, 10071, 0 }, { 0, 15, 10073, 10073, 0 }, { 0, 15, 10075, 10075, 0 }, { 0, 15, 10077, 10077, 0 }, { 0, 15, 10079, 10079, 0 }, { 0, 15, 10081, 10081, 0 }, { 0, 15, 10083, 10083, 0 }, { 0, 15, 10085, 10085, 0 },
+		{ 0, 15, 10087, 10087, 0 }, { 0, 15, 10089, 10089, 0 }, { 0, 15, 10091, 10091, 0 }, { 0, 15, 10093, 10093, 0 }, { 0, 15, 10095, 10095, 0 }, { 0, 15, 10097, 10097, 0 }, { 0, 15, 10099, 10099, 0 }, { 0, 15, 10101, 10101, 0 },
+		{ 0, 15, 10103, 10103, 0 }, { 0, 15, 10105, 10105, 0 }, { 0, 15, 10107, 10107, 0 }, { 0, 15, 10109, 10109, 0 }, { 0, 15, 10111, 10111, 0 }, { 0, 15, 10113, 10113, 0 }, { 0, 15, 10115, 10115, 0 }, { 0, 15, 10117, 10117, 0 },
+		{ 0, 15, 10119, 10119, 0 }, { 0, 15, 10121, 10121, 0 }, { 0, 15, 10123, 10123, 0 }, { 0, 15, 10125, 10125, 0 }, { 0, 15, 10127, 10127, 0 }, { 0, 15, 10129, 10129, 0 }, { 0, 15, 10131, 10131, 0 }, { 0, 15, 10133, 10133, 0 },
+		{ 0, 15, 10135, 10135, 0 }, { 0, 15, 10137, 10137, 0 }, { 0, 15, 10139, 10139, 0 }, { 0, 15, 10141, 10141, 0 }, { 0, 15, 10143, 10143, 0 }, { 0, 15, 10145, 10145, 0 }, { 0, 15, 10147, 10147, 0 }, { 0, 15, 10149, 10149, 0 },
+		{ 0, 15, 10151, 10151, 0 }, { 0, 15, 10153, 10153, 0 }, { 0, 15, 10155, 10155, 0 }, { 0, 15, 10157, 10157, 0 }, { 0, 15, 10159, 10159, 0 }, { 0, 15, 10161, 10161, 0 }, { 0, 15, 10163, 10163, 0 }, { 0, 15, 10165, 10165, 0 },
+		{ 0, 15, 10167, 10167, 0 }, { 0, 15, 10169, 10169, 0 }, { 0, 15, 10171, 10171, 0 }, { 0, 15, 10173, 10173, 0 }, { 0, 15, 10175, 10175, 0 }, { 0, 15, 10177, 10177, 0 }, { 0, 15, 10179, 10179, 0 }, { 0, 15, 10181, 10181, 0 },
+		{ 0, 15, 10183, 10183, 0 }, { 0, 15, 10185, 10185, 0 }, { 0, 15, 10187, 10187, 0 }, { 0, 15, 10189, 10189, 0 }, { 0, 15, 10191, 10191, 0 }, { 0, 15, 10193, 10193, 0 }, { 0, 15, 10195, 10195, 0 }, { 0, 15, 10197, 10197, 0 },
+		{ 0, 15, 10199, 10199, 0 }, { 0, 15, 10201, 10201, 0 }, { 0, 15, 10203, 10203, 0 }, { 0, 15, 10205, 10205, 0 }, { 0, 15, 10207, 10207, 0 }, { 0, 15, 10209, 10209, 0 }, { 0, 15, 10211, 10211, 0 }, { 0, 15, 10213, 10213, 0 },
+		{ 0, 15, 10215, 10215, 0 }, { 0, 15, 10217, 10217, 0 }, { 0, 15, 10219, 10219, 0 }, { 0, 15, 10221, 10221, 0 }, { 0, 15, 10223, 10223, 0 }, { 0, 15, 10225, 10225, 0 }, { 0, 15, 10227, 10227, 0 }, { 0, 15, 10229, 10229, 0 },
+		{ 0, 15, 10231, 10231, 0 }, { 0, 15, 10233, 10233, 0 }, { 0, 15, 10235, 10235, 0 }, { 0, 15, 10237, 10237, 0 }, { 0, 15, 10239, 10239, 0 }, { 0, 15, 10241, 10241, 0 }, { 0, 15, 10243, 10243, 0 }, { 0, 15, 10245, 10245, 0 },
+		{ 0, 15, 10247, 10247, 0 }, { 0, 15, 10249, 10249, 0 }, { 0, 15, 10251, 10251, 0 }, { 0, 15, 10253, 10253, 0 }, { 0, 15, 10255, 10255, 0 }, { 0, 15, 10257, 10257, 0 }, { 0, 15, 10259, 10259, 0 }, { 0, 15, 10261, 10261, 0 },
+		{ 0, 15, 10263, 10263, 0 }, { 0, 15, 10265, 10265, 0 }, { 0, 15, 10267, 10267, 0 }, { 0, 15, 10269, 10269, 0 }, { 0, 15, 10271, 10271, 0 }, { 0, 15, 10273, 10273, 0 }, { 0, 15, 10275, 10275, 0 }, { 0, 15, 10277, 10277, 0 },
+		{ 0, 15, 10279, 10279, 0 }, { 0, 15, 10281, 10281, 0 }, { 0, 15, 10283, 10283, 0 }, { 0, 15, 10285, 10285, 0 }, { 0, 15, 10287, 10287, 0 }, { 0, 15, 10289, 10289, 0 }, { 0, 15, 10291, 10291, 0 }, { 0, 15, 10293, 10293, 0 },
+		{ 0, 15, 10295, 10295, 0 }, { 0, 15, 10297, 10297, 0 }, { 0, 15, 10299, 10299, 0 }, { 0, 15, 10301, 10301, 0 }, { 0, 15, 10303, 10303, 0 }, { 0, 15, 10305, 10305, 0 }, { 0, 15, 10307, 10307, 0 }, { 0, 15, 10309, 10309, 0 },
+		{ 0, 15, 10311, 10311, 0 }, { 0, 15, 10313, 10313, 0 }, { 0, 15, 10315, 10315, 0 }, { 0, 15, 10317, 10317, 0 }, { 0, 15, 10319, 10319, 0 }, { 0, 15, 10321, 10321, 0 }, { 0, 15, 10323, 10323, 0 }, { 0, 15, 10325, 10325, 0 },
+		{ 0, 15, 10327, 10327, 0 }, { 0, 15, 10329, 10329, 0 }, { 0, 15, 10331, 10331, 0 }, { 0, 15, 10333, 10333, 0 }, { 0, 15, 10335, 10335, 0 }, { 0, 15, 10337, 10337, 0 }, { 0, 15, 10339, 10339, 0 }, { 0, 15, 10341, 10341, 0 },
+		{ 0, 15, 10343, 10343, 0 }, { 0, 15, 10345, 10345, 0 }, { 0, 15, 10347, 10347, 0 }, { 0, 15, 10349, 10349, 0 }, { 0, 15, 10351, 10351, 0 }, { 0, 15, 10353, 10353, 0 }, { 0, 15, 10355, 10355, 0 }, { 0, 15, 10357, 10357, 0 },
+		{ 0, 15, 10359, 10359, 0 }, { 0, 15, 10361, 10361, 0 }, { 0, 15, 10363, 10363, 0 }, { 0, 15, 10365, 10365, 0 }, { 0, 15, 10367, 10367, 0 }, { 0, 15, 10369, 10369, 0 }, { 0, 15, 10371, 10371, 0 }, { 0, 15, 4366, 4366, 0 },
+		{ 0, 15, 10373, 10373, 0 }, { 0, 15, 10375, 10375, 0 }, { 0, 15, 10377, 10377, 0 }, { 0, 15, 10379, 10379, 0 }, { 0, 15, 10381, 10381, 0 }, { 0, 15, 10383, 10383, 0 }, { 0, 15, 10385, 10385, 0 }, { 0, 15, 10387, 10387, 0 },
+		{ 0, 15, 10389, 10389, 0 }, { 0, 15, 10391, 10391, 0 }, { 0, 15, 10393, 10393, 0 }, { 0, 15, 4380, 4380, 0 }, { 0, 15, 10395, 10395, 0 }, { 0, 15, 10397, 10397, 0 }, { 0, 15, 10399, 10399, 0 }, { 0, 15, 10401, 10401, 0 },
+		{ 0, 15, 10403, 10403, 0 }, { 0, 15, 10405, 10405, 0 }, { 0, 15, 10407, 10407, 0 }, { 0, 15, 10409, 10409, 0 }, { 0, 15, 10411, 10411, 0 }, { 0, 15, 10413, 10413, 0 }, { 0, 15, 10415, 10415, 0 }, { 0, 15, 10417, 10417, 0 },
+		{ 0, 15, 10419, 10419, 0 }, { 0, 15, 10421, 10421, 0 }, { 0, 15, 10423, 10423, 0 }, { 0, 15, 10425, 10425, 0 }, { 0, 15, 10427, 10427, 0 }, { 0, 15, 10429, 10429, 0 }, { 0, 15, 10431, 10431, 0 }, { 0, 15, 10433, 10433, 0 },
+		{ 0, 15, 10435, 10435, 0 }, { 0, 15, 10437, 10437, 0 }, { 0, 15, 10439, 10439, 0 }, { 0, 15, 10441, 10441, 0 }, { 0, 15, 10443, 10443, 0 }, { 0, 15, 10445, 10445, 0 }, { 0, 15, 10447, 10447, 0 }, { 0, 15, 10449, 10449, 0 },
+		{ 0, 15, 10451, 10451, 0 }, { 0, 15, 10453, 10453, 0 }, { 0, 15, 10455, 10455, 0 }, { 0, 15, 10457, 10457, 0 }, { 0, 15, 10459, 10459, 0 }, { 0, 15, 10461, 10461, 0 }, { 0, 15, 10463, 10463, 0 }, { 0, 15, 10465, 10465, 0 },
+		{ 0, 15, 10467, 10467, 0 }, { 0, 15, 10469, 10469, 0 }, { 0, 15, 10471, 10471, 0 }, { 0, 15, 10473, 10473, 0 }, { 0, 15, 10475, 10475, 0 }, { 0, 15, 10477, 10477, 0 }, { 0, 15, 10479, 10479, 0 }, { 0, 15, 10481, 10481, 0 },
+		{ 0, 15, 10483, 10483, 0 }, { 0, 15, 10485, 10485, 0 }, { 0, 15, 10487, 10487, 0 }, { 0, 15, 10489, 10489, 0 }, { 0, 15, 10491, 10491, 0 }, { 0, 15, 10493, 10493, 0 }, { 0, 15, 10495, 10495, 0 }, { 0, 15, 10497, 10497, 0 },
+		{ 0, 15, 10499, 10499, 0 }, { 0, 15, 10501, 10501, 0 }, { 0, 15, 10503, 10503, 0 }, { 0, 15, 10505, 10505, 0 }, { 0, 15, 10507, 10507, 0 }, { 0, 15, 10509, 10509, 0 }, { 0, 15, 10511, 10511, 0 }, { 0, 15, 10513, 10513, 0 },
+		{ 0, 15, 10515, 10515, 0 }, { 0, 15, 10517, 10517, 0 }, { 0, 15, 4476, 4476, 0 }, { 0, 15, 10519, 10519, 0 }, { 0, 15, 4484, 4484, 0 }, { 0, 15, 10521, 10521, 0 }, { 0, 15, 10523, 10523, 0 }, { 0, 15, 10525, 10525, 0 },
+		{ 0, 15, 10527, 10527, 0 }, { 0, 15, 4494, 4494, 0 }, { 0, 15, 10529, 10529, 0 }
+	};
+
+	if(c >= 0x2FA1E) return properties[0];
+
+	return properties[records[((size_t)blocks[c >> 7] << 7) | (c & 0x7F)]];
+}
+
+// returns a full decomposition. The first entry is the number of characters and each character after it has its
+// combining class in the top 8 bits
+inline const std::uint32_t *GetUTF8Decomposition(size_t offset)
+{
+	static const std::uint32_t decompositions[10531] =
+	{
+		0x0, 0x1, 0x20, 0x2, 0x20, 0xE6000308, 0x1, 0x61, 0x2, 0x20, 0xE6000304, 0x1, 0x32, 0x1, 0x33, 0x2,
+		0x20, 0xE6000301, 0x1, 0x3BC, 0x2, 0x20, 0xCA000327, 0x1, 0x31, 0x1, 0x6F, 0x3, 0x31, 0x2044, 0x34, 0x3,
+		0x31, 0x2044, 0x32, 0x3, 0x33, 0x2044, 0x34, 0x2, 0x41, 0xE6000300, 0x2, 0x41, 0xE6000301, 0x2, 0x41, 0xE6000302,
+		0x2, 0x41, 0xE6000303, 0x2, 0x41, 0xE6000308, 0x2, 0x41, 0xE600030A, 0x2, 0x43, 0xCA000327, 0x2, 0x45, 0xE6000300, 0x2,
+		0x45, 0xE6000301, 0x2, 0x45, 0xE6000302, 0x2, 0x45, 0xE6000308, 0x2, 0x49, 0xE6000300, 0x2, 0x49, 0xE6000301, 0x2, 0x49,
+		0xE6000302, 0x2, 0x49, 0xE6000308, 0x2, 0x4E, 0xE6000303, 0x2, 0x4F, 0xE6000300, 0x2, 0x4F, 0xE6000301, 0x2, 0x4F, 0xE6000302,
+		0x2, 0x4F, 0xE6000303, 0x2, 0x4F, 0xE6000308, 0x2, 0x55, 0xE6000300, 0x2, 0x55, 0xE6000301, 0x2, 0x55, 0xE6000302, 0x2,
+		0x55, 0xE6000308, 0x2, 0x59, 0xE6000301, 0x2, 0x61, 0xE6000300, 0x2, 0x61, 0xE6000301, 0x2, 0x61, 0xE6000302, 0x2, 0x61,
+		0xE6000303, 0x2, 0x61, 0xE6000308, 0x2, 0x61, 0xE600030A, 0x2, 0x63, 0xCA000327, 0x2, 0x65, 0xE6000300, 0x2, 0x65, 0xE6000301,
+		0x2, 0x65, 0xE6000302, 0x2, 0x65, 0xE6000308, 0x2, 0x69, 0xE6000300, 0x2, 0x69, 0xE6000301, 0x2, 0x69, 0xE6000302, 0x2,
+		0x69, 0xE6000308, 0x2, 0x6E, 0xE6000303, 0x2, 0x6F, 0xE6000300, 0x2, 0x6F, 0xE6000301, 0x2, 0x6F, 0xE6000302, 0x2, 0x6F,
+		0xE6000303, 0x2, 0x6F, 0xE6000308, 0x2, 0x75, 0xE6000300, 0x2, 0x75, 0xE6000301, 0x2, 0x75, 0xE6000302, 0x2, 0x75, 0xE6000308,
+		0x2, 0x79, 0xE6000301, 0x2, 0x79, 0xE6000308, 0x2, 0x41, 0xE6000304, 0x2, 0x61, 0xE6000304, 0x2, 0x41, 0xE6000306, 0x2,
+		0x61, 0xE6000306, 0x2, 0x41, 0xCA000328, 0x2, 0x61, 0xCA000328, 0x2, 0x43, 0xE6000301, 0x2, 0x63, 0xE6000301, 0x2, 0x43,
+		0xE6000302, 0x2, 0x63, 0xE6000302, 0x2, 0x43, 0xE6000307, 0x2, 0x63, 0xE6000307, 0x2, 0x43, 0xE600030C, 0x2, 0x63, 0xE600030C,
+		0x2, 0x44, 0xE600030C, 0x2, 0x64, 0xE600030C, 0x2, 0x45, 0xE6000304, 0x2, 0x65, 0xE6000304, 0x2, 0x45, 0xE6000306, 0x2,
+		0x65, 0xE6000306, 0x2, 0x45, 0xE6000307, 0x2, 0x65, 0xE6000307, 0x2, 0x45, 0xCA000328, 0x2, 0x65, 0xCA000328, 0x2, 0x45,
+		0xE600030C, 0x2, 0x65, 0xE600030C, 0x2, 0x47, 0xE6000302, 0x2, 0x67, 0xE6000302, 0x2, 0x47, 0xE6000306, 0x2, 0x67, 0xE6000306,
+		0x2, 0x47, 0xE6000307, 0x2, 0x67, 0xE6000307, 0x2, 0x47, 0xCA000327, 0x2, 0x67, 0xCA000327, 0x2, 0x48, 0xE6000302, 0x2,
+		0x68, 0xE6000302, 0x2, 0x49, 0xE6000303, 0x2, 0x69, 0xE6000303, 0x2, 0x49, 0xE6000304, 0x2, 0x69, 0xE6000304, 0x2, 0x49,
+		0xE6000306, 0x2, 0x69, 0xE6000306, 0x2, 0x49, 0xCA000328, 0x2, 0x69, 0xCA000328, 0x2, 0x49, 0xE6000307, 0x2, 0x49, 0x4A,
+		0x2, 0x69, 0x6A, 0x2, 0x4A, 0xE6000302, 0x2, 0x6A, 0xE6000302, 0x2, 0x4B, 0xCA000327, 0x2, 0x6B, 0xCA000327, 0x2,
+		0x4C, 0xE6000301, 0x2, 0x6C, 0xE6000301, 0x2, 0x4C, 0xCA000327, 0x2, 0x6C, 0xCA000327, 0x2, 0x4C, 0xE600030C, 0x2, 0x6C,
+		0xE600030C, 0x2, 0x4C, 0xB7, 0x2, 0x6C, 0xB7, 0x2, 0x4E, 0xE6000301, 0x2, 0x6E, 0xE6000301, 0x2, 0x4E, 0xCA000327,
+		0x2, 0x6E, 0xCA000327, 0x2, 0x4E, 0xE600030C, 0x2, 0x6E, 0xE600030C, 0x2, 0x2BC, 0x6E, 0x2, 0x4F, 0xE6000304, 0x2,
+		0x6F, 0xE6000304, 0x2, 0x4F, 0xE6000306, 0x2, 0x6F, 0xE6000306, 0x2, 0x4F, 0xE600030B, 0x2, 0x6F, 0xE600030B, 0x2, 0x52,
+		0xE6000301, 0x2, 0x72, 0xE6000301, 0x2, 0x52, 0xCA000327, 0x2, 0x72, 0xCA000327, 0x2, 0x52, 0xE600030C, 0x2, 0x72, 0xE600030C,
+		0x2, 0x53, 0xE6000301, 0x2, 0x73, 0xE6000301, 0x2, 0x53, 0xE6000302, 0x2, 0x73, 0xE6000302, 0x2, 0x53, 0xCA000327, 0x2,
+		0x73, 0xCA000327, 0x2, 0x53, 0xE600030C, 0x2, 0x73, 0xE600030C, 0x2, 0x54, 0xCA000327, 0x2, 0x74, 0xCA000327, 0x2, 0x54,
+		0xE600030C, 0x2, 0x74, 0xE600030C, 0x2, 0x55, 0xE6000303, 0x2, 0x75, 0xE6000303, 0x2, 0x55, 0xE6000304, 0x2, 0x75, 0xE6000304,
+		0x2, 0x55, 0xE6000306, 0x2, 0x75, 0xE6000306, 0x2, 0x55, 0xE600030A, 0x2, 0x75, 0xE600030A, 0x2, 0x55, 0xE600030B, 0x2,
+		0x75, 0xE600030B, 0x2, 0x55, 0xCA000328, 0x2, 0x75, 0xCA000328, 0x2, 0x57, 0xE6000302, 0x2, 0x77, 0xE6000302, 0x2, 0x59,
+		0xE6000302, 0x2, 0x79, 0xE6000302, 0x2, 0x59, 0xE6000308, 0x2, 0x5A, 0xE6000301, 0x2, 0x7A, 0xE6000301, 0x2, 0x5A, 0xE6000307,
+		0x2, 0x7A, 0xE6000307, 0x2, 0x5A, 0xE600030C, 0x2, 0x7A, 0xE600030C, 0x1, 0x73, 0x2, 0x4F, 0xD800031B, 0x2, 0x6F,
+		0xD800031B, 0x2, 0x55, 0xD800031B, 0x2, 0x75, 0xD800031B, 0x3, 0x44, 0x5A, 0xE600030C, 0x3, 0x44, 0x7A, 0xE600030C, 0x3,
+		0x64, 0x7A, 0xE600030C, 0x2, 0x4C, 0x4A, 0x2, 0x4C, 0x6A, 0x2, 0x6C, 0x6A, 0x2, 0x4E, 0x4A, 0x2,
+		0x4E, 0x6A, 0x2, 0x6E, 0x6A, 0x2, 0x41, 0xE600030C, 0x2, 0x61, 0xE600030C, 0x2, 0x49, 0xE600030C, 0x2, 0x69,
+		0xE600030C, 0x2, 0x4F, 0xE600030C, 0x2, 0x6F, 0xE600030C, 0x2, 0x55, 0xE600030C, 0x2, 0x75, 0xE600030C, 0x3, 0x55, 0xE6000308,
+		0xE6000304, 0x3, 0x75, 0xE6000308, 0xE6000304, 0x3, 0x55, 0xE6000308, 0xE6000301, 0x3, 0x75, 0xE6000308, 0xE6000301, 0x3, 0x55, 0xE6000308,
+		0xE600030C, 0x3, 0x75, 0xE6000308, 0xE600030C, 0x3, 0x55, 0xE6000308, 0xE6000300, 0x3, 0x75, 0xE6000308, 0xE6000300, 0x3, 0x41, 0xE6000308,
+		0xE6000304, 0x3, 0x61, 0xE6000308, 0xE6000304, 0x3, 0x41, 0xE6000307, 0xE6000304, 0x3, 0x61, 0xE6000307, 0xE6000304, 0x2, 0xC6, 0xE6000304,
+		0x2, 0xE6, 0xE6000304, 0x2, 0x47, 0xE600030C, 0x2, 0x67, 0xE600030C, 0x2, 0x4B, 0xE600030C, 0x2, 0x6B, 0xE600030C, 0x2,
+		0x4F, 0xCA000328, 0x2, 0x6F, 0xCA000328, 0x3, 0x4F, 0xCA000328, 0xE6000304, 0x3, 0x6F, 0xCA000328, 0xE6000304, 0x2, 0x1B7, 0xE600030C,
+		0x2, 0x292, 0xE600030C, 0x2, 0x6A, 0xE600030C, 0x2, 0x44, 0x5A, 0x2, 0x44, 0x7A, 0x2, 0x64, 0x7A, 0x2,
+		0x47, 0xE6000301, 0x2, 0x67, 0xE6000301, 0x2, 0x4E, 0xE6000300, 0x2, 0x6E, 0xE6000300, 0x3, 0x41, 0xE600030A, 0xE6000301, 0x3,
+		0x61, 0xE600030A, 0xE6000301, 0x2, 0xC6, 0xE6000301, 0x2, 0xE6, 0xE6000301, 0x2, 0xD8, 0xE6000301, 0x2, 0xF8, 0xE6000301, 0x2,
+		0x41, 0xE600030F, 0x2, 0x61, 0xE600030F, 0x2, 0x41, 0xE6000311, 0x2, 0x61, 0xE6000311, 0x2, 0x45, 0xE600030F, 0x2, 0x65,
+		0xE600030F, 0x2, 0x45, 0xE6000311, 0x2, 0x65, 0xE6000311, 0x2, 0x49, 0xE600030F, 0x2, 0x69, 0xE600030F, 0x2, 0x49, 0xE6000311,
+		0x2, 0x69, 0xE6000311, 0x2, 0x4F, 0xE600030F, 0x2, 0x6F, 0xE600030F, 0x2, 0x4F, 0xE6000311, 0x2, 0x6F, 0xE6000311, 0x2,
+		0x52, 0xE600030F, 0x2, 0x72, 0xE600030F, 0x2, 0x52, 0xE6000311, 0x2, 0x72, 0xE6000311, 0x2, 0x55, 0xE600030F, 0x2, 0x75,
+		0xE600030F, 0x2, 0x55, 0xE6000311, 0x2, 0x75, 0xE6000311, 0x2, 0x53, 0xDC000326, 0x2, 0x73, 0xDC000326, 0x2, 0x54, 0xDC000326,
+		0x2, 0x74, 0xDC000326, 0x2, 0x48, 0xE600030C, 0x2, 0x68, 0xE600030C, 0x2, 0x41, 0xE6000307, 0x2, 0x61, 0xE6000307, 0x2,
+		0x45, 0xCA000327, 0x2, 0x65, 0xCA000327, 0x3, 0x4F, 0xE6000308, 0xE6000304, 0x3, 0x6F, 0xE6000308, 0xE6000304, 0x3, 0x4F, 0xE6000303,
+		0xE6000304, 0x3, 0x6F, 0xE6000303, 0xE6000304, 0x2, 0x4F, 0xE6000307, 0x2, 0x6F, 0xE6000307, 0x3, 0x4F, 0xE6000307, 0xE6000304, 0x3,
+		0x6F, 0xE6000307, 0xE6000304, 0x2, 0x59, 0xE6000304, 0x2, 0x79, 0xE6000304, 0x1, 0x68, 0x1, 0x266, 0x1, 0x6A, 0x1,
+		0x72, 0x1, 0x279, 0x1, 0x27B, 0x1, 0x281, 0x1, 0x77, 0x1, 0x79, 0x2, 0x20, 0xE6000306, 0x2, 0x20,
+		0xE6000307, 0x2, 0x20, 0xE600030A, 0x2, 0x20, 0xCA000328, 0x2, 0x20, 0xE6000303, 0x2, 0x20, 0xE600030B, 0x1, 0x263, 0x1,
+		0x6C, 0x1, 0x78, 0x1, 0x295, 0x1, 0xE6000300, 0x1, 0xE6000301, 0x1, 0xE6000313, 0x2, 0xE6000308, 0xE6000301, 0x1, 0x2B9,
+		0x2, 0x20, 0xF0000345, 0x1, 0x3B, 0x2, 0xA8, 0xE6000301, 0x3, 0x20, 0xE6000308, 0xE6000301, 0x2, 0x391, 0xE6000301, 0x1,
+		0xB7, 0x2, 0x395, 0xE6000301, 0x2, 0x397, 0xE6000301, 0x2, 0x399, 0xE6000301, 0x2, 0x39F, 0xE6000301, 0x2, 0x3A5, 0xE6000301,
+		0x2, 0x3A9, 0xE6000301, 0x3, 0x3B9, 0xE6000308, 0xE6000301, 0x2, 0x399, 0xE6000308, 0x2, 0x3A5, 0xE6000308, 0x2, 0x3B1, 0xE6000301,
+		0x2, 0x3B5, 0xE6000301, 0x2, 0x3B7, 0xE6000301, 0x2, 0x3B9, 0xE6000301, 0x3, 0x3C5, 0xE6000308, 0xE6000301, 0x2, 0x3B9, 0xE6000308,
+		0x2, 0x3C5, 0xE6000308, 0x2, 0x3BF, 0xE6000301, 0x2, 0x3C5, 0xE6000301, 0x2, 0x3C9, 0xE6000301, 0x1, 0x3B2, 0x1, 0x3B8,
+		0x1, 0x3A5, 0x2, 0x3D2, 0xE6000301, 0x2, 0x3D2, 0xE6000308, 0x1, 0x3C6, 0x1, 0x3C0, 0x1, 0x3BA, 0x1, 0x3C1,
+		0x1, 0x3C2, 0x1, 0x398, 0x1, 0x3B5, 0x1, 0x3A3, 0x2, 0x415, 0xE6000300, 0x2, 0x415, 0xE6000308, 0x2, 0x413,
+		0xE6000301, 0x2, 0x406, 0xE6000308, 0x2, 0x41A, 0xE6000301, 0x2, 0x418, 0xE6000300, 0x2, 0x423, 0xE6000306, 0x2, 0x418, 0xE6000306,
+		0x2, 0x438, 0xE6000306, 0x2, 0x435, 0xE6000300, 0x2, 0x435, 0xE6000308, 0x2, 0x433, 0xE6000301, 0x2, 0x456, 0xE6000308, 0x2,
+		0x43A, 0xE6000301, 0x2, 0x438, 0xE6000300, 0x2, 0x443, 0xE6000306, 0x2, 0x474, 0xE600030F, 0x2, 0x475, 0xE600030F, 0x2, 0x416,
+		0xE6000306, 0x2, 0x436, 0xE6000306, 0x2, 0x410, 0xE6000306, 0x2, 0x430, 0xE6000306, 0x2, 0x410, 0xE6000308, 0x2, 0x430, 0xE6000308,
+		0x2, 0x415, 0xE6000306, 0x2, 0x435, 0xE6000306, 0x2, 0x4D8, 0xE6000308, 0x2, 0x4D9, 0xE6000308, 0x2, 0x416, 0xE6000308, 0x2,
+		0x436, 0xE6000308, 0x2, 0x417, 0xE6000308, 0x2, 0x437, 0xE6000308, 0x2, 0x418, 0xE6000304, 0x2, 0x438, 0xE6000304, 0x2, 0x418,
+		0xE6000308, 0x2, 0x438, 0xE6000308, 0x2, 0x41E, 0xE6000308, 0x2, 0x43E, 0xE6000308, 0x2, 0x4E8, 0xE6000308, 0x2, 0x4E9, 0xE6000308,
+		0x2, 0x42D, 0xE6000308, 0x2, 0x44D, 0xE6000308, 0x2, 0x423, 0xE6000304, 0x2, 0x443, 0xE6000304, 0x2, 0x423, 0xE6000308, 0x2,
+		0x443, 0xE6000308, 0x2, 0x423, 0xE600030B, 0x2, 0x443, 0xE600030B, 0x2, 0x427, 0xE6000308, 0x2, 0x447, 0xE6000308, 0x2, 0x42B,
+		0xE6000308, 0x2, 0x44B, 0xE6000308, 0x2, 0x565, 0x582, 0x2, 0x627, 0xE6000653, 0x2, 0x627, 0xE6000654, 0x2, 0x648, 0xE6000654,
+		0x2, 0x627, 0xDC000655, 0x2, 0x64A, 0xE6000654, 0x2, 0x627, 0x674, 0x2, 0x648, 0x674, 0x2, 0x6C7, 0x674, 0x2,
+		0x64A, 0x674, 0x2, 0x6D5, 0xE6000654, 0x2, 0x6C1, 0xE6000654, 0x2, 0x6D2, 0xE6000654, 0x2, 0x928, 0x700093C, 0x2, 0x930,
+		0x700093C, 0x2, 0x933, 0x700093C, 0x2, 0x915, 0x700093C, 0x2, 0x916, 0x700093C, 0x2, 0x917, 0x700093C, 0x2, 0x91C, 0x700093C,
+		0x2, 0x921, 0x700093C, 0x2, 0x922, 0x700093C, 0x2, 0x92B, 0x700093C, 0x2, 0x92F, 0x700093C, 0x2, 0x9C7, 0x9BE, 0x2,
+		0x9C7, 0x9D7, 0x2, 0x9A1, 0x70009BC, 0x2, 0x9A2, 0x70009BC, 0x2, 0x9AF, 0x70009BC, 0x2, 0xA32, 0x7000A3C, 0x2, 0xA38,
+		0x7000A3C, 0x2, 0xA16, 0x7000A3C, 0x2, 0xA17, 0x7000A3C, 0x2, 0xA1C, 0x7000A3C, 0x2, 0xA2B, 0x7000A3C, 0x2, 0xB47, 0xB56,
+		0x2, 0xB47, 0xB3E, 0x2, 0xB47, 0xB57, 0x2, 0xB21, 0x7000B3C, 0x2, 0xB22, 0x7000B3C, 0x2, 0xB92, 0xBD7, 0x2,
+		0xBC6, 0xBBE, 0x2, 0xBC7, 0xBBE, 0x2, 0xBC6, 0xBD7, 0x2, 0xC46, 0x5B000C56, 0x2, 0xCBF, 0xCD5, 0x2, 0xCC6,
+		0xCD5, 0x2, 0xCC6, 0xCD6, 0x2, 0xCC6, 0xCC2, 0x3, 0xCC6, 0xCC2, 0xCD5, 0x2, 0xD46, 0xD3E, 0x2, 0xD47,
+		0xD3E, 0x2, 0xD46, 0xD57, 0x2, 0xDD9, 0x9000DCA, 0x2, 0xDD9, 0xDCF, 0x3, 0xDD9, 0xDCF, 0x9000DCA, 0x2, 0xDD9,
+		0xDDF, 0x2, 0xE4D, 0xE32, 0x2, 0xECD, 0xEB2, 0x2, 0xEAB, 0xE99, 0x2, 0xEAB, 0xEA1, 0x1, 0xF0B, 0x2,
+		0xF42, 0xFB7, 0x2, 0xF4C, 0xFB7, 0x2, 0xF51, 0xFB7, 0x2, 0xF56, 0xFB7, 0x2, 0xF5B, 0xFB7, 0x2, 0xF40,
+		0xFB5, 0x2, 0x81000F71, 0x82000F72, 0x2, 0x81000F71, 0x84000F74, 0x2, 0xFB2, 0x82000F80, 0x3, 0xFB2, 0x81000F71, 0x82000F80, 0x2, 0xFB3,
+		0x82000F80, 0x3, 0xFB3, 0x81000F71, 0x82000F80, 0x2, 0x81000F71, 0x82000F80, 0x2, 0xF92, 0xFB7, 0x2, 0xF9C, 0xFB7, 0x2, 0xFA1,
+		0xFB7, 0x2, 0xFA6, 0xFB7, 0x2, 0xFAB, 0xFB7, 0x2, 0xF90, 0xFB5, 0x2, 0x1025, 0x102E, 0x1, 0x10DC, 0x2,
+		0x1B05, 0x1B35, 0x2, 0x1B07, 0x1B35, 0x2, 0x1B09, 0x1B35, 0x2, 0x1B0B, 0x1B35, 0x2, 0x1B0D, 0x1B35, 0x2, 0x1B11,
+		0x1B35, 0x2, 0x1B3A, 0x1B35, 0x2, 0x1B3C, 0x1B35, 0x2, 0x1B3E, 0x1B35, 0x2, 0x1B3F, 0x1B35, 0x2, 0x1B42, 0x1B35,
+		0x1, 0x41, 0x1, 0xC6, 0x1, 0x42, 0x1, 0x44, 0x1, 0x45, 0x1, 0x18E, 0x1, 0x47, 0x1, 0x48,
+		0x1, 0x49, 0x1, 0x4A, 0x1, 0x4B, 0x1, 0x4C, 0x1, 0x4D, 0x1, 0x4E, 0x1, 0x4F, 0x1, 0x222,
+		0x1, 0x50, 0x1, 0x52, 0x1, 0x54, 0x1, 0x55, 0x1, 0x57, 0x1, 0x250, 0x1, 0x251, 0x1, 0x1D02,
+		0x1, 0x62, 0x1, 0x64, 0x1, 0x65, 0x1, 0x259, 0x1, 0x25B, 0x1, 0x25C, 0x1, 0x67, 0x1, 0x6B,
+		0x1, 0x6D, 0x1, 0x14B, 0x1, 0x254, 0x1, 0x1D16, 0x1, 0x1D17, 0x1, 0x70, 0x1, 0x74, 0x1, 0x75,
+		0x1, 0x1D1D, 0x1, 0x26F, 0x1, 0x76, 0x1, 0x1D25, 0x1, 0x3B3, 0x1, 0x3B4, 0x1, 0x3C7, 0x1, 0x69,
+		0x1, 0x43D, 0x1, 0x252, 0x1, 0x63, 0x1, 0x255, 0x1, 0xF0, 0x1, 0x66, 0x1, 0x25F, 0x1, 0x261,
+		0x1, 0x265, 0x1, 0x268, 0x1, 0x269, 0x1, 0x26A, 0x1, 0x1D7B, 0x1, 0x29D, 0x1, 0x26D, 0x1, 0x1D85,
+		0x1, 0x29F, 0x1, 0x271, 0x1, 0x270, 0x1, 0x272, 0x1, 0x273, 0x1, 0x274, 0x1, 0x275, 0x1, 0x278,
+		0x1, 0x282, 0x1, 0x283, 0x1, 0x1AB, 0x1, 0x289, 0x1, 0x28A, 0x1, 0x1D1C, 0x1, 0x28B, 0x1, 0x28C,
+		0x1, 0x7A, 0x1, 0x290, 0x1, 0x291, 0x1, 0x292, 0x2, 0x41, 0xDC000325, 0x2, 0x61, 0xDC000325, 0x2, 0x42,
+		0xE6000307, 0x2, 0x62, 0xE6000307, 0x2, 0x42, 0xDC000323, 0x2, 0x62, 0xDC000323, 0x2, 0x42, 0xDC000331, 0x2, 0x62, 0xDC000331,
+		0x3, 0x43, 0xCA000327, 0xE6000301, 0x3, 0x63, 0xCA000327, 0xE6000301, 0x2, 0x44, 0xE6000307, 0x2, 0x64, 0xE6000307, 0x2, 0x44,
+		0xDC000323, 0x2, 0x64, 0xDC000323, 0x2, 0x44, 0xDC000331, 0x2, 0x64, 0xDC000331, 0x2, 0x44, 0xCA000327, 0x2, 0x64, 0xCA000327,
+		0x2, 0x44, 0xDC00032D, 0x2, 0x64, 0xDC00032D, 0x3, 0x45, 0xE6000304, 0xE6000300, 0x3, 0x65, 0xE6000304, 0xE6000300, 0x3, 0x45,
+		0xE6000304, 0xE6000301, 0x3, 0x65, 0xE6000304, 0xE6000301, 0x2, 0x45, 0xDC00032D, 0x2, 0x65, 0xDC00032D, 0x2, 0x45, 0xDC000330, 0x2,
+		0x65, 0xDC000330, 0x3, 0x45, 0xCA000327, 0xE6000306, 0x3, 0x65, 0xCA000327, 0xE6000306, 0x2, 0x46, 0xE6000307, 0x2, 0x66, 0xE6000307,
+		0x2, 0x47, 0xE6000304, 0x2, 0x67, 0xE6000304, 0x2, 0x48, 0xE6000307, 0x2, 0x68, 0xE6000307, 0x2, 0x48, 0xDC000323, 0x2,
+		0x68, 0xDC000323, 0x2, 0x48, 0xE6000308, 0x2, 0x68, 0xE6000308, 0x2, 0x48, 0xCA000327, 0x2, 0x68, 0xCA000327, 0x2, 0x48,
+		0xDC00032E, 0x2, 0x68, 0xDC00032E, 0x2, 0x49, 0xDC000330, 0x2, 0x69, 0xDC000330, 0x3, 0x49, 0xE6000308, 0xE6000301, 0x3, 0x69,
+		0xE6000308, 0xE6000301, 0x2, 0x4B, 0xE6000301, 0x2, 0x6B, 0xE6000301, 0x2, 0x4B, 0xDC000323, 0x2, 0x6B, 0xDC000323, 0x2, 0x4B,
+		0xDC000331, 0x2, 0x6B, 0xDC000331, 0x2, 0x4C, 0xDC000323, 0x2, 0x6C, 0xDC000323, 0x3, 0x4C, 0xDC000323, 0xE6000304, 0x3, 0x6C,
+		0xDC000323, 0xE6000304, 0x2, 0x4C, 0xDC000331, 0x2, 0x6C, 0xDC000331, 0x2, 0x4C, 0xDC00032D, 0x2, 0x6C, 0xDC00032D, 0x2, 0x4D,
+		0xE6000301, 0x2, 0x6D, 0xE6000301, 0x2, 0x4D, 0xE6000307, 0x2, 0x6D, 0xE6000307, 0x2, 0x4D, 0xDC000323, 0x2, 0x6D, 0xDC000323,
+		0x2, 0x4E, 0xE6000307, 0x2, 0x6E, 0xE6000307, 0x2, 0x4E, 0xDC000323, 0x2, 0x6E, 0xDC000323, 0x2, 0x4E, 0xDC000331, 0x2,
+		0x6E, 0xDC000331, 0x2, 0x4E, 0xDC00032D, 0x2, 0x6E, 0xDC00032D, 0x3, 0x4F, 0xE6000303, 0xE6000301, 0x3, 0x6F, 0xE6000303, 0xE6000301,
+		0x3, 0x4F, 0xE6000303, 0xE6000308, 0x3, 0x6F, 0xE6000303, 0xE6000308, 0x3, 0x4F, 0xE6000304, 0xE6000300, 0x3, 0x6F, 0xE6000304, 0xE6000300,
+		0x3, 0x4F, 0xE6000304, 0xE6000301, 0x3, 0x6F, 0xE6000304, 0xE6000301, 0x2, 0x50, 0xE6000301, 0x2, 0x70, 0xE6000301, 0x2, 0x50,
+		0xE6000307, 0x2, 0x70, 0xE6000307, 0x2, 0x52, 0xE6000307, 0x2, 0x72, 0xE6000307, 0x2, 0x52, 0xDC000323, 0x2, 0x72, 0xDC000323,
+		0x3, 0x52, 0xDC000323, 0xE6000304, 0x3, 0x72, 0xDC000323, 0xE6000304, 0x2, 0x52, 0xDC000331, 0x2, 0x72, 0xDC000331, 0x2, 0x53,
+		0xE6000307, 0x2, 0x73, 0xE6000307, 0x2, 0x53, 0xDC000323, 0x2, 0x73, 0xDC000323, 0x3, 0x53, 0xE6000301, 0xE6000307, 0x3, 0x73,
+		0xE6000301, 0xE6000307, 0x3, 0x53, 0xE600030C, 0xE6000307, 0x3, 0x73, 0xE600030C, 0xE6000307, 0x3, 0x53, 0xDC000323, 0xE6000307, 0x3, 0x73,
+		0xDC000323, 0xE6000307, 0x2, 0x54, 0xE6000307, 0x2, 0x74, 0xE6000307, 0x2, 0x54, 0xDC000323, 0x2, 0x74, 0xDC000323, 0x2, 0x54,
+		0xDC000331, 0x2, 0x74, 0xDC000331, 0x2, 0x54, 0xDC00032D, 0x2, 0x74, 0xDC00032D, 0x2, 0x55, 0xDC000324, 0x2, 0x75, 0xDC000324,
+		0x2, 0x55, 0xDC000330, 0x2, 0x75, 0xDC000330, 0x2, 0x55, 0xDC00032D, 0x2, 0x75, 0xDC00032D, 0x3, 0x55, 0xE6000303, 0xE6000301,
+		0x3, 0x75, 0xE6000303, 0xE6000301, 0x3, 0x55, 0xE6000304, 0xE6000308, 0x3, 0x75, 0xE6000304, 0xE6000308, 0x2, 0x56, 0xE6000303, 0x2,
+		0x76, 0xE6000303, 0x2, 0x56, 0xDC000323, 0x2, 0x76, 0xDC000323, 0x2, 0x57, 0xE6000300, 0x2, 0x77, 0xE6000300, 0x2, 0x57,
+		0xE6000301, 0x2, 0x77, 0xE6000301, 0x2, 0x57, 0xE6000308, 0x2, 0x77, 0xE6000308, 0x2, 0x57, 0xE6000307, 0x2, 0x77, 0xE6000307,
+		0x2, 0x57, 0xDC000323, 0x2, 0x77, 0xDC000323, 0x2, 0x58, 0xE6000307, 0x2, 0x78, 0xE6000307, 0x2, 0x58, 0xE6000308, 0x2,
+		0x78, 0xE6000308, 0x2, 0x59, 0xE6000307, 0x2, 0x79, 0xE6000307, 0x2, 0x5A, 0xE6000302, 0x2, 0x7A, 0xE6000302, 0x2, 0x5A,
+		0xDC000323, 0x2, 0x7A, 0xDC000323, 0x2, 0x5A, 0xDC000331, 0x2, 0x7A, 0xDC000331, 0x2, 0x68, 0xDC000331, 0x2, 0x74, 0xE6000308,
+		0x2, 0x77, 0xE600030A, 0x2, 0x79, 0xE600030A, 0x2, 0x61, 0x2BE, 0x2, 0x17F, 0xE6000307, 0x2, 0x41, 0xDC000323, 0x2,
+		0x61, 0xDC000323, 0x2, 0x41, 0xE6000309, 0x2, 0x61, 0xE6000309, 0x3, 0x41, 0xE6000302, 0xE6000301, 0x3, 0x61, 0xE6000302, 0xE6000301,
+		0x3, 0x41, 0xE6000302, 0xE6000300, 0x3, 0x61, 0xE6000302, 0xE6000300, 0x3, 0x41, 0xE6000302, 0xE6000309, 0x3, 0x61, 0xE6000302, 0xE6000309,
+		0x3, 0x41, 0xE6000302, 0xE6000303, 0x3, 0x61, 0xE6000302, 0xE6000303, 0x3, 0x41, 0xDC000323, 0xE6000302, 0x3, 0x61, 0xDC000323, 0xE6000302,
+		0x3, 0x41, 0xE6000306, 0xE6000301, 0x3, 0x61, 0xE6000306, 0xE6000301, 0x3, 0x41, 0xE6000306, 0xE6000300, 0x3, 0x61, 0xE6000306, 0xE6000300,
+		0x3, 0x41, 0xE6000306, 0xE6000309, 0x3, 0x61, 0xE6000306, 0xE6000309, 0x3, 0x41, 0xE6000306, 0xE6000303, 0x3, 0x61, 0xE6000306, 0xE6000303,
+		0x3, 0x41, 0xDC000323, 0xE6000306, 0x3, 0x61, 0xDC000323, 0xE6000306, 0x2, 0x45, 0xDC000323, 0x2, 0x65, 0xDC000323, 0x2, 0x45,
+		0xE6000309, 0x2, 0x65, 0xE6000309, 0x2, 0x45, 0xE6000303, 0x2, 0x65, 0xE6000303, 0x3, 0x45, 0xE6000302, 0xE6000301, 0x3, 0x65,
+		0xE6000302, 0xE6000301, 0x3, 0x45, 0xE6000302, 0xE6000300, 0x3, 0x65, 0xE6000302, 0xE6000300, 0x3, 0x45, 0xE6000302, 0xE6000309, 0x3, 0x65,
+		0xE6000302, 0xE6000309, 0x3, 0x45, 0xE6000302, 0xE6000303, 0x3, 0x65, 0xE6000302, 0xE6000303, 0x3, 0x45, 0xDC000323, 0xE6000302, 0x3, 0x65,
+		0xDC000323, 0xE6000302, 0x2, 0x49, 0xE6000309, 0x2, 0x69, 0xE6000309, 0x2, 0x49, 0xDC000323, 0x2, 0x69, 0xDC000323, 0x2, 0x4F,
+		0xDC000323, 0x2, 0x6F, 0xDC000323, 0x2, 0x4F, 0xE6000309, 0x2, 0x6F, 0xE6000309, 0x3, 0x4F, 0xE6000302, 0xE6000301, 0x3, 0x6F,
+		0xE6000302, 0xE6000301, 0x3, 0x4F, 0xE6000302, 0xE6000300, 0x3, 0x6F, 0xE6000302, 0xE6000300, 0x3, 0x4F, 0xE6000302, 0xE6000309, 0x3, 0x6F,
+		0xE6000302, 0xE6000309, 0x3, 0x4F, 0xE6000302, 0xE6000303, 0x3, 0x6F, 0xE6000302, 0xE6000303, 0x3, 0x4F, 0xDC000323, 0xE6000302, 0x3, 0x6F,
+		0xDC000323, 0xE6000302, 0x3, 0x4F, 0xD800031B, 0xE6000301, 0x3, 0x6F, 0xD800031B, 0xE6000301, 0x3, 0x4F, 0xD800031B, 0xE6000300, 0x3, 0x6F,
+		0xD800031B, 0xE6000300, 0x3, 0x4F, 0xD800031B, 0xE6000309, 0x3, 0x6F, 0xD800031B, 0xE6000309, 0x3, 0x4F, 0xD800031B, 0xE6000303, 0x3, 0x6F,
+		0xD800031B, 0xE6000303, 0x3, 0x4F, 0xD800031B, 0xDC000323, 0x3, 0x6F, 0xD800031B, 0xDC000323, 0x2, 0x55, 0xDC000323, 0x2, 0x75, 0xDC000323,
+		0x2, 0x55, 0xE6000309, 0x2, 0x75, 0xE6000309, 0x3, 0x55, 0xD800031B, 0xE6000301, 0x3, 0x75, 0xD800031B, 0xE6000301, 0x3, 0x55,
+		0xD800031B, 0xE6000300, 0x3, 0x75, 0xD800031B, 0xE6000300, 0x3, 0x55, 0xD800031B, 0xE6000309, 0x3, 0x75, 0xD800031B, 0xE6000309, 0x3, 0x55,
+		0xD800031B, 0xE6000303, 0x3, 0x75, 0xD800031B, 0xE6000303, 0x3, 0x55, 0xD800031B, 0xDC000323, 0x3, 0x75, 0xD800031B, 0xDC000323, 0x2, 0x59,
+		0xE6000300, 0x2, 0x79, 0xE6000300, 0x2, 0x59, 0xDC000323, 0x2, 0x79, 0xDC000323, 0x2, 0x59, 0xE6000309, 0x2, 0x79, 0xE6000309,
+		0x2, 0x59, 0xE6000303, 0x2, 0x79, 0xE6000303, 0x2, 0x3B1, 0xE6000313, 0x2, 0x3B1, 0xE6000314, 0x3, 0x3B1, 0xE6000313, 0xE6000300,
+		0x3, 0x3B1, 0xE6000314, 0xE6000300, 0x3, 0x3B1, 0xE6000313, 0xE6000301, 0x3, 0x3B1, 0xE6000314, 0xE6000301, 0x3, 0x3B1, 0xE6000313, 0xE6000342,
+		0x3, 0x3B1, 0xE6000314, 0xE6000342, 0x2, 0x391, 0xE6000313, 0x2, 0x391, 0xE6000314, 0x3, 0x391, 0xE6000313, 0xE6000300, 0x3, 0x391,
+		0xE6000314, 0xE6000300, 0x3, 0x391, 0xE6000313, 0xE6000301, 0x3, 0x391, 0xE6000314, 0xE6000301, 0x3, 0x391, 0xE6000313, 0xE6000342, 0x3, 0x391,
+		0xE6000314, 0xE6000342, 0x2, 0x3B5, 0xE6000313, 0x2, 0x3B5, 0xE6000314, 0x3, 0x3B5, 0xE6000313, 0xE6000300, 0x3, 0x3B5, 0xE6000314, 0xE6000300,
+		0x3, 0x3B5, 0xE6000313, 0xE6000301, 0x3, 0x3B5, 0xE6000314, 0xE6000301, 0x2, 0x395, 0xE6000313, 0x2, 0x395, 0xE6000314, 0x3, 0x395,
+		0xE6000313, 0xE6000300, 0x3, 0x395, 0xE6000314, 0xE6000300, 0x3, 0x395, 0xE6000313, 0xE6000301, 0x3, 0x395, 0xE6000314, 0xE6000301, 0x2, 0x3B7,
+		0xE6000313, 0x2, 0x3B7, 0xE6000314, 0x3, 0x3B7, 0xE6000313, 0xE6000300, 0x3, 0x3B7, 0xE6000314, 0xE6000300, 0x3, 0x3B7, 0xE6000313, 0xE6000301,
+		0x3, 0x3B7, 0xE6000314, 0xE6000301, 0x3, 0x3B7, 0xE6000313, 0xE6000342, 0x3, 0x3B7, 0xE6000314, 0xE6000342, 0x2, 0x397, 0xE6000313, 0x2,
+		0x397, 0xE6000314, 0x3, 0x397, 0xE6000313, 0xE6000300, 0x3, 0x397, 0xE6000314, 0xE6000300, 0x3, 0x397, 0xE6000313, 0xE6000301, 0x3, 0x397,
+		0xE6000314, 0xE6000301, 0x3, 0x397, 0xE6000313, 0xE6000342, 0x3, 0x397, 0xE6000314, 0xE6000342, 0x2, 0x3B9, 0xE6000313, 0x2, 0x3B9, 0xE6000314,
+		0x3, 0x3B9, 0xE6000313, 0xE6000300, 0x3, 0x3B9, 0xE6000314, 0xE6000300, 0x3, 0x3B9, 0xE6000313, 0xE6000301, 0x3, 0x3B9, 0xE6000314, 0xE6000301,
+		0x3, 0x3B9, 0xE6000313, 0xE6000342, 0x3, 0x3B9, 0xE6000314, 0xE6000342, 0x2, 0x399, 0xE6000313, 0x2, 0x399, 0xE6000314, 0x3, 0x399,
+		0xE6000313, 0xE6000300, 0x3, 0x399, 0xE6000314, 0xE6000300, 0x3, 0x399, 0xE6000313, 0xE6000301, 0x3, 0x399, 0xE6000314, 0xE6000301, 0x3, 0x399,
+		0xE6000313, 0xE6000342, 0x3, 0x399, 0xE6000314, 0xE6000342, 0x2, 0x3BF, 0xE6000313, 0x2, 0x3BF, 0xE6000314, 0x3, 0x3BF, 0xE6000313, 0xE6000300,
+		0x3, 0x3BF, 0xE6000314, 0xE6000300, 0x3, 0x3BF, 0xE6000313, 0xE6000301, 0x3, 0x3BF, 0xE6000314, 0xE6000301, 0x2, 0x39F, 0xE6000313, 0x2,
+		0x39F, 0xE6000314, 0x3, 0x39F, 0xE6000313, 0xE6000300, 0x3, 0x39F, 0xE6000314, 0xE6000300, 0x3, 0x39F, 0xE6000313, 0xE6000301, 0x3, 0x39F,
+		0xE6000314, 0xE6000301, 0x2, 0x3C5, 0xE6000313, 0x2, 0x3C5, 0xE6000314, 0x3, 0x3C5, 0xE6000313, 0xE6000300, 0x3, 0x3C5, 0xE6000314, 0xE6000300,
+		0x3, 0x3C5, 0xE6000313, 0xE6000301, 0x3, 0x3C5, 0xE6000314, 0xE6000301, 0x3, 0x3C5, 0xE6000313, 0xE6000342, 0x3, 0x3C5, 0xE6000314, 0xE6000342,
+		0x2, 0x3A5, 0xE6000314, 0x3, 0x3A5, 0xE6000314, 0xE6000300, 0x3, 0x3A5, 0xE6000314, 0xE6000301, 0x3, 0x3A5, 0xE6000314, 0xE6000342, 0x2,
+		0x3C9, 0xE6000313, 0x2, 0x3C9, 0xE6000314, 0x3, 0x3C9, 0xE6000313, 0xE6000300, 0x3, 0x3C9, 0xE6000314, 0xE6000300, 0x3, 0x3C9, 0xE6000313,
+		0xE6000301, 0x3, 0x3C9, 0xE6000314, 0xE6000301, 0x3, 0x3C9, 0xE6000313, 0xE6000342, 0x3, 0x3C9, 0xE6000314, 0xE6000342, 0x2, 0x3A9, 0xE6000313,
+		0x2, 0x3A9, 0xE6000314, 0x3, 0x3A9, 0xE6000313, 0xE6000300, 0x3, 0x3A9, 0xE6000314, 0xE6000300, 0x3, 0x3A9, 0xE6000313, 0xE6000301, 0x3,
+		0x3A9, 0xE6000314, 0xE6000301, 0x3, 0x3A9, 0xE6000313, 0xE6000342, 0x3, 0x3A9, 0xE6000314, 0xE6000342, 0x2, 0x3B1, 0xE6000300, 0x2, 0x3B5,
+		0xE6000300, 0x2, 0x3B7, 0xE6000300, 0x2, 0x3B9, 0xE6000300, 0x2, 0x3BF, 0xE6000300, 0x2, 0x3C5, 0xE6000300, 0x2, 0x3C9, 0xE6000300,
+		0x3, 0x3B1, 0xE6000313, 0xF0000345, 0x3, 0x3B1, 0xE6000314, 0xF0000345, 0x4, 0x3B1, 0xE6000313, 0xE6000300, 0xF0000345, 0x4, 0x3B1, 0xE6000314,
+		0xE6000300, 0xF0000345, 0x4, 0x3B1, 0xE6000313, 0xE6000301, 0xF0000345, 0x4, 0x3B1, 0xE6000314, 0xE6000301, 0xF0000345, 0x4, 0x3B1, 0xE6000313, 0xE6000342,
+		0xF0000345, 0x4, 0x3B1, 0xE6000314, 0xE6000342, 0xF0000345, 0x3, 0x391, 0xE6000313, 0xF0000345, 0x3, 0x391, 0xE6000314, 0xF0000345, 0x4, 0x391,
+		0xE6000313, 0xE6000300, 0xF0000345, 0x4, 0x391, 0xE6000314, 0xE6000300, 0xF0000345, 0x4, 0x391, 0xE6000313, 0xE6000301, 0xF0000345, 0x4, 0x391, 0xE6000314,
+		0xE6000301, 0xF0000345, 0x4, 0x391, 0xE6000313, 0xE6000342, 0xF0000345, 0x4, 0x391, 0xE6000314, 0xE6000342, 0xF0000345, 0x3, 0x3B7, 0xE6000313, 0xF0000345,
+		0x3, 0x3B7, 0xE6000314, 0xF0000345, 0x4, 0x3B7, 0xE6000313, 0xE6000300, 0xF0000345, 0x4, 0x3B7, 0xE6000314, 0xE6000300, 0xF0000345, 0x4, 0x3B7,
+		0xE6000313, 0xE6000301, 0xF0000345, 0x4, 0x3B7, 0xE6000314, 0xE6000301, 0xF0000345, 0x4, 0x3B7, 0xE6000313, 0xE6000342, 0xF0000345, 0x4, 0x3B7, 0xE6000314,
+		0xE6000342, 0xF0000345, 0x3, 0x397, 0xE6000313, 0xF0000345, 0x3, 0x397, 0xE6000314, 0xF0000345, 0x4, 0x397, 0xE6000313, 0xE6000300, 0xF0000345, 0x4,
+		0x397, 0xE6000314, 0xE6000300, 0xF0000345, 0x4, 0x397, 0xE6000313, 0xE6000301, 0xF0000345, 0x4, 0x397, 0xE6000314, 0xE6000301, 0xF0000345, 0x4, 0x397,
+		0xE6000313, 0xE6000342, 0xF0000345, 0x4, 0x397, 0xE6000314, 0xE6000342, 0xF0000345, 0x3, 0x3C9, 0xE6000313, 0xF0000345, 0x3, 0x3C9, 0xE6000314, 0xF0000345,
+		0x4, 0x3C9, 0xE6000313, 0xE6000300, 0xF0000345, 0x4, 0x3C9, 0xE6000314, 0xE6000300, 0xF0000345, 0x4, 0x3C9, 0xE6000313, 0xE6000301, 0xF0000345, 0x4,
+		0x3C9, 0xE6000314, 0xE6000301, 0xF0000345, 0x4, 0x3C9, 0xE6000313, 0xE6000342, 0xF0000345, 0x4, 0x3C9, 0xE6000314, 0xE6000342, 0xF0000345, 0x3, 0x3A9,
+		0xE6000313, 0xF0000345, 0x3, 0x3A9, 0xE6000314, 0xF0000345, 0x4, 0x3A9, 0xE6000313, 0xE6000300, 0xF0000345, 0x4, 0x3A9, 0xE6000314, 0xE6000300, 0xF0000345,
+		0x4, 0x3A9, 0xE6000313, 0xE6000301, 0xF0000345, 0x4, 0x3A9, 0xE6000314, 0xE6000301, 0xF0000345, 0x4, 0x3A9, 0xE6000313, 0xE6000342, 0xF0000345, 0x4,
+		0x3A9, 0xE6000314, 0xE6000342, 0xF0000345, 0x2, 0x3B1, 0xE6000306, 0x2, 0x3B1, 0xE6000304, 0x3, 0x3B1, 0xE6000300, 0xF0000345, 0x2, 0x3B1,
+		0xF0000345, 0x3, 0x3B1, 0xE6000301, 0xF0000345, 0x2, 0x3B1, 0xE6000342, 0x3, 0x3B1, 0xE6000342, 0xF0000345, 0x2, 0x391, 0xE6000306, 0x2,
+		0x391, 0xE6000304, 0x2, 0x391, 0xE6000300, 0x2, 0x391, 0xF0000345, 0x2, 0x20, 0xE6000313, 0x1, 0x3B9, 0x2, 0x20, 0xE6000342,
+		0x2, 0xA8, 0xE6000342, 0x3, 0x20, 0xE6000308, 0xE6000342, 0x3, 0x3B7, 0xE6000300, 0xF0000345, 0x2, 0x3B7, 0xF0000345, 0x3, 0x3B7,
+		0xE6000301, 0xF0000345, 0x2, 0x3B7, 0xE6000342, 0x3, 0x3B7, 0xE6000342, 0xF0000345, 0x2, 0x395, 0xE6000300, 0x2, 0x397, 0xE6000300, 0x2,
+		0x397, 0xF0000345, 0x2, 0x1FBF, 0xE6000300, 0x3, 0x20, 0xE6000313, 0xE6000300, 0x2, 0x1FBF, 0xE6000301, 0x3, 0x20, 0xE6000313, 0xE6000301,
+		0x2, 0x1FBF, 0xE6000342, 0x3, 0x20, 0xE6000313, 0xE6000342, 0x2, 0x3B9, 0xE6000306, 0x2, 0x3B9, 0xE6000304, 0x3, 0x3B9, 0xE6000308,
+		0xE6000300, 0x2, 0x3B9, 0xE6000342, 0x3, 0x3B9, 0xE6000308, 0xE6000342, 0x2, 0x399, 0xE6000306, 0x2, 0x399, 0xE6000304, 0x2, 0x399,
+		0xE6000300, 0x2, 0x1FFE, 0xE6000300, 0x3, 0x20, 0xE6000314, 0xE6000300, 0x2, 0x1FFE, 0xE6000301, 0x3, 0x20, 0xE6000314, 0xE6000301, 0x2,
+		0x1FFE, 0xE6000342, 0x3, 0x20, 0xE6000314, 0xE6000342, 0x2, 0x3C5, 0xE6000306, 0x2, 0x3C5, 0xE6000304, 0x3, 0x3C5, 0xE6000308, 0xE6000300,
+		0x2, 0x3C1, 0xE6000313, 0x2, 0x3C1, 0xE6000314, 0x2, 0x3C5, 0xE6000342, 0x3, 0x3C5, 0xE6000308, 0xE6000342, 0x2, 0x3A5, 0xE6000306,
+		0x2, 0x3A5, 0xE6000304, 0x2, 0x3A5, 0xE6000300, 0x2, 0x3A1, 0xE6000314, 0x2, 0xA8, 0xE6000300, 0x3, 0x20, 0xE6000308, 0xE6000300,
+		0x1, 0x60, 0x3, 0x3C9, 0xE6000300, 0xF0000345, 0x2, 0x3C9, 0xF0000345, 0x3, 0x3C9, 0xE6000301, 0xF0000345, 0x2, 0x3C9, 0xE6000342,
+		0x3, 0x3C9, 0xE6000342, 0xF0000345, 0x2, 0x39F, 0xE6000300, 0x2, 0x3A9, 0xE6000300, 0x2, 0x3A9, 0xF0000345, 0x1, 0xB4, 0x2,
+		0x20, 0xE6000314, 0x1, 0x2002, 0x1, 0x2003, 0x1, 0x2010, 0x2, 0x20, 0xDC000333, 0x1, 0x2E, 0x2, 0x2E, 0x2E,
+		0x3, 0x2E, 0x2E, 0x2E, 0x2, 0x2032, 0x2032, 0x3, 0x2032, 0x2032, 0x2032, 0x2, 0x2035, 0x2035, 0x3, 0x2035,
+		0x2035, 0x2035, 0x2, 0x21, 0x21, 0x2, 0x20, 0xE6000305, 0x2, 0x3F, 0x3F, 0x2, 0x3F, 0x21, 0x2, 0x21,
+		0x3F, 0x4, 0x2032, 0x2032, 0x2032, 0x2032, 0x1, 0x30, 0x1, 0x34, 0x1, 0x35, 0x1, 0x36, 0x1, 0x37,
+		0x1, 0x38, 0x1, 0x39, 0x1, 0x2B, 0x1, 0x2212, 0x1, 0x3D, 0x1, 0x28, 0x1, 0x29, 0x1, 0x6E,
+		0x2, 0x52, 0x73, 0x3, 0x61, 0x2F, 0x63, 0x3, 0x61, 0x2F, 0x73, 0x1, 0x43, 0x2, 0xB0, 0x43,
+		0x3, 0x63, 0x2F, 0x6F, 0x3, 0x63, 0x2F, 0x75, 0x1, 0x190, 0x2, 0xB0, 0x46, 0x1, 0x127, 0x2,
+		0x4E, 0x6F, 0x1, 0x51, 0x2, 0x53, 0x4D, 0x3, 0x54, 0x45, 0x4C, 0x2, 0x54, 0x4D, 0x1, 0x5A,
+		0x1, 0x3A9, 0x1, 0x46, 0x1, 0x5D0, 0x1, 0x5D1, 0x1, 0x5D2, 0x1, 0x5D3, 0x3, 0x46, 0x41, 0x58,
+		0x1, 0x393, 0x1, 0x3A0, 0x1, 0x2211, 0x3, 0x31, 0x2044, 0x37, 0x3, 0x31, 0x2044, 0x39, 0x4, 0x31,
+		0x2044, 0x31, 0x30, 0x3, 0x31, 0x2044, 0x33, 0x3, 0x32, 0x2044, 0x33, 0x3, 0x31, 0x2044, 0x35, 0x3,
+		0x32, 0x2044, 0x35, 0x3, 0x33, 0x2044, 0x35, 0x3, 0x34, 0x2044, 0x35, 0x3, 0x31, 0x2044, 0x36, 0x3,
+		0x35, 0x2044, 0x36, 0x3, 0x31, 0x2044, 0x38, 0x3, 0x33, 0x2044, 0x38, 0x3, 0x35, 0x2044, 0x38, 0x3,
+		0x37, 0x2044, 0x38, 0x2, 0x31, 0x2044, 0x2, 0x49, 0x49, 0x3, 0x49, 0x49, 0x49, 0x2, 0x49, 0x56,
+		0x1, 0x56, 0x2, 0x56, 0x49, 0x3, 0x56, 0x49, 0x49, 0x4, 0x56, 0x49, 0x49, 0x49, 0x2, 0x49,
+		0x58, 0x1, 0x58, 0x2, 0x58, 0x49, 0x3, 0x58, 0x49, 0x49, 0x2, 0x69, 0x69, 0x3, 0x69, 0x69,
+		0x69, 0x2, 0x69, 0x76, 0x2, 0x76, 0x69, 0x3, 0x76, 0x69, 0x69, 0x4, 0x76, 0x69, 0x69, 0x69,
+		0x2, 0x69, 0x78, 0x2, 0x78, 0x69, 0x3, 0x78, 0x69, 0x69, 0x3, 0x30, 0x2044, 0x33, 0x2, 0x2190,
+		0x1000338, 0x2, 0x2192, 0x1000338, 0x2, 0x2194, 0x1000338, 0x2, 0x21D0, 0x1000338, 0x2, 0x21D4, 0x1000338, 0x2, 0x21D2, 0x1000338,
+		0x2, 0x2203, 0x1000338, 0x2, 0x2208, 0x1000338, 0x2, 0x220B, 0x1000338, 0x2, 0x2223, 0x1000338, 0x2, 0x2225, 0x1000338, 0x2,
+		0x222B, 0x222B, 0x3, 0x222B, 0x222B, 0x222B, 0x2, 0x222E, 0x222E, 0x3, 0x222E, 0x222E, 0x222E, 0x2, 0x223C, 0x1000338,
+		0x2, 0x2243, 0x1000338, 0x2, 0x2245, 0x1000338, 0x2, 0x2248, 0x1000338, 0x2, 0x3D, 0x1000338, 0x2, 0x2261, 0x1000338, 0x2,
+		0x224D, 0x1000338, 0x2, 0x3C, 0x1000338, 0x2, 0x3E, 0x1000338, 0x2, 0x2264, 0x1000338, 0x2, 0x2265, 0x1000338, 0x2, 0x2272,
+		0x1000338, 0x2, 0x2273, 0x1000338, 0x2, 0x2276, 0x1000338, 0x2, 0x2277, 0x1000338, 0x2, 0x227A, 0x1000338, 0x2, 0x227B, 0x1000338,
+		0x2, 0x2282, 0x1000338, 0x2, 0x2283, 0x1000338, 0x2, 0x2286, 0x1000338, 0x2, 0x2287, 0x1000338, 0x2, 0x22A2, 0x1000338, 0x2,
+		0x22A8, 0x1000338, 0x2, 0x22A9, 0x1000338, 0x2, 0x22AB, 0x1000338, 0x2, 0x227C, 0x1000338, 0x2, 0x227D, 0x1000338, 0x2, 0x2291,
+		0x1000338, 0x2, 0x2292, 0x1000338, 0x2, 0x22B2, 0x1000338, 0x2, 0x22B3, 0x1000338, 0x2, 0x22B4, 0x1000338, 0x2, 0x22B5, 0x1000338,
+		0x1, 0x3008, 0x1, 0x3009, 0x2, 0x31, 0x30, 0x2, 0x31, 0x31, 0x2, 0x31, 0x32, 0x2, 0x31, 0x33,
+		0x2, 0x31, 0x34, 0x2, 0x31, 0x35, 0x2, 0x31, 0x36, 0x2, 0x31, 0x37, 0x2, 0x31, 0x38, 0x2,
+		0x31, 0x39, 0x2, 0x32, 0x30, 0x3, 0x28, 0x31, 0x29, 0x3, 0x28, 0x32, 0x29, 0x3, 0x28, 0x33,
+		0x29, 0x3, 0x28, 0x34, 0x29, 0x3, 0x28, 0x35, 0x29, 0x3, 0x28, 0x36, 0x29, 0x3, 0x28, 0x37,
+		0x29, 0x3, 0x28, 0x38, 0x29, 0x3, 0x28, 0x39, 0x29, 0x4, 0x28, 0x31, 0x30, 0x29, 0x4, 0x28,
+		0x31, 0x31, 0x29, 0x4, 0x28, 0x31, 0x32, 0x29, 0x4, 0x28, 0x31, 0x33, 0x29, 0x4, 0x28, 0x31,
+		0x34, 0x29, 0x4, 0x28, 0x31, 0x35, 0x29, 0x4, 0x28, 0x31, 0x36, 0x29, 0x4, 0x28, 0x31, 0x37,
+		0x29, 0x4, 0x28, 0x31, 0x38, 0x29, 0x4, 0x28, 0x31, 0x39, 0x29, 0x4, 0x28, 0x32, 0x30, 0x29,
+		0x2, 0x31, 0x2E, 0x2, 0x32, 0x2E, 0x2, 0x33, 0x2E, 0x2, 0x34, 0x2E, 0x2, 0x35, 0x2E, 0x2,
+		0x36, 0x2E, 0x2, 0x37, 0x2E, 0x2, 0x38, 0x2E, 0x2, 0x39, 0x2E, 0x3, 0x31, 0x30, 0x2E, 0x3,
+		0x31, 0x31, 0x2E, 0x3, 0x31, 0x32, 0x2E, 0x3, 0x31, 0x33, 0x2E, 0x3, 0x31, 0x34, 0x2E, 0x3,
+		0x31, 0x35, 0x2E, 0x3, 0x31, 0x36, 0x2E, 0x3, 0x31, 0x37, 0x2E, 0x3, 0x31, 0x38, 0x2E, 0x3,
+		0x31, 0x39, 0x2E, 0x3, 0x32, 0x30, 0x2E, 0x3, 0x28, 0x61, 0x29, 0x3, 0x28, 0x62, 0x29, 0x3,
+		0x28, 0x63, 0x29, 0x3, 0x28, 0x64, 0x29, 0x3, 0x28, 0x65, 0x29, 0x3, 0x28, 0x66, 0x29, 0x3,
+		0x28, 0x67, 0x29, 0x3, 0x28, 0x68, 0x29, 0x3, 0x28, 0x69, 0x29, 0x3, 0x28, 0x6A, 0x29, 0x3,
+		0x28, 0x6B, 0x29, 0x3, 0x28, 0x6C, 0x29, 0x3, 0x28, 0x6D, 0x29, 0x3, 0x28, 0x6E, 0x29, 0x3,
+		0x28, 0x6F, 0x29, 0x3, 0x28, 0x70, 0x29, 0x3, 0x28, 0x71, 0x29, 0x3, 0x28, 0x72, 0x29, 0x3,
+		0x28, 0x73, 0x29, 0x3, 0x28, 0x74, 0x29, 0x3, 0x28, 0x75, 0x29, 0x3, 0x28, 0x76, 0x29, 0x3,
+		0x28, 0x77, 0x29, 0x3, 0x28, 0x78, 0x29, 0x3, 0x28, 0x79, 0x29, 0x3, 0x28, 0x7A, 0x29, 0x1,
+		0x53, 0x1, 0x59, 0x1, 0x71, 0x4, 0x222B, 0x222B, 0x222B, 0x222B, 0x3, 0x3A, 0x3A, 0x3D, 0x2, 0x3D,
+		0x3D, 0x3, 0x3D, 0x3D, 0x3D, 0x2, 0x2ADD, 0x1000338, 0x1, 0x2D61, 0x1, 0x6BCD, 0x1, 0x9F9F, 0x1, 0x4E00,
+		0x1, 0x4E28, 0x1, 0x4E36, 0x1, 0x4E3F, 0x1, 0x4E59, 0x1, 0x4E85, 0x1, 0x4E8C, 0x1, 0x4EA0, 0x1, 0x4EBA,
+		0x1, 0x513F, 0x1, 0x5165, 0x1, 0x516B, 0x1, 0x5182, 0x1, 0x5196, 0x1, 0x51AB, 0x1, 0x51E0, 0x1, 0x51F5,
+		0x1, 0x5200, 0x1, 0x529B, 0x1, 0x52F9, 0x1, 0x5315, 0x1, 0x531A, 0x1, 0x5338, 0x1, 0x5341, 0x1, 0x535C,
+		0x1, 0x5369, 0x1, 0x5382, 0x1, 0x53B6, 0x1, 0x53C8, 0x1, 0x53E3, 0x1, 0x56D7, 0x1, 0x571F, 0x1, 0x58EB,
+		0x1, 0x5902, 0x1, 0x590A, 0x1, 0x5915, 0x1, 0x5927, 0x1, 0x5973, 0x1, 0x5B50, 0x1, 0x5B80, 0x1, 0x5BF8,
+		0x1, 0x5C0F, 0x1, 0x5C22, 0x1, 0x5C38, 0x1, 0x5C6E, 0x1, 0x5C71, 0x1, 0x5DDB, 0x1, 0x5DE5, 0x1, 0x5DF1,
+		0x1, 0x5DFE, 0x1, 0x5E72, 0x1, 0x5E7A, 0x1, 0x5E7F, 0x1, 0x5EF4, 0x1, 0x5EFE, 0x1, 0x5F0B, 0x1, 0x5F13,
+		0x1, 0x5F50, 0x1, 0x5F61, 0x1, 0x5F73, 0x1, 0x5FC3, 0x1, 0x6208, 0x1, 0x6236, 0x1, 0x624B, 0x1, 0x652F,
+		0x1, 0x6534, 0x1, 0x6587, 0x1, 0x6597, 0x1, 0x65A4, 0x1, 0x65B9, 0x1, 0x65E0, 0x1, 0x65E5, 0x1, 0x66F0,
+		0x1, 0x6708, 0x1, 0x6728, 0x1, 0x6B20, 0x1, 0x6B62, 0x1, 0x6B79, 0x1, 0x6BB3, 0x1, 0x6BCB, 0x1, 0x6BD4,
+		0x1, 0x6BDB, 0x1, 0x6C0F, 0x1, 0x6C14, 0x1, 0x6C34, 0x1, 0x706B, 0x1, 0x722A, 0x1, 0x7236, 0x1, 0x723B,
+		0x1, 0x723F, 0x1, 0x7247, 0x1, 0x7259, 0x1, 0x725B, 0x1, 0x72AC, 0x1, 0x7384, 0x1, 0x7389, 0x1, 0x74DC,
+		0x1, 0x74E6, 0x1, 0x7518, 0x1, 0x751F, 0x1, 0x7528, 0x1, 0x7530, 0x1, 0x758B, 0x1, 0x7592, 0x1, 0x7676,
+		0x1, 0x767D, 0x1, 0x76AE, 0x1, 0x76BF, 0x1, 0x76EE, 0x1, 0x77DB, 0x1, 0x77E2, 0x1, 0x77F3, 0x1, 0x793A,
+		0x1, 0x79B8, 0x1, 0x79BE, 0x1, 0x7A74, 0x1, 0x7ACB, 0x1, 0x7AF9, 0x1, 0x7C73, 0x1, 0x7CF8, 0x1, 0x7F36,
+		0x1, 0x7F51, 0x1, 0x7F8A, 0x1, 0x7FBD, 0x1, 0x8001, 0x1, 0x800C, 0x1, 0x8012, 0x1, 0x8033, 0x1, 0x807F,
+		0x1, 0x8089, 0x1, 0x81E3, 0x1, 0x81EA, 0x1, 0x81F3, 0x1, 0x81FC, 0x1, 0x820C, 0x1, 0x821B, 0x1, 0x821F,
+		0x1, 0x826E, 0x1, 0x8272, 0x1, 0x8278, 0x1, 0x864D, 0x1, 0x866B, 0x1, 0x8840, 0x1, 0x884C, 0x1, 0x8863,
+		0x1, 0x897E, 0x1, 0x898B, 0x1, 0x89D2, 0x1, 0x8A00, 0x1, 0x8C37, 0x1, 0x8C46, 0x1, 0x8C55, 0x1, 0x8C78,
+		0x1, 0x8C9D, 0x1, 0x8D64, 0x1, 0x8D70, 0x1, 0x8DB3, 0x1, 0x8EAB, 0x1, 0x8ECA, 0x1, 0x8F9B, 0x1, 0x8FB0,
+		0x1, 0x8FB5, 0x1, 0x9091, 0x1, 0x9149, 0x1, 0x91C6, 0x1, 0x91CC, 0x1, 0x91D1, 0x1, 0x9577, 0x1, 0x9580,
+		0x1, 0x961C, 0x1, 0x96B6, 0x1, 0x96B9, 0x1, 0x96E8, 0x1, 0x9751, 0x1, 0x975E, 0x1, 0x9762, 0x1, 0x9769,
+		0x1, 0x97CB, 0x1, 0x97ED, 0x1, 0x97F3, 0x1, 0x9801, 0x1, 0x98A8, 0x1, 0x98DB, 0x1, 0x98DF, 0x1, 0x9996,
+		0x1, 0x9999, 0x1, 0x99AC, 0x1, 0x9AA8, 0x1, 0x9AD8, 0x1, 0x9ADF, 0x1, 0x9B25, 0x1, 0x9B2F, 0x1, 0x9B32,
+		0x1, 0x9B3C, 0x1, 0x9B5A, 0x1, 0x9CE5, 0x1, 0x9E75, 0x1, 0x9E7F, 0x1, 0x9EA5, 0x1, 0x9EBB, 0x1, 0x9EC3,
+		0x1, 0x9ECD, 0x1, 0x9ED1, 0x1, 0x9EF9, 0x1, 0x9EFD, 0x1, 0x9F0E, 0x1, 0x9F13, 0x1, 0x9F20, 0x1, 0x9F3B,
+		0x1, 0x9F4A, 0x1, 0x9F52, 0x1, 0x9F8D, 0x1, 0x9F9C, 0x1, 0x9FA0, 0x1, 0x3012, 0x1, 0x5344, 0x1, 0x5345,
+		0x2, 0x304B, 0x8003099, 0x2, 0x304D, 0x8003099, 0x2, 0x304F, 0x8003099, 0x2, 0x3051, 0x8003099, 0x2, 0x3053, 0x8003099, 0x2,
+		0x3055, 0x8003099, 0x2, 0x3057, 0x8003099, 0x2, 0x3059, 0x8003099, 0x2, 0x305B, 0x8003099, 0x2, 0x305D, 0x8003099, 0x2, 0x305F,
+		0x8003099, 0x2, 0x3061, 0x8003099, 0x2, 0x3064, 0x8003099, 0x2, 0x3066, 0x8003099, 0x2, 0x3068, 0x8003099, 0x2, 0x306F, 0x8003099,
+		0x2, 0x306F, 0x800309A, 0x2, 0x3072, 0x8003099, 0x2, 0x3072, 0x800309A, 0x2, 0x3075, 0x8003099, 0x2, 0x3075, 0x800309A, 0x2,
+		0x3078, 0x8003099, 0x2, 0x3078, 0x800309A, 0x2, 0x307B, 0x8003099, 0x2, 0x307B, 0x800309A, 0x2, 0x3046, 0x8003099, 0x2, 0x20,
+		0x8003099, 0x2, 0x20, 0x800309A, 0x2, 0x309D, 0x8003099, 0x2, 0x3088, 0x308A, 0x2, 0x30AB, 0x8003099, 0x2, 0x30AD, 0x8003099,
+		0x2, 0x30AF, 0x8003099, 0x2, 0x30B1, 0x8003099, 0x2, 0x30B3, 0x8003099, 0x2, 0x30B5, 0x8003099, 0x2, 0x30B7, 0x8003099, 0x2,
+		0x30B9, 0x8003099, 0x2, 0x30BB, 0x8003099, 0x2, 0x30BD, 0x8003099, 0x2, 0x30BF, 0x8003099, 0x2, 0x30C1, 0x8003099, 0x2, 0x30C4,
+		0x8003099, 0x2, 0x30C6, 0x8003099, 0x2, 0x30C8, 0x8003099, 0x2, 0x30CF, 0x8003099, 0x2, 0x30CF, 0x800309A, 0x2, 0x30D2, 0x8003099,
+		0x2, 0x30D2, 0x800309A, 0x2, 0x30D5, 0x8003099, 0x2, 0x30D5, 0x800309A, 0x2, 0x30D8, 0x8003099, 0x2, 0x30D8, 0x800309A, 0x2,
+		0x30DB, 0x8003099, 0x2, 0x30DB, 0x800309A, 0x2, 0x30A6, 0x8003099, 0x2, 0x30EF, 0x8003099, 0x2, 0x30F0, 0x8003099, 0x2, 0x30F1,
+		0x8003099, 0x2, 0x30F2, 0x8003099, 0x2, 0x30FD, 0x8003099, 0x2, 0x30B3, 0x30C8, 0x1, 0x1100, 0x1, 0x1101, 0x1, 0x11AA,
+		0x1, 0x1102, 0x1, 0x11AC, 0x1, 0x11AD, 0x1, 0x1103, 0x1, 0x1104, 0x1, 0x1105, 0x1, 0x11B0, 0x1, 0x11B1,
+		0x1, 0x11B2, 0x1, 0x11B3, 0x1, 0x11B4, 0x1, 0x11B5, 0x1, 0x111A, 0x1, 0x1106, 0x1, 0x1107, 0x1, 0x1108,
+		0x1, 0x1121, 0x1, 0x1109, 0x1, 0x110A, 0x1, 0x110B, 0x1, 0x110C, 0x1, 0x110D, 0x1, 0x110E, 0x1, 0x110F,
+		0x1, 0x1110, 0x1, 0x1111, 0x1, 0x1112, 0x1, 0x1161, 0x1, 0x1162, 0x1, 0x1163, 0x1, 0x1164, 0x1, 0x1165,
+		0x1, 0x1166, 0x1, 0x1167, 0x1, 0x1168, 0x1, 0x1169, 0x1, 0x116A, 0x1, 0x116B, 0x1, 0x116C, 0x1, 0x116D,
+		0x1, 0x116E, 0x1, 0x116F, 0x1, 0x1170, 0x1, 0x1171, 0x1, 0x1172, 0x1, 0x1173, 0x1, 0x1174, 0x1, 0x1175,
+		0x1, 0x1160, 0x1, 0x1114, 0x1, 0x1115, 0x1, 0x11C7, 0x1, 0x11C8, 0x1, 0x11CC, 0x1, 0x11CE, 0x1, 0x11D3,
+		0x1, 0x11D7, 0x1, 0x11D9, 0x1, 0x111C, 0x1, 0x11DD, 0x1, 0x11DF, 0x1, 0x111D, 0x1, 0x111E, 0x1, 0x1120,
+		0x1, 0x1122, 0x1, 0x1123, 0x1, 0x1127, 0x1, 0x1129, 0x1, 0x112B, 0x1, 0x112C, 0x1, 0x112D, 0x1, 0x112E,
+		0x1, 0x112F, 0x1, 0x1132, 0x1, 0x1136, 0x1, 0x1140, 0x1, 0x1147, 0x1, 0x114C, 0x1, 0x11F1, 0x1, 0x11F2,
+		0x1, 0x1157, 0x1, 0x1158, 0x1, 0x1159, 0x1, 0x1184, 0x1, 0x1185, 0x1, 0x1188, 0x1, 0x1191, 0x1, 0x1192,
+		0x1, 0x1194, 0x1, 0x119E, 0x1, 0x11A1, 0x1, 0x4E09, 0x1, 0x56DB, 0x1, 0x4E0A, 0x1, 0x4E2D, 0x1, 0x4E0B,
+		0x1, 0x7532, 0x1, 0x4E19, 0x1, 0x4E01, 0x1, 0x5929, 0x1, 0x5730, 0x3, 0x28, 0x1100, 0x29, 0x3, 0x28,
+		0x1102, 0x29, 0x3, 0x28, 0x1103, 0x29, 0x3, 0x28, 0x1105, 0x29, 0x3, 0x28, 0x1106, 0x29, 0x3, 0x28,
+		0x1107, 0x29, 0x3, 0x28, 0x1109, 0x29, 0x3, 0x28, 0x110B, 0x29, 0x3, 0x28, 0x110C, 0x29, 0x3, 0x28,
+		0x110E, 0x29, 0x3, 0x28, 0x110F, 0x29, 0x3, 0x28, 0x1110, 0x29, 0x3, 0x28, 0x1111, 0x29, 0x3, 0x28,
+		0x1112, 0x29, 0x4, 0x28, 0x1100, 0x1161, 0x29, 0x4, 0x28, 0x1102, 0x1161, 0x29, 0x4, 0x28, 0x1103, 0x1161,
+		0x29, 0x4, 0x28, 0x1105, 0x1161, 0x29, 0x4, 0x28, 0x1106, 0x1161, 0x29, 0x4, 0x28, 0x1107, 0x1161, 0x29,
+		0x4, 0x28, 0x1109, 0x1161, 0x29, 0x4, 0x28, 0x110B, 0x1161, 0x29, 0x4, 0x28, 0x110C, 0x1161, 0x29, 0x4,
+		0x28, 0x110E, 0x1161, 0x29, 0x4, 0x28, 0x110F, 0x1161, 0x29, 0x4, 0x28, 0x1110, 0x1161, 0x29, 0x4, 0x28,
+		0x1111, 0x1161, 0x29, 0x4, 0x28, 0x1112, 0x1161, 0x29, 0x4, 0x28, 0x110C, 0x116E, 0x29, 0x7, 0x28, 0x110B,
+		0x1169, 0x110C, 0x1165, 0x11AB, 0x29, 0x6, 0x28, 0x110B, 0x1169, 0x1112, 0x116E, 0x29, 0x3, 0x28, 0x4E00, 0x29,
+		0x3, 0x28, 0x4E8C, 0x29, 0x3, 0x28, 0x4E09, 0x29, 0x3, 0x28, 0x56DB, 0x29, 0x3, 0x28, 0x4E94, 0x29,
+		0x3, 0x28, 0x516D, 0x29, 0x3, 0x28, 0x4E03, 0x29, 0x3, 0x28, 0x516B, 0x29, 0x3, 0x28, 0x4E5D, 0x29,
+		0x3, 0x28, 0x5341, 0x29, 0x3, 0x28, 0x6708, 0x29, 0x3, 0x28, 0x706B, 0x29, 0x3, 0x28, 0x6C34, 0x29,
+		0x3, 0x28, 0x6728, 0x29, 0x3, 0x28, 0x91D1, 0x29, 0x3, 0x28, 0x571F, 0x29, 0x3, 0x28, 0x65E5, 0x29,
+		0x3, 0x28, 0x682A, 0x29, 0x3, 0x28, 0x6709, 0x29, 0x3, 0x28, 0x793E, 0x29, 0x3, 0x28, 0x540D, 0x29,
+		0x3, 0x28, 0x7279, 0x29, 0x3, 0x28, 0x8CA1, 0x29, 0x3, 0x28, 0x795D, 0x29, 0x3, 0x28, 0x52B4, 0x29,
+		0x3, 0x28, 0x4EE3, 0x29, 0x3, 0x28, 0x547C, 0x29, 0x3, 0x28, 0x5B66, 0x29, 0x3, 0x28, 0x76E3, 0x29,
+		0x3, 0x28, 0x4F01, 0x29, 0x3, 0x28, 0x8CC7, 0x29, 0x3, 0x28, 0x5354, 0x29, 0x3, 0x28, 0x796D, 0x29,
+		0x3, 0x28, 0x4F11, 0x29, 0x3, 0x28, 0x81EA, 0x29, 0x3, 0x28, 0x81F3, 0x29, 0x1, 0x554F, 0x1, 0x5E7C,
+		0x1, 0x7B8F, 0x3, 0x50, 0x54, 0x45, 0x2, 0x32, 0x31, 0x2, 0x32, 0x32, 0x2, 0x32, 0x33, 0x2,
+		0x32, 0x34, 0x2, 0x32, 0x35, 0x2, 0x32, 0x36, 0x2, 0x32, 0x37, 0x2, 0x32, 0x38, 0x2, 0x32,
+		0x39, 0x2, 0x33, 0x30, 0x2, 0x33, 0x31, 0x2, 0x33, 0x32, 0x2, 0x33, 0x33, 0x2, 0x33, 0x34,
+		0x2, 0x33, 0x35, 0x2, 0x1100, 0x1161, 0x2, 0x1102, 0x1161, 0x2, 0x1103, 0x1161, 0x2, 0x1105, 0x1161, 0x2,
+		0x1106, 0x1161, 0x2, 0x1107, 0x1161, 0x2, 0x1109, 0x1161, 0x2, 0x110B, 0x1161, 0x2, 0x110C, 0x1161, 0x2, 0x110E,
+		0x1161, 0x2, 0x110F, 0x1161, 0x2, 0x1110, 0x1161, 0x2, 0x1111, 0x1161, 0x2, 0x1112, 0x1161, 0x5, 0x110E, 0x1161,
+		0x11B7, 0x1100, 0x1169, 0x4, 0x110C, 0x116E, 0x110B, 0x1174, 0x2, 0x110B, 0x116E, 0x1, 0x4E94, 0x1, 0x516D, 0x1,
+		0x4E03, 0x1, 0x4E5D, 0x1, 0x682A, 0x1, 0x6709, 0x1, 0x793E, 0x1, 0x540D, 0x1, 0x7279, 0x1, 0x8CA1, 0x1,
+		0x795D, 0x1, 0x52B4, 0x1, 0x79D8, 0x1, 0x7537, 0x1, 0x9069, 0x1, 0x512A, 0x1, 0x5370, 0x1, 0x6CE8, 0x1,
+		0x9805, 0x1, 0x4F11, 0x1, 0x5199, 0x1, 0x6B63, 0x1, 0x5DE6, 0x1, 0x53F3, 0x1, 0x533B, 0x1, 0x5B97, 0x1,
+		0x5B66, 0x1, 0x76E3, 0x1, 0x4F01, 0x1, 0x8CC7, 0x1, 0x5354, 0x1, 0x591C, 0x2, 0x33, 0x36, 0x2, 0x33,
+		0x37, 0x2, 0x33, 0x38, 0x2, 0x33, 0x39, 0x2, 0x34, 0x30, 0x2, 0x34, 0x31, 0x2, 0x34, 0x32,
+		0x2, 0x34, 0x33, 0x2, 0x34, 0x34, 0x2, 0x34, 0x35, 0x2, 0x34, 0x36, 0x2, 0x34, 0x37, 0x2,
+		0x34, 0x38, 0x2, 0x34, 0x39, 0x2, 0x35, 0x30, 0x2, 0x31, 0x6708, 0x2, 0x32, 0x6708, 0x2, 0x33,
+		0x6708, 0x2, 0x34, 0x6708, 0x2, 0x35, 0x6708, 0x2, 0x36, 0x6708, 0x2, 0x37, 0x6708, 0x2, 0x38, 0x6708,
+		0x2, 0x39, 0x6708, 0x3, 0x31, 0x30, 0x6708, 0x3, 0x31, 0x31, 0x6708, 0x3, 0x31, 0x32, 0x6708, 0x2,
+		0x48, 0x67, 0x3, 0x65, 0x72, 0x67, 0x2, 0x65, 0x56, 0x3, 0x4C, 0x54, 0x44, 0x1, 0x30A2, 0x1,
+		0x30A4, 0x1, 0x30A6, 0x1, 0x30A8, 0x1, 0x30AA, 0x1, 0x30AB, 0x1, 0x30AD, 0x1, 0x30AF, 0x1, 0x30B1, 0x1,
+		0x30B3, 0x1, 0x30B5, 0x1, 0x30B7, 0x1, 0x30B9, 0x1, 0x30BB, 0x1, 0x30BD, 0x1, 0x30BF, 0x1, 0x30C1, 0x1,
+		0x30C4, 0x1, 0x30C6, 0x1, 0x30C8, 0x1, 0x30CA, 0x1, 0x30CB, 0x1, 0x30CC, 0x1, 0x30CD, 0x1, 0x30CE, 0x1,
+		0x30CF, 0x1, 0x30D2, 0x1, 0x30D5, 0x1, 0x30D8, 0x1, 0x30DB, 0x1, 0x30DE, 0x1, 0x30DF, 0x1, 0x30E0, 0x1,
+		0x30E1, 0x1, 0x30E2, 0x1, 0x30E4, 0x1, 0x30E6, 0x1, 0x30E8, 0x1, 0x30E9, 0x1, 0x30EA, 0x1, 0x30EB, 0x1,
+		0x30EC, 0x1, 0x30ED, 0x1, 0x30EF, 0x1, 0x30F0, 0x1, 0x30F1, 0x1, 0x30F2, 0x2, 0x4EE4, 0x548C, 0x5, 0x30A2,
+		0x30CF, 0x800309A, 0x30FC, 0x30C8, 0x4, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x5, 0x30A2, 0x30F3, 0x30D8, 0x800309A, 0x30A2, 0x3,
+		0x30A2, 0x30FC, 0x30EB, 0x5, 0x30A4, 0x30CB, 0x30F3, 0x30AF, 0x8003099, 0x3, 0x30A4, 0x30F3, 0x30C1, 0x3, 0x30A6, 0x30A9,
+		0x30F3, 0x6, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8, 0x8003099, 0x4, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x3, 0x30AA, 0x30F3,
+		0x30B9, 0x3, 0x30AA, 0x30FC, 0x30E0, 0x3, 0x30AB, 0x30A4, 0x30EA, 0x4, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x4, 0x30AB,
+		0x30ED, 0x30EA, 0x30FC, 0x4, 0x30AB, 0x8003099, 0x30ED, 0x30F3, 0x4, 0x30AB, 0x8003099, 0x30F3, 0x30DE, 0x4, 0x30AD, 0x8003099,
+		0x30AB, 0x8003099, 0x4, 0x30AD, 0x8003099, 0x30CB, 0x30FC, 0x4, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x6, 0x30AD, 0x8003099, 0x30EB,
+		0x30BF, 0x8003099, 0x30FC, 0x2, 0x30AD, 0x30ED, 0x6, 0x30AD, 0x30ED, 0x30AF, 0x8003099, 0x30E9, 0x30E0, 0x6, 0x30AD, 0x30ED,
+		0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x5, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x4, 0x30AF, 0x8003099, 0x30E9, 0x30E0, 0x6,
+		0x30AF, 0x8003099, 0x30E9, 0x30E0, 0x30C8, 0x30F3, 0x6, 0x30AF, 0x30EB, 0x30BB, 0x8003099, 0x30A4, 0x30ED, 0x4, 0x30AF, 0x30ED,
+		0x30FC, 0x30CD, 0x3, 0x30B1, 0x30FC, 0x30B9, 0x3, 0x30B3, 0x30EB, 0x30CA, 0x4, 0x30B3, 0x30FC, 0x30DB, 0x800309A, 0x4,
+		0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x5, 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x5, 0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x8003099,
+		0x3, 0x30BB, 0x30F3, 0x30C1, 0x3, 0x30BB, 0x30F3, 0x30C8, 0x4, 0x30BF, 0x8003099, 0x30FC, 0x30B9, 0x3, 0x30C6, 0x8003099,
+		0x30B7, 0x3, 0x30C8, 0x8003099, 0x30EB, 0x2, 0x30C8, 0x30F3, 0x2, 0x30CA, 0x30CE, 0x3, 0x30CE, 0x30C3, 0x30C8, 0x3,
+		0x30CF, 0x30A4, 0x30C4, 0x6, 0x30CF, 0x800309A, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x4, 0x30CF, 0x800309A, 0x30FC, 0x30C4, 0x5,
+		0x30CF, 0x8003099, 0x30FC, 0x30EC, 0x30EB, 0x6, 0x30D2, 0x800309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x4, 0x30D2, 0x800309A, 0x30AF,
+		0x30EB, 0x3, 0x30D2, 0x800309A, 0x30B3, 0x3, 0x30D2, 0x8003099, 0x30EB, 0x6, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8, 0x8003099,
+		0x4, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x6, 0x30D5, 0x8003099, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x3, 0x30D5, 0x30E9, 0x30F3,
+		0x5, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x3, 0x30D8, 0x800309A, 0x30BD, 0x4, 0x30D8, 0x800309A, 0x30CB, 0x30D2, 0x3,
+		0x30D8, 0x30EB, 0x30C4, 0x4, 0x30D8, 0x800309A, 0x30F3, 0x30B9, 0x5, 0x30D8, 0x800309A, 0x30FC, 0x30B7, 0x8003099, 0x4, 0x30D8,
+		0x8003099, 0x30FC, 0x30BF, 0x5, 0x30DB, 0x800309A, 0x30A4, 0x30F3, 0x30C8, 0x4, 0x30DB, 0x8003099, 0x30EB, 0x30C8, 0x2, 0x30DB,
+		0x30F3, 0x5, 0x30DB, 0x800309A, 0x30F3, 0x30C8, 0x8003099, 0x3, 0x30DB, 0x30FC, 0x30EB, 0x3, 0x30DB, 0x30FC, 0x30F3, 0x4,
+		0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x3, 0x30DE, 0x30A4, 0x30EB, 0x3, 0x30DE, 0x30C3, 0x30CF, 0x3, 0x30DE, 0x30EB, 0x30AF,
+		0x5, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x4, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x2, 0x30DF, 0x30EA, 0x6, 0x30DF,
+		0x30EA, 0x30CF, 0x8003099, 0x30FC, 0x30EB, 0x3, 0x30E1, 0x30AB, 0x8003099, 0x5, 0x30E1, 0x30AB, 0x8003099, 0x30C8, 0x30F3, 0x4,
+		0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x4, 0x30E4, 0x30FC, 0x30C8, 0x8003099, 0x3, 0x30E4, 0x30FC, 0x30EB, 0x3, 0x30E6, 0x30A2,
+		0x30F3, 0x4, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x2, 0x30EA, 0x30E9, 0x4, 0x30EB, 0x30D2, 0x800309A, 0x30FC, 0x5, 0x30EB,
+		0x30FC, 0x30D5, 0x8003099, 0x30EB, 0x2, 0x30EC, 0x30E0, 0x6, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x8003099, 0x30F3, 0x3, 0x30EF,
+		0x30C3, 0x30C8, 0x2, 0x30, 0x70B9, 0x2, 0x31, 0x70B9, 0x2, 0x32, 0x70B9, 0x2, 0x33, 0x70B9, 0x2, 0x34,
+		0x70B9, 0x2, 0x35, 0x70B9, 0x2, 0x36, 0x70B9, 0x2, 0x37, 0x70B9, 0x2, 0x38, 0x70B9, 0x2, 0x39, 0x70B9,
+		0x3, 0x31, 0x30, 0x70B9, 0x3, 0x31, 0x31, 0x70B9, 0x3, 0x31, 0x32, 0x70B9, 0x3, 0x31, 0x33, 0x70B9,
+		0x3, 0x31, 0x34, 0x70B9, 0x3, 0x31, 0x35, 0x70B9, 0x3, 0x31, 0x36, 0x70B9, 0x3, 0x31, 0x37, 0x70B9,
+		0x3, 0x31, 0x38, 0x70B9, 0x3, 0x31, 0x39, 0x70B9, 0x3, 0x32, 0x30, 0x70B9, 0x3, 0x32, 0x31, 0x70B9,
+		0x3, 0x32, 0x32, 0x70B9, 0x3, 0x32, 0x33, 0x70B9, 0x3, 0x32, 0x34, 0x70B9, 0x3, 0x68, 0x50, 0x61,
+		0x2, 0x64, 0x61, 0x2, 0x41, 0x55, 0x3, 0x62, 0x61, 0x72, 0x2, 0x6F, 0x56, 0x2, 0x70, 0x63,
+		0x2, 0x64, 0x6D, 0x3, 0x64, 0x6D, 0x32, 0x3, 0x64, 0x6D, 0x33, 0x2, 0x49, 0x55, 0x2, 0x5E73,
+		0x6210, 0x2, 0x662D, 0x548C, 0x2, 0x5927, 0x6B63, 0x2, 0x660E, 0x6CBB, 0x4, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x2,
+		0x70, 0x41, 0x2, 0x6E, 0x41, 0x2, 0x3BC, 0x41, 0x2, 0x6D, 0x41, 0x2, 0x6B, 0x41, 0x2, 0x4B,
+		0x42, 0x2, 0x4D, 0x42, 0x2, 0x47, 0x42, 0x3, 0x63, 0x61, 0x6C, 0x4, 0x6B, 0x63, 0x61, 0x6C,
+		0x2, 0x70, 0x46, 0x2, 0x6E, 0x46, 0x2, 0x3BC, 0x46, 0x2, 0x3BC, 0x67, 0x2, 0x6D, 0x67, 0x2,
+		0x6B, 0x67, 0x2, 0x48, 0x7A, 0x3, 0x6B, 0x48, 0x7A, 0x3, 0x4D, 0x48, 0x7A, 0x3, 0x47, 0x48,
+		0x7A, 0x3, 0x54, 0x48, 0x7A, 0x2, 0x3BC, 0x6C, 0x2, 0x6D, 0x6C, 0x2, 0x64, 0x6C, 0x2, 0x6B,
+		0x6C, 0x2, 0x66, 0x6D, 0x2, 0x6E, 0x6D, 0x2, 0x3BC, 0x6D, 0x2, 0x6D, 0x6D, 0x2, 0x63, 0x6D,
+		0x2, 0x6B, 0x6D, 0x3, 0x6D, 0x6D, 0x32, 0x3, 0x63, 0x6D, 0x32, 0x2, 0x6D, 0x32, 0x3, 0x6B,
+		0x6D, 0x32, 0x3, 0x6D, 0x6D, 0x33, 0x3, 0x63, 0x6D, 0x33, 0x2, 0x6D, 0x33, 0x3, 0x6B, 0x6D,
+		0x33, 0x3, 0x6D, 0x2215, 0x73, 0x4, 0x6D, 0x2215, 0x73, 0x32, 0x2, 0x50, 0x61, 0x3, 0x6B, 0x50,
+		0x61, 0x3, 0x4D, 0x50, 0x61, 0x3, 0x47, 0x50, 0x61, 0x3, 0x72, 0x61, 0x64, 0x5, 0x72, 0x61,
+		0x64, 0x2215, 0x73, 0x6, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x32, 0x2, 0x70, 0x73, 0x2, 0x6E, 0x73,
+		0x2, 0x3BC, 0x73, 0x2, 0x6D, 0x73, 0x2, 0x70, 0x56, 0x2, 0x6E, 0x56, 0x2, 0x3BC, 0x56, 0x2,
+		0x6D, 0x56, 0x2, 0x6B, 0x56, 0x2, 0x4D, 0x56, 0x2, 0x70, 0x57, 0x2, 0x6E, 0x57, 0x2, 0x3BC,
+		0x57, 0x2, 0x6D, 0x57, 0x2, 0x6B, 0x57, 0x2, 0x4D, 0x57, 0x2, 0x6B, 0x3A9, 0x2, 0x4D, 0x3A9,
+		0x4, 0x61, 0x2E, 0x6D, 0x2E, 0x2, 0x42, 0x71, 0x2, 0x63, 0x63, 0x2, 0x63, 0x64, 0x4, 0x43,
+		0x2215, 0x6B, 0x67, 0x3, 0x43, 0x6F, 0x2E, 0x2, 0x64, 0x42, 0x2, 0x47, 0x79, 0x2, 0x68, 0x61,
+		0x2, 0x48, 0x50, 0x2, 0x69, 0x6E, 0x2, 0x4B, 0x4B, 0x2, 0x4B, 0x4D, 0x2, 0x6B, 0x74, 0x2,
+		0x6C, 0x6D, 0x2, 0x6C, 0x6E, 0x3, 0x6C, 0x6F, 0x67, 0x2, 0x6C, 0x78, 0x2, 0x6D, 0x62, 0x3,
+		0x6D, 0x69, 0x6C, 0x3, 0x6D, 0x6F, 0x6C, 0x2, 0x50, 0x48, 0x4, 0x70, 0x2E, 0x6D, 0x2E, 0x3,
+		0x50, 0x50, 0x4D, 0x2, 0x50, 0x52, 0x2, 0x73, 0x72, 0x2, 0x53, 0x76, 0x2, 0x57, 0x62, 0x3,
+		0x56, 0x2215, 0x6D, 0x3, 0x41, 0x2215, 0x6D, 0x2, 0x31, 0x65E5, 0x2, 0x32, 0x65E5, 0x2, 0x33, 0x65E5,
+		0x2, 0x34, 0x65E5, 0x2, 0x35, 0x65E5, 0x2, 0x36, 0x65E5, 0x2, 0x37, 0x65E5, 0x2, 0x38, 0x65E5, 0x2,
+		0x39, 0x65E5, 0x3, 0x31, 0x30, 0x65E5, 0x3, 0x31, 0x31, 0x65E5, 0x3, 0x31, 0x32, 0x65E5, 0x3, 0x31,
+		0x33, 0x65E5, 0x3, 0x31, 0x34, 0x65E5, 0x3, 0x31, 0x35, 0x65E5, 0x3, 0x31, 0x36, 0x65E5, 0x3, 0x31,
+		0x37, 0x65E5, 0x3, 0x31, 0x38, 0x65E5, 0x3, 0x31, 0x39, 0x65E5, 0x3, 0x32, 0x30, 0x65E5, 0x3, 0x32,
+		0x31, 0x65E5, 0x3, 0x32, 0x32, 0x65E5, 0x3, 0x32, 0x33, 0x65E5, 0x3, 0x32, 0x34, 0x65E5, 0x3, 0x32,
+		0x35, 0x65E5, 0x3, 0x32, 0x36, 0x65E5, 0x3, 0x32, 0x37, 0x65E5, 0x3, 0x32, 0x38, 0x65E5, 0x3, 0x32,
+		0x39, 0x65E5, 0x3, 0x33, 0x30, 0x65E5, 0x3, 0x33, 0x31, 0x65E5, 0x3, 0x67, 0x61, 0x6C, 0x1, 0x44A,
+		0x1, 0x44C, 0x1, 0xA76F, 0x1, 0x126, 0x1, 0x153, 0x1, 0xA727, 0x1, 0xAB37, 0x1, 0x26B, 0x1, 0xAB52,
+		0x1, 0x28D, 0x1, 0x8C48, 0x1, 0x66F4, 0x1, 0x8CC8, 0x1, 0x6ED1, 0x1, 0x4E32, 0x1, 0x53E5, 0x1, 0x5951,
+		0x1, 0x5587, 0x1, 0x5948, 0x1, 0x61F6, 0x1, 0x7669, 0x1, 0x7F85, 0x1, 0x863F, 0x1, 0x87BA, 0x1, 0x88F8,
+		0x1, 0x908F, 0x1, 0x6A02, 0x1, 0x6D1B, 0x1, 0x70D9, 0x1, 0x73DE, 0x1, 0x843D, 0x1, 0x916A, 0x1, 0x99F1,
+		0x1, 0x4E82, 0x1, 0x5375, 0x1, 0x6B04, 0x1, 0x721B, 0x1, 0x862D, 0x1, 0x9E1E, 0x1, 0x5D50, 0x1, 0x6FEB,
+		0x1, 0x85CD, 0x1, 0x8964, 0x1, 0x62C9, 0x1, 0x81D8, 0x1, 0x881F, 0x1, 0x5ECA, 0x1, 0x6717, 0x1, 0x6D6A,
+		0x1, 0x72FC, 0x1, 0x90CE, 0x1, 0x4F86, 0x1, 0x51B7, 0x1, 0x52DE, 0x1, 0x64C4, 0x1, 0x6AD3, 0x1, 0x7210,
+		0x1, 0x76E7, 0x1, 0x8606, 0x1, 0x865C, 0x1, 0x8DEF, 0x1, 0x9732, 0x1, 0x9B6F, 0x1, 0x9DFA, 0x1, 0x788C,
+		0x1, 0x797F, 0x1, 0x7DA0, 0x1, 0x83C9, 0x1, 0x9304, 0x1, 0x8AD6, 0x1, 0x58DF, 0x1, 0x5F04, 0x1, 0x7C60,
+		0x1, 0x807E, 0x1, 0x7262, 0x1, 0x78CA, 0x1, 0x8CC2, 0x1, 0x96F7, 0x1, 0x58D8, 0x1, 0x5C62, 0x1, 0x6A13,
+		0x1, 0x6DDA, 0x1, 0x6F0F, 0x1, 0x7D2F, 0x1, 0x7E37, 0x1, 0x964B, 0x1, 0x52D2, 0x1, 0x808B, 0x1, 0x51DC,
+		0x1, 0x51CC, 0x1, 0x7A1C, 0x1, 0x7DBE, 0x1, 0x83F1, 0x1, 0x9675, 0x1, 0x8B80, 0x1, 0x62CF, 0x1, 0x8AFE,
+		0x1, 0x4E39, 0x1, 0x5BE7, 0x1, 0x6012, 0x1, 0x7387, 0x1, 0x7570, 0x1, 0x5317, 0x1, 0x78FB, 0x1, 0x4FBF,
+		0x1, 0x5FA9, 0x1, 0x4E0D, 0x1, 0x6CCC, 0x1, 0x6578, 0x1, 0x7D22, 0x1, 0x53C3, 0x1, 0x585E, 0x1, 0x7701,
+		0x1, 0x8449, 0x1, 0x8AAA, 0x1, 0x6BBA, 0x1, 0x6C88, 0x1, 0x62FE, 0x1, 0x82E5, 0x1, 0x63A0, 0x1, 0x7565,
+		0x1, 0x4EAE, 0x1, 0x5169, 0x1, 0x51C9, 0x1, 0x6881, 0x1, 0x7CE7, 0x1, 0x826F, 0x1, 0x8AD2, 0x1, 0x91CF,
+		0x1, 0x52F5, 0x1, 0x5442, 0x1, 0x5EEC, 0x1, 0x65C5, 0x1, 0x6FFE, 0x1, 0x792A, 0x1, 0x95AD, 0x1, 0x9A6A,
+		0x1, 0x9E97, 0x1, 0x9ECE, 0x1, 0x66C6, 0x1, 0x6B77, 0x1, 0x8F62, 0x1, 0x5E74, 0x1, 0x6190, 0x1, 0x6200,
+		0x1, 0x649A, 0x1, 0x6F23, 0x1, 0x7149, 0x1, 0x7489, 0x1, 0x79CA, 0x1, 0x7DF4, 0x1, 0x806F, 0x1, 0x8F26,
+		0x1, 0x84EE, 0x1, 0x9023, 0x1, 0x934A, 0x1, 0x5217, 0x1, 0x52A3, 0x1, 0x54BD, 0x1, 0x70C8, 0x1, 0x88C2,
+		0x1, 0x5EC9, 0x1, 0x5FF5, 0x1, 0x637B, 0x1, 0x6BAE, 0x1, 0x7C3E, 0x1, 0x7375, 0x1, 0x4EE4, 0x1, 0x56F9,
+		0x1, 0x5DBA, 0x1, 0x601C, 0x1, 0x73B2, 0x1, 0x7469, 0x1, 0x7F9A, 0x1, 0x8046, 0x1, 0x9234, 0x1, 0x96F6,
+		0x1, 0x9748, 0x1, 0x9818, 0x1, 0x4F8B, 0x1, 0x79AE, 0x1, 0x91B4, 0x1, 0x96B8, 0x1, 0x60E1, 0x1, 0x4E86,
+		0x1, 0x50DA, 0x1, 0x5BEE, 0x1, 0x5C3F, 0x1, 0x6599, 0x1, 0x71CE, 0x1, 0x7642, 0x1, 0x84FC, 0x1, 0x907C,
+		0x1, 0x6688, 0x1, 0x962E, 0x1, 0x5289, 0x1, 0x677B, 0x1, 0x67F3, 0x1, 0x6D41, 0x1, 0x6E9C, 0x1, 0x7409,
+		0x1, 0x7559, 0x1, 0x786B, 0x1, 0x7D10, 0x1, 0x985E, 0x1, 0x622E, 0x1, 0x9678, 0x1, 0x502B, 0x1, 0x5D19,
+		0x1, 0x6DEA, 0x1, 0x8F2A, 0x1, 0x5F8B, 0x1, 0x6144, 0x1, 0x6817, 0x1, 0x9686, 0x1, 0x5229, 0x1, 0x540F,
+		0x1, 0x5C65, 0x1, 0x6613, 0x1, 0x674E, 0x1, 0x68A8, 0x1, 0x6CE5, 0x1, 0x7406, 0x1, 0x75E2, 0x1, 0x7F79,
+		0x1, 0x88CF, 0x1, 0x88E1, 0x1, 0x96E2, 0x1, 0x533F, 0x1, 0x6EBA, 0x1, 0x541D, 0x1, 0x71D0, 0x1, 0x7498,
+		0x1, 0x85FA, 0x1, 0x96A3, 0x1, 0x9C57, 0x1, 0x9E9F, 0x1, 0x6797, 0x1, 0x6DCB, 0x1, 0x81E8, 0x1, 0x7B20,
+		0x1, 0x7C92, 0x1, 0x72C0, 0x1, 0x7099, 0x1, 0x8B58, 0x1, 0x4EC0, 0x1, 0x8336, 0x1, 0x523A, 0x1, 0x5207,
+		0x1, 0x5EA6, 0x1, 0x62D3, 0x1, 0x7CD6, 0x1, 0x5B85, 0x1, 0x6D1E, 0x1, 0x66B4, 0x1, 0x8F3B, 0x1, 0x964D,
+		0x1, 0x5ED3, 0x1, 0x5140, 0x1, 0x55C0, 0x1, 0x585A, 0x1, 0x6674, 0x1, 0x51DE, 0x1, 0x732A, 0x1, 0x76CA,
+		0x1, 0x793C, 0x1, 0x795E, 0x1, 0x7965, 0x1, 0x798F, 0x1, 0x9756, 0x1, 0x7CBE, 0x1, 0x8612, 0x1, 0x8AF8,
+		0x1, 0x9038, 0x1, 0x90FD, 0x1, 0x98EF, 0x1, 0x98FC, 0x1, 0x9928, 0x1, 0x9DB4, 0x1, 0x90DE, 0x1, 0x96B7,
+		0x1, 0x4FAE, 0x1, 0x50E7, 0x1, 0x514D, 0x1, 0x52C9, 0x1, 0x52E4, 0x1, 0x5351, 0x1, 0x559D, 0x1, 0x5606,
+		0x1, 0x5668, 0x1, 0x5840, 0x1, 0x58A8, 0x1, 0x5C64, 0x1, 0x6094, 0x1, 0x6168, 0x1, 0x618E, 0x1, 0x61F2,
+		0x1, 0x654F, 0x1, 0x65E2, 0x1, 0x6691, 0x1, 0x6885, 0x1, 0x6D77, 0x1, 0x6E1A, 0x1, 0x6F22, 0x1, 0x716E,
+		0x1, 0x722B, 0x1, 0x7422, 0x1, 0x7891, 0x1, 0x7949, 0x1, 0x7948, 0x1, 0x7950, 0x1, 0x7956, 0x1, 0x798D,
+		0x1, 0x798E, 0x1, 0x7A40, 0x1, 0x7A81, 0x1, 0x7BC0, 0x1, 0x7E09, 0x1, 0x7E41, 0x1, 0x7F72, 0x1, 0x8005,
+		0x1, 0x81ED, 0x1, 0x8279, 0x1, 0x8457, 0x1, 0x8910, 0x1, 0x8996, 0x1, 0x8B01, 0x1, 0x8B39, 0x1, 0x8CD3,
+		0x1, 0x8D08, 0x1, 0x8FB6, 0x1, 0x96E3, 0x1, 0x97FF, 0x1, 0x983B, 0x1, 0x6075, 0x1, 0x242EE, 0x1, 0x8218,
+		0x1, 0x4E26, 0x1, 0x51B5, 0x1, 0x5168, 0x1, 0x4F80, 0x1, 0x5145, 0x1, 0x5180, 0x1, 0x52C7, 0x1, 0x52FA,
+		0x1, 0x5555, 0x1, 0x5599, 0x1, 0x55E2, 0x1, 0x58B3, 0x1, 0x5944, 0x1, 0x5954, 0x1, 0x5A62, 0x1, 0x5B28,
+		0x1, 0x5ED2, 0x1, 0x5ED9, 0x1, 0x5F69, 0x1, 0x5FAD, 0x1, 0x60D8, 0x1, 0x614E, 0x1, 0x6108, 0x1, 0x6160,
+		0x1, 0x6234, 0x1, 0x63C4, 0x1, 0x641C, 0x1, 0x6452, 0x1, 0x6556, 0x1, 0x671B, 0x1, 0x6756, 0x1, 0x6EDB,
+		0x1, 0x6ECB, 0x1, 0x701E, 0x1, 0x77A7, 0x1, 0x7235, 0x1, 0x72AF, 0x1, 0x7471, 0x1, 0x7506, 0x1, 0x753B,
+		0x1, 0x761D, 0x1, 0x761F, 0x1, 0x76DB, 0x1, 0x76F4, 0x1, 0x774A, 0x1, 0x7740, 0x1, 0x78CC, 0x1, 0x7AB1,
+		0x1, 0x7C7B, 0x1, 0x7D5B, 0x1, 0x7F3E, 0x1, 0x8352, 0x1, 0x83EF, 0x1, 0x8779, 0x1, 0x8941, 0x1, 0x8986,
+		0x1, 0x8ABF, 0x1, 0x8ACB, 0x1, 0x8AED, 0x1, 0x8B8A, 0x1, 0x8F38, 0x1, 0x9072, 0x1, 0x9199, 0x1, 0x9276,
+		0x1, 0x967C, 0x1, 0x97DB, 0x1, 0x980B, 0x1, 0x9B12, 0x1, 0x2284A, 0x1, 0x22844, 0x1, 0x233D5, 0x1, 0x3B9D,
+		0x1, 0x4018, 0x1, 0x4039, 0x1, 0x25249, 0x1, 0x25CD0, 0x1, 0x27ED3, 0x1, 0x9F43, 0x1, 0x9F8E, 0x2, 0x66,
+		0x66, 0x2, 0x66, 0x69, 0x2, 0x66, 0x6C, 0x3, 0x66, 0x66, 0x69, 0x3, 0x66, 0x66, 0x6C, 0x2,
+		0x73, 0x74, 0x2, 0x574, 0x576, 0x2, 0x574, 0x565, 0x2, 0x574, 0x56B, 0x2, 0x57E, 0x576, 0x2, 0x574,
+		0x56D, 0x2, 0x5D9, 0xE0005B4, 0x2, 0x5F2, 0x110005B7, 0x1, 0x5E2, 0x1, 0x5D4, 0x1, 0x5DB, 0x1, 0x5DC, 0x1,
+		0x5DD, 0x1, 0x5E8, 0x1, 0x5EA, 0x2, 0x5E9, 0x180005C1, 0x2, 0x5E9, 0x190005C2, 0x3, 0x5E9, 0x150005BC, 0x180005C1, 0x3,
+		0x5E9, 0x150005BC, 0x190005C2, 0x2, 0x5D0, 0x110005B7, 0x2, 0x5D0, 0x120005B8, 0x2, 0x5D0, 0x150005BC, 0x2, 0x5D1, 0x150005BC, 0x2,
+		0x5D2, 0x150005BC, 0x2, 0x5D3, 0x150005BC, 0x2, 0x5D4, 0x150005BC, 0x2, 0x5D5, 0x150005BC, 0x2, 0x5D6, 0x150005BC, 0x2, 0x5D8,
+		0x150005BC, 0x2, 0x5D9, 0x150005BC, 0x2, 0x5DA, 0x150005BC, 0x2, 0x5DB, 0x150005BC, 0x2, 0x5DC, 0x150005BC, 0x2, 0x5DE, 0x150005BC,
+		0x2, 0x5E0, 0x150005BC, 0x2, 0x5E1, 0x150005BC, 0x2, 0x5E3, 0x150005BC, 0x2, 0x5E4, 0x150005BC, 0x2, 0x5E6, 0x150005BC, 0x2,
+		0x5E7, 0x150005BC, 0x2, 0x5E8, 0x150005BC, 0x2, 0x5E9, 0x150005BC, 0x2, 0x5EA, 0x150005BC, 0x2, 0x5D5, 0x130005B9, 0x2, 0x5D1,
+		0x170005BF, 0x2, 0x5DB, 0x170005BF, 0x2, 0x5E4, 0x170005BF, 0x2, 0x5D0, 0x5DC, 0x1, 0x671, 0x1, 0x67B, 0x1, 0x67E,
+		0x1, 0x680, 0x1, 0x67A, 0x1, 0x67F, 0x1, 0x679, 0x1, 0x6A4, 0x1, 0x6A6, 0x1, 0x684, 0x1, 0x683,
+		0x1, 0x686, 0x1, 0x687, 0x1, 0x68D, 0x1, 0x68C, 0x1, 0x68E, 0x1, 0x688, 0x1, 0x698, 0x1, 0x691,
+		0x1, 0x6A9, 0x1, 0x6AF, 0x1, 0x6B3, 0x1, 0x6B1, 0x1, 0x6BA, 0x1, 0x6BB, 0x1, 0x6C1, 0x1, 0x6BE,
+		0x1, 0x6D2, 0x1, 0x6AD, 0x1, 0x6C7, 0x1, 0x6C6, 0x1, 0x6C8, 0x1, 0x6CB, 0x1, 0x6C5, 0x1, 0x6C9,
+		0x1, 0x6D0, 0x1, 0x649, 0x3, 0x64A, 0xE6000654, 0x627, 0x3, 0x64A, 0xE6000654, 0x6D5, 0x3, 0x64A, 0xE6000654, 0x648,
+		0x3, 0x64A, 0xE6000654, 0x6C7, 0x3, 0x64A, 0xE6000654, 0x6C6, 0x3, 0x64A, 0xE6000654, 0x6C8, 0x3, 0x64A, 0xE6000654, 0x6D0,
+		0x3, 0x64A, 0xE6000654, 0x649, 0x1, 0x6CC, 0x3, 0x64A, 0xE6000654, 0x62C, 0x3, 0x64A, 0xE6000654, 0x62D, 0x3, 0x64A,
+		0xE6000654, 0x645, 0x3, 0x64A, 0xE6000654, 0x64A, 0x2, 0x628, 0x62C, 0x2, 0x628, 0x62D, 0x2, 0x628, 0x62E, 0x2,
+		0x628, 0x645, 0x2, 0x628, 0x649, 0x2, 0x628, 0x64A, 0x2, 0x62A, 0x62C, 0x2, 0x62A, 0x62D, 0x2, 0x62A,
+		0x62E, 0x2, 0x62A, 0x645, 0x2, 0x62A, 0x649, 0x2, 0x62A, 0x64A, 0x2, 0x62B, 0x62C, 0x2, 0x62B, 0x645,
+		0x2, 0x62B, 0x649, 0x2, 0x62B, 0x64A, 0x2, 0x62C, 0x62D, 0x2, 0x62C, 0x645, 0x2, 0x62D, 0x62C, 0x2,
+		0x62D, 0x645, 0x2, 0x62E, 0x62C, 0x2, 0x62E, 0x62D, 0x2, 0x62E, 0x645, 0x2, 0x633, 0x62C, 0x2, 0x633,
+		0x62D, 0x2, 0x633, 0x62E, 0x2, 0x633, 0x645, 0x2, 0x635, 0x62D, 0x2, 0x635, 0x645, 0x2, 0x636, 0x62C,
+		0x2, 0x636, 0x62D, 0x2, 0x636, 0x62E, 0x2, 0x636, 0x645, 0x2, 0x637, 0x62D, 0x2, 0x637, 0x645, 0x2,
+		0x638, 0x645, 0x2, 0x639, 0x62C, 0x2, 0x639, 0x645, 0x2, 0x63A, 0x62C, 0x2, 0x63A, 0x645, 0x2, 0x641,
+		0x62C, 0x2, 0x641, 0x62D, 0x2, 0x641, 0x62E, 0x2, 0x641, 0x645, 0x2, 0x641, 0x649, 0x2, 0x641, 0x64A,
+		0x2, 0x642, 0x62D, 0x2, 0x642, 0x645, 0x2, 0x642, 0x649, 0x2, 0x642, 0x64A, 0x2, 0x643, 0x627, 0x2,
+		0x643, 0x62C, 0x2, 0x643, 0x62D, 0x2, 0x643, 0x62E, 0x2, 0x643, 0x644, 0x2, 0x643, 0x645, 0x2, 0x643,
+		0x649, 0x2, 0x643, 0x64A, 0x2, 0x644, 0x62C, 0x2, 0x644, 0x62D, 0x2, 0x644, 0x62E, 0x2, 0x644, 0x645,
+		0x2, 0x644, 0x649, 0x2, 0x644, 0x64A, 0x2, 0x645, 0x62C, 0x2, 0x645, 0x62D, 0x2, 0x645, 0x62E, 0x2,
+		0x645, 0x645, 0x2, 0x645, 0x649, 0x2, 0x645, 0x64A, 0x2, 0x646, 0x62C, 0x2, 0x646, 0x62D, 0x2, 0x646,
+		0x62E, 0x2, 0x646, 0x645, 0x2, 0x646, 0x649, 0x2, 0x646, 0x64A, 0x2, 0x647, 0x62C, 0x2, 0x647, 0x645,
+		0x2, 0x647, 0x649, 0x2, 0x647, 0x64A, 0x2, 0x64A, 0x62C, 0x2, 0x64A, 0x62D, 0x2, 0x64A, 0x62E, 0x2,
+		0x64A, 0x645, 0x2, 0x64A, 0x649, 0x2, 0x64A, 0x64A, 0x2, 0x630, 0x23000670, 0x2, 0x631, 0x23000670, 0x2, 0x649,
+		0x23000670, 0x3, 0x20, 0x1C00064C, 0x21000651, 0x3, 0x20, 0x1D00064D, 0x21000651, 0x3, 0x20, 0x1E00064E, 0x21000651, 0x3, 0x20, 0x1F00064F,
+		0x21000651, 0x3, 0x20, 0x20000650, 0x21000651, 0x3, 0x20, 0x21000651, 0x23000670, 0x3, 0x64A, 0xE6000654, 0x631, 0x3, 0x64A, 0xE6000654,
+		0x632, 0x3, 0x64A, 0xE6000654, 0x646, 0x2, 0x628, 0x631, 0x2, 0x628, 0x632, 0x2, 0x628, 0x646, 0x2, 0x62A,
+		0x631, 0x2, 0x62A, 0x632, 0x2, 0x62A, 0x646, 0x2, 0x62B, 0x631, 0x2, 0x62B, 0x632, 0x2, 0x62B, 0x646,
+		0x2, 0x645, 0x627, 0x2, 0x646, 0x631, 0x2, 0x646, 0x632, 0x2, 0x646, 0x646, 0x2, 0x64A, 0x631, 0x2,
+		0x64A, 0x632, 0x2, 0x64A, 0x646, 0x3, 0x64A, 0xE6000654, 0x62E, 0x3, 0x64A, 0xE6000654, 0x647, 0x2, 0x628, 0x647,
+		0x2, 0x62A, 0x647, 0x2, 0x635, 0x62E, 0x2, 0x644, 0x647, 0x2, 0x646, 0x647, 0x2, 0x647, 0x23000670, 0x2,
+		0x64A, 0x647, 0x2, 0x62B, 0x647, 0x2, 0x633, 0x647, 0x2, 0x634, 0x645, 0x2, 0x634, 0x647, 0x3, 0x640,
+		0x1E00064E, 0x21000651, 0x3, 0x640, 0x1F00064F, 0x21000651, 0x3, 0x640, 0x20000650, 0x21000651, 0x2, 0x637, 0x649, 0x2, 0x637, 0x64A,
+		0x2, 0x639, 0x649, 0x2, 0x639, 0x64A, 0x2, 0x63A, 0x649, 0x2, 0x63A, 0x64A, 0x2, 0x633, 0x649, 0x2,
+		0x633, 0x64A, 0x2, 0x634, 0x649, 0x2, 0x634, 0x64A, 0x2, 0x62D, 0x649, 0x2, 0x62D, 0x64A, 0x2, 0x62C,
+		0x649, 0x2, 0x62C, 0x64A, 0x2, 0x62E, 0x649, 0x2, 0x62E, 0x64A, 0x2, 0x635, 0x649, 0x2, 0x635, 0x64A,
+		0x2, 0x636, 0x649, 0x2, 0x636, 0x64A, 0x2, 0x634, 0x62C, 0x2, 0x634, 0x62D, 0x2, 0x634, 0x62E, 0x2,
+		0x634, 0x631, 0x2, 0x633, 0x631, 0x2, 0x635, 0x631, 0x2, 0x636, 0x631, 0x2, 0x627, 0x1B00064B, 0x3, 0x62A,
+		0x62C, 0x645, 0x3, 0x62A, 0x62D, 0x62C, 0x3, 0x62A, 0x62D, 0x645, 0x3, 0x62A, 0x62E, 0x645, 0x3, 0x62A,
+		0x645, 0x62C, 0x3, 0x62A, 0x645, 0x62D, 0x3, 0x62A, 0x645, 0x62E, 0x3, 0x62C, 0x645, 0x62D, 0x3, 0x62D,
+		0x645, 0x64A, 0x3, 0x62D, 0x645, 0x649, 0x3, 0x633, 0x62D, 0x62C, 0x3, 0x633, 0x62C, 0x62D, 0x3, 0x633,
+		0x62C, 0x649, 0x3, 0x633, 0x645, 0x62D, 0x3, 0x633, 0x645, 0x62C, 0x3, 0x633, 0x645, 0x645, 0x3, 0x635,
+		0x62D, 0x62D, 0x3, 0x635, 0x645, 0x645, 0x3, 0x634, 0x62D, 0x645, 0x3, 0x634, 0x62C, 0x64A, 0x3, 0x634,
+		0x645, 0x62E, 0x3, 0x634, 0x645, 0x645, 0x3, 0x636, 0x62D, 0x649, 0x3, 0x636, 0x62E, 0x645, 0x3, 0x637,
+		0x645, 0x62D, 0x3, 0x637, 0x645, 0x645, 0x3, 0x637, 0x645, 0x64A, 0x3, 0x639, 0x62C, 0x645, 0x3, 0x639,
+		0x645, 0x645, 0x3, 0x639, 0x645, 0x649, 0x3, 0x63A, 0x645, 0x645, 0x3, 0x63A, 0x645, 0x64A, 0x3, 0x63A,
+		0x645, 0x649, 0x3, 0x641, 0x62E, 0x645, 0x3, 0x642, 0x645, 0x62D, 0x3, 0x642, 0x645, 0x645, 0x3, 0x644,
+		0x62D, 0x645, 0x3, 0x644, 0x62D, 0x64A, 0x3, 0x644, 0x62D, 0x649, 0x3, 0x644, 0x62C, 0x62C, 0x3, 0x644,
+		0x62E, 0x645, 0x3, 0x644, 0x645, 0x62D, 0x3, 0x645, 0x62D, 0x62C, 0x3, 0x645, 0x62D, 0x645, 0x3, 0x645,
+		0x62D, 0x64A, 0x3, 0x645, 0x62C, 0x62D, 0x3, 0x645, 0x62C, 0x645, 0x3, 0x645, 0x62E, 0x62C, 0x3, 0x645,
+		0x62E, 0x645, 0x3, 0x645, 0x62C, 0x62E, 0x3, 0x647, 0x645, 0x62C, 0x3, 0x647, 0x645, 0x645, 0x3, 0x646,
+		0x62D, 0x645, 0x3, 0x646, 0x62D, 0x649, 0x3, 0x646, 0x62C, 0x645, 0x3, 0x646, 0x62C, 0x649, 0x3, 0x646,
+		0x645, 0x64A, 0x3, 0x646, 0x645, 0x649, 0x3, 0x64A, 0x645, 0x645, 0x3, 0x628, 0x62E, 0x64A, 0x3, 0x62A,
+		0x62C, 0x64A, 0x3, 0x62A, 0x62C, 0x649, 0x3, 0x62A, 0x62E, 0x64A, 0x3, 0x62A, 0x62E, 0x649, 0x3, 0x62A,
+		0x645, 0x64A, 0x3, 0x62A, 0x645, 0x649, 0x3, 0x62C, 0x645, 0x64A, 0x3, 0x62C, 0x62D, 0x649, 0x3, 0x62C,
+		0x645, 0x649, 0x3, 0x633, 0x62E, 0x649, 0x3, 0x635, 0x62D, 0x64A, 0x3, 0x634, 0x62D, 0x64A, 0x3, 0x636,
+		0x62D, 0x64A, 0x3, 0x644, 0x62C, 0x64A, 0x3, 0x644, 0x645, 0x64A, 0x3, 0x64A, 0x62D, 0x64A, 0x3, 0x64A,
+		0x62C, 0x64A, 0x3, 0x64A, 0x645, 0x64A, 0x3, 0x645, 0x645, 0x64A, 0x3, 0x642, 0x645, 0x64A, 0x3, 0x646,
+		0x62D, 0x64A, 0x3, 0x639, 0x645, 0x64A, 0x3, 0x643, 0x645, 0x64A, 0x3, 0x646, 0x62C, 0x62D, 0x3, 0x645,
+		0x62E, 0x64A, 0x3, 0x644, 0x62C, 0x645, 0x3, 0x643, 0x645, 0x645, 0x3, 0x62C, 0x62D, 0x64A, 0x3, 0x62D,
+		0x62C, 0x64A, 0x3, 0x645, 0x62C, 0x64A, 0x3, 0x641, 0x645, 0x64A, 0x3, 0x628, 0x62D, 0x64A, 0x3, 0x633,
+		0x62E, 0x64A, 0x3, 0x646, 0x62C, 0x64A, 0x3, 0x635, 0x644, 0x6D2, 0x3, 0x642, 0x644, 0x6D2, 0x4, 0x627,
+		0x644, 0x644, 0x647, 0x4, 0x627, 0x643, 0x628, 0x631, 0x4, 0x645, 0x62D, 0x645, 0x62F, 0x4, 0x635, 0x644,
+		0x639, 0x645, 0x4, 0x631, 0x633, 0x648, 0x644, 0x4, 0x639, 0x644, 0x64A, 0x647, 0x4, 0x648, 0x633, 0x644,
+		0x645, 0x3, 0x635, 0x644, 0x649, 0x12, 0x635, 0x644, 0x649, 0x20, 0x627, 0x644, 0x644, 0x647, 0x20, 0x639,
+		0x644, 0x64A, 0x647, 0x20, 0x648, 0x633, 0x644, 0x645, 0x8, 0x62C, 0x644, 0x20, 0x62C, 0x644, 0x627, 0x644,
+		0x647, 0x4, 0x631, 0x6CC, 0x627, 0x644, 0x1, 0x2C, 0x1, 0x3001, 0x1, 0x3002, 0x1, 0x3A, 0x1, 0x21,
+		0x1, 0x3F, 0x1, 0x3016, 0x1, 0x3017, 0x1, 0x2014, 0x1, 0x2013, 0x1, 0x5F, 0x1, 0x7B, 0x1, 0x7D,
+		0x1, 0x3014, 0x1, 0x3015, 0x1, 0x3010, 0x1, 0x3011, 0x1, 0x300A, 0x1, 0x300B, 0x1, 0x300C, 0x1, 0x300D,
+		0x1, 0x300E, 0x1, 0x300F, 0x1, 0x5B, 0x1, 0x5D, 0x1, 0x23, 0x1, 0x26, 0x1, 0x2A, 0x1, 0x2D,
+		0x1, 0x3C, 0x1, 0x3E, 0x1, 0x5C, 0x1, 0x24, 0x1, 0x25, 0x1, 0x40, 0x2, 0x20, 0x1B00064B, 0x2,
+		0x640, 0x1B00064B, 0x2, 0x20, 0x1C00064C, 0x2, 0x20, 0x1D00064D, 0x2, 0x20, 0x1E00064E, 0x2, 0x640, 0x1E00064E, 0x2, 0x20,
+		0x1F00064F, 0x2, 0x640, 0x1F00064F, 0x2, 0x20, 0x20000650, 0x2, 0x640, 0x20000650, 0x2, 0x20, 0x21000651, 0x2, 0x640, 0x21000651,
+		0x2, 0x20, 0x22000652, 0x2, 0x640, 0x22000652, 0x1, 0x621, 0x1, 0x627, 0x1, 0x628, 0x1, 0x629, 0x1, 0x62A,
+		0x1, 0x62B, 0x1, 0x62C, 0x1, 0x62D, 0x1, 0x62E, 0x1, 0x62F, 0x1, 0x630, 0x1, 0x631, 0x1, 0x632,
+		0x1, 0x633, 0x1, 0x634, 0x1, 0x635, 0x1, 0x636, 0x1, 0x637, 0x1, 0x638, 0x1, 0x639, 0x1, 0x63A,
+		0x1, 0x641, 0x1, 0x642, 0x1, 0x643, 0x1, 0x644, 0x1, 0x645, 0x1, 0x646, 0x1, 0x647, 0x1, 0x648,
+		0x1, 0x64A, 0x3, 0x644, 0x627, 0xE6000653, 0x3, 0x644, 0x627, 0xE6000654, 0x3, 0x644, 0x627, 0xDC000655, 0x2, 0x644,
+		0x627, 0x1, 0x22, 0x1, 0x27, 0x1, 0x2F, 0x1, 0x5E, 0x1, 0x7C, 0x1, 0x7E, 0x1, 0x2985, 0x1,
+		0x2986, 0x1, 0x30FB, 0x1, 0x30A1, 0x1, 0x30A3, 0x1, 0x30A5, 0x1, 0x30A7, 0x1, 0x30A9, 0x1, 0x30E3, 0x1,
+		0x30E5, 0x1, 0x30E7, 0x1, 0x30C3, 0x1, 0x30FC, 0x1, 0x30F3, 0x1, 0x8003099, 0x1, 0x800309A, 0x1, 0xA2, 0x1,
+		0xA3, 0x1, 0xAC, 0x1, 0xA6, 0x1, 0xA5, 0x1, 0x20A9, 0x1, 0x2502, 0x1, 0x2190, 0x1, 0x2191, 0x1,
+		0x2192, 0x1, 0x2193, 0x1, 0x25A0, 0x1, 0x25CB, 0x2, 0x105D2, 0xE6000307, 0x2, 0x105DA, 0xE6000307, 0x1, 0x2D0, 0x1,
+		0x2D1, 0x1, 0xE6, 0x1, 0x299, 0x1, 0x253, 0x1, 0x2A3, 0x1, 0xAB66, 0x1, 0x2A5, 0x1, 0x2A4, 0x1,
+		0x256, 0x1, 0x257, 0x1, 0x1D91, 0x1, 0x258, 0x1, 0x25E, 0x1, 0x2A9, 0x1, 0x264, 0x1, 0x262, 0x1,
+		0x260, 0x1, 0x29B, 0x1, 0x29C, 0x1, 0x267, 0x1, 0x284, 0x1, 0x2AA, 0x1, 0x2AB, 0x1, 0x26C, 0x1,
+		0x1DF04, 0x1, 0xA78E, 0x1, 0x26E, 0x1, 0x1DF05, 0x1, 0x28E, 0x1, 0x1DF06, 0x1, 0xF8, 0x1, 0x276, 0x1,
+		0x277, 0x1, 0x27A, 0x1, 0x1DF08, 0x1, 0x27D, 0x1, 0x27E, 0x1, 0x280, 0x1, 0x2A8, 0x1, 0x2A6, 0x1,
+		0xAB67, 0x1, 0x2A7, 0x1, 0x288, 0x1, 0x2C71, 0x1, 0x28F, 0x1, 0x2A1, 0x1, 0x2A2, 0x1, 0x298, 0x1,
+		0x1C0, 0x1, 0x1C1, 0x1, 0x1C2, 0x1, 0x1DF0A, 0x1, 0x1DF1E, 0x2, 0x11099, 0x70110BA, 0x2, 0x1109B, 0x70110BA, 0x2,
+		0x110A5, 0x70110BA, 0x2, 0x11131, 0x11127, 0x2, 0x11132, 0x11127, 0x2, 0x11347, 0x1133E, 0x2, 0x11347, 0x11357, 0x2, 0x11382,
+		0x113C9, 0x2, 0x11384, 0x113BB, 0x2, 0x1138B, 0x113C2, 0x2, 0x11390, 0x113C9, 0x2, 0x113C2, 0x113C2, 0x2, 0x113C2, 0x113B8,
+		0x2, 0x113C2, 0x113C9, 0x2, 0x114B9, 0x114BA, 0x2, 0x114B9, 0x114B0, 0x2, 0x114B9, 0x114BD, 0x2, 0x115B8, 0x115AF, 0x2,
+		0x115B9, 0x115AF, 0x2, 0x11935, 0x11930, 0x2, 0x1611E, 0x1611E, 0x2, 0x1611E, 0x16129, 0x2, 0x1611E, 0x1611F, 0x2, 0x16129,
+		0x1611F, 0x2, 0x1611E, 0x16120, 0x3, 0x1611E, 0x1611E, 0x1611F, 0x3, 0x1611E, 0x16129, 0x1611F, 0x3, 0x1611E, 0x1611E, 0x16120,
+		0x2, 0x16D67, 0x16D67, 0x2, 0x16D63, 0x16D67, 0x3, 0x16D63, 0x16D67, 0x16D67, 0x2, 0x1D157, 0xD801D165, 0x2, 0x1D158, 0xD801D165,
+		0x3, 0x1D158, 0xD801D165, 0xD801D16E, 0x3, 0x1D158, 0xD801D165, 0xD801D16F, 0x3, 0x1D158, 0xD801D165, 0xD801D170, 0x3, 0x1D158, 0xD801D165, 0xD801D171,
+		0x3, 0x1D158, 0xD801D165, 0xD801D172, 0x2, 0x1D1B9, 0xD801D165, 0x2, 0x1D1BA, 0xD801D165, 0x3, 0x1D1B9, 0xD801D165, 0xD801D16E, 0x3, 0x1D1BA,
+		0xD801D165, 0xD801D16E, 0x3, 0x1D1B9, 0xD801D165, 0xD801D16F, 0x3, 0x1D1BA, 0xD801D165, 0xD801D16F, 0x1, 0x131, 0x1, 0x237, 0x1, 0x391,
+		0x1, 0x392, 0x1, 0x394, 0x1, 0x395, 0x1, 0x396, 0x1, 0x397, 0x1, 0x399, 0x1, 0x39A, 0x1, 0x39B,
+		0x1, 0x39C, 0x1, 0x39D, 0x1, 0x39E, 0x1, 0x39F, 0x1, 0x3A1, 0x1, 0x3A4, 0x1, 0x3A6, 0x1, 0x3A7,
+		0x1, 0x3A8, 0x1, 0x2207, 0x1, 0x3B1, 0x1, 0x3B6, 0x1, 0x3B7, 0x1, 0x3BB, 0x1, 0x3BD, 0x1, 0x3BE,
+		0x1, 0x3BF, 0x1, 0x3C3, 0x1, 0x3C4, 0x1, 0x3C5, 0x1, 0x3C8, 0x1, 0x3C9, 0x1, 0x2202, 0x1, 0x3DC,
+		0x1, 0x3DD, 0x1, 0x430, 0x1, 0x431, 0x1, 0x432, 0x1, 0x433, 0x1, 0x434, 0x1, 0x435, 0x1, 0x436,
+		0x1, 0x437, 0x1, 0x438, 0x1, 0x43A, 0x1, 0x43B, 0x1, 0x43C, 0x1, 0x43E, 0x1, 0x43F, 0x1, 0x440,
+		0x1, 0x441, 0x1, 0x442, 0x1, 0x443, 0x1, 0x444, 0x1, 0x445, 0x1, 0x446, 0x1, 0x447, 0x1, 0x448,
+		0x1, 0x44B, 0x1, 0x44D, 0x1, 0x44E, 0x1, 0xA689, 0x1, 0x4D9, 0x1, 0x456, 0x1, 0x458, 0x1, 0x4E9,
+		0x1, 0x4AF, 0x1, 0x4CF, 0x1, 0x491, 0x1, 0x455, 0x1, 0x45F, 0x1, 0x4AB, 0x1, 0xA651, 0x1, 0x4B1,
+		0x1, 0x66E, 0x1, 0x6A1, 0x1, 0x66F, 0x2, 0x30, 0x2E, 0x2, 0x30, 0x2C, 0x2, 0x31, 0x2C, 0x2,
+		0x32, 0x2C, 0x2, 0x33, 0x2C, 0x2, 0x34, 0x2C, 0x2, 0x35, 0x2C, 0x2, 0x36, 0x2C, 0x2, 0x37,
+		0x2C, 0x2, 0x38, 0x2C, 0x2, 0x39, 0x2C, 0x3, 0x28, 0x41, 0x29, 0x3, 0x28, 0x42, 0x29, 0x3,
+		0x28, 0x43, 0x29, 0x3, 0x28, 0x44, 0x29, 0x3, 0x28, 0x45, 0x29, 0x3, 0x28, 0x46, 0x29, 0x3,
+		0x28, 0x47, 0x29, 0x3, 0x28, 0x48, 0x29, 0x3, 0x28, 0x49, 0x29, 0x3, 0x28, 0x4A, 0x29, 0x3,
+		0x28, 0x4B, 0x29, 0x3, 0x28, 0x4C, 0x29, 0x3, 0x28, 0x4D, 0x29, 0x3, 0x28, 0x4E, 0x29, 0x3,
+		0x28, 0x4F, 0x29, 0x3, 0x28, 0x50, 0x29, 0x3, 0x28, 0x51, 0x29, 0x3, 0x28, 0x52, 0x29, 0x3,
+		0x28, 0x53, 0x29, 0x3, 0x28, 0x54, 0x29, 0x3, 0x28, 0x55, 0x29, 0x3, 0x28, 0x56, 0x29, 0x3,
+		0x28, 0x57, 0x29, 0x3, 0x28, 0x58, 0x29, 0x3, 0x28, 0x59, 0x29, 0x3, 0x28, 0x5A, 0x29, 0x3,
+		0x3014, 0x53, 0x3015, 0x2, 0x43, 0x44, 0x2, 0x57, 0x5A, 0x2, 0x48, 0x56, 0x2, 0x53, 0x44, 0x2,
+		0x53, 0x53, 0x3, 0x50, 0x50, 0x56, 0x2, 0x57, 0x43, 0x2, 0x4D, 0x43, 0x2, 0x4D, 0x44, 0x2,
+		0x4D, 0x52, 0x2, 0x44, 0x4A, 0x2, 0x307B, 0x304B, 0x2, 0x30B3, 0x30B3, 0x1, 0x5B57, 0x1, 0x53CC, 0x1,
+		0x591A, 0x1, 0x89E3, 0x1, 0x4EA4, 0x1, 0x6620, 0x1, 0x7121, 0x1, 0x524D, 0x1, 0x5F8C, 0x1, 0x518D, 0x1,
+		0x65B0, 0x1, 0x521D, 0x1, 0x7D42, 0x1, 0x8CA9, 0x1, 0x58F0, 0x1, 0x5439, 0x1, 0x6F14, 0x1, 0x6295, 0x1,
+		0x6355, 0x1, 0x904A, 0x1, 0x6307, 0x1, 0x6253, 0x1, 0x7981, 0x1, 0x7A7A, 0x1, 0x5408, 0x1, 0x6E80, 0x1,
+		0x7533, 0x1, 0x5272, 0x1, 0x55B6, 0x1, 0x914D, 0x3, 0x3014, 0x672C, 0x3015, 0x3, 0x3014, 0x4E09, 0x3015, 0x3,
+		0x3014, 0x4E8C, 0x3015, 0x3, 0x3014, 0x5B89, 0x3015, 0x3, 0x3014, 0x70B9, 0x3015, 0x3, 0x3014, 0x6253, 0x3015, 0x3,
+		0x3014, 0x76D7, 0x3015, 0x3, 0x3014, 0x52DD, 0x3015, 0x3, 0x3014, 0x6557, 0x3015, 0x1, 0x5F97, 0x1, 0x53EF, 0x1,
+		0x4E3D, 0x1, 0x4E38, 0x1, 0x4E41, 0x1, 0x20122, 0x1, 0x4F60, 0x1, 0x4FBB, 0x1, 0x5002, 0x1, 0x507A, 0x1,
+		0x5099, 0x1, 0x50CF, 0x1, 0x349E, 0x1, 0x2063A, 0x1, 0x5154, 0x1, 0x5164, 0x1, 0x5177, 0x1, 0x2051C, 0x1,
+		0x34B9, 0x1, 0x5167, 0x1, 0x2054B, 0x1, 0x5197, 0x1, 0x51A4, 0x1, 0x4ECC, 0x1, 0x51AC, 0x1, 0x291DF, 0x1,
+		0x5203, 0x1, 0x34DF, 0x1, 0x523B, 0x1, 0x5246, 0x1, 0x5277, 0x1, 0x3515, 0x1, 0x5305, 0x1, 0x5306, 0x1,
+		0x5349, 0x1, 0x535A, 0x1, 0x5373, 0x1, 0x537D, 0x1, 0x537F, 0x1, 0x20A2C, 0x1, 0x7070, 0x1, 0x53CA, 0x1,
+		0x53DF, 0x1, 0x20B63, 0x1, 0x53EB, 0x1, 0x53F1, 0x1, 0x5406, 0x1, 0x549E, 0x1, 0x5438, 0x1, 0x5448, 0x1,
+		0x5468, 0x1, 0x54A2, 0x1, 0x54F6, 0x1, 0x5510, 0x1, 0x5553, 0x1, 0x5563, 0x1, 0x5584, 0x1, 0x55AB, 0x1,
+		0x55B3, 0x1, 0x55C2, 0x1, 0x5716, 0x1, 0x5717, 0x1, 0x5651, 0x1, 0x5674, 0x1, 0x58EE, 0x1, 0x57CE, 0x1,
+		0x57F4, 0x1, 0x580D, 0x1, 0x578B, 0x1, 0x5832, 0x1, 0x5831, 0x1, 0x58AC, 0x1, 0x214E4, 0x1, 0x58F2, 0x1,
+		0x58F7, 0x1, 0x5906, 0x1, 0x5922, 0x1, 0x5962, 0x1, 0x216A8, 0x1, 0x216EA, 0x1, 0x59EC, 0x1, 0x5A1B, 0x1,
+		0x5A27, 0x1, 0x59D8, 0x1, 0x5A66, 0x1, 0x36EE, 0x1, 0x36FC, 0x1, 0x5B08, 0x1, 0x5B3E, 0x1, 0x219C8, 0x1,
+		0x5BC3, 0x1, 0x5BD8, 0x1, 0x5BF3, 0x1, 0x21B18, 0x1, 0x5BFF, 0x1, 0x5C06, 0x1, 0x5F53, 0x1, 0x3781, 0x1,
+		0x5C60, 0x1, 0x5CC0, 0x1, 0x5C8D, 0x1, 0x21DE4, 0x1, 0x5D43, 0x1, 0x21DE6, 0x1, 0x5D6E, 0x1, 0x5D6B, 0x1,
+		0x5D7C, 0x1, 0x5DE1, 0x1, 0x5DE2, 0x1, 0x382F, 0x1, 0x5DFD, 0x1, 0x5E28, 0x1, 0x5E3D, 0x1, 0x5E69, 0x1,
+		0x3862, 0x1, 0x22183, 0x1, 0x387C, 0x1, 0x5EB0, 0x1, 0x5EB3, 0x1, 0x5EB6, 0x1, 0x2A392, 0x1, 0x22331, 0x1,
+		0x8201, 0x1, 0x5F22, 0x1, 0x38C7, 0x1, 0x232B8, 0x1, 0x261DA, 0x1, 0x5F62, 0x1, 0x5F6B, 0x1, 0x38E3, 0x1,
+		0x5F9A, 0x1, 0x5FCD, 0x1, 0x5FD7, 0x1, 0x5FF9, 0x1, 0x6081, 0x1, 0x393A, 0x1, 0x391C, 0x1, 0x226D4, 0x1,
+		0x60C7, 0x1, 0x6148, 0x1, 0x614C, 0x1, 0x617A, 0x1, 0x61B2, 0x1, 0x61A4, 0x1, 0x61AF, 0x1, 0x61DE, 0x1,
+		0x6210, 0x1, 0x621B, 0x1, 0x625D, 0x1, 0x62B1, 0x1, 0x62D4, 0x1, 0x6350, 0x1, 0x22B0C, 0x1, 0x633D, 0x1,
+		0x62FC, 0x1, 0x6368, 0x1, 0x6383, 0x1, 0x63E4, 0x1, 0x22BF1, 0x1, 0x6422, 0x1, 0x63C5, 0x1, 0x63A9, 0x1,
+		0x3A2E, 0x1, 0x6469, 0x1, 0x647E, 0x1, 0x649D, 0x1, 0x6477, 0x1, 0x3A6C, 0x1, 0x656C, 0x1, 0x2300A, 0x1,
+		0x65E3, 0x1, 0x66F8, 0x1, 0x6649, 0x1, 0x3B19, 0x1, 0x3B08, 0x1, 0x3AE4, 0x1, 0x5192, 0x1, 0x5195, 0x1,
+		0x6700, 0x1, 0x669C, 0x1, 0x80AD, 0x1, 0x43D9, 0x1, 0x6721, 0x1, 0x675E, 0x1, 0x6753, 0x1, 0x233C3, 0x1,
+		0x3B49, 0x1, 0x67FA, 0x1, 0x6785, 0x1, 0x6852, 0x1, 0x2346D, 0x1, 0x688E, 0x1, 0x681F, 0x1, 0x6914, 0x1,
+		0x6942, 0x1, 0x69A3, 0x1, 0x69EA, 0x1, 0x6AA8, 0x1, 0x236A3, 0x1, 0x6ADB, 0x1, 0x3C18, 0x1, 0x6B21, 0x1,
+		0x238A7, 0x1, 0x6B54, 0x1, 0x3C4E, 0x1, 0x6B72, 0x1, 0x6B9F, 0x1, 0x6BBB, 0x1, 0x23A8D, 0x1, 0x21D0B, 0x1,
+		0x23AFA, 0x1, 0x6C4E, 0x1, 0x23CBC, 0x1, 0x6CBF, 0x1, 0x6CCD, 0x1, 0x6C67, 0x1, 0x6D16, 0x1, 0x6D3E, 0x1,
+		0x6D69, 0x1, 0x6D78, 0x1, 0x6D85, 0x1, 0x23D1E, 0x1, 0x6D34, 0x1, 0x6E2F, 0x1, 0x6E6E, 0x1, 0x3D33, 0x1,
+		0x6EC7, 0x1, 0x23ED1, 0x1, 0x6DF9, 0x1, 0x6F6E, 0x1, 0x23F5E, 0x1, 0x23F8E, 0x1, 0x6FC6, 0x1, 0x7039, 0x1,
+		0x701B, 0x1, 0x3D96, 0x1, 0x704A, 0x1, 0x707D, 0x1, 0x7077, 0x1, 0x70AD, 0x1, 0x20525, 0x1, 0x7145, 0x1,
+		0x24263, 0x1, 0x719C, 0x1, 0x243AB, 0x1, 0x7228, 0x1, 0x7250, 0x1, 0x24608, 0x1, 0x7280, 0x1, 0x7295, 0x1,
+		0x24735, 0x1, 0x24814, 0x1, 0x737A, 0x1, 0x738B, 0x1, 0x3EAC, 0x1, 0x73A5, 0x1, 0x3EB8, 0x1, 0x7447, 0x1,
+		0x745C, 0x1, 0x7485, 0x1, 0x74CA, 0x1, 0x3F1B, 0x1, 0x7524, 0x1, 0x24C36, 0x1, 0x753E, 0x1, 0x24C92, 0x1,
+		0x2219F, 0x1, 0x7610, 0x1, 0x24FA1, 0x1, 0x24FB8, 0x1, 0x25044, 0x1, 0x3FFC, 0x1, 0x4008, 0x1, 0x250F3, 0x1,
+		0x250F2, 0x1, 0x25119, 0x1, 0x25133, 0x1, 0x771E, 0x1, 0x771F, 0x1, 0x778B, 0x1, 0x4046, 0x1, 0x4096, 0x1,
+		0x2541D, 0x1, 0x784E, 0x1, 0x40E3, 0x1, 0x25626, 0x1, 0x2569A, 0x1, 0x256C5, 0x1, 0x79EB, 0x1, 0x412F, 0x1,
+		0x7A4A, 0x1, 0x7A4F, 0x1, 0x2597C, 0x1, 0x25AA7, 0x1, 0x7AEE, 0x1, 0x4202, 0x1, 0x25BAB, 0x1, 0x7BC6, 0x1,
+		0x7BC9, 0x1, 0x4227, 0x1, 0x25C80, 0x1, 0x7CD2, 0x1, 0x42A0, 0x1, 0x7CE8, 0x1, 0x7CE3, 0x1, 0x7D00, 0x1,
+		0x25F86, 0x1, 0x7D63, 0x1, 0x4301, 0x1, 0x7DC7, 0x1, 0x7E02, 0x1, 0x7E45, 0x1, 0x4334, 0x1, 0x26228, 0x1,
+		0x26247, 0x1, 0x4359, 0x1, 0x262D9, 0x1, 0x7F7A, 0x1, 0x2633E, 0x1, 0x7F95, 0x1, 0x7FFA, 0x1, 0x264DA, 0x1,
+		0x26523, 0x1, 0x8060, 0x1, 0x265A8, 0x1, 0x8070, 0x1, 0x2335F, 0x1, 0x43D5, 0x1, 0x80B2, 0x1, 0x8103, 0x1,
+		0x440B, 0x1, 0x813E, 0x1, 0x5AB5, 0x1, 0x267A7, 0x1, 0x267B5, 0x1, 0x23393, 0x1, 0x2339C, 0x1, 0x8204, 0x1,
+		0x8F9E, 0x1, 0x446B, 0x1, 0x8291, 0x1, 0x828B, 0x1, 0x829D, 0x1, 0x52B3, 0x1, 0x82B1, 0x1, 0x82B3, 0x1,
+		0x82BD, 0x1, 0x82E6, 0x1, 0x26B3C, 0x1, 0x831D, 0x1, 0x8363, 0x1, 0x83AD, 0x1, 0x8323, 0x1, 0x83BD, 0x1,
+		0x83E7, 0x1, 0x8353, 0x1, 0x83CA, 0x1, 0x83CC, 0x1, 0x83DC, 0x1, 0x26C36, 0x1, 0x26D6B, 0x1, 0x26CD5, 0x1,
+		0x452B, 0x1, 0x84F1, 0x1, 0x84F3, 0x1, 0x8516, 0x1, 0x273CA, 0x1, 0x8564, 0x1, 0x26F2C, 0x1, 0x455D, 0x1,
+		0x4561, 0x1, 0x26FB1, 0x1, 0x270D2, 0x1, 0x456B, 0x1, 0x8650, 0x1, 0x8667, 0x1, 0x8669, 0x1, 0x86A9, 0x1,
+		0x8688, 0x1, 0x870E, 0x1, 0x86E2, 0x1, 0x8728, 0x1, 0x876B, 0x1, 0x8786, 0x1, 0x45D7, 0x1, 0x87E1, 0x1,
+		0x8801, 0x1, 0x45F9, 0x1, 0x8860, 0x1, 0x27667, 0x1, 0x88D7, 0x1, 0x88DE, 0x1, 0x4635, 0x1, 0x88FA, 0x1,
+		0x34BB, 0x1, 0x278AE, 0x1, 0x27966, 0x1, 0x46BE, 0x1, 0x46C7, 0x1, 0x8AA0, 0x1, 0x27CA8, 0x1, 0x8CAB, 0x1,
+		0x8CC1, 0x1, 0x8D1B, 0x1, 0x8D77, 0x1, 0x27F2F, 0x1, 0x20804, 0x1, 0x8DCB, 0x1, 0x8DBC, 0x1, 0x8DF0, 0x1,
+		0x208DE, 0x1, 0x8ED4, 0x1, 0x285D2, 0x1, 0x285ED, 0x1, 0x9094, 0x1, 0x90F1, 0x1, 0x9111, 0x1, 0x2872E, 0x1,
+		0x911B, 0x1, 0x9238, 0x1, 0x92D7, 0x1, 0x92D8, 0x1, 0x927C, 0x1, 0x93F9, 0x1, 0x9415, 0x1, 0x28BFA, 0x1,
+		0x958B, 0x1, 0x4995, 0x1, 0x95B7, 0x1, 0x28D77, 0x1, 0x49E6, 0x1, 0x96C3, 0x1, 0x5DB2, 0x1, 0x9723, 0x1,
+		0x29145, 0x1, 0x2921A, 0x1, 0x4A6E, 0x1, 0x4A76, 0x1, 0x97E0, 0x1, 0x2940A, 0x1, 0x4AB2, 0x1, 0x29496, 0x1,
+		0x9829, 0x1, 0x295B6, 0x1, 0x98E2, 0x1, 0x4B33, 0x1, 0x9929, 0x1, 0x99A7, 0x1, 0x99C2, 0x1, 0x99FE, 0x1,
+		0x4BCE, 0x1, 0x29B30, 0x1, 0x9C40, 0x1, 0x9CFD, 0x1, 0x4CCE, 0x1, 0x4CED, 0x1, 0x9D67, 0x1, 0x2A0CE, 0x1,
+		0x4CF8, 0x1, 0x2A105, 0x1, 0x2A20E, 0x1, 0x2A291, 0x1, 0x4D56, 0x1, 0x9EFE, 0x1, 0x9F05, 0x1, 0x9F0F, 0x1,
+		0x9F16, 0x1, 0x2A600
+	};
+
+	return decompositions + offset;
+}
+
+// returns the characters a starter combines with. The first entry is the number of pairs and each pair is the
+// character that follows and the character the two combine into
+inline const std::uint32_t *GetUTF8Compositions(size_t offset)
+{
+	static const std::uint32_t compositions[2314] =
+	{
+		0x0, 0x1, 0x338, 0x226E, 0x1, 0x338, 0x2260, 0x1, 0x338, 0x226F, 0x10, 0x300, 0xC0, 0x301, 0xC1, 0x302,
+		0xC2, 0x303, 0xC3, 0x304, 0x100, 0x306, 0x102, 0x307, 0x226, 0x308, 0xC4, 0x309, 0x1EA2, 0x30A, 0xC5, 0x30C,
+		0x1CD, 0x30F, 0x200, 0x311, 0x202, 0x323, 0x1EA0, 0x325, 0x1E00, 0x328, 0x104, 0x3, 0x307, 0x1E02, 0x323, 0x1E04,
+		0x331, 0x1E06, 0x5, 0x301, 0x106, 0x302, 0x108, 0x307, 0x10A, 0x30C, 0x10C, 0x327, 0xC7, 0x6, 0x307, 0x1E0A,
+		0x30C, 0x10E, 0x323, 0x1E0C, 0x327, 0x1E10, 0x32D, 0x1E12, 0x331, 0x1E0E, 0x11, 0x300, 0xC8, 0x301, 0xC9, 0x302,
+		0xCA, 0x303, 0x1EBC, 0x304, 0x112, 0x306, 0x114, 0x307, 0x116, 0x308, 0xCB, 0x309, 0x1EBA, 0x30C, 0x11A, 0x30F,
+		0x204, 0x311, 0x206, 0x323, 0x1EB8, 0x327, 0x228, 0x328, 0x118, 0x32D, 0x1E18, 0x330, 0x1E1A, 0x1, 0x307, 0x1E1E,
+		0x7, 0x301, 0x1F4, 0x302, 0x11C, 0x304, 0x1E20, 0x306, 0x11E, 0x307, 0x120, 0x30C, 0x1E6, 0x327, 0x122, 0x7,
+		0x302, 0x124, 0x307, 0x1E22, 0x308, 0x1E26, 0x30C, 0x21E, 0x323, 0x1E24, 0x327, 0x1E28, 0x32E, 0x1E2A, 0xF, 0x300,
+		0xCC, 0x301, 0xCD, 0x302, 0xCE, 0x303, 0x128, 0x304, 0x12A, 0x306, 0x12C, 0x307, 0x130, 0x308, 0xCF, 0x309,
+		0x1EC8, 0x30C, 0x1CF, 0x30F, 0x208, 0x311, 0x20A, 0x323, 0x1ECA, 0x328, 0x12E, 0x330, 0x1E2C, 0x1, 0x302, 0x134,
+		0x5, 0x301, 0x1E30, 0x30C, 0x1E8, 0x323, 0x1E32, 0x327, 0x136, 0x331, 0x1E34, 0x6, 0x301, 0x139, 0x30C, 0x13D,
+		0x323, 0x1E36, 0x327, 0x13B, 0x32D, 0x1E3C, 0x331, 0x1E3A, 0x3, 0x301, 0x1E3E, 0x307, 0x1E40, 0x323, 0x1E42, 0x9,
+		0x300, 0x1F8, 0x301, 0x143, 0x303, 0xD1, 0x307, 0x1E44, 0x30C, 0x147, 0x323, 0x1E46, 0x327, 0x145, 0x32D, 0x1E4A,
+		0x331, 0x1E48, 0x10, 0x300, 0xD2, 0x301, 0xD3, 0x302, 0xD4, 0x303, 0xD5, 0x304, 0x14C, 0x306, 0x14E, 0x307,
+		0x22E, 0x308, 0xD6, 0x309, 0x1ECE, 0x30B, 0x150, 0x30C, 0x1D1, 0x30F, 0x20C, 0x311, 0x20E, 0x31B, 0x1A0, 0x323,
+		0x1ECC, 0x328, 0x1EA, 0x2, 0x301, 0x1E54, 0x307, 0x1E56, 0x8, 0x301, 0x154, 0x307, 0x1E58, 0x30C, 0x158, 0x30F,
+		0x210, 0x311, 0x212, 0x323, 0x1E5A, 0x327, 0x156, 0x331, 0x1E5E, 0x7, 0x301, 0x15A, 0x302, 0x15C, 0x307, 0x1E60,
+		0x30C, 0x160, 0x323, 0x1E62, 0x326, 0x218, 0x327, 0x15E, 0x7, 0x307, 0x1E6A, 0x30C, 0x164, 0x323, 0x1E6C, 0x326,
+		0x21A, 0x327, 0x162, 0x32D, 0x1E70, 0x331, 0x1E6E, 0x13, 0x300, 0xD9, 0x301, 0xDA, 0x302, 0xDB, 0x303, 0x168,
+		0x304, 0x16A, 0x306, 0x16C, 0x308, 0xDC, 0x309, 0x1EE6, 0x30A, 0x16E, 0x30B, 0x170, 0x30C, 0x1D3, 0x30F, 0x214,
+		0x311, 0x216, 0x31B, 0x1AF, 0x323, 0x1EE4, 0x324, 0x1E72, 0x328, 0x172, 0x32D, 0x1E76, 0x330, 0x1E74, 0x2, 0x303,
+		0x1E7C, 0x323, 0x1E7E, 0x6, 0x300, 0x1E80, 0x301, 0x1E82, 0x302, 0x174, 0x307, 0x1E86, 0x308, 0x1E84, 0x323, 0x1E88,
+		0x2, 0x307, 0x1E8A, 0x308, 0x1E8C, 0x9, 0x300, 0x1EF2, 0x301, 0xDD, 0x302, 0x176, 0x303, 0x1EF8, 0x304, 0x232,
+		0x307, 0x1E8E, 0x308, 0x178, 0x309, 0x1EF6, 0x323, 0x1EF4, 0x6, 0x301, 0x179, 0x302, 0x1E90, 0x307, 0x17B, 0x30C,
+		0x17D, 0x323, 0x1E92, 0x331, 0x1E94, 0x10, 0x300, 0xE0, 0x301, 0xE1, 0x302, 0xE2, 0x303, 0xE3, 0x304, 0x101,
+		0x306, 0x103, 0x307, 0x227, 0x308, 0xE4, 0x309, 0x1EA3, 0x30A, 0xE5, 0x30C, 0x1CE, 0x30F, 0x201, 0x311, 0x203,
+		0x323, 0x1EA1, 0x325, 0x1E01, 0x328, 0x105, 0x3, 0x307, 0x1E03, 0x323, 0x1E05, 0x331, 0x1E07, 0x5, 0x301, 0x107,
+		0x302, 0x109, 0x307, 0x10B, 0x30C, 0x10D, 0x327, 0xE7, 0x6, 0x307, 0x1E0B, 0x30C, 0x10F, 0x323, 0x1E0D, 0x327,
+		0x1E11, 0x32D, 0x1E13, 0x331, 0x1E0F, 0x11, 0x300, 0xE8, 0x301, 0xE9, 0x302, 0xEA, 0x303, 0x1EBD, 0x304, 0x113,
+		0x306, 0x115, 0x307, 0x117, 0x308, 0xEB, 0x309, 0x1EBB, 0x30C, 0x11B, 0x30F, 0x205, 0x311, 0x207, 0x323, 0x1EB9,
+		0x327, 0x229, 0x328, 0x119, 0x32D, 0x1E19, 0x330, 0x1E1B, 0x1, 0x307, 0x1E1F, 0x7, 0x301, 0x1F5, 0x302, 0x11D,
+		0x304, 0x1E21, 0x306, 0x11F, 0x307, 0x121, 0x30C, 0x1E7, 0x327, 0x123, 0x8, 0x302, 0x125, 0x307, 0x1E23, 0x308,
+		0x1E27, 0x30C, 0x21F, 0x323, 0x1E25, 0x327, 0x1E29, 0x32E, 0x1E2B, 0x331, 0x1E96, 0xE, 0x300, 0xEC, 0x301, 0xED,
+		0x302, 0xEE, 0x303, 0x129, 0x304, 0x12B, 0x306, 0x12D, 0x308, 0xEF, 0x309, 0x1EC9, 0x30C, 0x1D0, 0x30F, 0x209,
+		0x311, 0x20B, 0x323, 0x1ECB, 0x328, 0x12F, 0x330, 0x1E2D, 0x2, 0x302, 0x135, 0x30C, 0x1F0, 0x5, 0x301, 0x1E31,
+		0x30C, 0x1E9, 0x323, 0x1E33, 0x327, 0x137, 0x331, 0x1E35, 0x6, 0x301, 0x13A, 0x30C, 0x13E, 0x323, 0x1E37, 0x327,
+		0x13C, 0x32D, 0x1E3D, 0x331, 0x1E3B, 0x3, 0x301, 0x1E3F, 0x307, 0x1E41, 0x323, 0x1E43, 0x9, 0x300, 0x1F9, 0x301,
+		0x144, 0x303, 0xF1, 0x307, 0x1E45, 0x30C, 0x148, 0x323, 0x1E47, 0x327, 0x146, 0x32D, 0x1E4B, 0x331, 0x1E49, 0x10,
+		0x300, 0xF2, 0x301, 0xF3, 0x302, 0xF4, 0x303, 0xF5, 0x304, 0x14D, 0x306, 0x14F, 0x307, 0x22F, 0x308, 0xF6,
+		0x309, 0x1ECF, 0x30B, 0x151, 0x30C, 0x1D2, 0x30F, 0x20D, 0x311, 0x20F, 0x31B, 0x1A1, 0x323, 0x1ECD, 0x328, 0x1EB,
+		0x2, 0x301, 0x1E55, 0x307, 0x1E57, 0x8, 0x301, 0x155, 0x307, 0x1E59, 0x30C, 0x159, 0x30F, 0x211, 0x311, 0x213,
+		0x323, 0x1E5B, 0x327, 0x157, 0x331, 0x1E5F, 0x7, 0x301, 0x15B, 0x302, 0x15D, 0x307, 0x1E61, 0x30C, 0x161, 0x323,
+		0x1E63, 0x326, 0x219, 0x327, 0x15F, 0x8, 0x307, 0x1E6B, 0x308, 0x1E97, 0x30C, 0x165, 0x323, 0x1E6D, 0x326, 0x21B,
+		0x327, 0x163, 0x32D, 0x1E71, 0x331, 0x1E6F, 0x13, 0x300, 0xF9, 0x301, 0xFA, 0x302, 0xFB, 0x303, 0x169, 0x304,
+		0x16B, 0x306, 0x16D, 0x308, 0xFC, 0x309, 0x1EE7, 0x30A, 0x16F, 0x30B, 0x171, 0x30C, 0x1D4, 0x30F, 0x215, 0x311,
+		0x217, 0x31B, 0x1B0, 0x323, 0x1EE5, 0x324, 0x1E73, 0x328, 0x173, 0x32D, 0x1E77, 0x330, 0x1E75, 0x2, 0x303, 0x1E7D,
+		0x323, 0x1E7F, 0x7, 0x300, 0x1E81, 0x301, 0x1E83, 0x302, 0x175, 0x307, 0x1E87, 0x308, 0x1E85, 0x30A, 0x1E98, 0x323,
+		0x1E89, 0x2, 0x307, 0x1E8B, 0x308, 0x1E8D, 0xA, 0x300, 0x1EF3, 0x301, 0xFD, 0x302, 0x177, 0x303, 0x1EF9, 0x304,
+		0x233, 0x307, 0x1E8F, 0x308, 0xFF, 0x309, 0x1EF7, 0x30A, 0x1E99, 0x323, 0x1EF5, 0x6, 0x301, 0x17A, 0x302, 0x1E91,
+		0x307, 0x17C, 0x30C, 0x17E, 0x323, 0x1E93, 0x331, 0x1E95, 0x3, 0x300, 0x1FED, 0x301, 0x385, 0x342, 0x1FC1, 0x4,
+		0x300, 0x1EA6, 0x301, 0x1EA4, 0x303, 0x1EAA, 0x309, 0x1EA8, 0x1, 0x304, 0x1DE, 0x1, 0x301, 0x1FA, 0x2, 0x301,
+		0x1FC, 0x304, 0x1E2, 0x1, 0x301, 0x1E08, 0x4, 0x300, 0x1EC0, 0x301, 0x1EBE, 0x303, 0x1EC4, 0x309, 0x1EC2, 0x1,
+		0x301, 0x1E2E, 0x4, 0x300, 0x1ED2, 0x301, 0x1ED0, 0x303, 0x1ED6, 0x309, 0x1ED4, 0x3, 0x301, 0x1E4C, 0x304, 0x22C,
+		0x308, 0x1E4E, 0x1, 0x304, 0x22A, 0x1, 0x301, 0x1FE, 0x4, 0x300, 0x1DB, 0x301, 0x1D7, 0x304, 0x1D5, 0x30C,
+		0x1D9, 0x4, 0x300, 0x1EA7, 0x301, 0x1EA5, 0x303, 0x1EAB, 0x309, 0x1EA9, 0x1, 0x304, 0x1DF, 0x1, 0x301, 0x1FB,
+		0x2, 0x301, 0x1FD, 0x304, 0x1E3, 0x1, 0x301, 0x1E09, 0x4, 0x300, 0x1EC1, 0x301, 0x1EBF, 0x303, 0x1EC5, 0x309,
+		0x1EC3, 0x1, 0x301, 0x1E2F, 0x4, 0x300, 0x1ED3, 0x301, 0x1ED1, 0x303, 0x1ED7, 0x309, 0x1ED5, 0x3, 0x301, 0x1E4D,
+		0x304, 0x22D, 0x308, 0x1E4F, 0x1, 0x304, 0x22B, 0x1, 0x301, 0x1FF, 0x4, 0x300, 0x1DC, 0x301, 0x1D8, 0x304,
+		0x1D6, 0x30C, 0x1DA, 0x4, 0x300, 0x1EB0, 0x301, 0x1EAE, 0x303, 0x1EB4, 0x309, 0x1EB2, 0x4, 0x300, 0x1EB1, 0x301,
+		0x1EAF, 0x303, 0x1EB5, 0x309, 0x1EB3, 0x2, 0x300, 0x1E14, 0x301, 0x1E16, 0x2, 0x300, 0x1E15, 0x301, 0x1E17, 0x2,
+		0x300, 0x1E50, 0x301, 0x1E52, 0x2, 0x300, 0x1E51, 0x301, 0x1E53, 0x1, 0x307, 0x1E64, 0x1, 0x307, 0x1E65, 0x1,
+		0x307, 0x1E66, 0x1, 0x307, 0x1E67, 0x1, 0x301, 0x1E78, 0x1, 0x301, 0x1E79, 0x1, 0x308, 0x1E7A, 0x1, 0x308,
+		0x1E7B, 0x1, 0x307, 0x1E9B, 0x5, 0x300, 0x1EDC, 0x301, 0x1EDA, 0x303, 0x1EE0, 0x309, 0x1EDE, 0x323, 0x1EE2, 0x5,
+		0x300, 0x1EDD, 0x301, 0x1EDB, 0x303, 0x1EE1, 0x309, 0x1EDF, 0x323, 0x1EE3, 0x5, 0x300, 0x1EEA, 0x301, 0x1EE8, 0x303,
+		0x1EEE, 0x309, 0x1EEC, 0x323, 0x1EF0, 0x5, 0x300, 0x1EEB, 0x301, 0x1EE9, 0x303, 0x1EEF, 0x309, 0x1EED, 0x323, 0x1EF1,
+		0x1, 0x30C, 0x1EE, 0x1, 0x304, 0x1EC, 0x1, 0x304, 0x1ED, 0x1, 0x304, 0x1E0, 0x1, 0x304, 0x1E1, 0x1,
+		0x306, 0x1E1C, 0x1, 0x306, 0x1E1D, 0x1, 0x304, 0x230, 0x1, 0x304, 0x231, 0x1, 0x30C, 0x1EF, 0x7, 0x300,
+		0x1FBA, 0x301, 0x386, 0x304, 0x1FB9, 0x306, 0x1FB8, 0x313, 0x1F08, 0x314, 0x1F09, 0x345, 0x1FBC, 0x4, 0x300, 0x1FC8,
+		0x301, 0x388, 0x313, 0x1F18, 0x314, 0x1F19, 0x5, 0x300, 0x1FCA, 0x301, 0x389, 0x313, 0x1F28, 0x314, 0x1F29, 0x345,
+		0x1FCC, 0x7, 0x300, 0x1FDA, 0x301, 0x38A, 0x304, 0x1FD9, 0x306, 0x1FD8, 0x308, 0x3AA, 0x313, 0x1F38, 0x314, 0x1F39,
+		0x4, 0x300, 0x1FF8, 0x301, 0x38C, 0x313, 0x1F48, 0x314, 0x1F49, 0x1, 0x314, 0x1FEC, 0x6, 0x300, 0x1FEA, 0x301,
+		0x38E, 0x304, 0x1FE9, 0x306, 0x1FE8, 0x308, 0x3AB, 0x314, 0x1F59, 0x5, 0x300, 0x1FFA, 0x301, 0x38F, 0x313, 0x1F68,
+		0x314, 0x1F69, 0x345, 0x1FFC, 0x1, 0x345, 0x1FB4, 0x1, 0x345, 0x1FC4, 0x8, 0x300, 0x1F70, 0x301, 0x3AC, 0x304,
+		0x1FB1, 0x306, 0x1FB0, 0x313, 0x1F00, 0x314, 0x1F01, 0x342, 0x1FB6, 0x345, 0x1FB3, 0x4, 0x300, 0x1F72, 0x301, 0x3AD,
+		0x313, 0x1F10, 0x314, 0x1F11, 0x6, 0x300, 0x1F74, 0x301, 0x3AE, 0x313, 0x1F20, 0x314, 0x1F21, 0x342, 0x1FC6, 0x345,
+		0x1FC3, 0x8, 0x300, 0x1F76, 0x301, 0x3AF, 0x304, 0x1FD1, 0x306, 0x1FD0, 0x308, 0x3CA, 0x313, 0x1F30, 0x314, 0x1F31,
+		0x342, 0x1FD6, 0x4, 0x300, 0x1F78, 0x301, 0x3CC, 0x313, 0x1F40, 0x314, 0x1F41, 0x2, 0x313, 0x1FE4, 0x314, 0x1FE5,
+		0x8, 0x300, 0x1F7A, 0x301, 0x3CD, 0x304, 0x1FE1, 0x306, 0x1FE0, 0x308, 0x3CB, 0x313, 0x1F50, 0x314, 0x1F51, 0x342,
+		0x1FE6, 0x6, 0x300, 0x1F7C, 0x301, 0x3CE, 0x313, 0x1F60, 0x314, 0x1F61, 0x342, 0x1FF6, 0x345, 0x1FF3, 0x3, 0x300,
+		0x1FD2, 0x301, 0x390, 0x342, 0x1FD7, 0x3, 0x300, 0x1FE2, 0x301, 0x3B0, 0x342, 0x1FE7, 0x1, 0x345, 0x1FF4, 0x2,
+		0x301, 0x3D3, 0x308, 0x3D4, 0x1, 0x308, 0x407, 0x2, 0x306, 0x4D0, 0x308, 0x4D2, 0x1, 0x301, 0x403, 0x3,
+		0x300, 0x400, 0x306, 0x4D6, 0x308, 0x401, 0x2, 0x306, 0x4C1, 0x308, 0x4DC, 0x1, 0x308, 0x4DE, 0x4, 0x300,
+		0x40D, 0x304, 0x4E2, 0x306, 0x419, 0x308, 0x4E4, 0x1, 0x301, 0x40C, 0x1, 0x308, 0x4E6, 0x4, 0x304, 0x4EE,
+		0x306, 0x40E, 0x308, 0x4F0, 0x30B, 0x4F2, 0x1, 0x308, 0x4F4, 0x1, 0x308, 0x4F8, 0x1, 0x308, 0x4EC, 0x2,
+		0x306, 0x4D1, 0x308, 0x4D3, 0x1, 0x301, 0x453, 0x3, 0x300, 0x450, 0x306, 0x4D7, 0x308, 0x451, 0x2, 0x306,
+		0x4C2, 0x308, 0x4DD, 0x1, 0x308, 0x4DF, 0x4, 0x300, 0x45D, 0x304, 0x4E3, 0x306, 0x439, 0x308, 0x4E5, 0x1,
+		0x301, 0x45C, 0x1, 0x308, 0x4E7, 0x4, 0x304, 0x4EF, 0x306, 0x45E, 0x308, 0x4F1, 0x30B, 0x4F3, 0x1, 0x308,
+		0x4F5, 0x1, 0x308, 0x4F9, 0x1, 0x308, 0x4ED, 0x1, 0x308, 0x457, 0x1, 0x30F, 0x476, 0x1, 0x30F, 0x477,
+		0x1, 0x308, 0x4DA, 0x1, 0x308, 0x4DB, 0x1, 0x308, 0x4EA, 0x1, 0x308, 0x4EB, 0x3, 0x653, 0x622, 0x654,
+		0x623, 0x655, 0x625, 0x1, 0x654, 0x624, 0x1, 0x654, 0x626, 0x1, 0x654, 0x6C2, 0x1, 0x654, 0x6D3, 0x1,
+		0x654, 0x6C0, 0x1, 0x93C, 0x929, 0x1, 0x93C, 0x931, 0x1, 0x93C, 0x934, 0x2, 0x9BE, 0x9CB, 0x9D7, 0x9CC,
+		0x3, 0xB3E, 0xB4B, 0xB56, 0xB48, 0xB57, 0xB4C, 0x1, 0xBD7, 0xB94, 0x2, 0xBBE, 0xBCA, 0xBD7, 0xBCC, 0x1,
+		0xBBE, 0xBCB, 0x1, 0xC56, 0xC48, 0x1, 0xCD5, 0xCC0, 0x3, 0xCC2, 0xCCA, 0xCD5, 0xCC7, 0xCD6, 0xCC8, 0x1,
+		0xCD5, 0xCCB, 0x2, 0xD3E, 0xD4A, 0xD57, 0xD4C, 0x1, 0xD3E, 0xD4B, 0x3, 0xDCA, 0xDDA, 0xDCF, 0xDDC, 0xDDF,
+		0xDDE, 0x1, 0xDCA, 0xDDD, 0x1, 0x102E, 0x1026, 0x1, 0x1B35, 0x1B06, 0x1, 0x1B35, 0x1B08, 0x1, 0x1B35, 0x1B0A,
+		0x1, 0x1B35, 0x1B0C, 0x1, 0x1B35, 0x1B0E, 0x1, 0x1B35, 0x1B12, 0x1, 0x1B35, 0x1B3B, 0x1, 0x1B35, 0x1B3D, 0x1,
+		0x1B35, 0x1B40, 0x1, 0x1B35, 0x1B41, 0x1, 0x1B35, 0x1B43, 0x1, 0x304, 0x1E38, 0x1, 0x304, 0x1E39, 0x1, 0x304,
+		0x1E5C, 0x1, 0x304, 0x1E5D, 0x1, 0x307, 0x1E68, 0x1, 0x307, 0x1E69, 0x2, 0x302, 0x1EAC, 0x306, 0x1EB6, 0x2,
+		0x302, 0x1EAD, 0x306, 0x1EB7, 0x1, 0x302, 0x1EC6, 0x1, 0x302, 0x1EC7, 0x1, 0x302, 0x1ED8, 0x1, 0x302, 0x1ED9,
+		0x4, 0x300, 0x1F02, 0x301, 0x1F04, 0x342, 0x1F06, 0x345, 0x1F80, 0x4, 0x300, 0x1F03, 0x301, 0x1F05, 0x342, 0x1F07,
+		0x345, 0x1F81, 0x1, 0x345, 0x1F82, 0x1, 0x345, 0x1F83, 0x1, 0x345, 0x1F84, 0x1, 0x345, 0x1F85, 0x1, 0x345,
+		0x1F86, 0x1, 0x345, 0x1F87, 0x4, 0x300, 0x1F0A, 0x301, 0x1F0C, 0x342, 0x1F0E, 0x345, 0x1F88, 0x4, 0x300, 0x1F0B,
+		0x301, 0x1F0D, 0x342, 0x1F0F, 0x345, 0x1F89, 0x1, 0x345, 0x1F8A, 0x1, 0x345, 0x1F8B, 0x1, 0x345, 0x1F8C, 0x1,
+		0x345, 0x1F8D, 0x1, 0x345, 0x1F8E, 0x1, 0x345, 0x1F8F, 0x2, 0x300, 0x1F12, 0x301, 0x1F14, 0x2, 0x300, 0x1F13,
+		0x301, 0x1F15, 0x2, 0x300, 0x1F1A, 0x301, 0x1F1C, 0x2, 0x300, 0x1F1B, 0x301, 0x1F1D, 0x4, 0x300, 0x1F22, 0x301,
+		0x1F24, 0x342, 0x1F26, 0x345, 0x1F90, 0x4, 0x300, 0x1F23, 0x301, 0x1F25, 0x342, 0x1F27, 0x345, 0x1F91, 0x1, 0x345,
+		0x1F92, 0x1, 0x345, 0x1F93, 0x1, 0x345, 0x1F94, 0x1, 0x345, 0x1F95, 0x1, 0x345, 0x1F96, 0x1, 0x345, 0x1F97,
+		0x4, 0x300, 0x1F2A, 0x301, 0x1F2C, 0x342, 0x1F2E, 0x345, 0x1F98, 0x4, 0x300, 0x1F2B, 0x301, 0x1F2D, 0x342, 0x1F2F,
+		0x345, 0x1F99, 0x1, 0x345, 0x1F9A, 0x1, 0x345, 0x1F9B, 0x1, 0x345, 0x1F9C, 0x1, 0x345, 0x1F9D, 0x1, 0x345,
+		0x1F9E, 0x1, 0x345, 0x1F9F, 0x3, 0x300, 0x1F32, 0x301, 0x1F34, 0x342, 0x1F36, 0x3, 0x300, 0x1F33, 0x301, 0x1F35,
+		0x342, 0x1F37, 0x3, 0x300, 0x1F3A, 0x301, 0x1F3C, 0x342, 0x1F3E, 0x3, 0x300, 0x1F3B, 0x301, 0x1F3D, 0x342, 0x1F3F,
+		0x2, 0x300, 0x1F42, 0x301, 0x1F44, 0x2, 0x300, 0x1F43, 0x301, 0x1F45, 0x2, 0x300, 0x1F4A, 0x301, 0x1F4C, 0x2,
+		0x300, 0x1F4B, 0x301, 0x1F4D, 0x3, 0x300, 0x1F52, 0x301, 0x1F54, 0x342, 0x1F56, 0x3, 0x300, 0x1F53, 0x301, 0x1F55,
+		0x342, 0x1F57, 0x3, 0x300, 0x1F5B, 0x301, 0x1F5D, 0x342, 0x1F5F, 0x4, 0x300, 0x1F62, 0x301, 0x1F64, 0x342, 0x1F66,
+		0x345, 0x1FA0, 0x4, 0x300, 0x1F63, 0x301, 0x1F65, 0x342, 0x1F67, 0x345, 0x1FA1, 0x1, 0x345, 0x1FA2, 0x1, 0x345,
+		0x1FA3, 0x1, 0x345, 0x1FA4, 0x1, 0x345, 0x1FA5, 0x1, 0x345, 0x1FA6, 0x1, 0x345, 0x1FA7, 0x4, 0x300, 0x1F6A,
+		0x301, 0x1F6C, 0x342, 0x1F6E, 0x345, 0x1FA8, 0x4, 0x300, 0x1F6B, 0x301, 0x1F6D, 0x342, 0x1F6F, 0x345, 0x1FA9, 0x1,
+		0x345, 0x1FAA, 0x1, 0x345, 0x1FAB, 0x1, 0x345, 0x1FAC, 0x1, 0x345, 0x1FAD, 0x1, 0x345, 0x1FAE, 0x1, 0x345,
+		0x1FAF, 0x1, 0x345, 0x1FB2, 0x1, 0x345, 0x1FC2, 0x1, 0x345, 0x1FF2, 0x1, 0x345, 0x1FB7, 0x3, 0x300, 0x1FCD,
+		0x301, 0x1FCE, 0x342, 0x1FCF, 0x1, 0x345, 0x1FC7, 0x1, 0x345, 0x1FF7, 0x3, 0x300, 0x1FDD, 0x301, 0x1FDE, 0x342,
+		0x1FDF, 0x1, 0x338, 0x219A, 0x1, 0x338, 0x219B, 0x1, 0x338, 0x21AE, 0x1, 0x338, 0x21CD, 0x1, 0x338, 0x21CF,
+		0x1, 0x338, 0x21CE, 0x1, 0x338, 0x2204, 0x1, 0x338, 0x2209, 0x1, 0x338, 0x220C, 0x1, 0x338, 0x2224, 0x1,
+		0x338, 0x2226, 0x1, 0x338, 0x2241, 0x1, 0x338, 0x2244, 0x1, 0x338, 0x2247, 0x1, 0x338, 0x2249, 0x1, 0x338,
+		0x226D, 0x1, 0x338, 0x2262, 0x1, 0x338, 0x2270, 0x1, 0x338, 0x2271, 0x1, 0x338, 0x2274, 0x1, 0x338, 0x2275,
+		0x1, 0x338, 0x2278, 0x1, 0x338, 0x2279, 0x1, 0x338, 0x2280, 0x1, 0x338, 0x2281, 0x1, 0x338, 0x22E0, 0x1,
+		0x338, 0x22E1, 0x1, 0x338, 0x2284, 0x1, 0x338, 0x2285, 0x1, 0x338, 0x2288, 0x1, 0x338, 0x2289, 0x1, 0x338,
+		0x22E2, 0x1, 0x338, 0x22E3, 0x1, 0x338, 0x22AC, 0x1, 0x338, 0x22AD, 0x1, 0x338, 0x22AE, 0x1, 0x338, 0x22AF,
+		0x1, 0x338, 0x22EA, 0x1, 0x338, 0x22EB, 0x1, 0x338, 0x22EC, 0x1, 0x338, 0x22ED, 0x1, 0x3099, 0x3094, 0x1,
+		0x3099, 0x304C, 0x1, 0x3099, 0x304E, 0x1, 0x3099, 0x3050, 0x1, 0x3099, 0x3052, 0x1, 0x3099, 0x3054, 0x1, 0x3099,
+		0x3056, 0x1, 0x3099, 0x3058, 0x1, 0x3099, 0x305A, 0x1, 0x3099, 0x305C, 0x1, 0x3099, 0x305E, 0x1, 0x3099, 0x3060,
+		0x1, 0x3099, 0x3062, 0x1, 0x3099, 0x3065, 0x1, 0x3099, 0x3067, 0x1, 0x3099, 0x3069, 0x2, 0x3099, 0x3070, 0x309A,
+		0x3071, 0x2, 0x3099, 0x3073, 0x309A, 0x3074, 0x2, 0x3099, 0x3076, 0x309A, 0x3077, 0x2, 0x3099, 0x3079, 0x309A, 0x307A,
+		0x2, 0x3099, 0x307C, 0x309A, 0x307D, 0x1, 0x3099, 0x309E, 0x1, 0x3099, 0x30F4, 0x1, 0x3099, 0x30AC, 0x1, 0x3099,
+		0x30AE, 0x1, 0x3099, 0x30B0, 0x1, 0x3099, 0x30B2, 0x1, 0x3099, 0x30B4, 0x1, 0x3099, 0x30B6, 0x1, 0x3099, 0x30B8,
+		0x1, 0x3099, 0x30BA, 0x1, 0x3099, 0x30BC, 0x1, 0x3099, 0x30BE, 0x1, 0x3099, 0x30C0, 0x1, 0x3099, 0x30C2, 0x1,
+		0x3099, 0x30C5, 0x1, 0x3099, 0x30C7, 0x1, 0x3099, 0x30C9, 0x2, 0x3099, 0x30D0, 0x309A, 0x30D1, 0x2, 0x3099, 0x30D3,
+		0x309A, 0x30D4, 0x2, 0x3099, 0x30D6, 0x309A, 0x30D7, 0x2, 0x3099, 0x30D9, 0x309A, 0x30DA, 0x2, 0x3099, 0x30DC, 0x309A,
+		0x30DD, 0x1, 0x3099, 0x30F7, 0x1, 0x3099, 0x30F8, 0x1, 0x3099, 0x30F9, 0x1, 0x3099, 0x30FA, 0x1, 0x3099, 0x30FE,
+		0x1, 0x307, 0x105C9, 0x1, 0x307, 0x105E4, 0x1, 0x110BA, 0x1109A, 0x1, 0x110BA, 0x1109C, 0x1, 0x110BA, 0x110AB, 0x1,
+		0x11127, 0x1112E, 0x1, 0x11127, 0x1112F, 0x2, 0x1133E, 0x1134B, 0x11357, 0x1134C, 0x1, 0x113C9, 0x11383, 0x1, 0x113BB, 0x11385,
+		0x1, 0x113C2, 0x1138E, 0x1, 0x113C9, 0x11391, 0x3, 0x113B8, 0x113C7, 0x113C2, 0x113C5, 0x113C9, 0x113C8, 0x3, 0x114B0, 0x114BC,
+		0x114BA, 0x114BB, 0x114BD, 0x114BE, 0x1, 0x115AF, 0x115BA, 0x1, 0x115AF, 0x115BB, 0x1, 0x11930, 0x11938, 0x4, 0x1611E, 0x16121,
+		0x1611F, 0x16123, 0x16120, 0x16125, 0x16129, 0x16122, 0x2, 0x1611F, 0x16126, 0x16120, 0x16128, 0x1, 0x1611F, 0x16127, 0x1, 0x1611F,
+		0x16124, 0x1, 0x16D67, 0x16D69, 0x1, 0x16D67, 0x16D68, 0x1, 0x16D67, 0x16D6A
+	};
+
+	return compositions + offset;
+}
+
+}
+
+#endif
@@ -0,0 +1,459 @@
+// utf8parallel.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8PARALLELHEADER
+#define UTF8PARALLELHEADER
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <system_error>
+
+#include "utf8string.h"
+
+// number of bytes or code units a thread works on at a time
+// smaller pieces spread the work more evenly but each piece has a small cost
+#ifndef UTF8PARALLEL_PIECE_SIZE
+#define UTF8PARALLEL_PIECE_SIZE (1 << 20)
+#endif
+
+namespace sd_utf8
+{
+
+// a small pool of threads for the parallel functions below
+// the functions take an executor so they can also be run on the caller's own threads. An executor is any
+// object with a run(count, work) member that calls work(i) once for every i in [0, count), from any threads,
+// and returns when all of them have returned. It should rethrow an exception thrown by work
+// utf8thread_pool::shared() is used when no executor is given
+class utf8thread_pool
+{
+	private:
+		std::vector<std::thread> pool_threads;
+
+		std::mutex pool_lock;
+		std::condition_variable pool_wake;
+		std::condition_variable pool_done;
+		bool pool_stopping;
+
+		// only one job runs at a time
+		std::mutex pool_run_lock;
+
+		// the job. work(i) is called through job_call so the job doesn't have to be copied
+		void (*job_call)(void *, size_t);
+		void *job_context;
+		size_t job_count;
+		std::atomic<size_t> job_next;
+		size_t job_generation;
+		bool job_open;				// workers can still join the job
+		size_t job_active;			// workers that joined and haven't finished
+		std::exception_ptr job_error;
+
+		utf8thread_pool(const utf8thread_pool &);
+		utf8thread_pool &operator=(const utf8thread_pool &);
+
+		template <class Func>
+		static void calljob(void *context, size_t i)
+		{
+			(*(Func *)context)(i);
+		}
+
+		// takes the next i until there are none left
+		void work()
+		{
+			try
+			{
+				for(size_t i = job_next++; i < job_count; i = job_next++) job_call(job_context, i);
+			}
+			catch(...)
+			{
+				// stop handing out the rest
+				job_next = job_count;
+
+				std::lock_guard<std::mutex> guard(pool_lock);
+				if(!job_error) job_error = std::current_exception();
+			}
+		}
+
+		void workerloop()
+		{
+			size_t seen = 0;
+			std::unique_lock<std::mutex> lock(pool_lock);
+
+			for(;;)
+			{
+				pool_wake.wait(lock, [&] { return pool_stopping || (job_generation != seen); });
+				if(pool_stopping) return;
+
+				seen = job_generation;
+
+				// a worker that wakes up after run() has finished mustn't touch the job
+				if(!job_open) continue;
+
+				++job_active;
+				lock.unlock();
+
+				work();
+
+				lock.lock();
+				if(--job_active == 0) pool_done.notify_all();
+			}
+		}
+
+	public:
+		// threads is the number of threads that work on a job including the one that calls run()
+		// 0 uses std::thread::hardware_concurrency()
+		explicit utf8thread_pool(unsigned threads = 0)
+			:pool_stopping(false), job_call(NULL), job_context(NULL), job_count(0), job_next(0), job_generation(0),
+			 job_open(false), job_active(0)
+		{
+			if(threads == 0) threads = std::thread::hardware_concurrency();
+
+			// if the system won't give us more threads the pool makes do with the ones it has
+			try
+			{
+				for(unsigned t = 1; t < threads; ++t) pool_threads.push_back(std::thread(&utf8thread_pool::workerloop, this));
+			}
+			catch(const std::system_error &)
+			{
+			}
+		}
+
+		~utf8thread_pool()
+		{
+			{
+				std::lock_guard<std::mutex> guard(pool_lock);
+				pool_stopping = true;
+			}
+
+			pool_wake.notify_all();
+
+			for(std::thread &t : pool_threads) t.join();
+		}
+
+		// returns the number of threads that work on a job including the one that calls run()
+		size_t size() const
+		{
+			return pool_threads.size() + 1;
+		}
+
+		// calls work(i) for every i in [0, count) and returns when they're all done
+		// the calling thread works too. The first exception thrown by work is rethrown here
+		// don't call run() on the same pool from inside work
+		template <class Func>
+		void run(size_t count, Func work_func)
+		{
+			if((count <= 1) || pool_threads.empty())
+			{
+				for(size_t i = 0; i < count; ++i) work_func(i);
+				return;
+			}
+
+			std::lock_guard<std::mutex> run_guard(pool_run_lock);
+
+			{
+				std::lock_guard<std::mutex> guard(pool_lock);
+
+				job_call = &calljob<Func>;
+				job_context = &work_func;
+				job_count = count;
+				job_next = 0;
+				job_error = std::exception_ptr();
+				job_open = true;
+				++job_generation;
+			}
+
+			pool_wake.notify_all();
+
+			work();
+
+			std::exception_ptr error;
+			{
+				std::unique_lock<std::mutex> lock(pool_lock);
+
+				job_open = false;
+				pool_done.wait(lock, [this] { return job_active == 0; });
+
+				error = job_error;
+				job_error = std::exception_ptr();
+			}
+
+			if(error) std::rethrow_exception(error);
+		}
+
+		// a pool with a thread for each core that's made the first time it's used
+		static utf8thread_pool &shared()
+		{
+			static utf8thread_pool pool;
+
+			return pool;
+		}
+};
+
+// cuts [begin, end) into pieces that start on character boundaries
+// cuts gets the start of each piece followed by end
+inline void SplitUTF8Pieces(const _uchar8bit *begin, const _uchar8bit *end, std::vector<const _uchar8bit *> &cuts)
+{
+	cuts.clear();
+	cuts.reserve((size_t)(end - begin) / UTF8PARALLEL_PIECE_SIZE + 2);
+
+	while((size_t)(end - begin) > UTF8PARALLEL_PIECE_SIZE)
+	{
+		cuts.push_back(begin);
+		begin = NextUTF8Boundary(begin + UTF8PARALLEL_PIECE_SIZE, end);
+	}
+
+	cuts.push_back(begin);
+	cuts.push_back(end);
+}
+
+// cuts a UTF-16 or UTF-32 string into pieces that don't split a surrogate pair
+// cuts gets the start of each piece followed by end
+template <typename char_type>
+inline void SplitUnicodePieces(const char_type *begin, const char_type *end, bool default_order, std::vector<const char_type *> &cuts)
+{
+	cuts.clear();
+	cuts.reserve((size_t)(end - begin) / UTF8PARALLEL_PIECE_SIZE + 2);
+
+	while((size_t)(end - begin) > UTF8PARALLEL_PIECE_SIZE)
+	{
+		cuts.push_back(begin);
+		begin += UTF8PARALLEL_PIECE_SIZE;
+
+		// ReadUnicodeCharacter() joins a high surrogate with the low surrogate after it
+		_char32bit last = default_order ? (_char32bit)begin[-1] : SwapByteOrder(begin[-1]);
+		_char32bit next = default_order ? (_char32bit)begin[0] : SwapByteOrder(begin[0]);
+		if(IsHighSurrogate(last) && IsLowSurrogate(next)) ++begin;
+	}
+
+	cuts.push_back(begin);
+	cuts.push_back(end);
+}
+
+/// \brief Counts the characters in a UTF-8 range with several threads
+/// Gives the same result as CountUTF8Characters()
+template <class Executor>
+inline size_t CountUTF8CharactersParallel(const _uchar8bit *begin, const _uchar8bit *end, Executor &exec)
+{
+	std::vector<const _uchar8bit *> cuts;
+	SplitUTF8Pieces(begin, end, cuts);
+
+	std::vector<size_t> counts(cuts.size() - 1);
+	exec.run(counts.size(), [&](size_t i)
+	{
+		counts[i] = CountUTF8Characters(cuts[i], cuts[i + 1]);
+	});
+
+	size_t total = 0;
+	for(size_t count : counts) total += count;
+
+	return total;
+}
+
+inline size_t CountUTF8CharactersParallel(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	return CountUTF8CharactersParallel(begin, end, utf8thread_pool::shared());
+}
+
+/// \brief Finds the first byte that isn't part of valid UTF-8 with several threads
+/// Gives the same result as FindInvalidUTF8(). No sequence crosses a cut so each piece can be checked on its own
+/// and the first piece with a problem has the first problem. Pieces after it aren't checked
+template <class Executor>
+inline size_t FindInvalidUTF8Parallel(const _uchar8bit *begin, const _uchar8bit *end, Executor &exec)
+{
+	std::vector<const _uchar8bit *> cuts;
+	SplitUTF8Pieces(begin, end, cuts);
+
+	size_t pieces = cuts.size() - 1;
+	std::vector<size_t> found(pieces, (size_t)-1);
+	std::atomic<size_t> first_bad(pieces);
+
+	exec.run(pieces, [&](size_t i)
+	{
+		if(i > first_bad) return;
+
+		size_t piece_size = (size_t)(cuts[i + 1] - cuts[i]);
+		size_t invalid = FindInvalidUTF8(cuts[i], cuts[i + 1]);
+		if(invalid == piece_size) return;
+
+		found[i] = (size_t)(cuts[i] - begin) + invalid;
+
+		size_t cur = first_bad;
+		while((i < cur) && !first_bad.compare_exchange_weak(cur, i));
+	});
+
+	size_t bad = first_bad;
+
+	return (bad < pieces) ? found[bad] : (size_t)(end - begin);
+}
+
+inline size_t FindInvalidUTF8Parallel(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	return FindInvalidUTF8Parallel(begin, end, utf8thread_pool::shared());
+}
+
+template <class Executor>
+inline bool IsValidUTF8Parallel(const _uchar8bit *begin, const _uchar8bit *end, Executor &exec)
+{
+	return FindInvalidUTF8Parallel(begin, end, exec) == (size_t)(end - begin);
+}
+
+inline bool IsValidUTF8Parallel(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	return IsValidUTF8Parallel(begin, end, utf8thread_pool::shared());
+}
+
+// shared by EncodeUTF8Parallel() and MakeUTF8StringParallel()
+// works out where each piece's UTF-8 starts. offsets gets one more entry than there are pieces, the total size
+template <typename char_type, class Executor>
+inline void GetUTF8PieceOffsets(const std::vector<const char_type *> &cuts, bool default_order, std::vector<size_t> &offsets, Executor &exec)
+{
+	offsets.assign(cuts.size(), 0);
+
+	exec.run(cuts.size() - 1, [&](size_t i)
+	{
+		offsets[i + 1] = GetUTF8BufferSize(cuts[i], cuts[i + 1], default_order);
+	});
+
+	for(size_t i = 1; i < offsets.size(); ++i) offsets[i] += offsets[i - 1];
+}
+
+/// \brief Encodes a UTF-16 or UTF-32 string as UTF-8 with several threads
+/// Works out the size of each piece, adds them up to find where each piece goes and then encodes the pieces
+/// straight into out. out must point to a buffer of at least GetUTF8BufferSize() bytes. The output is the same
+/// as EncodeUTF8(). Returns a pointer to just after the last byte written.
+template <typename char_type, class Executor>
+inline _uchar8bit *EncodeUTF8Parallel(const char_type *begin, const char_type *end, _uchar8bit *out, bool default_order, Executor &exec)
+{
+	std::vector<const char_type *> cuts;
+	SplitUnicodePieces(begin, end, default_order, cuts);
+
+	std::vector<size_t> offsets;
+	GetUTF8PieceOffsets(cuts, default_order, offsets, exec);
+
+	exec.run(cuts.size() - 1, [&](size_t i)
+	{
+		EncodeUTF8(cuts[i], cuts[i + 1], out + offsets[i], default_order);
+	});
+
+	return out + offsets.back();
+}
+
+template <typename char_type>
+inline _uchar8bit *EncodeUTF8Parallel(const char_type *begin, const char_type *end, _uchar8bit *out, bool default_order = true)
+{
+	return EncodeUTF8Parallel(begin, end, out, default_order, utf8thread_pool::shared());
+}
+
+/// \brief Converts a UTF-16 or UTF-32 string to UTF-8 with several threads
+/// The parallel version of MakeUTF8StringImpl(). A byte order mark is read and skipped the same way
+/// out is only resized once. Resizing clears the new bytes on one thread so EncodeUTF8Parallel() into a buffer
+/// that's already there scales better
+template <typename char_type, typename Alloc, class Executor>
+inline void MakeUTF8StringParallel(const char_type* instring, size_t length, std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> &out, bool appendToOut, Executor &exec)
+{
+	if(!appendToOut) out.clear();
+
+	bool default_order;
+	const char_type *begin = instring + ReadByteOrderMark(instring, length, default_order);
+	const char_type *end = instring + length;
+
+	std::vector<const char_type *> cuts;
+	SplitUnicodePieces(begin, end, default_order, cuts);
+
+	std::vector<size_t> offsets;
+	GetUTF8PieceOffsets(cuts, default_order, offsets, exec);
+	if(offsets.back() == 0) return;
+
+	size_t start = out.length();
+	out.resize(start + offsets.back());
+
+	_uchar8bit *out_data = &out[start];
+	exec.run(cuts.size() - 1, [&](size_t i)
+	{
+		EncodeUTF8(cuts[i], cuts[i + 1], out_data + offsets[i], default_order);
+	});
+}
+
+template <typename char_type, typename Alloc>
+inline void MakeUTF8StringParallel(const char_type* instring, size_t length, std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> &out, bool appendToOut = false)
+{
+	MakeUTF8StringParallel(instring, length, out, appendToOut, utf8thread_pool::shared());
+}
+
+/// \brief Decodes a UTF-8 range into UTF-16 or UTF-32 with several threads
+/// The output is UTF-16 with surrogate pairs if char_type is 16 bits wide and UTF-32 otherwise, the same as
+/// DecodeUTF8(). out is replaced with the result. For valid UTF-8 the size of each piece is counted first and the
+/// pieces are decoded straight into out. A broken sequence can change how many units a piece takes so if any
+/// piece doesn't come out the size it was counted as, the range is decoded again on one thread
+template <typename char_type, typename Traits, typename Alloc, class Executor>
+inline void DecodeUTF8Parallel(const _uchar8bit *begin, const _uchar8bit *end, std::basic_string<char_type, Traits, Alloc> &out, Executor &exec)
+{
+	out.clear();
+	if(begin == end) return;
+
+	std::vector<const _uchar8bit *> cuts;
+	SplitUTF8Pieces(begin, end, cuts);
+
+	size_t pieces = cuts.size() - 1;
+	std::vector<size_t> offsets(pieces + 1, 0);
+
+	exec.run(pieces, [&](size_t i)
+	{
+		offsets[i + 1] = (sizeof(char_type) == 2) ? GetUTF16BufferSize(cuts[i], cuts[i + 1]) : CountUTF8Characters(cuts[i], cuts[i + 1]);
+	});
+
+	for(size_t i = 1; i <= pieces; ++i) offsets[i] += offsets[i - 1];
+
+	out.resize(offsets.back());
+
+	char_type *out_data = &out[0];
+	std::atomic<bool> mismatch(false);
+
+	exec.run(pieces, [&](size_t i)
+	{
+		const _uchar8bit *cur = cuts[i];
+		char_type *piece_out = out_data + offsets[i];
+		char_type *piece_end = out_data + offsets[i + 1];
+
+		if((DecodeUTF8Units(cur, cuts[i + 1], piece_out, piece_end) != piece_end) || (cur != cuts[i + 1])) mismatch = true;
+	});
+
+	if(mismatch)
+	{
+		// every byte gives at most one unit
+		out.resize((size_t)(end - begin));
+		out.resize(DecodeUTF8(begin, end, &out[0], out.size()));
+	}
+}
+
+template <typename char_type, typename Traits, typename Alloc>
+inline void DecodeUTF8Parallel(const _uchar8bit *begin, const _uchar8bit *end, std::basic_string<char_type, Traits, Alloc> &out)
+{
+	DecodeUTF8Parallel(begin, end, out, utf8thread_pool::shared());
+}
+
+}
+
+#endif
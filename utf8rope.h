@@ -0,0 +1,943 @@
+// utf8rope.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8ROPEHEADER
+#define UTF8ROPEHEADER
+
+#include "utf8string.h"
+
+// the most bytes a chunk of a rope will hold
+// small edits are made inside a chunk if it has room so bigger chunks mean fewer nodes but longer moves
+#ifndef UTF8ROPE_CHUNK_SIZE
+#define UTF8ROPE_CHUNK_SIZE 1024
+#endif
+
+namespace sd_utf8
+{
+
+// a UTF-8 string for large documents that are edited often
+// the text is kept in chunks in a balanced tree (a treap) ordered by position. Each node stores how many bytes
+// and characters are in its subtree so insert(), erase(), replace() and finding a character are O(log n) instead
+// of moving the whole buffer like _utf8string does
+// every chunk holds whole characters so the chunks can be read as ordinary UTF-8
+template <class Alloc = std::allocator<_uchar8bit>>
+class _utf8rope
+{
+	public:
+		typedef _char32bit			value_type;
+		typedef const _char32bit	*pointer;
+		typedef const _char32bit	*const_pointer;
+		typedef const _char32bit	&reference;
+		typedef const _char32bit	&const_reference;
+		typedef size_t				size_type;
+		typedef ptrdiff_t			difference_type;
+
+	private:
+		typedef std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> buffer_type;
+
+		struct ropenode
+		{
+			buffer_type chunk;
+			size_type chunk_chars;
+
+			// totals for this node and everything under it
+			size_type bytes;
+			size_type chars;
+
+			ropenode *left;
+			ropenode *right;
+			std::uint32_t priority;
+
+			ropenode(const _uchar8bit *str, size_type n, size_type n_chars, std::uint32_t p, const Alloc &alloc)
+				:chunk(str, n, alloc), chunk_chars(n_chars), bytes(n), chars(n_chars), left(NULL), right(NULL), priority(p)
+			{
+			}
+		};
+
+		typedef typename std::allocator_traits<Alloc>::template rebind_alloc<ropenode> node_allocator;
+		typedef std::allocator_traits<node_allocator> node_traits;
+
+		ropenode *rope_root;
+		Alloc rope_alloc;
+
+		// state of the random number generator used for the node priorities
+		std::uint32_t rope_seed;
+
+	public:
+		// iterates over the characters of a rope
+		// moving inside a chunk just steps over the bytes. Moving to the next chunk looks it up from the root
+		// so that's O(log n) once per chunk. The iterator is invalidated by any change to the rope
+		class utf8rope_iterator : public std::iterator<std::bidirectional_iterator_tag, const value_type>
+		{
+			private:
+				const _utf8rope *rope;
+				const ropenode *node;
+
+				// the position of the first character of node's chunk
+				size_type chunk_pos;
+
+				// the current byte in node's chunk. NULL at the end of the rope
+				const _uchar8bit *cur;
+
+				void inc()
+				{
+					// result in undefined behavior (crashes) if already at the end
+					IncToNextCharacter(cur);
+
+					if(cur == node->chunk.c_str() + node->chunk.length()) seek(chunk_pos + node->chunk_chars);
+				}
+
+				void dec()
+				{
+					// result in undefined behavior (crashes) if already at the beginning
+					if((node == NULL) || (cur == node->chunk.c_str()))
+					{
+						seek(((node == NULL) ? rope->size() : chunk_pos) - 1);
+
+						// go to the last character of the chunk
+						cur = node->chunk.c_str() + node->chunk.length();
+					}
+
+					DecToNextCharacter(cur);
+				}
+
+				// moves to the start of the chunk that holds the character at pos
+				void seek(size_type pos)
+				{
+					node = rope->findnode(pos, chunk_pos);
+					cur = (node == NULL) ? NULL : node->chunk.c_str();
+				}
+
+			public:
+				utf8rope_iterator()
+					:rope(NULL), node(NULL), chunk_pos(0), cur(NULL)
+				{
+				}
+
+				// points to the character at pos or to the end if pos is off the rope
+				utf8rope_iterator(const _utf8rope *r, size_type pos)
+					:rope(r)
+				{
+					seek(pos);
+
+					// the node was found for pos so this stays in the chunk
+					if(node != NULL) IncrementToPosition(cur, pos - chunk_pos);
+				}
+
+				_char32bit operator*() const
+				{
+					// returns the character currently being pointed to
+					return UTF8CharToUnicode(cur);
+				}
+
+				// does not check to see if it goes past the end
+				// iterating past the end is undefined
+				utf8rope_iterator &operator++()
+				{
+					inc();
+
+					return *this;
+				}
+
+				// does not check to see if it goes past the end
+				// iterating past the end is undefined
+				utf8rope_iterator operator++(int)
+				{
+					utf8rope_iterator copy(*this);
+
+					inc();
+
+					return copy;
+				}
+
+				// does not check to see if it goes past the end
+				// iterating past begin is undefined
+				utf8rope_iterator &operator--()
+				{
+					dec();
+
+					return *this;
+				}
+
+				// does not check to see if it goes past the end
+				// iterating past begin is undefined
+				utf8rope_iterator operator--(int)
+				{
+					utf8rope_iterator copy(*this);
+
+					dec();
+
+					return copy;
+				}
+
+				bool operator == (const utf8rope_iterator &other) const
+				{
+					// the programmer is responsible for making both iterators are for the same rope
+					return cur == other.cur;
+				}
+
+				bool operator != (const utf8rope_iterator &other) const
+				{
+					return cur != other.cur;
+				}
+		};
+
+		// all iterators are const because characters can't be changed in place
+		typedef utf8rope_iterator								const_iterator;
+		typedef utf8rope_iterator								iterator;
+		typedef value_reverse_iterator<const_iterator>		const_reverse_iterator;
+		typedef const_reverse_iterator							reverse_iterator;
+
+	private:
+		static size_type nodebytes(const ropenode *node)
+		{
+			return (node == NULL) ? 0 : node->bytes;
+		}
+
+		static size_type nodechars(const ropenode *node)
+		{
+			return (node == NULL) ? 0 : node->chars;
+		}
+
+		// recalculates the totals of a node after its chunk or children change
+		static void update(ropenode *node)
+		{
+			node->bytes = nodebytes(node->left) + node->chunk.length() + nodebytes(node->right);
+			node->chars = nodechars(node->left) + node->chunk_chars + nodechars(node->right);
+		}
+
+		// xorshift. The priorities only have to be spread out, not unpredictable
+		std::uint32_t nextpriority()
+		{
+			rope_seed ^= rope_seed << 13;
+			rope_seed ^= rope_seed >> 17;
+			rope_seed ^= rope_seed << 5;
+
+			return rope_seed;
+		}
+
+		ropenode *newnode(const _uchar8bit *str, size_type n, size_type n_chars, std::uint32_t priority)
+		{
+			node_allocator alloc(rope_alloc);
+			ropenode *node = node_traits::allocate(alloc, 1);
+
+			try
+			{
+				node_traits::construct(alloc, node, str, n, n_chars, priority, rope_alloc);
+			}
+			catch(...)
+			{
+				node_traits::deallocate(alloc, node, 1);
+				throw;
+			}
+
+			return node;
+		}
+
+		void deletenode(ropenode *node)
+		{
+			node_allocator alloc(rope_alloc);
+
+			node_traits::destroy(alloc, node);
+			node_traits::deallocate(alloc, node, 1);
+		}
+
+		// deletes a node and everything under it
+		void deletetree(ropenode *node)
+		{
+			if(node == NULL) return;
+
+			deletetree(node->left);
+			deletetree(node->right);
+			deletenode(node);
+		}
+
+		ropenode *copytree(const ropenode *node)
+		{
+			if(node == NULL) return NULL;
+
+			ropenode *copy = newnode(node->chunk.c_str(), node->chunk.length(), node->chunk_chars, node->priority);
+
+			try
+			{
+				copy->left = copytree(node->left);
+				copy->right = copytree(node->right);
+			}
+			catch(...)
+			{
+				deletetree(copy);
+				throw;
+			}
+
+			copy->bytes = node->bytes;
+			copy->chars = node->chars;
+
+			return copy;
+		}
+
+		// joins two trees. Everything in left comes before everything in right
+		static ropenode *merge(ropenode *left, ropenode *right)
+		{
+			if(left == NULL) return right;
+			if(right == NULL) return left;
+
+			if(left->priority >= right->priority)
+			{
+				left->right = merge(left->right, right);
+				update(left);
+
+				return left;
+			}
+
+			right->left = merge(left, right->left);
+			update(right);
+
+			return right;
+		}
+
+		// splits a tree into the characters before pos and the characters from pos on
+		// a chunk that pos falls inside of is cut in two
+		void split(ropenode *node, size_type pos, ropenode *&left, ropenode *&right)
+		{
+			if(node == NULL)
+			{
+				left = right = NULL;
+				return;
+			}
+
+			size_type left_chars = nodechars(node->left);
+
+			if(pos <= left_chars)
+			{
+				split(node->left, pos, left, node->left);
+				update(node);
+				right = node;
+			}
+			else if(pos >= left_chars + node->chunk_chars)
+			{
+				split(node->right, pos - left_chars - node->chunk_chars, node->right, right);
+				update(node);
+				left = node;
+			}
+			else
+			{
+				// cut the chunk
+				size_type chunk_pos = pos - left_chars;
+
+				const _uchar8bit *start = node->chunk.c_str();
+				const _uchar8bit *cut = start;
+				AdvanceUTF8Characters(cut, start + node->chunk.length(), chunk_pos);
+
+				// the second half keeps the priority so it can take the place of node above the right subtree
+				ropenode *tail = newnode(cut, node->chunk.length() - (size_type)(cut - start), node->chunk_chars - chunk_pos, node->priority);
+
+				node->chunk.resize((size_type)(cut - start));
+				node->chunk_chars = chunk_pos;
+
+				tail->right = node->right;
+				node->right = NULL;
+
+				update(node);
+				update(tail);
+
+				left = node;
+				right = tail;
+			}
+		}
+
+		// splits the rope into the characters before pos, the len characters from pos on and the rest
+		// splitting a chunk can run out of memory. If it does the rope is put back together and the exception is passed on
+		void cut(size_type pos, size_type len, ropenode *&left, ropenode *&middle, ropenode *&right)
+		{
+			// nothing is changed if the first split throws
+			split(rope_root, pos, left, right);
+
+			try
+			{
+				split(right, len, middle, right);
+			}
+			catch(...)
+			{
+				rope_root = merge(left, right);
+				throw;
+			}
+		}
+
+		// makes a tree from a view, cutting it into chunks at character boundaries
+		ropenode *buildtree(utf8string_view str)
+		{
+			ropenode *tree = NULL;
+
+			const _uchar8bit *cur = str.data();
+			const _uchar8bit *finish = cur + str.size_bytes();
+
+			try
+			{
+				while(cur < finish)
+				{
+					const _uchar8bit *next = ((size_type)(finish - cur) > UTF8ROPE_CHUNK_SIZE) ? cur + UTF8ROPE_CHUNK_SIZE : finish;
+
+					// back up to the start of a character
+					while((next < finish) && (next > cur) && ((*next & 0xC0) == 0x80)) --next;
+					if(next == cur) next = cur + 1;
+
+					// the chunk isn't allowed to end in the middle of a character
+					while((next < finish) && ((*next & 0xC0) == 0x80)) ++next;
+
+					tree = merge(tree, newnode(cur, (size_type)(next - cur), CountUTF8Characters(cur, next), nextpriority()));
+
+					cur = next;
+				}
+			}
+			catch(...)
+			{
+				deletetree(tree);
+				throw;
+			}
+
+			return tree;
+		}
+
+		// adds str to the chunk that pos is in if it fits
+		// returns false without changing anything if it doesn't
+		static bool insertinchunk(ropenode *node, size_type pos, utf8string_view str, size_type str_chars)
+		{
+			if(node == NULL) return false;
+
+			size_type left_chars = nodechars(node->left);
+			bool inserted;
+
+			if(pos < left_chars)
+			{
+				inserted = insertinchunk(node->left, pos, str, str_chars);
+			}
+			else if(pos > left_chars + node->chunk_chars)
+			{
+				inserted = insertinchunk(node->right, pos - left_chars - node->chunk_chars, str, str_chars);
+			}
+			else
+			{
+				if(node->chunk.length() + str.size_bytes() > UTF8ROPE_CHUNK_SIZE) return false;
+
+				const _uchar8bit *start = node->chunk.c_str();
+				const _uchar8bit *cur = start;
+				AdvanceUTF8Characters(cur, start + node->chunk.length(), pos - left_chars);
+
+				node->chunk.insert((size_type)(cur - start), str.data(), str.size_bytes());
+				node->chunk_chars += str_chars;
+				inserted = true;
+			}
+
+			if(inserted)
+			{
+				node->bytes += str.size_bytes();
+				node->chars += str_chars;
+			}
+
+			return inserted;
+		}
+
+		// finds the node that holds the character at pos
+		// node_pos is set to the position of the first character of its chunk
+		// returns NULL if pos is off the rope
+		const ropenode *findnode(size_type pos, size_type &node_pos) const
+		{
+			const ropenode *node = rope_root;
+			node_pos = 0;
+
+			while(node != NULL)
+			{
+				size_type left_chars = nodechars(node->left);
+
+				if(pos < left_chars)
+				{
+					node = node->left;
+				}
+				else if(pos < left_chars + node->chunk_chars)
+				{
+					node_pos += left_chars;
+					return node;
+				}
+				else
+				{
+					pos -= left_chars + node->chunk_chars;
+					node_pos += left_chars + node->chunk_chars;
+					node = node->right;
+				}
+			}
+
+			return NULL;
+		}
+
+		// calls f(const _uchar8bit *str, size_type n) for the bytes of the characters in [start, finish) in order
+		// node_pos is the position of the first character under node
+		template <class Function>
+		static void visitchunks(const ropenode *node, size_type node_pos, size_type start, size_type finish, Function &f)
+		{
+			if((node == NULL) || (start >= finish)) return;
+			if((finish <= node_pos) || (start >= node_pos + node->chars)) return;
+
+			size_type chunk_pos = node_pos + nodechars(node->left);
+
+			visitchunks(node->left, node_pos, start, finish, f);
+
+			size_type chunk_end = chunk_pos + node->chunk_chars;
+			if((start < chunk_end) && (finish > chunk_pos))
+			{
+				const _uchar8bit *begin = node->chunk.c_str();
+				const _uchar8bit *end = begin + node->chunk.length();
+
+				// only part of the chunk might be in the range
+				if(start > chunk_pos) AdvanceUTF8Characters(begin, end, start - chunk_pos);
+				if(finish < chunk_end)
+				{
+					end = begin;
+					AdvanceUTF8Characters(end, node->chunk.c_str() + node->chunk.length(), finish - ((start > chunk_pos) ? start : chunk_pos));
+				}
+
+				f(begin, (size_type)(end - begin));
+			}
+
+			visitchunks(node->right, chunk_end, start, finish, f);
+		}
+
+		// appends the bytes it's given to a _utf8string
+		struct stringbuilder
+		{
+			_utf8string<Alloc> &out;
+
+			stringbuilder(_utf8string<Alloc> &o)
+				:out(o)
+			{
+			}
+
+			void operator()(const _uchar8bit *str, size_type n)
+			{
+				out += utf8string_view(str, n);
+			}
+		};
+
+		// passes the bytes it's given to a function that takes a view
+		template <class Function>
+		struct viewcaller
+		{
+			Function &f;
+
+			viewcaller(Function &function)
+				:f(function)
+			{
+			}
+
+			void operator()(const _uchar8bit *str, size_type n)
+			{
+				f(utf8string_view(str, n));
+			}
+		};
+
+	public:
+		// default constructor
+		_utf8rope()
+			:rope_root(NULL), rope_alloc(), rope_seed(2463534242u)
+		{
+		}
+
+		// makes an empty rope that gets its memory from alloc
+		explicit _utf8rope(const Alloc &alloc)
+			:rope_root(NULL), rope_alloc(alloc), rope_seed(2463534242u)
+		{
+		}
+
+		// build from UTF-8 data. A _utf8string, a c string or a view can be passed in
+		_utf8rope(utf8string_view str, const Alloc &alloc = Alloc())
+			:rope_root(NULL), rope_alloc(alloc), rope_seed(2463534242u)
+		{
+			rope_root = buildtree(str);
+		}
+
+		// copy constructor
+		_utf8rope(const _utf8rope &other)
+			:rope_root(NULL), rope_alloc(other.rope_alloc), rope_seed(other.rope_seed)
+		{
+			rope_root = copytree(other.rope_root);
+		}
+
+		// move constructor
+		_utf8rope(_utf8rope &&other)
+			:rope_root(other.rope_root), rope_alloc(other.rope_alloc), rope_seed(other.rope_seed)
+		{
+			other.rope_root = NULL;
+		}
+
+		~_utf8rope()
+		{
+			deletetree(rope_root);
+		}
+
+		_utf8rope &operator= (const _utf8rope &other)
+		{
+			if(this != &other)
+			{
+				// copy first so an exception leaves this rope as it was
+				ropenode *copy = copytree(other.rope_root);
+
+				deletetree(rope_root);
+				rope_root = copy;
+			}
+
+			return *this;
+		}
+
+		_utf8rope &operator= (_utf8rope &&other)
+		{
+			if(this == &other) return *this;
+
+			if(rope_alloc == other.rope_alloc)
+			{
+				deletetree(rope_root);
+				rope_root = other.rope_root;
+				other.rope_root = NULL;
+			}
+			else
+			{
+				// the nodes can't be taken if they came from a different allocator
+				*this = (const _utf8rope &)other;
+				other.clear();
+			}
+
+			return *this;
+		}
+
+		// capacity ------------------------------------------------------------
+
+		// returns the number of characters in the rope
+		size_type size() const
+		{
+			return nodechars(rope_root);
+		}
+
+		// synonomous with size()
+		size_type length() const
+		{
+			return size();
+		}
+
+		// returns the number of bytes of UTF-8 in the rope
+		size_type size_bytes() const
+		{
+			return nodebytes(rope_root);
+		}
+
+		bool empty() const
+		{
+			return rope_root == NULL;
+		}
+
+		void clear()
+		{
+			deletetree(rope_root);
+			rope_root = NULL;
+		}
+
+		Alloc get_allocator() const
+		{
+			return rope_alloc;
+		}
+
+		// iterators ----------------------------------------------------------------------
+
+		const_iterator cbegin() const
+		{
+			return const_iterator(this, 0);
+		}
+
+		const_iterator begin() const
+		{
+			return cbegin();
+		}
+
+		const_iterator cend() const
+		{
+			return const_iterator(this, size());
+		}
+
+		const_iterator end() const
+		{
+			return cend();
+		}
+
+		const_reverse_iterator crbegin() const
+		{
+			return const_reverse_iterator(cend());
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return crbegin();
+		}
+
+		const_reverse_iterator crend() const
+		{
+			return const_reverse_iterator(cbegin());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return crend();
+		}
+
+		// returns an iterator to the character at pos
+		const_iterator iterator_at(size_type pos) const
+		{
+			return const_iterator(this, pos);
+		}
+
+		// access -------------------------------------------------------------------------------------
+
+		// returns the character at pos
+		// doesn't throw exception. undefined if out of range
+		value_type operator[](size_type pos) const
+		{
+			size_type chunk_pos;
+			const ropenode *node = findnode(pos, chunk_pos);
+
+			const _uchar8bit *cur = node->chunk.c_str();
+			IncrementToPosition(cur, pos - chunk_pos);
+
+			return UTF8CharToUnicode(cur);
+		}
+
+		// returns the character at pos
+		// will throw an exception if out of range
+		value_type at(size_type pos) const
+		{
+			if(pos >= size())
+			{
+				throw std::out_of_range("subscript out of range");
+			}
+
+			return (*this)[pos];
+		}
+
+		// returns the position in the UTF-8 data of the character at pos
+		// returns size_bytes() if pos is off the rope
+		size_type byte_position(size_type pos) const
+		{
+			size_type chunk_pos;
+			const ropenode *node = findnode(pos, chunk_pos);
+			if(node == NULL) return size_bytes();
+
+			// add up the bytes of everything before the node on the way down
+			size_type byte_pos = 0;
+			const ropenode *cur_node = rope_root;
+			size_type char_pos = pos;
+
+			while(cur_node != node)
+			{
+				size_type left_chars = nodechars(cur_node->left);
+
+				if(char_pos < left_chars)
+				{
+					cur_node = cur_node->left;
+				}
+				else
+				{
+					char_pos -= left_chars + cur_node->chunk_chars;
+					byte_pos += nodebytes(cur_node->left) + cur_node->chunk.length();
+					cur_node = cur_node->right;
+				}
+			}
+
+			byte_pos += nodebytes(node->left);
+
+			return byte_pos + GetBufferPosition(node->chunk.c_str(), pos - chunk_pos);
+		}
+
+		// modifiers -------------------------------------------------------------------------------------
+
+		// inserts str right before character at position pos
+		// small strings are added to the chunk at pos if it has room, otherwise the tree is split at pos
+		_utf8rope &insert(size_type pos, utf8string_view str)
+		{
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
+			}
+
+			if(str.empty()) return *this;
+
+			size_type str_chars = str.size();
+			if(insertinchunk(rope_root, pos, str, str_chars)) return *this;
+
+			// build the new nodes first so running out of memory doesn't change the rope
+			ropenode *middle = buildtree(str);
+
+			ropenode *left, *right;
+			try
+			{
+				split(rope_root, pos, left, right);
+			}
+			catch(...)
+			{
+				deletetree(middle);
+				throw;
+			}
+
+			rope_root = merge(merge(left, middle), right);
+
+			return *this;
+		}
+
+		// erases len characters starting at pos
+		_utf8rope &erase(size_type pos = 0, size_type len = npos)
+		{
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
+			}
+
+			if((len == npos) || (len > size() - pos)) len = size() - pos;
+			if(len == 0) return *this;
+
+			ropenode *left, *middle, *right;
+			cut(pos, len, left, middle, right);
+
+			deletetree(middle);
+			rope_root = merge(left, right);
+
+			return *this;
+		}
+
+		// replaces len characters starting at pos with str
+		_utf8rope &replace(size_type pos, size_type len, utf8string_view str)
+		{
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
+			}
+
+			// build the new nodes first so running out of memory doesn't change the rope
+			ropenode *middle = buildtree(str);
+
+			if((len == npos) || (len > size() - pos)) len = size() - pos;
+
+			ropenode *left, *old_middle, *right;
+			try
+			{
+				cut(pos, len, left, old_middle, right);
+			}
+			catch(...)
+			{
+				deletetree(middle);
+				throw;
+			}
+
+			deletetree(old_middle);
+			rope_root = merge(merge(left, middle), right);
+
+			return *this;
+		}
+
+		// adds str to the end of the rope
+		_utf8rope &append(utf8string_view str)
+		{
+			return insert(size(), str);
+		}
+
+		_utf8rope &operator+= (utf8string_view str)
+		{
+			return append(str);
+		}
+
+		// the ropes must have equal allocators. The allocators aren't swapped
+		void swap(_utf8rope &other)
+		{
+			std::swap(rope_root, other.rope_root);
+			std::swap(rope_seed, other.rope_seed);
+		}
+
+		// string operations -----------------------------------------------------------------------------
+
+		// copies len characters starting at pos into a _utf8string
+		_utf8string<Alloc> substr(size_type pos = 0, size_type len = npos) const
+		{
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
+			}
+
+			if((len == npos) || (len > size() - pos)) len = size() - pos;
+
+			_utf8string<Alloc> out(rope_alloc);
+			stringbuilder builder(out);
+			visitchunks(rope_root, 0, pos, pos + len, builder);
+
+			return out;
+		}
+
+		// copies the whole rope into a _utf8string
+		_utf8string<Alloc> str() const
+		{
+			_utf8string<Alloc> out(rope_alloc);
+			out.reserve(size_bytes());
+
+			stringbuilder builder(out);
+			visitchunks(rope_root, 0, 0, size(), builder);
+
+			return out;
+		}
+
+		// calls f(utf8string_view) for each chunk of the rope in order
+		// use this to write the rope out without copying it into one buffer first
+		template <class Function>
+		void for_each_chunk(Function f) const
+		{
+			viewcaller<Function> caller(f);
+			visitchunks(rope_root, 0, 0, size(), caller);
+		}
+
+		// overload stream insertion so we can write to streams
+		friend std::ostream& operator<<(std::ostream& os, const _utf8rope& rope)
+		{
+			rope.for_each_chunk([&os](utf8string_view chunk) { os << chunk; });
+
+			return os;
+		}
+
+		static const size_type npos = -1;
+};
+
+typedef _utf8rope<> utf8rope;
+
+#if defined(UTF8STRING_HAS_PMR)
+namespace pmr
+{
+
+// a utf8rope that gets its memory from a std::pmr::memory_resource
+typedef _utf8rope<std::pmr::polymorphic_allocator<_uchar8bit>> utf8rope;
+
+}
+#endif
+
+}
+
+#endif
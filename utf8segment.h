@@ -0,0 +1,780 @@
+// utf8segment.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8SEGMENTHEADER
+#define UTF8SEGMENTHEADER
+
+#include <iterator>
+
+#include "utf8string.h"
+#include "utf8segmenttables.h"
+
+namespace sd_utf8
+{
+
+inline utf8grapheme_break GetGraphemeBreak(std::uint16_t properties)
+{
+	return (utf8grapheme_break)(properties & 0x0F);
+}
+
+inline utf8conjunct_break GetConjunctBreak(std::uint16_t properties)
+{
+	return (utf8conjunct_break)((properties >> 4) & 0x03);
+}
+
+inline utf8word_break GetWordBreak(std::uint16_t properties)
+{
+	return (utf8word_break)((properties >> 6) & 0x1F);
+}
+
+inline utf8sentence_break GetSentenceBreak(std::uint16_t properties)
+{
+	return (utf8sentence_break)((properties >> 11) & 0x0F);
+}
+
+// decodes the character at cur, moves cur past it and returns its segmentation properties
+inline std::uint16_t ReadSegmentProperties(const _uchar8bit *&cur, const _uchar8bit *end)
+{
+	if(*cur < 0x80) return GetUTF8SegmentProperties(*cur++);
+
+	return GetUTF8SegmentProperties(DecodeUTF8Character(cur, end));
+}
+
+// returns the segmentation properties of the character just before cur and moves cur back to its start
+// cur must be past begin
+inline std::uint16_t ReadSegmentPropertiesBack(const _uchar8bit *begin, const _uchar8bit *&cur)
+{
+	const _uchar8bit *end = cur;
+
+	--cur;
+	if(*cur < 0x80) return GetUTF8SegmentProperties(*cur);
+
+	for(int i = 0; (i < 3) && (cur > begin) && ((*cur & 0xC0) == 0x80); ++i) --cur;
+
+	const _uchar8bit *start = cur;
+	return GetUTF8SegmentProperties(DecodeUTF8Character(start, end));
+}
+
+// the rules for finding the previous boundary are the same for every kind of segment
+// the forward rules never look before the boundary they start from, so going back only has to find a place that
+// is certainly a boundary and then step forward from there. Rules::certain(a, b, begin, pos, end) says if the place
+// between the characters a and b at pos is certainly a boundary. It can look at the text around them but shouldn't
+// have to go far, the search calls it for every character it goes back over
+template <class Rules>
+inline const _uchar8bit *FindPreviousSegment(const _uchar8bit *begin, const _uchar8bit *cur, const _uchar8bit *end)
+{
+	if(cur <= begin) return begin;
+
+	// find a boundary before cur to start from
+	const _uchar8bit *start = cur;
+	std::uint16_t b = ReadSegmentPropertiesBack(begin, start);
+
+	while(start > begin)
+	{
+		const _uchar8bit *a_start = start;
+		std::uint16_t a = ReadSegmentPropertiesBack(begin, a_start);
+
+		if(Rules::certain(a, b, begin, start, end)) break;
+
+		start = a_start;
+		b = a;
+	}
+
+	// step forward to the last boundary before cur
+	for(;;)
+	{
+		const _uchar8bit *next = Rules::next(start, end);
+		if(next >= cur) return start;
+
+		start = next;
+	}
+}
+
+// grapheme clusters (user-perceived characters) from UAX #29
+// a letter with its accents, a Hangul syllable, an emoji ZWJ sequence or a flag is one cluster
+struct utf8grapheme_rules
+{
+	// returns the end of the cluster that starts at cur
+	// cur must be at a boundary and before end
+	static const _uchar8bit *next(const _uchar8bit *cur, const _uchar8bit *end)
+	{
+		// two ASCII characters in a row are always split except for CR LF
+		if(*cur < 0x80)
+		{
+			if(cur + 1 == end) return end;
+			if(cur[1] < 0x80) return ((cur[0] == '\r') && (cur[1] == '\n')) ? cur + 2 : cur + 1;
+		}
+
+		std::uint16_t properties = ReadSegmentProperties(cur, end);
+		utf8grapheme_break prev = GetGraphemeBreak(properties);
+
+		// GB4: break after controls, except CR LF
+		if((prev == gb_control) || (prev == gb_lf)) return cur;
+		if(prev == gb_cr) return ((cur < end) && (*cur == '\n')) ? cur + 1 : cur;
+
+		// the state for GB9c, GB11 and GB12/13
+		// conjunct is 1 after a consonant and 2 once a linker follows it. pictographic is 1 after a pictograph and
+		// its extends and 2 after the ZWJ that follows them. regional counts the regional indicators in a row
+		int conjunct = (GetConjunctBreak(properties) == incb_consonant) ? 1 : 0;
+		int pictographic = (prev == gb_extended_pictographic) ? 1 : 0;
+		size_t regional = (prev == gb_regional_indicator) ? 1 : 0;
+
+		while(cur < end)
+		{
+			const _uchar8bit *next_start = cur;
+			properties = ReadSegmentProperties(cur, end);
+
+			utf8grapheme_break c = GetGraphemeBreak(properties);
+			utf8conjunct_break incb = GetConjunctBreak(properties);
+
+			bool join;
+			switch(c)
+			{
+				case gb_cr:
+				case gb_lf:
+				case gb_control:
+					join = false;	// GB5
+					break;
+
+				case gb_extend:
+				case gb_zwj:
+				case gb_spacingmark:
+					join = true;	// GB9, GB9a
+					break;
+
+				default:
+					join = (prev == gb_prepend)																// GB9b
+						|| ((prev == gb_l) && ((c == gb_l) || (c == gb_v) || (c == gb_lv) || (c == gb_lvt)))	// GB6
+						|| (((prev == gb_lv) || (prev == gb_v)) && ((c == gb_v) || (c == gb_t)))				// GB7
+						|| (((prev == gb_lvt) || (prev == gb_t)) && (c == gb_t))								// GB8
+						|| ((incb == incb_consonant) && (conjunct == 2))										// GB9c
+						|| ((c == gb_extended_pictographic) && (pictographic == 2))								// GB11
+						|| ((c == gb_regional_indicator) && (regional % 2 == 1));								// GB12, GB13
+					break;
+			}
+
+			if(!join) return next_start;
+
+			if(incb == incb_consonant) conjunct = 1;
+			else if((incb == incb_linker) && (conjunct != 0)) conjunct = 2;
+			else if(incb != incb_extend) conjunct = 0;
+
+			if(c == gb_extended_pictographic) pictographic = 1;
+			else if((c == gb_zwj) && (pictographic == 1)) pictographic = 2;
+			else if((c != gb_extend) || (pictographic != 1)) pictographic = 0;
+
+			regional = (c == gb_regional_indicator) ? regional + 1 : 0;
+
+			prev = c;
+		}
+
+		return end;
+	}
+
+	// true if there is always a boundary between a and b. Only GB9c, GB11 and GB12/13 need more than the two
+	// characters so the others can be decided here
+	static bool certain(std::uint16_t a, std::uint16_t b, const _uchar8bit *, const _uchar8bit *, const _uchar8bit *)
+	{
+		utf8grapheme_break left = GetGraphemeBreak(a);
+		utf8grapheme_break right = GetGraphemeBreak(b);
+
+		if((left == gb_cr) && (right == gb_lf)) return false;
+		if((left == gb_cr) || (left == gb_lf) || (left == gb_control)) return true;
+		if((right == gb_cr) || (right == gb_lf) || (right == gb_control)) return true;
+
+		if((right == gb_extend) || (right == gb_zwj) || (right == gb_spacingmark) || (left == gb_prepend)) return false;
+		if((left == gb_l) && ((right == gb_l) || (right == gb_v) || (right == gb_lv) || (right == gb_lvt))) return false;
+		if(((left == gb_lv) || (left == gb_v)) && ((right == gb_v) || (right == gb_t))) return false;
+		if(((left == gb_lvt) || (left == gb_t)) && (right == gb_t)) return false;
+
+		if((GetConjunctBreak(b) == incb_consonant) && (GetConjunctBreak(a) != incb_none)) return false;
+		if((right == gb_extended_pictographic) && (left == gb_zwj)) return false;
+		if((right == gb_regional_indicator) && (left == gb_regional_indicator)) return false;
+
+		return true;
+	}
+};
+
+// words from UAX #29
+// every character is in a segment. Words, numbers, runs of spaces and single punctuation marks are segments
+struct utf8word_rules
+{
+	static bool isletter(utf8word_break c)
+	{
+		return (c == wb_aletter) || (c == wb_hebrew_letter);
+	}
+
+	static bool isignored(utf8word_break c)
+	{
+		return (c == wb_extend) || (c == wb_format) || (c == wb_zwj);
+	}
+
+	static bool isnewline(utf8word_break c)
+	{
+		return (c == wb_newline) || (c == wb_cr) || (c == wb_lf);
+	}
+
+	// the word break class of the first character at or after cur that WB4 doesn't skip
+	// returns wb_other at the end
+	static utf8word_break peek(const _uchar8bit *cur, const _uchar8bit *end)
+	{
+		while(cur < end)
+		{
+			utf8word_break c = GetWordBreak(ReadSegmentProperties(cur, end));
+			if(!isignored(c)) return c;
+		}
+
+		return wb_other;
+	}
+
+	// returns the end of the segment that starts at cur
+	// cur must be at a boundary and before end
+	static const _uchar8bit *next(const _uchar8bit *cur, const _uchar8bit *end)
+	{
+		// ASCII words, numbers and runs of spaces can be found without the tables. the run has to end with an
+		// ASCII character that can't join it
+		if(*cur < 0x80)
+		{
+			const _uchar8bit *run = cur;
+
+			if(isalnumascii(*run))
+			{
+				while((run < end) && isalnumascii(*run)) ++run;
+
+				if(run == end) return end;
+				if((*run < 0x80) && (*run != '.') && (*run != ':') && (*run != ',') && (*run != ';') && (*run != '\'')) return run;
+			}
+			else if(*run == ' ')
+			{
+				while((run < end) && (*run == ' ')) ++run;
+
+				if((run == end) || (*run < 0x80)) return run;
+			}
+			else if((run + 1 < end) && (run[1] < 0x80))
+			{
+				return ((run[0] == '\r') && (run[1] == '\n')) ? run + 2 : run + 1;
+			}
+		}
+
+		std::uint16_t properties = ReadSegmentProperties(cur, end);
+		utf8word_break prev = GetWordBreak(properties);
+
+		// WB3, WB3a
+		if(prev == wb_cr) return ((cur < end) && (*cur == '\n')) ? cur + 1 : cur;
+		if(isnewline(prev)) return cur;
+
+		// the last character before cur, not skipping anything, for WB3c and WB3d
+		utf8word_break last = prev;
+
+		size_t regional = (prev == wb_regional_indicator) ? 1 : 0;
+
+		while(cur < end)
+		{
+			const _uchar8bit *next_start = cur;
+			properties = ReadSegmentProperties(cur, end);
+			utf8word_break c = GetWordBreak(properties);
+
+			// WB3b
+			if(isnewline(c)) return next_start;
+
+			// WB4
+			if(isignored(c))
+			{
+				last = c;
+				continue;
+			}
+
+			// WB3c, WB3d
+			if(((last == wb_zwj) && (GetGraphemeBreak(properties) == gb_extended_pictographic)) || ((last == wb_wsegspace) && (c == wb_wsegspace)))
+			{
+				regional = 0;
+				prev = last = c;
+				continue;
+			}
+
+			bool join = false;
+
+			if(isletter(prev) && isletter(c)) join = true;			// WB5
+			else if(isletter(prev) && ((c == wb_midletter) || (c == wb_midnumlet) || (c == wb_single_quote)))
+			{
+				// WB6, WB7. the letter after the mark joins too
+				if(isletter(peek(cur, end)))
+				{
+					join = true;
+					c = wb_aletter;
+				}
+				else if((prev == wb_hebrew_letter) && (c == wb_single_quote))
+				{
+					join = true;		// WB7a
+				}
+			}
+			else if((prev == wb_hebrew_letter) && (c == wb_double_quote))
+			{
+				// WB7b, WB7c
+				if(peek(cur, end) == wb_hebrew_letter)
+				{
+					join = true;
+					c = wb_hebrew_letter;
+				}
+			}
+			else if((prev == wb_numeric) && ((c == wb_numeric) || isletter(c))) join = true;		// WB8, WB10
+			else if(isletter(prev) && (c == wb_numeric)) join = true;								// WB9
+			else if((prev == wb_numeric) && ((c == wb_midnum) || (c == wb_midnumlet) || (c == wb_single_quote)))
+			{
+				// WB11, WB12
+				if(peek(cur, end) == wb_numeric)
+				{
+					join = true;
+					c = wb_numeric;
+				}
+			}
+			else if((prev == wb_katakana) && (c == wb_katakana)) join = true;		// WB13
+			else if((c == wb_extendnumlet) && (isletter(prev) || (prev == wb_numeric) || (prev == wb_katakana) || (prev == wb_extendnumlet))) join = true;	// WB13a
+			else if((prev == wb_extendnumlet) && (isletter(c) || (c == wb_numeric) || (c == wb_katakana))) join = true;		// WB13b
+			else if((prev == wb_regional_indicator) && (c == wb_regional_indicator) && (regional % 2 == 1)) join = true;	// WB15, WB16
+
+			if(!join) return next_start;
+
+			// a mark joined by WB6 or WB11 takes the class of the character after it so that character joins
+			// with WB5 or WB8. Skip what's between them the same as WB4 would
+			regional = (c == wb_regional_indicator) ? regional + 1 : 0;
+			prev = c;
+			last = GetWordBreak(properties);
+		}
+
+		return end;
+	}
+
+	static bool isalnumascii(_uchar8bit c)
+	{
+		return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) || (c == '_');
+	}
+
+	static bool ismidletter(utf8word_break c)
+	{
+		return (c == wb_midletter) || (c == wb_midnumlet) || (c == wb_single_quote);
+	}
+
+	static bool ismidnum(utf8word_break c)
+	{
+		return (c == wb_midnum) || (c == wb_midnumlet) || (c == wb_single_quote);
+	}
+
+	// the word break class of the first character before cur that WB4 doesn't skip
+	// returns wb_other at begin
+	static utf8word_break peekback(const _uchar8bit *begin, const _uchar8bit *cur)
+	{
+		while(cur > begin)
+		{
+			utf8word_break c = GetWordBreak(ReadSegmentPropertiesBack(begin, cur));
+			if(!isignored(c)) return c;
+		}
+
+		return wb_other;
+	}
+
+	// true if there is always a boundary between a and b at pos. It isn't certain next to a character WB4 skips or
+	// between regional indicators. WB6 to WB7c, WB11 and WB12 look at the characters on either side of a mark
+	static bool certain(std::uint16_t a, std::uint16_t b, const _uchar8bit *begin, const _uchar8bit *pos, const _uchar8bit *end)
+	{
+		utf8word_break left = GetWordBreak(a);
+		utf8word_break right = GetWordBreak(b);
+
+		if((left == wb_cr) && (right == wb_lf)) return false;
+		if(isnewline(left) || isnewline(right)) return true;
+
+		if(isignored(left) || isignored(right)) return false;
+		if((left == wb_wsegspace) && (right == wb_wsegspace)) return false;
+		if((left == wb_regional_indicator) && (right == wb_regional_indicator)) return false;
+
+		// WB5, WB8, WB9, WB10, WB13, WB13a, WB13b
+		bool left_word = isletter(left) || (left == wb_numeric);
+		bool right_word = isletter(right) || (right == wb_numeric);
+
+		if(left_word && right_word) return false;
+		if((left == wb_katakana) && (right == wb_katakana)) return false;
+		if((right == wb_extendnumlet) && (left_word || (left == wb_katakana) || (left == wb_extendnumlet))) return false;
+		if((left == wb_extendnumlet) && (right_word || (right == wb_katakana))) return false;
+
+		// WB7a
+		if((left == wb_hebrew_letter) && (right == wb_single_quote)) return false;
+
+		// WB6, WB7b and WB12 need the character after the mark, WB7, WB7c and WB11 the one before it
+		const _uchar8bit *after = pos;
+		ReadSegmentProperties(after, end);
+
+		const _uchar8bit *before = pos;
+		ReadSegmentPropertiesBack(begin, before);
+
+		if(isletter(left) && ismidletter(right) && isletter(peek(after, end))) return false;
+		if((left == wb_hebrew_letter) && (right == wb_double_quote) && (peek(after, end) == wb_hebrew_letter)) return false;
+		if((left == wb_numeric) && ismidnum(right) && (peek(after, end) == wb_numeric)) return false;
+
+		if(ismidletter(left) && isletter(right) && isletter(peekback(begin, before))) return false;
+		if((left == wb_double_quote) && (right == wb_hebrew_letter) && (peekback(begin, before) == wb_hebrew_letter)) return false;
+		if(ismidnum(left) && (right == wb_numeric) && (peekback(begin, before) == wb_numeric)) return false;
+
+		return true;
+	}
+};
+
+// sentences from UAX #29
+// a sentence includes the spaces after it and a paragraph separator if one ends it
+struct utf8sentence_rules
+{
+	static bool isterm(utf8sentence_break c)
+	{
+		return (c == sb_aterm) || (c == sb_sterm);
+	}
+
+	static bool isparasep(utf8sentence_break c)
+	{
+		return (c == sb_sep) || (c == sb_cr) || (c == sb_lf);
+	}
+
+	static bool isignored(utf8sentence_break c)
+	{
+		return (c == sb_extend) || (c == sb_format);
+	}
+
+	// SB8: looks past the characters that aren't letters, separators or terminators to see if a lowercase letter comes next
+	// stop is set to the character that decided it, or end. Looking from anywhere up to stop gives the same answer
+	static bool lowerfollows(const _uchar8bit *cur, const _uchar8bit *end, const _uchar8bit *&stop)
+	{
+		while(cur < end)
+		{
+			stop = cur;
+			utf8sentence_break c = GetSentenceBreak(ReadSegmentProperties(cur, end));
+
+			if(c == sb_lower) return true;
+			if((c == sb_oletter) || (c == sb_upper) || isparasep(c) || isterm(c)) return false;
+		}
+
+		stop = end;
+		return false;
+	}
+
+	// moves past a paragraph separator at cur, and the LF after a CR
+	static const _uchar8bit *skipparasep(utf8sentence_break c, const _uchar8bit *cur, const _uchar8bit *end)
+	{
+		return ((c == sb_cr) && (cur < end) && (*cur == '\n')) ? cur + 1 : cur;
+	}
+
+	// returns the end of the sentence that starts at cur
+	// cur must be at a boundary and before end
+	static const _uchar8bit *next(const _uchar8bit *cur, const _uchar8bit *end)
+	{
+		// the class of the last character SB5 doesn't skip. for SB7
+		utf8sentence_break prev = sb_other;
+
+		// where the sentence is in a terminator sequence: 0 not in one, 1 after SATerm Close*, 2 after SATerm Close* Sp+
+		int term = 0;
+		bool aterm = false;			// the terminator is an ATerm
+		bool closed = false;		// a Close came after it
+		bool after_case = false;	// the terminator came after an Upper or Lower. for SB7
+
+		// the last SB8 answer and how far it holds, so a long run of spaces or closes is only looked through once
+		bool lower = false;
+		const _uchar8bit *lower_stop = NULL;
+
+		bool first = true;
+
+		while(cur < end)
+		{
+			// ASCII that can't end a sentence or start a terminator sequence doesn't need the tables
+			if((term == 0) && !first)
+			{
+				const _uchar8bit *run = cur;
+				while((run < end) && (*run < 0x80) && (*run != '.') && (*run != '!') && (*run != '?') && (*run != '\r') && (*run != '\n')) ++run;
+
+				if(run != cur)
+				{
+					prev = GetSentenceBreak(GetUTF8SegmentProperties(run[-1]));
+					cur = run;
+					if(cur == end) break;
+				}
+			}
+
+			const _uchar8bit *next_start = cur;
+			utf8sentence_break c = GetSentenceBreak(ReadSegmentProperties(cur, end));
+
+			// SB4. SB3 keeps CR LF together
+			if(isparasep(c)) return skipparasep(c, cur, end);
+
+			// SB5. at the start of the text or after a separator there's nothing for them to attach to
+			if(isignored(c) && !first) continue;
+			first = false;
+
+			if(term != 0)
+			{
+				if(aterm && ((lower_stop == NULL) || (next_start > lower_stop))) lower = lowerfollows(next_start, end, lower_stop);
+
+				bool join = false;
+
+				if(aterm && !closed && (term == 1) && (c == sb_numeric)) join = true;								// SB6
+				else if(aterm && !closed && (term == 1) && after_case && (c == sb_upper)) join = true;				// SB7
+				else if(aterm && lower) join = true;																// SB8
+				else if((c == sb_scontinue) || isterm(c)) join = true;												// SB8a
+				else if((term == 1) && (c == sb_close)) join = true;												// SB9
+				else if(c == sb_sp) join = true;																	// SB9, SB10
+
+				// SB11
+				if(!join) return next_start;
+
+				if(c == sb_close) closed = true;
+				else if(c == sb_sp) term = 2;
+				else if(!isterm(c)) term = 0;
+			}
+
+			if(isterm(c))
+			{
+				term = 1;
+				aterm = (c == sb_aterm);
+				closed = false;
+				after_case = (prev == sb_upper) || (prev == sb_lower);
+			}
+
+			prev = c;
+		}
+
+		return end;
+	}
+
+	// true if there is always a boundary between a and b at pos
+	// after a paragraph separator, and before a character that doesn't continue the terminator, closing marks and
+	// spaces before it unless SB6, SB7 or SB8 keep it in the sentence
+	static bool certain(std::uint16_t a, std::uint16_t b, const _uchar8bit *begin, const _uchar8bit *pos, const _uchar8bit *end)
+	{
+		utf8sentence_break left = GetSentenceBreak(a);
+		utf8sentence_break right = GetSentenceBreak(b);
+
+		if((left == sb_cr) && (right == sb_lf)) return false;
+		if(isparasep(left)) return true;
+
+		if((right == sb_sp) || (right == sb_close) || (right == sb_scontinue) || isterm(right) || isparasep(right) || isignored(right)) return false;
+
+		// go back over Close* Sp* to a terminator. SB5 skips extends and formats
+		const _uchar8bit *cur = pos;
+		int spaces = 0;
+		bool closes = false;
+		utf8sentence_break c = sb_other;
+
+		while(cur > begin)
+		{
+			c = GetSentenceBreak(ReadSegmentPropertiesBack(begin, cur));
+
+			if(isignored(c)) continue;
+			if((c == sb_sp) && !closes) ++spaces;
+			else if(c == sb_close) closes = true;
+			else break;
+		}
+
+		if(!isterm(c)) return false;
+		if(c == sb_sterm) return true;
+
+		// SB6, SB7
+		if(!closes && (spaces == 0))
+		{
+			if(right == sb_numeric) return false;
+
+			if(right == sb_upper)
+			{
+				utf8sentence_break before = sb_other;
+				while(cur > begin)
+				{
+					before = GetSentenceBreak(ReadSegmentPropertiesBack(begin, cur));
+					if(!isignored(before)) break;
+				}
+
+				if((before == sb_upper) || (before == sb_lower)) return false;
+			}
+		}
+
+		// SB8
+		const _uchar8bit *stop;
+		return !lowerfollows(pos, end, stop);
+	}
+};
+
+// steps over the segments of a UTF-8 range
+// Rules is utf8grapheme_rules, utf8word_rules or utf8sentence_rules. Going forward finds each boundary by looking at
+// every character once. Going back looks for the nearest place that is always a boundary and steps forward from
+// there. For grapheme clusters that's usually the cluster before, for words the last space or punctuation mark and for
+// sentences the start of the sentence before. The segments are views into the range. Nothing is allocated
+template <class Rules>
+class utf8segment_iterator
+{
+	public:
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef utf8string_view					value_type;
+		typedef ptrdiff_t						difference_type;
+		typedef const utf8string_view			*pointer;
+		typedef utf8string_view					reference;
+
+	private:
+		const _uchar8bit *range_begin;
+		const _uchar8bit *range_end;
+
+		// the segment is [segment_begin, segment_end)
+		const _uchar8bit *segment_begin;
+		const _uchar8bit *segment_end;
+
+	public:
+		utf8segment_iterator()
+			:range_begin(NULL), range_end(NULL), segment_begin(NULL), segment_end(NULL)
+		{
+		}
+
+		// an iterator at the segment that starts at pos. pos must be at a boundary
+		utf8segment_iterator(const _uchar8bit *begin, const _uchar8bit *end, const _uchar8bit *pos)
+			:range_begin(begin), range_end(end), segment_begin(pos), segment_end((pos < end) ? Rules::next(pos, end) : end)
+		{
+		}
+
+		// the current segment
+		utf8string_view operator*() const
+		{
+			return utf8string_view(segment_begin, (size_t)(segment_end - segment_begin));
+		}
+
+		utf8segment_iterator &operator++()
+		{
+			segment_begin = segment_end;
+			if(segment_end < range_end) segment_end = Rules::next(segment_end, range_end);
+
+			return *this;
+		}
+
+		utf8segment_iterator operator++(int)
+		{
+			utf8segment_iterator temp = *this;
+			++(*this);
+
+			return temp;
+		}
+
+		utf8segment_iterator &operator--()
+		{
+			segment_end = segment_begin;
+			segment_begin = FindPreviousSegment<Rules>(range_begin, segment_begin, range_end);
+
+			return *this;
+		}
+
+		utf8segment_iterator operator--(int)
+		{
+			utf8segment_iterator temp = *this;
+			--(*this);
+
+			return temp;
+		}
+
+		bool operator==(const utf8segment_iterator &other) const
+		{
+			return segment_begin == other.segment_begin;
+		}
+
+		bool operator!=(const utf8segment_iterator &other) const
+		{
+			return segment_begin != other.segment_begin;
+		}
+
+		// the first byte of the segment
+		const _uchar8bit *data() const
+		{
+			return segment_begin;
+		}
+
+		// the number of bytes in the segment
+		size_t size_bytes() const
+		{
+			return (size_t)(segment_end - segment_begin);
+		}
+};
+
+typedef utf8segment_iterator<utf8grapheme_rules>	utf8grapheme_iterator;
+typedef utf8segment_iterator<utf8word_rules>		utf8word_iterator;
+typedef utf8segment_iterator<utf8sentence_rules>	utf8sentence_iterator;
+
+// the segments of a UTF-8 range for range based for loops
+// for(utf8string_view cluster : utf8graphemes(str)) ...
+// a _utf8string, a view or a c string can be passed in. The string must outlive the loop
+template <class Rules>
+class utf8segments
+{
+	private:
+		const _uchar8bit *range_begin;
+		const _uchar8bit *range_end;
+
+	public:
+		typedef utf8segment_iterator<Rules> iterator;
+		typedef iterator const_iterator;
+
+		utf8segments(utf8string_view str)
+			:range_begin(str.data()), range_end(str.data() + str.size_bytes())
+		{
+		}
+
+		utf8segments(const _uchar8bit *begin, const _uchar8bit *end)
+			:range_begin(begin), range_end(end)
+		{
+		}
+
+		iterator begin() const
+		{
+			return iterator(range_begin, range_end, range_begin);
+		}
+
+		iterator end() const
+		{
+			return iterator(range_begin, range_end, range_end);
+		}
+};
+
+typedef utf8segments<utf8grapheme_rules>	utf8graphemes;
+typedef utf8segments<utf8word_rules>		utf8words;
+typedef utf8segments<utf8sentence_rules>	utf8sentences;
+
+// counts the grapheme clusters in [begin, end)
+inline size_t CountUTF8Graphemes(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	size_t count = 0;
+	for(const _uchar8bit *cur = begin; cur < end; cur = utf8grapheme_rules::next(cur, end)) ++count;
+
+	return count;
+}
+
+// moves cur forward by n grapheme clusters without going past end and returns the number it moved
+// cur must be at a boundary. Truncating to the first n user-perceived characters is
+// AdvanceUTF8Graphemes(cur, end, n) followed by taking [begin, cur)
+inline size_t AdvanceUTF8Graphemes(const _uchar8bit *&cur, const _uchar8bit *end, size_t n)
+{
+	size_t moved = 0;
+	for(; (moved < n) && (cur < end); ++moved) cur = utf8grapheme_rules::next(cur, end);
+
+	return moved;
+}
+
+}
+
+#endif
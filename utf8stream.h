@@ -0,0 +1,502 @@
+// utf8stream.h
+// Copyright (c) 2013, Dominque A Douglas
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer
+//    in the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+// OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// squaredprogramming.blogspot.com
+//
+#pragma once
+
+#ifndef UTF8STREAMHEADER
+#define UTF8STREAMHEADER
+
+#include <streambuf>
+
+#include "utf8string.h"
+
+// number of code units the stream buffers read or write at a time
+// the memory used by a stream buffer is about 5 times this for UTF-16 and 8 times this for UTF-32
+#ifndef UTF8STREAM_BUFFER_UNITS
+#define UTF8STREAM_BUFFER_UNITS 4096
+#endif
+
+namespace sd_utf8
+{
+
+// decodes UTF-8 that comes in chunks that can be split anywhere, even in the middle of a character
+// the start of a character at the end of a chunk is kept until the next chunk finishes it. Everything else goes
+// straight through DecodeUTF8() so it's as fast as decoding the whole buffer at once. The output is the same as
+// DecodeUTF8() would give for all of the chunks put together, so broken sequences become U+FFFD
+class utf8_decoder
+{
+	private:
+		_uchar8bit decoder_pending[4];
+		size_t decoder_pending_size;
+
+		// the number of bytes in the sequence that starts with lead
+		static size_t sequencelength(_uchar8bit lead)
+		{
+			return (lead < 0xE0) ? 2 : ((lead < 0xF0) ? 3 : 4);
+		}
+
+	public:
+		utf8_decoder()
+			:decoder_pending_size(0)
+		{
+		}
+
+		// the most code units decode() can write for a chunk of n bytes
+		static size_t max_decoded_size(size_t n)
+		{
+			return n + 2;
+		}
+
+		/// \brief Decodes a chunk into UTF-16 or UTF-32
+		/// The output is UTF-16 with surrogate pairs if char_type is 16 bits wide and UTF-32 otherwise.
+		/// out must have room for max_decoded_size(end - begin) code units. Returns the number of code units written.
+		template <typename char_type>
+		size_t decode(const _uchar8bit *begin, const _uchar8bit *end, char_type *out)
+		{
+			char_type *out_start = out;
+			const _uchar8bit *cur = begin;
+
+			// finish the character the last chunk ended in
+			while((decoder_pending_size > 0) && (cur < end))
+			{
+				if((*cur & 0xC0) != 0x80)
+				{
+					// cut short. The byte that cut it off is decoded with the rest of the chunk
+					out += WriteUnicodeCharacter((_char32bit)0xFFFD, out);
+					decoder_pending_size = 0;
+					break;
+				}
+
+				decoder_pending[decoder_pending_size++] = *cur++;
+
+				if(decoder_pending_size == sequencelength(decoder_pending[0]))
+				{
+					const _uchar8bit *pending = decoder_pending;
+					out += WriteUnicodeCharacter(DecodeUTF8Character(pending, decoder_pending + decoder_pending_size), out);
+					decoder_pending_size = 0;
+				}
+			}
+
+			if(cur == end) return (size_t)(out - out_start);
+
+			// keep a character that runs past the end for the next chunk
+			const _uchar8bit *tail = FindIncompleteUTF8Tail(cur, end);
+			out += DecodeUTF8(cur, tail, out, max_decoded_size((size_t)(end - begin)) - (size_t)(out - out_start));
+
+			decoder_pending_size = (size_t)(end - tail);
+			if(decoder_pending_size > 0) memcpy(decoder_pending, tail, decoder_pending_size);
+
+			return (size_t)(out - out_start);
+		}
+
+		/// \brief Ends the stream
+		/// A character that was cut off by the end of the stream is written as U+FFFD. out must have room for 1 code unit.
+		/// Returns the number of code units written. The decoder can be used for a new stream afterwards.
+		template <typename char_type>
+		size_t finish(char_type *out)
+		{
+			if(decoder_pending_size == 0) return 0;
+
+			decoder_pending_size = 0;
+			*out = (char_type)0xFFFD;
+
+			return 1;
+		}
+
+		// returns true if the last chunk ended in the middle of a character
+		bool pending() const
+		{
+			return decoder_pending_size > 0;
+		}
+
+		void reset()
+		{
+			decoder_pending_size = 0;
+		}
+};
+
+// checks UTF-8 that comes in chunks that can be split anywhere with the same rules as FindInvalidUTF8()
+// only the few bytes of a character that was cut off by the end of a chunk are copied. The rest is checked in place
+// with the SIMD validator
+class utf8_validator
+{
+	private:
+		_uchar8bit validator_pending[4];
+		size_t validator_pending_size;
+
+		// the stream position of the first pending byte
+		size_t validator_pending_pos;
+
+		// the number of bytes that have been passed in
+		size_t validator_total;
+
+		// the stream position of the first invalid sequence or -1 if there hasn't been one
+		size_t validator_error;
+
+		bool fail(size_t pos)
+		{
+			validator_error = pos;
+			validator_pending_size = 0;
+
+			return false;
+		}
+
+	public:
+		utf8_validator()
+			:validator_pending_size(0), validator_pending_pos(0), validator_total(0), validator_error((size_t)-1)
+		{
+		}
+
+		// checks the next chunk of the stream
+		// returns false once the stream has an invalid sequence. Chunks after that aren't checked
+		bool check(const _uchar8bit *begin, const _uchar8bit *end)
+		{
+			if(!valid()) return false;
+
+			size_t chunk_pos = validator_total;
+			validator_total += (size_t)(end - begin);
+
+			const _uchar8bit *cur = begin;
+
+			// finish the character the last chunk ended in
+			if(validator_pending_size > 0)
+			{
+				_uchar8bit lead = validator_pending[0];
+				size_t length = (lead < 0xE0) ? 2 : ((lead < 0xF0) ? 3 : 4);
+
+				while((validator_pending_size < length) && (cur < end) && ((*cur & 0xC0) == 0x80))
+				{
+					validator_pending[validator_pending_size++] = *cur++;
+				}
+
+				if(validator_pending_size < length)
+				{
+					// still waiting for the rest of it
+					if(cur == end) return true;
+
+					return fail(validator_pending_pos);
+				}
+
+				if(FindInvalidUTF8(validator_pending, validator_pending + validator_pending_size) != validator_pending_size)
+				{
+					return fail(validator_pending_pos);
+				}
+
+				validator_pending_size = 0;
+			}
+
+			const _uchar8bit *tail = FindIncompleteUTF8Tail(cur, end);
+
+			size_t valid_size = FindInvalidUTF8(cur, tail);
+			if(valid_size != (size_t)(tail - cur)) return fail(chunk_pos + (size_t)(cur - begin) + valid_size);
+
+			validator_pending_size = (size_t)(end - tail);
+			validator_pending_pos = chunk_pos + (size_t)(tail - begin);
+			if(validator_pending_size > 0) memcpy(validator_pending, tail, validator_pending_size);
+
+			return true;
+		}
+
+		// ends the stream. A character that was cut off by the end of the stream is invalid
+		// returns true if the whole stream was valid
+		bool finish()
+		{
+			if(valid() && (validator_pending_size > 0)) fail(validator_pending_pos);
+
+			return valid();
+		}
+
+		bool valid() const
+		{
+			return validator_error == (size_t)-1;
+		}
+
+		// returns the stream position of the first byte of the first invalid sequence
+		// or the number of bytes checked if there hasn't been one
+		size_t error_position() const
+		{
+			return valid() ? validator_total : validator_error;
+		}
+
+		void reset()
+		{
+			validator_pending_size = 0;
+			validator_pending_pos = 0;
+			validator_total = 0;
+			validator_error = (size_t)-1;
+		}
+};
+
+// encodes UTF-16 or UTF-32 that comes in chunks as UTF-8
+// a high surrogate at the end of a chunk is kept until the next chunk shows if it's half of a pair. Everything else
+// goes straight through EncodeUTF8(). The output is the same as EncodeUTF8() would give for all of the chunks put together
+template <typename char_type>
+class utf8_encoder
+{
+	private:
+		bool encoder_default_order;
+		bool encoder_has_pending;
+		_char32bit encoder_pending;
+
+		_char32bit unit(char_type c) const
+		{
+			return encoder_default_order ? (_char32bit)c : SwapByteOrder(c);
+		}
+
+	public:
+		// default_order should be false if the byte order of the stream doesn't match the system
+		explicit utf8_encoder(bool default_order = true)
+			:encoder_default_order(default_order), encoder_has_pending(false), encoder_pending(0)
+		{
+		}
+
+		// the most bytes encode() can write for a chunk of n code units
+		static size_t max_encoded_size(size_t n)
+		{
+			return (n + 1) * ((sizeof(char_type) == 2) ? 3 : 4);
+		}
+
+		/// \brief Encodes a chunk as UTF-8
+		/// out must have room for max_encoded_size(end - begin) bytes. Returns a pointer to just after the last byte written.
+		_uchar8bit *encode(const char_type *begin, const char_type *end, _uchar8bit *out)
+		{
+			const char_type *cur = begin;
+			if(cur == end) return out;
+
+			// finish the pair the last chunk ended in
+			if(encoder_has_pending)
+			{
+				_char32bit next = unit(*cur);
+
+				if(IsLowSurrogate(next))
+				{
+					out += WriteUTF8Character(0x10000 + ((encoder_pending - 0xD800) << 10) + (next - 0xDC00), out);
+					++cur;
+				}
+				else
+				{
+					out += WriteUTF8Character(encoder_pending, out);
+				}
+
+				encoder_has_pending = false;
+			}
+
+			// keep a high surrogate at the end for the next chunk
+			const char_type *safe_end = end;
+			if((cur < end) && IsHighSurrogate(unit(end[-1]))) --safe_end;
+
+			out = EncodeUTF8(cur, safe_end, out, encoder_default_order);
+
+			if(safe_end < end)
+			{
+				encoder_pending = unit(*safe_end);
+				encoder_has_pending = true;
+			}
+
+			return out;
+		}
+
+		/// \brief Ends the stream
+		/// A high surrogate at the very end is written by itself. out must have room for 3 bytes.
+		/// Returns a pointer to just after the last byte written.
+		_uchar8bit *finish(_uchar8bit *out)
+		{
+			if(encoder_has_pending)
+			{
+				out += WriteUTF8Character(encoder_pending, out);
+				encoder_has_pending = false;
+			}
+
+			return out;
+		}
+
+		bool pending() const
+		{
+			return encoder_has_pending;
+		}
+
+		bool default_order() const
+		{
+			return encoder_default_order;
+		}
+};
+
+// a stream buffer that reads UTF-16 or UTF-32 from another stream buffer and gives it out as UTF-8
+// put it in a std::istream to read a UTF-16 or UTF-32 stream as UTF-8 text. A byte order mark at the start is
+// used to set the byte order and skipped. Only UTF8STREAM_BUFFER_UNITS code units are held at a time
+// the source must outlive this stream buffer
+// unit_type is used instead of char_type because the base class's char_type (char) would hide it
+template <typename unit_type, class Traits = std::char_traits<unit_type>>
+class utf8_input_streambuf : public std::streambuf
+{
+	private:
+		std::basic_streambuf<unit_type, Traits> *input_source;
+		utf8_encoder<unit_type> input_encoder;
+		bool input_started;
+		bool input_finished;
+
+		unit_type input_units[UTF8STREAM_BUFFER_UNITS];
+		char input_bytes[(UTF8STREAM_BUFFER_UNITS + 1) * 4];
+
+		// can't be copied because the get area points into the buffers
+		utf8_input_streambuf(const utf8_input_streambuf &);
+		utf8_input_streambuf &operator=(const utf8_input_streambuf &);
+
+	protected:
+		virtual int_type underflow()
+		{
+			if(gptr() < egptr()) return traits_type::to_int_type(*gptr());
+
+			// a chunk can encode to nothing if it's only a high surrogate so keep reading until there are bytes
+			while(!input_finished)
+			{
+				std::streamsize n = input_source->sgetn(input_units, UTF8STREAM_BUFFER_UNITS);
+				const unit_type *begin = input_units;
+				const unit_type *end = input_units + ((n > 0) ? n : 0);
+
+				if(!input_started && (begin < end))
+				{
+					input_started = true;
+
+					bool default_order;
+					begin += ReadByteOrderMark(begin, (size_t)(end - begin), default_order);
+					input_encoder = utf8_encoder<unit_type>(default_order);
+				}
+
+				_uchar8bit *out = (_uchar8bit *)input_bytes;
+
+				if(n <= 0)
+				{
+					input_finished = true;
+					out = input_encoder.finish(out);
+				}
+				else
+				{
+					out = input_encoder.encode(begin, end, out);
+				}
+
+				if(out > (_uchar8bit *)input_bytes)
+				{
+					setg(input_bytes, input_bytes, (char *)out);
+					return traits_type::to_int_type(*gptr());
+				}
+			}
+
+			return traits_type::eof();
+		}
+
+	public:
+		explicit utf8_input_streambuf(std::basic_streambuf<unit_type, Traits> *source)
+			:input_source(source), input_started(false), input_finished(false)
+		{
+			setg(input_bytes, input_bytes, input_bytes);
+		}
+};
+
+// a stream buffer that takes UTF-16 or UTF-32 and writes it to another stream buffer as UTF-8
+// put it in a std::basic_ostream of char_type to write UTF-8 to a file or socket. Only UTF8STREAM_BUFFER_UNITS
+// code units are held at a time. pubsync() (std::flush) writes everything but a high surrogate whose other half
+// hasn't been written yet. finish() or the destructor writes that too
+// the sink must outlive this stream buffer
+template <typename char_type, class Traits = std::char_traits<char_type>>
+class utf8_output_streambuf : public std::basic_streambuf<char_type, Traits>
+{
+	public:
+		typedef typename std::basic_streambuf<char_type, Traits>::int_type int_type;
+		typedef Traits traits_type;
+
+	private:
+		std::streambuf *output_sink;
+		utf8_encoder<char_type> output_encoder;
+		bool output_failed;
+
+		char_type output_units[UTF8STREAM_BUFFER_UNITS];
+		char output_bytes[(UTF8STREAM_BUFFER_UNITS + 1) * 4];
+
+		// can't be copied because the put area points into the buffers
+		utf8_output_streambuf(const utf8_output_streambuf &);
+		utf8_output_streambuf &operator=(const utf8_output_streambuf &);
+
+		// sends bytes to the sink
+		bool write(const _uchar8bit *end)
+		{
+			std::streamsize n = (std::streamsize)((const char *)end - output_bytes);
+			if((n > 0) && (output_sink->sputn(output_bytes, n) != n)) output_failed = true;
+
+			return !output_failed;
+		}
+
+		// encodes the put area and sends it to the sink
+		bool flushunits()
+		{
+			_uchar8bit *out = output_encoder.encode(this->pbase(), this->pptr(), (_uchar8bit *)output_bytes);
+			this->setp(output_units, output_units + UTF8STREAM_BUFFER_UNITS);
+
+			return write(out);
+		}
+
+	protected:
+		virtual int_type overflow(int_type c)
+		{
+			if(!flushunits()) return traits_type::eof();
+
+			if(!traits_type::eq_int_type(c, traits_type::eof()))
+			{
+				*this->pptr() = traits_type::to_char_type(c);
+				this->pbump(1);
+			}
+
+			return traits_type::not_eof(c);
+		}
+
+		virtual int sync()
+		{
+			if(!flushunits()) return -1;
+
+			return output_sink->pubsync();
+		}
+
+	public:
+		explicit utf8_output_streambuf(std::streambuf *sink)
+			:output_sink(sink), output_failed(false)
+		{
+			this->setp(output_units, output_units + UTF8STREAM_BUFFER_UNITS);
+		}
+
+		~utf8_output_streambuf()
+		{
+			finish();
+		}
+
+		// writes everything including a high surrogate that is still waiting for its other half
+		// returns false if the sink couldn't take all of it
+		bool finish()
+		{
+			if(!flushunits()) return false;
+			if(!write(output_encoder.finish((_uchar8bit *)output_bytes))) return false;
+
+			return output_sink->pubsync() != -1;
+		}
+};
+
+}
+
+#endif
@@ -32,12 +32,698 @@
 #include <stdexcept>
 #include <iostream>
 #include <cstdint>
+#include <vector>
+#include <memory>
+#include <algorithm>
 
 #include "utf8utils.h"
+#include "utf8case.h"
+
+// number of characters between the checkpoints of the position index used by operator[], at(), find(), etc.
+// the index is off by default. Define this before including the header to turn it on for every string or
+// call set_index_interval() on the strings that need it
+#ifndef UTF8STRING_INDEX_INTERVAL
+#define UTF8STRING_INDEX_INTERVAL 0
+#endif
+
+// utf8string_view can be made from a std::string_view when compiling as C++17 or later
+#if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+#define UTF8STRING_HAS_STRING_VIEW
+#include <string_view>
+#endif
+
+// pmr::utf8string and pmr::utf8arena need the C++17 <memory_resource> header
+#if defined(UTF8STRING_HAS_STRING_VIEW) && defined(__has_include)
+#if __has_include(<memory_resource>)
+#define UTF8STRING_HAS_PMR
+#include <memory_resource>
+#endif
+#endif
 
 namespace sd_utf8
 {
 
+// thrown when input that is being checked isn't valid UTF-8
+class utf8_error : public std::invalid_argument
+{
+	private:
+		size_t error_pos;
+
+	public:
+		utf8_error(const char *message, size_t pos)
+			:std::invalid_argument(message), error_pos(pos)
+		{
+		}
+
+		// returns the position in the input buffer of the first invalid byte sequence
+		size_t position() const
+		{
+			return error_pos;
+		}
+};
+
+// pass validate_utf8 to a constructor or to assign() to have the input checked while it's copied
+struct validate_utf8_t
+{
+};
+
+static const validate_utf8_t validate_utf8 = validate_utf8_t();
+
+// declare our iterator
+// declare as template class so we don't have to write everything twice for the const_iterator
+// these are used by both _utf8string and utf8string_view
+template <class TBaseIterator>
+class value_reverse_iterator : public std::iterator<std::bidirectional_iterator_tag, _char32bit>
+{
+	public:
+		TBaseIterator forward_iterator;
+
+	public:
+		// copy constructor
+		value_reverse_iterator(const value_reverse_iterator &other)
+			:forward_iterator(other.forward_iterator)
+		{
+		}
+
+		// create from forward iterator
+		value_reverse_iterator(const TBaseIterator &iterator)
+			:forward_iterator(iterator)
+		{
+		}
+
+		_char32bit operator*() const
+		{
+			TBaseIterator temp = forward_iterator;
+			return *(--temp);
+		}
+
+		// does not check to see if it goes past the end
+		// iterating past the end is undefined
+		value_reverse_iterator &operator++()
+		{
+			--forward_iterator;
+
+			return *this;
+		}
+
+		// does not check to see if it goes past the end
+		// iterating past the end is undefined
+		value_reverse_iterator operator++(int)
+		{
+			value_reverse_iterator copy(*this);
+
+			// increment
+			--forward_iterator;
+
+			return copy;
+		}
+
+		// does not check to see if it goes past the end
+		// iterating past begin is undefined
+		value_reverse_iterator &operator--()
+		{
+			++forward_iterator;
+			return *this;
+		}
+
+		// does not check to see if it goes past the end
+		// iterating past begin is undefined
+		value_reverse_iterator operator--(int)
+		{
+			value_reverse_iterator copy(*this);
+
+			++forward_iterator;
+
+			return copy;
+		}
+
+		bool operator == ( const value_reverse_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return forward_iterator == other.forward_iterator;
+		}
+ 
+		bool operator != (const value_reverse_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return forward_iterator != other.forward_iterator;
+		}
+
+		bool operator < ( const value_reverse_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return forward_iterator > other.forward_iterator;
+		}
+ 
+		bool operator > (const value_reverse_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return forward_iterator < other.forward_iterator;
+		}
+
+		bool operator <= ( const value_reverse_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return forward_iterator >= other.forward_iterator;
+		}
+ 
+		bool operator >= (const value_reverse_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return forward_iterator <= other.forward_iterator;
+		}
+
+};
+
+template <class Ty>
+class utf8string_iterator : public std::iterator<std::bidirectional_iterator_tag, Ty>
+{
+	private:
+		const _uchar8bit *utf8string_buf;
+
+		void inc()
+		{
+			// increments the iterator by one
+			// result in undefined behavior (crashes) if already at the end 
+			IncToNextCharacter(utf8string_buf);
+		}
+
+		void dec()
+		{
+			// decrements the iterator by one
+			// result in undefined behavior (crashes) if already at the beginning
+			DecToNextCharacter(utf8string_buf);
+		}
+
+	public:
+		// b should be a null terminated string in UTF-8
+		// if this is the end start_pos should be the index of the null terminator
+		// start_pos should be the valid start of a character
+		utf8string_iterator(const _uchar8bit *b, size_t start_pos)
+			:utf8string_buf(b)
+		{
+			IncrementToPosition(utf8string_buf, start_pos);
+		}
+
+		// copy constructor
+		utf8string_iterator(const utf8string_iterator &other)
+			:utf8string_buf(other.utf8string_buf)
+		{
+		}
+
+		utf8string_iterator &operator=(const utf8string_iterator &other)
+		{
+			utf8string_buf = other.utf8string_buf;
+			return *this;
+		}
+
+		// b should already point to the correct position in the string
+		utf8string_iterator(const _uchar8bit *b)
+			:utf8string_buf(b)
+		{
+		}
+
+		_char32bit operator*() const
+		{
+			// returns the character currently being pointed to
+			return UTF8CharToUnicode(utf8string_buf);
+		}
+
+		// returns a pointer to the first byte of the character the iterator points to
+		const _uchar8bit *data() const
+		{
+			return utf8string_buf;
+		}
+
+		// does not check to see if it goes past the end
+		// iterating past the end is undefined
+		utf8string_iterator &operator++()
+		{
+			inc();
+
+			return *this;
+		}
+
+		// does not check to see if it goes past the end
+		// iterating past the end is undefined
+		utf8string_iterator operator++(int)
+		{
+			utf8string_iterator copy(*this);
+
+			// increment
+			inc();
+
+			return copy;
+		}
+
+		// does not check to see if it goes past the end
+		// iterating past begin is undefined
+		utf8string_iterator &operator--()
+		{
+			dec();
+			return *this;
+		}
+
+		// does not check to see if it goes past the end
+		// iterating past begin is undefined
+		utf8string_iterator operator--(int)
+		{
+			utf8string_iterator copy(*this);
+
+			dec();
+
+			return copy;
+		}
+
+		bool operator == ( const utf8string_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return utf8string_buf == other.utf8string_buf;
+		}
+ 
+		bool operator != (const utf8string_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return utf8string_buf != other.utf8string_buf;
+		}
+
+		bool operator < ( const utf8string_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return utf8string_buf < other.utf8string_buf;
+		}
+ 
+		bool operator > (const utf8string_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return utf8string_buf > other.utf8string_buf;
+		}
+
+		bool operator <= ( const utf8string_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return utf8string_buf <= other.utf8string_buf;
+		}
+ 
+		bool operator >= (const utf8string_iterator &other) const
+		{
+			// just compare pointers
+			// the programmer is responsible for making both iterators are for the same set of data
+			return utf8string_buf >= other.utf8string_buf;
+		}
+};
+
+// a read-only view of UTF-8 data owned by something else
+// it's a pointer and a length in bytes so it can be made from part of a buffer without copying
+// the data doesn't have to be null terminated and must outlive the view
+// positions and lengths are in characters like _utf8string
+class utf8string_view
+{
+	public:
+		typedef _char32bit			value_type;
+		typedef const _char32bit	*pointer;
+		typedef const _char32bit	*const_pointer;
+		typedef const _char32bit	&reference;
+		typedef const _char32bit	&const_reference;
+		typedef size_t				size_type;
+		typedef ptrdiff_t			difference_type;
+
+		// the data can't be changed through a view so all iterators are const
+		typedef utf8string_iterator<const value_type>	const_iterator;
+		typedef const_iterator							iterator;
+		typedef value_reverse_iterator<const_iterator>	const_reverse_iterator;
+		typedef const_reverse_iterator					reverse_iterator;
+
+	private:
+		const _uchar8bit *view_data;
+		size_type view_bytes;
+
+		// gets the position in the buffer of the character at pos
+		// returns the length of the buffer if pos is off the view
+		size_type bufferposition(size_type pos) const
+		{
+			const _uchar8bit *cur = view_data;
+			AdvanceUTF8Characters(cur, view_data + view_bytes, pos);
+
+			return (size_type)(cur - view_data);
+		}
+
+		// gets the character position from a position in the buffer
+		// npos stays npos
+		size_type charposition(size_type buffer_pos) const
+		{
+			if(buffer_pos == npos) return npos;
+
+			return CountUTF8Characters(view_data, view_data + buffer_pos);
+		}
+
+	public:
+		// default constructor. Makes an empty view
+		utf8string_view()
+			:view_data((const _uchar8bit *)""), view_bytes(0)
+		{
+		}
+
+		// view a c string
+		// undefined (ie crashes) if str is NULL
+		utf8string_view(const _char8bit *str)
+			:view_data((const _uchar8bit *)str), view_bytes(strlen(str))
+		{
+		}
+
+		// view the first n bytes of a buffer
+		utf8string_view(const _char8bit *str, size_type n)
+			:view_data((const _uchar8bit *)str), view_bytes(n)
+		{
+		}
+
+		// view a c string
+		// explicit so it doesn't compete with _utf8string's constructor in overloaded calls
+		explicit utf8string_view(const _uchar8bit *str)
+			:view_data(str), view_bytes(strlen((const char *)str))
+		{
+		}
+
+		// view the first n bytes of a buffer
+		utf8string_view(const _uchar8bit *str, size_type n)
+			:view_data(str), view_bytes(n)
+		{
+		}
+
+#if defined(UTF8STRING_HAS_STRING_VIEW)
+		// view the data of a std::string_view
+		utf8string_view(std::string_view str)
+			:view_data((const _uchar8bit *)str.data()), view_bytes(str.size())
+		{
+		}
+#endif
+
+		// capacity ------------------------------------------------------------
+
+		// returns the number of characters in the view
+		// the view doesn't store it so this counts the characters every time it's called
+		size_type size() const
+		{
+			return CountUTF8Characters(view_data, view_data + view_bytes);
+		}
+
+		// returns the number of characters in the view
+		// synonomous with size()
+		size_type length() const
+		{
+			return size();
+		}
+
+		// returns the number of bytes in the view
+		size_type size_bytes() const
+		{
+			return view_bytes;
+		}
+
+		// checks to see if the view is empty
+		bool empty() const
+		{
+			return view_bytes == 0;
+		}
+
+		// returns a pointer to the first byte of the view
+		// the data isn't null terminated unless the view was made from a whole c string
+		const _uchar8bit *data() const
+		{
+			return view_data;
+		}
+
+		// decodes up to max_chars characters starting at pos into out and moves pos to where the next block starts
+		// returns the number of characters written. It's less than max_chars only when pos reaches end()
+		size_type decode_block (const_iterator &pos, _char32bit *out, size_type max_chars) const
+		{
+			const _uchar8bit *cur = pos.data();
+			size_type count = DecodeUTF8Block(cur, view_data + view_bytes, out, max_chars);
+
+			pos = const_iterator(cur);
+
+			return count;
+		}
+
+		// decodes up to max_chars characters that come before pos into out and moves pos back over them
+		// out[0] is the character just before pos
+		size_type decode_block_reverse (const_iterator &pos, _char32bit *out, size_type max_chars) const
+		{
+			const _uchar8bit *cur = pos.data();
+			size_type count = DecodeUTF8BlockReverse(view_data, cur, out, max_chars);
+
+			pos = const_iterator(cur);
+
+			return count;
+		}
+
+		// iterators ----------------------------------------------------------------------
+
+		const_iterator cbegin() const
+		{
+			return const_iterator(view_data);
+		}
+
+		const_iterator begin() const
+		{
+			return cbegin();
+		}
+
+		const_iterator cend() const
+		{
+			return const_iterator(view_data + view_bytes);
+		}
+
+		const_iterator end() const
+		{
+			return cend();
+		}
+
+		const_reverse_iterator crbegin() const
+		{
+			return const_reverse_iterator(cend());
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return crbegin();
+		}
+
+		const_reverse_iterator crend() const
+		{
+			return const_reverse_iterator(cbegin());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return crend();
+		}
+
+		// access -------------------------------------------------------------------------------------
+
+		// returns the character at pos
+		// doesn't throw exception. undefined if out of range
+		value_type operator[](size_type pos) const
+		{
+			return UTF8CharToUnicode(view_data + bufferposition(pos));
+		}
+
+		// returns the character at pos
+		// will throw an exception if out of range
+		value_type at(size_type pos) const
+		{
+			const _uchar8bit *cur = view_data;
+			const _uchar8bit *finish = view_data + view_bytes;
+
+			if((AdvanceUTF8Characters(cur, finish, pos) < pos) || (cur == finish))
+			{
+				throw std::out_of_range("subscript out of range");
+			}
+
+			return UTF8CharToUnicode(cur);
+		}
+
+		// undefined behavior on empty views
+		value_type front() const
+		{
+			return UTF8CharToUnicode(view_data);
+		}
+
+		// undefined behavior on empty views
+		value_type back() const
+		{
+			const _uchar8bit *last = view_data + view_bytes;
+			DecToNextCharacter(last);
+
+			return UTF8CharToUnicode(last);
+		}
+
+		// string operations -----------------------------------------------------------------------------
+
+		// returns a view of part of this view. Nothing is copied
+		utf8string_view substr(size_type pos = 0, size_type len = npos) const
+		{
+			const _uchar8bit *start = view_data;
+			const _uchar8bit *finish = view_data + view_bytes;
+
+			if(AdvanceUTF8Characters(start, finish, pos) < pos)
+			{
+				throw std::out_of_range("pos out of range");
+			}
+
+			const _uchar8bit *stop = finish;
+			if(len != npos)
+			{
+				stop = start;
+				AdvanceUTF8Characters(stop, finish, len);
+			}
+
+			return utf8string_view(start, (size_type)(stop - start));
+		}
+
+		size_type find(utf8string_view str, size_type pos = 0) const
+		{
+			const _uchar8bit *start = view_data;
+			const _uchar8bit *finish = view_data + view_bytes;
+
+			size_type start_pos = AdvanceUTF8Characters(start, finish, pos);
+			if(start_pos < pos) return npos;
+
+			size_type found_pos = FindUTF8Bytes(start, finish, str.view_data, str.view_data + str.view_bytes);
+			if(found_pos == npos) return npos;
+
+			// only count the characters between the start of the search and the match
+			return start_pos + CountUTF8Characters(start, start + found_pos);
+		}
+
+		// finds the last match that starts at or before pos
+		size_type rfind(utf8string_view str, size_type pos = npos) const
+		{
+			// the match can end past pos
+			size_type end_pos = bufferposition(pos) + str.view_bytes;
+			if(end_pos > view_bytes) end_pos = view_bytes;
+
+			return charposition(FindLastUTF8Bytes(view_data, view_data + end_pos, str.view_data, str.view_data + str.view_bytes));
+		}
+
+		size_type find_first_of(utf8string_view str, size_type pos = 0) const
+		{
+			return findfirstof(str, pos, true);
+		}
+
+		size_type find_last_of(utf8string_view str, size_type pos = npos) const
+		{
+			return findlastof(str, pos, true);
+		}
+
+		size_type find_first_not_of(utf8string_view str, size_type pos = 0) const
+		{
+			return findfirstof(str, pos, false);
+		}
+
+		size_type find_last_not_of(utf8string_view str, size_type pos = npos) const
+		{
+			return findlastof(str, pos, false);
+		}
+
+		// compares the views character by character
+		// returns 0 if they're equal, < 0 if this view comes first and > 0 if str comes first
+		// comparing the bytes gives the same order as comparing the characters for UTF-8
+		int compare(utf8string_view str) const
+		{
+			size_type common = (view_bytes < str.view_bytes) ? view_bytes : str.view_bytes;
+
+			int result = (common > 0) ? memcmp(view_data, str.view_data, common) : 0;
+			if(result != 0) return result;
+
+			if(view_bytes < str.view_bytes) return -1;
+			return (view_bytes > str.view_bytes) ? 1 : 0;
+		}
+
+		// returns a hash of the bytes in the view
+		// views with the same characters have the same hash
+		size_t hash() const
+		{
+			return GetUTF8Hash(view_data, view_data + view_bytes);
+		}
+
+		// comparison operators ---------------------------------------------------------------------------
+		bool operator == (utf8string_view other) const
+		{
+			return (view_bytes == other.view_bytes) && (compare(other) == 0);
+		}
+
+		bool operator != (utf8string_view other) const
+		{
+			return !(*this == other);
+		}
+
+		bool operator < (utf8string_view other) const
+		{
+			return compare(other) < 0;
+		}
+
+		bool operator > (utf8string_view other) const
+		{
+			return compare(other) > 0;
+		}
+
+		bool operator <= (utf8string_view other) const
+		{
+			return compare(other) <= 0;
+		}
+
+		bool operator >= (utf8string_view other) const
+		{
+			return compare(other) >= 0;
+		}
+
+		static const size_type npos = -1;
+
+	private:
+		// shared by find_first_of() and find_first_not_of()
+		size_type findfirstof(utf8string_view str, size_type pos, bool in_set) const
+		{
+			const _uchar8bit *start = view_data;
+			const _uchar8bit *finish = view_data + view_bytes;
+
+			size_type start_pos = AdvanceUTF8Characters(start, finish, pos);
+
+			size_type found_pos = FindFirstOfUTF8(start, finish, UTF8CharacterSet(str.view_data, str.view_data + str.view_bytes), in_set);
+			if(found_pos == npos) return npos;
+
+			return start_pos + CountUTF8Characters(start, start + found_pos);
+		}
+
+		// shared by find_last_of() and find_last_not_of()
+		size_type findlastof(utf8string_view str, size_type pos, bool in_set) const
+		{
+			// search up to and including the character at pos
+			size_type end_pos = (pos == npos) ? view_bytes : bufferposition(pos + 1);
+
+			return charposition(FindLastOfUTF8(view_data, view_data + end_pos, UTF8CharacterSet(str.view_data, str.view_data + str.view_bytes), in_set));
+		}
+};
+
+// write a view to a stream
+inline std::ostream& operator<<(std::ostream& os, utf8string_view view)
+{
+	os.write((const char *)view.data(), (std::streamsize)view.size_bytes());
+
+	return os;
+}
+
 template <class Alloc = std::allocator<_uchar8bit>>
 class _utf8string
 {
@@ -52,258 +738,260 @@ class _utf8string
 		typedef size_t				size_type;
 		typedef ptrdiff_t			difference_type;
 
-		// declare our iterator
-		// declare as template class so we don't have to write everything twice for the const_iterator
-		template <class TBaseIterator>
-		class value_reverse_iterator : public std::iterator<std::bidirectional_iterator_tag, value_type>
+		// make our iterator types here
+		typedef utf8string_iterator<value_type>			iterator;
+		typedef utf8string_iterator<const value_type>	const_iterator;
+		typedef value_reverse_iterator<iterator>		reverse_iterator;
+		typedef value_reverse_iterator<const_iterator>	const_reverse_iterator;
+
+	private:
+		typedef std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> buffer_type;
+		buffer_type utfstring_data;
+
+		// the number of characters in utfstring_data
+		// every modifier keeps this up to date so size() doesn't have to scan the buffer
+		size_type utfstring_length;
+
+		// sparse index of the buffer
+		// utfstring_index[i] is the buffer position of character (i + 1) * utfstring_indexstep
+		// it's built lazily and only ever covers a prefix of the string, so appending leaves it valid and
+		// changes in the middle of the string only drop the checkpoints after the change
+		// because it's built from const methods, a string with the index turned on shouldn't be read
+		// from more than one thread at a time
+		typedef std::vector<size_type, typename std::allocator_traits<Alloc>::template rebind_alloc<size_type>> position_index;
+		typedef typename position_index::allocator_type index_allocator;
+		mutable position_index utfstring_index;
+		size_type utfstring_indexstep;
+
+		// recounts the characters in the buffer
+		// used after operations where the number of characters added can't be known in advance
+		void updatelength()
 		{
-			public:
-				TBaseIterator forward_iterator;
+			utfstring_length = CountUTF8Characters(utfstring_data.c_str(), utfstring_data.c_str() + utfstring_data.length());
+			utfstring_index.clear();
+		}
 
-			public:
-				// copy constructor
-				value_reverse_iterator(const value_reverse_iterator &other)
-					:forward_iterator(other.forward_iterator)
-				{
-				}
+		// copies n bytes from str into the buffer while checking that they are valid UTF-8
+		// throws utf8_error if they aren't. The string isn't changed if an exception is thrown
+		void assignvalidated(const _uchar8bit *str, size_type n)
+		{
+			buffer_type temp(n, 0, utfstring_data.get_allocator());
 
-				// create from forward iterator
-				value_reverse_iterator(const TBaseIterator &iterator)
-					:forward_iterator(iterator)
-				{
-					int a;
-					a = 5;
-				}
+			size_type valid_size = (n > 0) ? CopyValidUTF8(str, str + n, &temp[0]) : 0;
+			if(valid_size != n)
+			{
+				throw utf8_error("invalid UTF-8 sequence", valid_size);
+			}
 
-				value_type operator*() const
-				{
-					TBaseIterator temp = forward_iterator;
-					return *(--temp);
-				}
+			utfstring_data.swap(temp);
+			updatelength();
+		}
+
+		// case maps the buffer
+		// the buffer is changed in place until a character's mapping needs a different number of bytes. The rest is
+		// mapped into a new buffer that's the right size
+		void mapcase(utf8case_mapping mapping)
+		{
+			if(utfstring_data.empty()) return;
+
+			_uchar8bit *begin = &utfstring_data[0];
+			_uchar8bit *end = begin + utfstring_data.length();
+			_uchar8bit *stop = MapUTF8CaseInPlace(begin, end, mapping);
+
+			if(stop != end)
+			{
+				size_type done = (size_type)(stop - begin);
+
+				buffer_type out(done + GetUTF8CaseMappedSize(stop, end, mapping), 0, utfstring_data.get_allocator());
+				memcpy(&out[0], begin, done);
+				MapUTF8Case(stop, end, &out[done], mapping);
+
+				utfstring_data.swap(out);
+			}
+
+			// the number of characters can change even in place. "ß" and "ss" are both 2 bytes
+			updatelength();
+		}
+
+		// drops all checkpoints for characters after pos
+		// must be called by any modifier that changes the string before its end
+		void truncateindex(size_type pos)
+		{
+			if(utfstring_indexstep == 0) return;
+
+			size_type keep = pos / utfstring_indexstep;
+			if(keep < utfstring_index.size()) utfstring_index.resize(keep);
+		}
+
+		// adds checkpoints to the index until it reaches the character at pos
+		// pos must not be greater than the number of characters in the string
+		void extendindex(size_type pos) const
+		{
+			size_type needed = pos / utfstring_indexstep;
+			if(utfstring_index.size() >= needed) return;
+
+			if(utfstring_index.empty()) utfstring_index.reserve(utfstring_length / utfstring_indexstep);
 
-				// does not check to see if it goes past the end
-				// iterating past the end is undefined
-				value_reverse_iterator &operator++()
-				{
-					--forward_iterator;
+			const _uchar8bit *start = utfstring_data.c_str();
+			const _uchar8bit *cur = start + (utfstring_index.empty() ? 0 : utfstring_index.back());
 
-					return *this;
-				}
+			while(utfstring_index.size() < needed)
+			{
+				AdvanceUTF8Characters(cur, start + utfstring_data.length(), utfstring_indexstep);
+				utfstring_index.push_back((size_type)(cur - start));
+			}
+		}
 
-				// does not check to see if it goes past the end
-				// iterating past the end is undefined
-				value_reverse_iterator operator++(int)
-				{
-					value_reverse_iterator copy(*this);
+		// gets the position in the buffer of the character at pos
+		// returns the length of the buffer if pos is off the string
+		size_type bufferposition(size_type pos) const
+		{
+			if(pos >= utfstring_length) return utfstring_data.length();
 
-					// increment
-					--forward_iterator;
+			// one byte per character
+			if(is_ascii()) return pos;
 
-					return copy;
-				}
+			const _uchar8bit *begin = utfstring_data.c_str();
+			const _uchar8bit *cur = begin;
 
-				// does not check to see if it goes past the end
-				// iterating past begin is undefined
-				value_reverse_iterator &operator--()
-				{
-					++forward_iterator;
-					return *this;
-				}
+			if((utfstring_indexstep != 0) && (pos >= utfstring_indexstep))
+			{
+				extendindex(pos);
 
-				// does not check to see if it goes past the end
-				// iterating past begin is undefined
-				value_reverse_iterator operator--(int)
-				{
-					value_reverse_iterator copy(*this);
+				// start from the closest checkpoint before pos
+				size_type checkpoint = pos / utfstring_indexstep;
+				cur += utfstring_index[checkpoint - 1];
+				pos -= checkpoint * utfstring_indexstep;
+			}
 
-					++forward_iterator;
+			AdvanceUTF8Characters(cur, begin + utfstring_data.length(), pos);
 
-					return copy;
-				}
+			return (size_type)(cur - begin);
+		}
 
-				bool operator == ( const value_reverse_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return forward_iterator == other.forward_iterator;
-				}
- 
-				bool operator != (const value_reverse_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return forward_iterator != other.forward_iterator;
-				}
+		// finds the buffer positions of the characters at pos and pos + len with one scan
+		// len is cut down to the number of characters left after pos
+		// pos must not be greater than the number of characters in the string
+		void bufferrange(size_type pos, size_type &len, size_type &start, size_type &finish) const
+		{
+			start = bufferposition(pos);
 
-				bool operator < ( const value_reverse_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return forward_iterator > other.forward_iterator;
-				}
- 
-				bool operator > (const value_reverse_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return forward_iterator < other.forward_iterator;
-				}
-		
-				bool operator <= ( const value_reverse_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return forward_iterator >= other.forward_iterator;
-				}
- 
-				bool operator >= (const value_reverse_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return forward_iterator <= other.forward_iterator;
-				}
+			if((len == npos) || (len >= utfstring_length - pos))
+			{
+				len = utfstring_length - pos;
+				finish = utfstring_data.length();
+			}
+			else if(is_ascii())
+			{
+				finish = start + len;
+			}
+			else if((utfstring_indexstep != 0) && (len > utfstring_indexstep))
+			{
+				// quicker to go through the index than to step over all the characters
+				finish = bufferposition(pos + len);
+			}
+			else
+			{
+				// keep going from start
+				const _uchar8bit *cur = utfstring_data.c_str() + start;
+				AdvanceUTF8Characters(cur, utfstring_data.c_str() + utfstring_data.length(), len);
 
-		};
+				finish = (size_type)(cur - utfstring_data.c_str());
+			}
+		}
 
-		template <class Ty>
-		class utf8string_iterator : public std::iterator<std::bidirectional_iterator_tag, Ty>
+		// gets the character position from a position in the buffer
+		// npos stays npos so the result of a std::basic_string search can be passed in directly
+		size_type charposition(size_type buffer_pos) const
 		{
-			private:
-				const _uchar8bit *utf8string_buf;
+			if(buffer_pos == std::string::npos) return npos;
 
-				void inc()
-				{
-					// increments the iterator by one
-					// result in undefined behavior (crashes) if already at the end 
-					IncToNextCharacter(utf8string_buf);
-				}
+			// one byte per character
+			if(is_ascii()) return buffer_pos;
 
-				void dec()
-				{
-					// decrements the iterator by one
-					// result in undefined behavior (crashes) if already at the beginning
-					DecToNextCharacter(utf8string_buf);
-				}
+			if((utfstring_indexstep == 0) || (utfstring_length < utfstring_indexstep))
+			{
+				return GetCharPosFromBufferPosition(utfstring_data.c_str(), buffer_pos);
+			}
 
-			public:
-				// b should be a null terminated string in UTF-8
-				// if this is the end start_pos should be the index of the null terminator
-				// start_pos should be the valid start of a character
-				utf8string_iterator(const _uchar8bit *b, size_type start_pos)
-					:utf8string_buf(b)
-				{
-					IncrementToPosition(utf8string_buf, start_pos);
-				}
+			extendindex(utfstring_length);
 
-				// copy constructor
-				utf8string_iterator(const utf8string_iterator &other)
-					:utf8string_buf(other.utf8string_buf)
-				{
-				}
+			// find the last checkpoint at or before buffer_pos
+			size_type checkpoint = std::upper_bound(utfstring_index.begin(), utfstring_index.end(), buffer_pos) - utfstring_index.begin();
+			size_type start = checkpoint ? utfstring_index[checkpoint - 1] : 0;
 
-				// b should already point to the correct position in the string
-				utf8string_iterator(const _uchar8bit *b)
-					:utf8string_buf(b)
-				{
-				}
+			return checkpoint * utfstring_indexstep + GetCharPosFromBufferPosition(utfstring_data.c_str() + start, buffer_pos - start);
+		}
 
-				value_type operator*() const
-				{
-					// returns the character currently being pointed to
-					return UTF8CharToUnicode(utf8string_buf);
-				}
+		// the number of characters between two positions in the buffer
+		// used to turn a search result into a character position by counting only the part that was searched
+		size_type charsbetween(size_type start, size_type finish) const
+		{
+			if(is_ascii()) return finish - start;
 
-				// does not check to see if it goes past the end
-				// iterating past the end is undefined
-				utf8string_iterator &operator++()
-				{
-					inc();
+			return CountUTF8Characters(utfstring_data.c_str() + start, utfstring_data.c_str() + finish);
+		}
 
-					return *this;
-				}
+		// shared by find_first_of() and find_first_not_of()
+		size_type findfirstof(utf8string_view str, size_type pos, bool in_set) const
+		{
+			if(pos >= utfstring_length) return npos;
 
-				// does not check to see if it goes past the end
-				// iterating past the end is undefined
-				utf8string_iterator operator++(int)
-				{
-					utf8string_iterator copy(*this);
+			const _uchar8bit *start = utfstring_data.c_str();
+			size_type real_pos = bufferposition(pos);
 
-					// increment
-					inc();
+			size_type found_pos = FindFirstOfUTF8(start + real_pos, start + utfstring_data.length(), UTF8CharacterSet(str.data(), str.data() + str.size_bytes()), in_set);
+			if(found_pos == npos) return npos;
 
-					return copy;
-				}
+			return pos + charsbetween(real_pos, real_pos + found_pos);
+		}
 
-				// does not check to see if it goes past the end
-				// iterating past begin is undefined
-				utf8string_iterator &operator--()
-				{
-					dec();
-					return *this;
-				}
+		// the iterator version of findfirstof()
+		const_iterator findfirstof(utf8string_view str, const_iterator first, bool in_set) const
+		{
+			const _uchar8bit *finish = utfstring_data.c_str() + utfstring_data.length();
 
-				// does not check to see if it goes past the end
-				// iterating past begin is undefined
-				utf8string_iterator operator--(int)
-				{
-					utf8string_iterator copy(*this);
+			size_type found_pos = FindFirstOfUTF8(first.data(), finish, UTF8CharacterSet(str.data(), str.data() + str.size_bytes()), in_set);
 
-					dec();
+			return const_iterator((found_pos == npos) ? finish : first.data() + found_pos);
+		}
 
-					return copy;
-				}
+		// shared by find_last_of() and find_last_not_of()
+		size_type findlastof(utf8string_view str, size_type pos, bool in_set) const
+		{
+			const _uchar8bit *start = utfstring_data.c_str();
 
-				bool operator == ( const utf8string_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return utf8string_buf == other.utf8string_buf;
-				}
- 
-				bool operator != (const utf8string_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return utf8string_buf != other.utf8string_buf;
-				}
+			// search up to and including the character at pos
+			size_type end_pos = (pos >= utfstring_length) ? utfstring_length : pos + 1;
+			size_type real_end = bufferposition(end_pos);
 
-				bool operator < ( const utf8string_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return utf8string_buf < other.utf8string_buf;
-				}
- 
-				bool operator > (const utf8string_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return utf8string_buf > other.utf8string_buf;
-				}
-		
-				bool operator <= ( const utf8string_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return utf8string_buf <= other.utf8string_buf;
-				}
- 
-				bool operator >= (const utf8string_iterator &other) const
-				{
-					// just compare pointers
-					// the programmer is responsible for making both iterators are for the same set of data
-					return utf8string_buf >= other.utf8string_buf;
-				}
-		};
+			size_type found_pos = FindLastOfUTF8(start, start + real_end, UTF8CharacterSet(str.data(), str.data() + str.size_bytes()), in_set);
+			if(found_pos == npos) return npos;
 
-		// make our iterator types here
-		typedef utf8string_iterator<value_type>			iterator;
-		typedef utf8string_iterator<const value_type>	const_iterator;
-		typedef value_reverse_iterator<iterator>		reverse_iterator;
-		typedef value_reverse_iterator<const_iterator>	const_reverse_iterator;
+			// count back from the end of the search
+			return end_pos - charsbetween(found_pos, real_end);
+		}
 
-	private:
-		std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> utfstring_data;
+		// replaces len characters starting at pos with str_chars characters from the buffer str
+		// basic_string::replace() does the work in place, keeps the string as it was if it throws
+		// and handles str pointing into this string
+		_utf8string<Alloc>& replacebytes(size_type pos, size_type len, const _uchar8bit *str, size_type n, size_type str_chars)
+		{
+			if(pos > utfstring_length)
+			{
+				throw std::out_of_range("pos out of range");
+			}
+
+			// find both ends with one scan
+			size_type start, finish;
+			bufferrange(pos, len, start, finish);
+
+			utfstring_data.replace(start, finish - start, str, n);
+			utfstring_length = utfstring_length - len + str_chars;
+			truncateindex(pos);
+
+			return *this;
+		}
 
 		// No longer needed. std::basic_string will take care of this for us
 		// void growbuffer(size_type new_size, bool copy_data = true);
@@ -312,26 +1000,37 @@ class _utf8string
 
 	public:
 		// default constructor
-		_utf8string<Alloc>()
+		_utf8string()
+		:utfstring_length(0), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
+		{
+		}
+
+		// makes an empty string that gets its memory from alloc
+		// every constructor takes an allocator as its last argument so strings can be built in an arena
+		explicit _utf8string(const Alloc &alloc)
+		:utfstring_data(alloc), utfstring_length(0), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
 		}
 
 		// build from a c string
 		// undefined (ie crashes) if str is NULL
-		_utf8string<Alloc>(const _char8bit *str)
-		:utfstring_data((const _uchar8bit *)str)
+		_utf8string(const _char8bit *str, const Alloc &alloc = Alloc())
+		:utfstring_data((const _uchar8bit *)str, alloc), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
+			updatelength();
 		}
 
 		// build from a c string
 		// undefined (ie crashes) if str is NULL
-		_utf8string<Alloc>(const _uchar8bit *str)
-		:utfstring_data(str)
+		_utf8string(const _uchar8bit *str, const Alloc &alloc = Alloc())
+		:utfstring_data(str, alloc), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
+			updatelength();
 		}
 
 		// construct from an unsigned char
-		_utf8string<Alloc>(size_t n, _char32bit c)
+		_utf8string(size_t n, _char32bit c, const Alloc &alloc = Alloc())
+		:utfstring_data(alloc), utfstring_length(n), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
 			utf8_encoding encoding;
 			size_t encoding_size;
@@ -350,19 +1049,20 @@ class _utf8string
 		}
 
 		// construct from a normal char
-		_utf8string<Alloc>(_uchar8bit c)
-		:utfstring_data(1, c)
+		_utf8string(_uchar8bit c, const Alloc &alloc = Alloc())
+		:utfstring_data(1, c, alloc), utfstring_length(1), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
 		}
 
 		// construct from a normal char
-		_utf8string<Alloc>(_char8bit c)
-		:utfstring_data(1, (_uchar8bit)c)
+		_utf8string(_char8bit c, const Alloc &alloc = Alloc())
+		:utfstring_data(1, (_uchar8bit)c, alloc), utfstring_length(1), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
 		}
 
 		// construct from a normal char
-		_utf8string<Alloc>(_char16bit c)
+		_utf8string(_char16bit c, const Alloc &alloc = Alloc())
+		:utfstring_data(alloc), utfstring_length(1), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
 			utf8_encoding encoding;
 			size_t encoding_size;
@@ -376,7 +1076,8 @@ class _utf8string
 		}
 
 		// construct from a normal char
-		_utf8string<Alloc>(_char32bit c)
+		_utf8string(_char32bit c, const Alloc &alloc = Alloc())
+		:utfstring_data(alloc), utfstring_length(1), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
 			utf8_encoding encoding;
 			size_t encoding_size;
@@ -390,37 +1091,109 @@ class _utf8string
 		}
 
 		// copy constructor
-		_utf8string<Alloc>(const _utf8string<Alloc> &str)
-		:utfstring_data(str.utfstring_data)
+		// the allocator is chosen the way std::basic_string chooses it, so a std::pmr string copy uses the default resource
+		_utf8string(const _utf8string<Alloc> &str)
+		:utfstring_data(str.utfstring_data), utfstring_length(str.utfstring_length),
+		 utfstring_index(index_allocator(utfstring_data.get_allocator())), utfstring_indexstep(str.utfstring_indexstep)
+		{
+		}
+
+		// copy constructor that gets its memory from alloc
+		_utf8string(const _utf8string<Alloc> &str, const Alloc &alloc)
+		:utfstring_data(str.utfstring_data, alloc), utfstring_length(str.utfstring_length),
+		 utfstring_index(index_allocator(alloc)), utfstring_indexstep(str.utfstring_indexstep)
+		{
+		}
+
+		// move constructor
+		// takes the buffer and the position index and leaves str empty
+		_utf8string(_utf8string<Alloc> &&str)
+		:utfstring_data(std::move(str.utfstring_data)), utfstring_length(str.utfstring_length),
+		 utfstring_index(std::move(str.utfstring_index)), utfstring_indexstep(str.utfstring_indexstep)
+		{
+			// leave the old string empty so its length stays in sync with its buffer
+			str.utfstring_data.clear();
+			str.utfstring_length = 0;
+			str.utfstring_index.clear();
+		}
+
+		// move constructor that gets its memory from alloc
+		// the buffer is only taken if alloc is equal to str's allocator, otherwise it's copied
+		_utf8string(_utf8string<Alloc> &&str, const Alloc &alloc)
+		:utfstring_data(std::move(str.utfstring_data), alloc), utfstring_length(str.utfstring_length),
+		 utfstring_index(index_allocator(alloc)), utfstring_indexstep(str.utfstring_indexstep)
 		{
+			str.utfstring_data.clear();
+			str.utfstring_length = 0;
+			str.utfstring_index.clear();
 		}
 
 		/// \brief Constructs a UTF-8 string from an 16 bit character terminated string
-		_utf8string<Alloc> (const _char16bit* instring_UCS2)
+		_utf8string(const _char16bit* instring_UCS2, const Alloc &alloc = Alloc())
+		:utfstring_data(alloc), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
 			MakeUTF8StringImpl(instring_UCS2, utfstring_data, true);
+			updatelength();
 		}
 
 		/// \brief Constructs a UTF-8 string from an 32 bit character terminated string
-		_utf8string<Alloc> (const _char32bit* instring_UCS4)
+		_utf8string(const _char32bit* instring_UCS4, const Alloc &alloc = Alloc())
+		:utfstring_data(alloc), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
 			MakeUTF8StringImpl(instring_UCS4, utfstring_data, true);
+			updatelength();
 		}
 
 		/// \brief copy constructor from basic std::string
-		_utf8string<Alloc>(const std::string &instring)
-			:utfstring_data((const unsigned char *)instring.c_str())
+		_utf8string(const std::string &instring, const Alloc &alloc = Alloc())
+			:utfstring_data((const unsigned char *)instring.c_str(), alloc), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
+		{
+			updatelength();
+		}
+
+		// build from a c string, checking that it is valid UTF-8
+		// throws utf8_error if it isn't
+		_utf8string(const _char8bit *str, validate_utf8_t, const Alloc &alloc = Alloc())
+		:utfstring_data(alloc), utfstring_length(0), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
+		{
+			assignvalidated((const _uchar8bit *)str, strlen(str));
+		}
+
+		// build from the first n bytes of a buffer, checking that they are valid UTF-8
+		// the buffer doesn't have to be null terminated
+		// throws utf8_error if it isn't valid
+		_utf8string(const _char8bit *str, size_type n, validate_utf8_t, const Alloc &alloc = Alloc())
+		:utfstring_data(alloc), utfstring_length(0), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
+			assignvalidated((const _uchar8bit *)str, n);
+		}
+
+		/// \brief copy constructor from basic std::string, checking that it is valid UTF-8
+		/// throws utf8_error if it isn't
+		_utf8string(const std::string &instring, validate_utf8_t, const Alloc &alloc = Alloc())
+		:utfstring_data(alloc), utfstring_length(0), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
+		{
+			assignvalidated((const _uchar8bit *)instring.data(), instring.length());
 		}
 
 		/// \brief copy constructor from basic std::string
-		_utf8string<Alloc>(const std::wstring &instring)
+		_utf8string(const std::wstring &instring, const Alloc &alloc = Alloc())
+		:utfstring_data(alloc), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
+		{
+			MakeUTF8StringImpl(instring.data(), instring.length(), utfstring_data, true);
+			updatelength();
+		}
+
+		// copy the data of a view
+		// explicit because a view can also be made from a c string and overloaded calls would be ambiguous
+		explicit _utf8string(utf8string_view str, const Alloc &alloc = Alloc())
+			:utfstring_data(str.data(), str.size_bytes(), alloc), utfstring_index(index_allocator(alloc)), utfstring_indexstep(UTF8STRING_INDEX_INTERVAL)
 		{
-			MakeUTF8StringImpl(instring.c_str(), utfstring_data, true);
+			updatelength();
 		}
 
 		// destructor
-		~_utf8string<Alloc>()
+		~_utf8string()
 		{
 		}
 
@@ -434,6 +1207,8 @@ class _utf8string
 		_utf8string<Alloc>& operator= (const _utf8string<Alloc> &rvalue)
 		{
 			utfstring_data = rvalue.utfstring_data;
+			utfstring_length = rvalue.utfstring_length;
+			utfstring_index.clear();
 
 			return *this;
 		}
@@ -443,10 +1218,29 @@ class _utf8string
 		_utf8string<Alloc>& operator= (_utf8string<Alloc> &&rvalue)
 		{
 			utfstring_data = std::move(rvalue.utfstring_data);
+			utfstring_length = rvalue.utfstring_length;
+			utfstring_index.clear();
+
+			// leave the old string empty so its length stays in sync with its buffer
+			rvalue.utfstring_data.clear();
+			rvalue.utfstring_length = 0;
+			rvalue.utfstring_index.clear();
 
 			return *this;
 		}
 
+		// assign from a c string without building a temporary _utf8string
+		_utf8string<Alloc>& operator= (const _char8bit *str)
+		{
+			return assign(str);
+		}
+
+		// assign from a view without building a temporary _utf8string
+		_utf8string<Alloc>& operator= (utf8string_view str)
+		{
+			return assign(str);
+		}
+
 		// capacity ------------------------------------------------------------
 		// request a new buffer size
 		// this will resize the buffer, but it will not shrink the buffer is new_size < reserve_size
@@ -460,7 +1254,7 @@ class _utf8string
 		// synonomous with length()
 		size_type size() const
 		{
-			return GetNumCharactersInUTF8String(utfstring_data.c_str());
+			return utfstring_length;
 		}
 
 		// returns the size of the string in characters
@@ -470,6 +1264,15 @@ class _utf8string
 			return size();
 		}
 
+		// returns true if every character in the string is ASCII
+		// character positions are the same as buffer positions for these strings so operator[], find(), etc.
+		// don't have to scan the buffer
+		bool is_ascii() const
+		{
+			// every character takes one byte only if they're all ASCII
+			return utfstring_length == utfstring_data.length();
+		}
+
 		// resizes the length of the string, padding the string with c
 		// if the size is greater than the current size
 		void resize(size_type n, value_type c)
@@ -477,10 +1280,12 @@ class _utf8string
 			if(n < size())
 			{
 				// find the position to chop of the string
-				size_type cut_pos = GetBufferPosition(utfstring_data.c_str(), n);
+				size_type cut_pos = bufferposition(n);
 
-				// set the null terminator
-				utfstring_data[cut_pos] = 0;
+				// chop off the string
+				utfstring_data.resize(cut_pos);
+				utfstring_length = n;
+				truncateindex(n);
 			}
 			else if(n > size())
 			{
@@ -506,6 +1311,8 @@ class _utf8string
 				{
 					for(size_type j = 0; j < c_real_size; ++j) utfstring_data[i+j] = c_utf8[j];
 				}
+
+				utfstring_length = n;
 			}
 		}
 
@@ -526,6 +1333,8 @@ class _utf8string
 		void clear()
 		{
 			utfstring_data.clear();
+			utfstring_length = 0;
+			utfstring_index.clear();
 		}
 
 		// checks to see if the string is empty
@@ -537,6 +1346,34 @@ class _utf8string
 		void shrink_to_fit()
 		{
 			utfstring_data.shrink_to_fit();
+			utfstring_index.shrink_to_fit();
+		}
+
+		// returns the number of characters between checkpoints in the position index
+		// 0 means the index is turned off
+		size_type index_interval() const
+		{
+			return utfstring_indexstep;
+		}
+
+		// sets the number of characters between checkpoints in the position index
+		// random access will step through at most interval characters after a table look up
+		// and the index will use sizeof(size_type) bytes for every interval characters
+		// set to 0 to turn the index off and free its memory
+		void set_index_interval(size_type interval)
+		{
+			if(interval == utfstring_indexstep) return;
+
+			utfstring_indexstep = interval;
+
+			position_index empty_index(utfstring_index.get_allocator());
+			utfstring_index.swap(empty_index);
+		}
+
+		// returns the number of bytes of memory used by the position index
+		size_type index_memory_usage() const
+		{
+			return utfstring_index.capacity() * sizeof(size_type);
 		}
 
 		// iterators ----------------------------------------------------------------------
@@ -627,66 +1464,213 @@ class _utf8string
 
 		size_type find (const _utf8string<Alloc>& str, size_type pos = 0) const
 		{
-			size_type real_pos = GetBufferPosition(utfstring_data.c_str(), pos);
+			return find(utf8string_view(str), pos);
+		}
+
+		size_type find (const _char8bit *str, size_type pos = 0) const
+		{
+			return find(utf8string_view(str), pos);
+		}
+
+		// only the characters between pos and the match are counted to get its position
+		// finding pos is O(pos) unless the string is ASCII or the position index is on, so to go through
+		// every match use find_all() or the iterator version of find()
+		size_type find (utf8string_view str, size_type pos = 0) const
+		{
+			if(pos > utfstring_length) return npos;
+
+			const _uchar8bit *start = utfstring_data.c_str();
+			size_type real_pos = bufferposition(pos);
+
+			size_type found_pos = FindUTF8Bytes(start + real_pos, start + utfstring_data.length(), str.data(), str.data() + str.size_bytes());
+			if(found_pos == npos) return npos;
+
+			return pos + charsbetween(real_pos, real_pos + found_pos);
+		}
+
+		// returns an iterator to the first match that starts at or after first or cend() if there isn't one
+		// no character positions are worked out so finding every match by starting again after the last one
+		// is linear in the length of the string
+		const_iterator find (utf8string_view str, const_iterator first) const
+		{
+			const _uchar8bit *finish = utfstring_data.c_str() + utfstring_data.length();
 
-			size_type found_pos = utfstring_data.find(str.utfstring_data, real_pos);
+			size_type found_pos = FindUTF8Bytes(first.data(), finish, str.data(), str.data() + str.size_bytes());
 
-			// return the character position
-			return GetCharPosFromBufferPosition(utfstring_data.c_str(), found_pos);
+			return const_iterator((found_pos == npos) ? finish : first.data() + found_pos);
 		}
 
+		// returns the character positions of every match, including matches that overlap
+		// the same as calling find() again from one character after each match but only goes through the string once
+		std::vector<size_type> find_all (utf8string_view str) const
+		{
+			std::vector<size_type> found;
+
+			const _uchar8bit *start = utfstring_data.c_str();
+			const _uchar8bit *finish = start + utfstring_data.length();
+
+			// the character position of cur is carried along instead of being worked out from the start each time
+			const _uchar8bit *cur = start;
+			size_type cur_pos = 0;
+
+			for(;;)
+			{
+				size_type found_pos = FindUTF8Bytes(cur, finish, str.data(), str.data() + str.size_bytes());
+				if(found_pos == npos) break;
+
+				cur_pos += is_ascii() ? found_pos : CountUTF8Characters(cur, cur + found_pos);
+				cur += found_pos;
+				found.push_back(cur_pos);
+
+				// an empty str matches at every character and at the end
+				if(cur == finish) break;
+
+				IncToNextCharacter(cur);
+				++cur_pos;
+			}
+
+			return found;
+		}
+
+		// pos defaults to 0 here, unlike std::string and the other overloads, so without it only a match at the start
+		// is found. It's kept that way for code that already depends on it
 		size_type rfind (const _utf8string<Alloc>& str, size_type pos = 0) const
 		{
-			size_type real_pos = GetBufferPosition(utfstring_data.c_str(), pos);
+			return rfind(utf8string_view(str), pos);
+		}
+
+		size_type rfind (const _char8bit *str, size_type pos = npos) const
+		{
+			return rfind(utf8string_view(str), pos);
+		}
+
+		// finds the last match that starts at or before pos. pos defaults to npos like std::string
+		// only the characters between the match and pos are counted to get its position
+		size_type rfind (utf8string_view str, size_type pos = npos) const
+		{
+			if(pos > utfstring_length) pos = utfstring_length;
+
+			const _uchar8bit *start = utfstring_data.c_str();
+			size_type real_pos = bufferposition(pos);
+
+			// the match can end past pos
+			size_type real_end = real_pos + str.size_bytes();
+			if(real_end > utfstring_data.length()) real_end = utfstring_data.length();
+
+			size_type found_pos = FindLastUTF8Bytes(start, start + real_end, str.data(), str.data() + str.size_bytes());
+			if(found_pos == npos) return npos;
+
+			return pos - charsbetween(found_pos, real_pos);
+		}
+
+		// returns an iterator to the last match that starts at or before last or cend() if there isn't one
+		const_iterator rfind (utf8string_view str, const_iterator last) const
+		{
+			const _uchar8bit *start = utfstring_data.c_str();
+			const _uchar8bit *finish = start + utfstring_data.length();
+
+			const _uchar8bit *search_end = ((size_type)(finish - last.data()) < str.size_bytes()) ? finish : last.data() + str.size_bytes();
 
-			size_type found_pos = utfstring_data.rfind(str.utfstring_data, real_pos);
+			size_type found_pos = FindLastUTF8Bytes(start, search_end, str.data(), str.data() + str.size_bytes());
 
-			// return the character position
-			return GetCharPosFromBufferPosition(utfstring_data.c_str(), found_pos);
+			return const_iterator((found_pos == npos) ? finish : start + found_pos);
 		}
 
+		// the find_first_of() family compares whole characters so a multibyte character in str
+		// only matches that character and not other characters that share some of its bytes
 		size_type find_first_of (const _utf8string<Alloc>& str, size_type pos = 0) const
 		{
-			size_type real_pos = GetBufferPosition(utfstring_data.c_str(), pos);
+			return findfirstof(str, pos, true);
+		}
+
+		size_type find_first_of (const _char8bit *str, size_type pos = 0) const
+		{
+			return findfirstof(str, pos, true);
+		}
 
-			size_type found_pos = utfstring_data.find_first_of(str.utfstring_data, real_pos);
+		size_type find_first_of (utf8string_view str, size_type pos = 0) const
+		{
+			return findfirstof(str, pos, true);
+		}
 
-			// return the character position
-			return GetCharPosFromBufferPosition(utfstring_data.c_str(), found_pos);
+		// returns an iterator to the first character at or after first that is in str or cend() if there isn't one
+		const_iterator find_first_of (utf8string_view str, const_iterator first) const
+		{
+			return findfirstof(str, first, true);
 		}
 
-		size_type find_last_of (const _utf8string<Alloc>& str, size_type pos = std::string::npos) const
+		size_type find_last_of (const _utf8string<Alloc>& str, size_type pos = npos) const
 		{
-			size_type real_pos;//
-			if(size_type pos == std::string::npos) real_pos = pos;
-			else real_pos = GetBufferPosition(utfstring_data.c_str(), pos);
+			return findlastof(str, pos, true);
+		}
 
-			size_type found_pos = utfstring_data.find_last_of(str.utfstring_data, real_pos);
+		size_type find_last_of (const _char8bit *str, size_type pos = npos) const
+		{
+			return findlastof(str, pos, true);
+		}
 
-			// return the character position
-			return GetCharPosFromBufferPosition(utfstring_data.c_str(), found_pos);
+		size_type find_last_of (utf8string_view str, size_type pos = npos) const
+		{
+			return findlastof(str, pos, true);
 		}
 
 		size_type find_first_not_of (const _utf8string<Alloc>& str, size_type pos = 0) const
 		{
-			size_type real_pos = GetBufferPosition(utfstring_data.c_str(), pos);
+			return findfirstof(str, pos, false);
+		}
+
+		size_type find_first_not_of (const _char8bit *str, size_type pos = 0) const
+		{
+			return findfirstof(str, pos, false);
+		}
+
+		size_type find_first_not_of (utf8string_view str, size_type pos = 0) const
+		{
+			return findfirstof(str, pos, false);
+		}
+
+		// returns an iterator to the first character at or after first that isn't in str or cend() if there isn't one
+		const_iterator find_first_not_of (utf8string_view str, const_iterator first) const
+		{
+			return findfirstof(str, first, false);
+		}
+
+		size_type find_last_not_of (const _utf8string<Alloc>& str, size_type pos = npos) const
+		{
+			return findlastof(str, pos, false);
+		}
+
+		size_type find_last_not_of (const _char8bit *str, size_type pos = npos) const
+		{
+			return findlastof(str, pos, false);
+		}
 
-			size_type found_pos = utfstring_data.find_first_not_of(str.utfstring_data, real_pos);
+		size_type find_last_not_of (utf8string_view str, size_type pos = npos) const
+		{
+			return findlastof(str, pos, false);
+		}
 
-			// return the character position
-			return GetCharPosFromBufferPosition(utfstring_data.c_str(), found_pos);
+		// compares the strings character by character
+		// returns 0 if they're equal, < 0 if this string comes first and > 0 if str comes first
+		int compare (const _utf8string<Alloc>& str) const
+		{
+			return utf8string_view(*this).compare(str);
 		}
 
-		size_type find_last_not_of (const _utf8string<Alloc>& str, size_type pos = std::string::npos) const
+		int compare (const _char8bit *str) const
 		{
-			size_type real_pos;//
-			if(size_type pos == std::string::npos) real_pos = pos;
-			else real_pos = GetBufferPosition(utfstring_data.c_str(), pos);
+			return utf8string_view(*this).compare(str);
+		}
 
-			size_type found_pos = utfstring_data.find_last_not_of(str.utfstring_data, real_pos);
+		int compare (utf8string_view str) const
+		{
+			return utf8string_view(*this).compare(str);
+		}
 
-			// return the character position
-			return GetCharPosFromBufferPosition(utfstring_data.c_str(), found_pos);
+		// a view of the whole string. It's only valid until the string is changed
+		operator utf8string_view () const
+		{
+			return utf8string_view(utfstring_data.c_str(), utfstring_data.length());
 		}
 
 		// returns a c-style null-terminated string
@@ -695,10 +1679,98 @@ class _utf8string
 			return (const char *)utfstring_data.c_str();
 		}
 
-		// returns a c-style null-terminated string
-		const _uchar8bit *data() const
+		// returns a c-style null-terminated string
+		const _uchar8bit *data() const
+		{
+			return utfstring_data.c_str();
+		}
+
+		// decodes up to max_chars characters starting at pos into out and moves pos to where the next block starts
+		// returns the number of characters written. It's less than max_chars only when pos reaches end() so
+		// a loop can keep calling it until it returns 0. Much faster than dereferencing an iterator for each character
+		size_type decode_block (const_iterator &pos, _char32bit *out, size_type max_chars) const
+		{
+			const _uchar8bit *cur = pos.data();
+			size_type count = DecodeUTF8Block(cur, utfstring_data.c_str() + utfstring_data.length(), out, max_chars);
+
+			pos = const_iterator(cur);
+
+			return count;
+		}
+
+		template <size_t N>
+		size_type decode_block (const_iterator &pos, _char32bit (&out)[N]) const
+		{
+			return decode_block(pos, out, N);
+		}
+
+		// decodes up to max_chars characters that come before pos into out and moves pos back over them
+		// the characters are written last first, so out[0] is the character just before pos
+		// start with pos at end() to read the whole string backwards
+		size_type decode_block_reverse (const_iterator &pos, _char32bit *out, size_type max_chars) const
+		{
+			const _uchar8bit *cur = pos.data();
+			size_type count = DecodeUTF8BlockReverse(utfstring_data.c_str(), cur, out, max_chars);
+
+			pos = const_iterator(cur);
+
+			return count;
+		}
+
+		template <size_t N>
+		size_type decode_block_reverse (const_iterator &pos, _char32bit (&out)[N]) const
+		{
+			return decode_block_reverse(pos, out, N);
+		}
+
+		// decodes the string N characters at a time and calls f(const _char32bit *block, size_type count) for each block
+		// every block but the last one is full
+		template <size_t N, class Func>
+		void for_each_block (Func f) const
+		{
+			_char32bit block[N];
+
+			const _uchar8bit *cur = utfstring_data.c_str();
+			const _uchar8bit *finish = cur + utfstring_data.length();
+
+			while(cur < finish)
+			{
+				size_type count = DecodeUTF8Block(cur, finish, block, N);
+				if(count == 0) break;
+
+				f((const _char32bit *)block, count);
+			}
+		}
+
+		template <class Func>
+		void for_each_block (Func f) const
+		{
+			for_each_block<64>(f);
+		}
+
+		// the same as for_each_block() but goes from the end of the string to the start
+		// each block is in reverse order, block[0] is the character closest to the end
+		template <size_t N, class Func>
+		void for_each_block_reverse (Func f) const
+		{
+			_char32bit block[N];
+
+			const _uchar8bit *start = utfstring_data.c_str();
+			const _uchar8bit *cur = start + utfstring_data.length();
+
+			while(cur > start)
+			{
+				size_type count = DecodeUTF8BlockReverse(start, cur, block, N);
+				if(count == 0) break;
+
+				f((const _char32bit *)block, count);
+			}
+		}
+
+		template <class Func>
+		void for_each_block_reverse (Func f) const
 		{
-			return c_str();
+			for_each_block_reverse<64>(f);
 		}
 
 		// copies a sub string of this string to s and returns the number of characters copied
@@ -717,8 +1789,8 @@ class _utf8string
 
 			size_type start, end, real_len;
 			
-			start = GetBufferPosition(utfstring_data.c_str(), pos);
-			end   = GetBufferPosition(utfstring_data.c_str(), copy_to);
+			start = bufferposition(pos);
+			end   = bufferposition(copy_to);
 
 			real_len = end - start;
 
@@ -726,10 +1798,11 @@ class _utf8string
 			return utfstring_data.copy(s, real_len, start);
 		}
 
-		// copies a sub string of this string to s and returns the number of characters copied
-		// if this string is shorter than len, as many characters as possible are copied
+		// copies a sub string of this string to s and returns the number of code units written
+		// len and pos are in characters. If this string is shorter than len, as many characters as possible are copied
 		// undefined behavior if the buffer pointed to by s is not long enough
-		// outputs to UCS-2
+		// outputs to UTF-16 if _char16bit is 16 bits wide, so characters above U+FFFF are written as surrogate pairs
+		// and take 2 units. Outputs to UTF-32 if it's 32 bits wide
 		size_type copy (_char16bit *s, size_type len, size_type pos = 0) const
 		{
 			if(pos > size())
@@ -738,18 +1811,16 @@ class _utf8string
 			}
 
 			size_type copy_to = pos + len;
-			if(copy_to > size()) copy_to = size();
+			if((copy_to > size()) || (copy_to < pos)) copy_to = size();
 
-			// make end iterator here
-			iterator substr_end(utfstring_data.c_str(), copy_to);
+			const _uchar8bit *start = utfstring_data.c_str();
+			const _uchar8bit *first = start + bufferposition(pos);
+			const _uchar8bit *last = start + bufferposition(copy_to);
 
-			// use the iterator, later the reason will become clear
-			for(auto it = iterator(utfstring_data.c_str(), pos); it < substr_end; ++it)
-			{
-				*s++ = (_char16bit)*it;
-			}
+			// the room the output needs. The decoder can't write past it
+			size_type out_size = (sizeof(_char16bit) == 2) ? GetUTF16BufferSize(first, last) : copy_to - pos;
 
-			return copy_to - pos;
+			return DecodeUTF8(first, last, s, out_size);
 		}
 
 		// outputs to UCS-4
@@ -761,18 +1832,11 @@ class _utf8string
 			}
 
 			size_type copy_to = pos + len;
-			if(copy_to > size()) copy_to = size();
+			if((copy_to > size()) || (copy_to < pos)) copy_to = size();
 
-			// make end iterator here
-			iterator substr_end(utfstring_data.c_str(), copy_to);
+			const _uchar8bit *start = utfstring_data.c_str();
 
-			// use the iterator, later the reason will become clear
-			for(auto it = iterator(utfstring_data.c_str(), pos); it < substr_end; ++it)
-			{
-				*s++ = (_char32bit)*it;
-			}
-
-			return copy_to - pos;
+			return DecodeUTF8(start + bufferposition(pos), start + bufferposition(copy_to), s, copy_to - pos);
 		}
 
 		// access -------------------------------------------------------------------------------------
@@ -781,10 +1845,8 @@ class _utf8string
 		// don't keep non-const version because this will always be const
 		value_type operator[](size_type pos) const
 		{
-			const _uchar8bit *utf8data = utfstring_data.c_str();
-
-			// increment to the correct location
-			IncrementToPosition(utf8data, pos);
+			// find the correct location
+			const _uchar8bit *utf8data = utfstring_data.c_str() + bufferposition(pos);
 
 
 			return UTF8CharToUnicode(utf8data);
@@ -813,23 +1875,25 @@ class _utf8string
 		// no-throw guarantee on non-empty strings. Undefined behavior on empty strings
 		value_type front() const
 		{
-			UTF8CharToUnicode(utfstring_data.c_str());
+			return UTF8CharToUnicode(utfstring_data.c_str());
 		}
 
 		// string operations -----------------------------------------------------------------------------
 		_utf8string<Alloc> substr (size_type pos = 0, size_type len = std::string::npos) const
 		{
-			_utf8string<Alloc> temp;
-
-			size_type end_pos = pos + len;
-			if(end_pos > size()) end_pos = size() - pos;
-
-			// use an iterator to copy the data
-			for(auto it = const_iterator(utfstring_data.c_str(), pos); it < const_iterator(utfstring_data.c_str(), end_pos); ++it)
+			if(pos > size())
 			{
-				temp += (value_type) *it;
+				throw std::out_of_range("pos out of range");
 			}
 
+			size_type start, finish;
+			bufferrange(pos, len, start, finish);
+
+			// copy the bytes straight across into a string that uses the same allocator
+			_utf8string<Alloc> temp(get_allocator());
+			temp.utfstring_data.assign(utfstring_data, start, finish - start);
+			temp.utfstring_length = len;
+
 			return temp;
 		}
 
@@ -844,6 +1908,34 @@ class _utf8string
 		{
 			// just use operator from std::basic_string
 			utfstring_data += str.utfstring_data;
+			utfstring_length += str.utfstring_length;
+
+			return *this;
+		}
+
+		// appends a string that is about to be thrown away
+		// if this string is empty it takes str's buffer instead of copying it
+		_utf8string<Alloc>& operator+= (_utf8string<Alloc>&& str)
+		{
+			if(empty() && (capacity() < str.capacity())) return (*this) = std::move(str);
+
+			return (*this) += (const _utf8string<Alloc>&)str;
+		}
+
+		// appends a c string without building a temporary _utf8string
+		_utf8string<Alloc>& operator+= (const _char8bit *str)
+		{
+			return (*this) += utf8string_view(str);
+		}
+
+		// appends a view without building a temporary _utf8string
+		_utf8string<Alloc>& operator+= (utf8string_view str)
+		{
+			// count first. The view could be of this string
+			size_type str_length = str.size();
+
+			utfstring_data.append(str.data(), str.size_bytes());
+			utfstring_length += str_length;
 
 			return *this;
 		}
@@ -851,17 +1943,17 @@ class _utf8string
 		// for maximum compatibility with std::wstring add a cast operator
 		operator std::wstring () const
 		{
-			// a temporary string
-			std::wstring out;
+			const _uchar8bit *start = utfstring_data.c_str();
+			const _uchar8bit *finish = start + utfstring_data.length();
 
-			// grow the string so it won't have to resize
-			out.reserve(length());
+			// wchar_t is UTF-16 on some systems and UTF-32 on others
+			size_type out_size = (sizeof(wchar_t) == 2) ? GetUTF16BufferSize(start, finish) : utfstring_length;
 
-			// copy using our iterator
-			for(const_iterator it = begin(); it < end(); ++it)
-			{
-				out += (_char16bit)*it;
-			}
+			std::wstring out(out_size, L'\0');
+			if(out_size == 0) return out;
+
+			// broken sequences can make the output shorter than expected
+			out.resize(DecodeUTF8(start, finish, &out[0], out_size));
 
 			return out;
 		}
@@ -879,6 +1971,7 @@ class _utf8string
 		_utf8string<Alloc> &assign(const _char8bit *str)
 		{
 			utfstring_data.assign((const _uchar8bit *)str);
+			updatelength();
 
 			return *this;
 		}
@@ -887,6 +1980,7 @@ class _utf8string
 		_utf8string<Alloc> &assign(const _uchar8bit *str)
 		{
 			utfstring_data.assign(str);
+			updatelength();
 
 			return *this;
 		}
@@ -895,12 +1989,16 @@ class _utf8string
 		_utf8string<Alloc> &assign(size_t n, _uchar8bit c)
 		{
 			utfstring_data.assign(n, c);
+			updatelength();
+
+			return *this;
 		}
 
 		// assigns a new value from a character and count
 		_utf8string<Alloc> &assign(size_t n, _char8bit c)
 		{
 			utfstring_data.assign(n, (_uchar8bit)c);
+			updatelength();
 
 			return *this;
 		}
@@ -910,22 +2008,33 @@ class _utf8string
 		_utf8string<Alloc> &assign(const _utf8string<Alloc> &str)
 		{
 			utfstring_data.assign(str.utfstring_data);
+			utfstring_length = str.utfstring_length;
+			utfstring_index.clear();
 
 			return *this;
 		}
 
-		// assigns a new value from a _utf8string (MOVE(
-		_utf8string<Alloc> &assign(const _utf8string<Alloc> &&str)
+		// assigns a new value from a view
+		_utf8string<Alloc> &assign(utf8string_view str)
 		{
-			utfstring_data = std::move(str.utfstring_data);
+			// basic_string::assign() handles views of this string
+			utfstring_data.assign(str.data(), str.size_bytes());
+			updatelength();
 
 			return *this;
 		}
 
+		// assigns a new value from a _utf8string, taking its buffer and leaving it empty
+		_utf8string<Alloc> &assign(_utf8string<Alloc> &&str)
+		{
+			return (*this) = std::move(str);
+		}
+
 		// assigns a new value from a 16-bit character null terminated string
 		_utf8string<Alloc> &assign(const _char16bit* instring_UCS2)
 		{
-			MakeUTF8StringImpl(instring_UCS2, utfstring_data, true);
+			MakeUTF8StringImpl(instring_UCS2, utfstring_data, false);
+			updatelength();
 
 			return *this;
 		}
@@ -933,7 +2042,8 @@ class _utf8string
 		// assigns a new value from a 32-bit character null terminated string
 		_utf8string<Alloc> &assign(const _char32bit* instring_UCS4)
 		{
-			MakeUTF8StringImpl(instring_UCS4, utfstring_data, true);
+			MakeUTF8StringImpl(instring_UCS4, utfstring_data, false);
+			updatelength();
 
 			return *this;
 		}
@@ -942,6 +2052,34 @@ class _utf8string
 		_utf8string<Alloc> &assign(const std::string &instring)
 		{
 			utfstring_data.assign((const unsigned char *)instring.c_str());
+			updatelength();
+
+			return *this;
+		}
+
+		// assigns a new value from a UTF-8 string, checking that it is valid
+		// throws utf8_error if it isn't. The string isn't changed if an exception is thrown
+		_utf8string<Alloc> &assign(const _char8bit *str, validate_utf8_t)
+		{
+			assignvalidated((const _uchar8bit *)str, strlen(str));
+
+			return *this;
+		}
+
+		// assigns a new value from the first n bytes of a buffer, checking that they are valid UTF-8
+		// throws utf8_error if they aren't. The string isn't changed if an exception is thrown
+		_utf8string<Alloc> &assign(const _char8bit *str, size_type n, validate_utf8_t)
+		{
+			assignvalidated((const _uchar8bit *)str, n);
+
+			return *this;
+		}
+
+		// assigns a new value from a std::string, checking that it is valid UTF-8
+		// throws utf8_error if it isn't. The string isn't changed if an exception is thrown
+		_utf8string<Alloc> &assign(const std::string &instring, validate_utf8_t)
+		{
+			assignvalidated((const _uchar8bit *)instring.data(), instring.length());
 
 			return *this;
 		}
@@ -949,7 +2087,8 @@ class _utf8string
 		// assigns a new value from a std::wstring
 		_utf8string<Alloc> &assign(const std::wstring &instring)
 		{
-			MakeUTF8StringImpl(instring.c_str(), utfstring_data, true);
+			MakeUTF8StringImpl(instring.data(), instring.length(), utfstring_data, false);
+			updatelength();
 
 			return *this;
 		}
@@ -958,12 +2097,14 @@ class _utf8string
 		_utf8string<Alloc> &assign (InputIterator first, InputIterator last)
 		{
 			// create a temporary string first so an excpetion won't alter the current value
-			_utf8string<Alloc> temp;
+			_utf8string<Alloc> temp(get_allocator());
 			for(auto it = first; it < last; it++)
 			{
 				temp += (value_type)*it;
 			}
 			assign(temp);
+
+			return *this;
 		}
 
 		// appends a character to the string
@@ -983,88 +2124,224 @@ class _utf8string
 		// inserts str right before character at position pos
 		_utf8string<Alloc>& insert (size_type pos, const _utf8string<Alloc> & str)
 		{
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
+			}
+
 			// get the real position in the buffer
-			size_type real_pos = sd_utf8::GetBufferPosition(utfstring_data.c_str(), pos);
+			size_type real_pos = bufferposition(pos);
 
 			// just use the standard insert
-			utfstring_data.insert(pos, str.utfstring_data);
+			utfstring_data.insert(real_pos, str.utfstring_data);
+			utfstring_length += str.utfstring_length;
+			truncateindex(pos);
 
 			return *this;
 		}
 
-		_utf8string<Alloc>& insert (size_type pos, const _utf8string<Alloc>& str, size_type subpos, size_type sublen)
+		// inserts a c string right before character at position pos
+		_utf8string<Alloc>& insert (size_type pos, const _char8bit *str)
 		{
-			// create substring
-			_utf8string<Alloc> temp = str.substr(subpos, sub_len);
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
+			}
 
-			return insert(pos, temp);
+			return insert(pos, utf8string_view(str));
 		}
 
-		_utf8string<Alloc>& erase (size_type pos = 0, size_type len = std::string::npos)
+		// inserts a view right before character at position pos
+		_utf8string<Alloc>& insert (size_type pos, utf8string_view str)
 		{
-			size_type real_pos = sd_utf8::GetBufferPosition(utfstring_data.c_str(), pos);
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
+			}
 
-			if(len == std::string::npos) utfstring_data.erase(real_pos, len);
-			else
+			// count first. The view could be of this string
+			size_type str_length = str.size();
+			size_type real_pos = bufferposition(pos);
+
+			utfstring_data.insert(real_pos, str.data(), str.size_bytes());
+			utfstring_length += str_length;
+			truncateindex(pos);
+
+			return *this;
+		}
+
+		_utf8string<Alloc>& insert (size_type pos, const _utf8string<Alloc>& str, size_type subpos, size_type sublen)
+		{
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
+			}
+
+			if(subpos > str.size())
 			{
-				size_type end_pos = pos + len;
-				if(end_pos > size()) end_pos = size() - pos;
+				throw std::out_of_range("subpos out of range");
+			}
 
-				size_type real_end_pos = sd_utf8::GetBufferPosition(utfstring_data.c_str(), end_pos);
+			// find the part of str to insert
+			size_type start, finish;
+			str.bufferrange(subpos, sublen, start, finish);
+
+			size_type real_pos = bufferposition(pos);
+
+			// insert the bytes straight from str. This works even if str is this string
+			utfstring_data.insert(real_pos, str.utfstring_data, start, finish - start);
+			utfstring_length += sublen;
+			truncateindex(pos);
+
+			return *this;
+		}
 
-				utfstring_data.erase(real_pos, real_end_pos - real_pos);
+		_utf8string<Alloc>& erase (size_type pos = 0, size_type len = std::string::npos)
+		{
+			if(pos > size())
+			{
+				throw std::out_of_range("pos out of range");
 			}
 
+			// find both ends with one scan
+			size_type start, finish;
+			bufferrange(pos, len, start, finish);
+
+			utfstring_data.erase(start, finish - start);
+			utfstring_length -= len;
+			truncateindex(pos);
+
 			return *this;
 		}
 
 		_utf8string<Alloc>& replace (size_type pos, size_type len, const _utf8string<Alloc>& str)
 		{
-			// make copy so exceptions won't change string
-			_utf8string<Alloc> temp_copy(*this);
+			return replacebytes(pos, len, str.utfstring_data.c_str(), str.utfstring_data.length(), str.utfstring_length);
+		}
+
+		_utf8string<Alloc>& replace (size_type pos, size_type len, const _char8bit *str)
+		{
+			return replace(pos, len, utf8string_view(str));
+		}
+
+		_utf8string<Alloc>& replace (size_type pos, size_type len, utf8string_view str)
+		{
+			return replacebytes(pos, len, str.data(), str.size_bytes(), str.size());
+		}
+
+		_utf8string<Alloc>& replace (size_type pos, size_type len, const _utf8string<Alloc>& str, size_type subpos, size_type sublen)
+		{
+			if(subpos > str.size())
+			{
+				throw std::out_of_range("subpos out of range");
+			}
 
-			// erase
-			temp_copy.erase(pos, len);
+			// find the part of str to use
+			size_type start, finish;
+			str.bufferrange(subpos, sublen, start, finish);
+
+			return replacebytes(pos, len, str.utfstring_data.c_str() + start, finish - start, sublen);
+		}
+
+		_utf8string<Alloc>& replace (size_type pos, size_type len, size_type n, value_type c)
+		{
+			utf8_encoding encoding;
+			size_t encoding_size;
 
-			// insert
-			temp_copy.insert(pos, str);
+			GetUTF8Encoding(c, encoding, encoding_size);
 
-			assign(temp_copy);
+			// only the new characters are built separately
+			buffer_type fill(utfstring_data.get_allocator());
+			fill.reserve(n * encoding_size);
+			for(size_type i = 0; i < n; ++i) fill.append(encoding, encoding_size);
 
-			return *this;
+			return replacebytes(pos, len, fill.c_str(), fill.length(), n);
 		}
 
-		_utf8string<Alloc>& replace (size_type pos, size_type len, const _utf8string<Alloc>& str, size_type subpos, size_type sublen)
+		// replaces every occurrence of needle with replacement and returns the number of replacements
+		// the new string is built in one pass over the old one. An empty needle doesn't match anything
+		size_type replace_all (utf8string_view needle, utf8string_view replacement)
 		{
-			// make copy so exceptions won't change string
-			_utf8string<Alloc> temp_copy(*this);
-			_utf8string<Alloc> sub_str = str.substr(subpos, sublen);
+			if(needle.empty()) return 0;
 
-			// erase
-			temp_copy.erase(pos, len);
+			const _uchar8bit *cur = utfstring_data.c_str();
+			const _uchar8bit *finish = cur + utfstring_data.length();
 
-			// insert
-			temp_copy.insert(pos, sub_str);
+			size_type found_pos = FindUTF8Bytes(cur, finish, needle.data(), needle.data() + needle.size_bytes());
+			if(found_pos == npos) return 0;
 
-			assign(temp_copy);
+			// count these before anything changes. The views could be of this string
+			size_type needle_length = needle.size();
+			size_type replacement_length = replacement.size();
 
-			return *this;
+			buffer_type out(utfstring_data.get_allocator());
+			out.reserve(utfstring_data.length());
+
+			size_type count = 0;
+			while(found_pos != npos)
+			{
+				out.append(cur, found_pos);
+				out.append(replacement.data(), replacement.size_bytes());
+				++count;
+
+				cur += found_pos + needle.size_bytes();
+				found_pos = FindUTF8Bytes(cur, finish, needle.data(), needle.data() + needle.size_bytes());
+			}
+
+			out.append(cur, (size_type)(finish - cur));
+
+			utfstring_data.swap(out);
+			utfstring_length = utfstring_length - count * needle_length + count * replacement_length;
+			utfstring_index.clear();
+
+			return count;
 		}
 
-		_utf8string<Alloc>& replace (size_type pos, size_type len, size_type n, value_type c)
+		// returns a lowercase copy of the string. See utf8case_mapping for the mappings that are used
+		_utf8string<Alloc> to_lower() const
+		{
+			_utf8string<Alloc> out(*this, get_allocator());
+			out.mapcase(utf8case_lower);
+
+			return out;
+		}
+
+		// returns an uppercase copy of the string. Some characters become more than one, "ß" becomes "SS"
+		_utf8string<Alloc> to_upper() const
+		{
+			_utf8string<Alloc> out(*this, get_allocator());
+			out.mapcase(utf8case_upper);
+
+			return out;
+		}
+
+		// returns a case folded copy of the string. Two strings that only differ by case are equal once they're folded
+		_utf8string<Alloc> case_fold() const
 		{
-			// make copy so exceptions won't change string
-			_utf8string<Alloc> temp_copy(*this);
-			_utf8string<Alloc> str(n, c);
+			_utf8string<Alloc> out(*this, get_allocator());
+			out.mapcase(utf8case_fold);
 
-			// erase
-			temp_copy.erase(pos, len);
+			return out;
+		}
 
-			// insert
-			temp_copy.insert(pos, str);
+		// lowercases the string in place
+		_utf8string<Alloc>& make_lower()
+		{
+			mapcase(utf8case_lower);
+			return *this;
+		}
 
-			assign(temp_copy);
+		// uppercases the string in place
+		_utf8string<Alloc>& make_upper()
+		{
+			mapcase(utf8case_upper);
+			return *this;
+		}
 
+		// case folds the string in place
+		_utf8string<Alloc>& make_case_folded()
+		{
+			mapcase(utf8case_fold);
 			return *this;
 		}
 
@@ -1072,6 +2349,9 @@ class _utf8string
 		void swap (_utf8string<Alloc>& str)
 		{
 			utfstring_data.swap(str.utfstring_data);
+			std::swap(utfstring_length, str.utfstring_length);
+			utfstring_index.swap(str.utfstring_index);
+			std::swap(utfstring_indexstep, str.utfstring_indexstep);
 		}
 
 		void KillEndingWhiteSpace()
@@ -1085,10 +2365,20 @@ class _utf8string
 					--new_length;
 					c = utfstring_data[new_length - 1];
 				}
+				// only ASCII white space is removed so one byte is one character
+				utfstring_length -= utfstring_data.size() - new_length;
 				utfstring_data.resize(new_length);
+				truncateindex(utfstring_length);
 			}
 		}
 
+		// returns a hash of the bytes in the string
+		// the same as utf8string_view::hash() for the same characters so strings and views can share a hash table
+		size_t hash() const
+		{
+			return GetUTF8Hash(utfstring_data.data(), utfstring_data.data() + utfstring_data.length());
+		}
+
 		// comparison operators ---------------------------------------------------------------------------
 		bool operator == ( const _utf8string<Alloc> &other) const
 		{
@@ -1104,6 +2394,26 @@ class _utf8string
 			return utfstring_data != other.utfstring_data;
 		}
 
+		bool operator == (const _char8bit *other) const
+		{
+			return utf8string_view(*this) == utf8string_view(other);
+		}
+
+		bool operator != (const _char8bit *other) const
+		{
+			return utf8string_view(*this) != utf8string_view(other);
+		}
+
+		bool operator == (utf8string_view other) const
+		{
+			return utf8string_view(*this) == other;
+		}
+
+		bool operator != (utf8string_view other) const
+		{
+			return utf8string_view(*this) != other;
+		}
+
 		bool operator < ( const _utf8string<Alloc> &other) const
 		{
 			// just compare pointers
@@ -1132,10 +2442,37 @@ class _utf8string
 			return utfstring_data >= other.utfstring_data;
 		}
 
+		// joins the pieces into one string with a single allocation
+		// the total size is added up first so a log line made from many pieces doesn't reallocate as it grows
+		// each piece can be a _utf8string, a utf8string_view, a c string or a std::string
+		template <class First, class... Rest>
+		static _utf8string<Alloc> concat(const First &first, const Rest&... rest)
+		{
+			return concat(std::allocator_arg, Alloc(), first, rest...);
+		}
+
+		// joins the pieces into one string that gets its memory from alloc
+		template <class First, class... Rest>
+		static _utf8string<Alloc> concat(std::allocator_arg_t, const Alloc &alloc, const First &first, const Rest&... rest)
+		{
+			utf8string_view pieces[] = { pieceview(first), pieceview(rest)... };
+
+			size_type total_size = 0;
+			for(const utf8string_view &piece : pieces) total_size += piece.size_bytes();
+
+			_utf8string<Alloc> out(alloc);
+			out.utfstring_data.reserve(total_size);
+
+			for(const utf8string_view &piece : pieces) out.utfstring_data.append(piece.data(), piece.size_bytes());
+
+			out.updatelength();
+
+			return out;
+		}
+
 		// non-member function overloads ------------------------------------------------------------------
 
 		// overload stream insertion so we can write to streams
-		template <class Alloc>
 		friend std::ostream& operator<<(std::ostream& os, const _utf8string<Alloc>& string)
 		{
 			// use from basic string
@@ -1146,7 +2483,6 @@ class _utf8string
 		}
 
 		// overload stream extraction so we can write to streams
-		template <class Alloc>
 		friend std::istream& operator>>(std::istream& is, _utf8string<Alloc>& string)
 		{
 			// for now just use std::string because istream as defined can not read unsigned char
@@ -1161,21 +2497,203 @@ class _utf8string
  		// we can define this operator for all possible types such as char, const char *, etc,
 		// but this is not neccessary. Because those constructors were provided, the compiler will be
 		// able to build a _utf8string<Alloc> for those types and then call this overloaded operator.
-		// if performance becomes an issue, the additional variations to this operator can be created
-		template <class Alloc>
+		// use concat() to join more than two strings with one allocation
+		// the result uses lhs's allocator
 		friend _utf8string<Alloc> operator + (const _utf8string<Alloc>& lhs, const _utf8string<Alloc>& rhs)
 		{
-			_utf8string<Alloc> out(lhs);
+			_utf8string<Alloc> out(lhs.get_allocator());
+			out.utfstring_data.reserve(lhs.utfstring_data.length() + rhs.utfstring_data.length());
+
+			out += lhs;
 			out += rhs;
 
 			return out;
 		}
 
+		// the rvalue versions reuse the buffer of the temporary so a + b + c only copies a and b once
+		friend _utf8string<Alloc> operator + (_utf8string<Alloc>&& lhs, const _utf8string<Alloc>& rhs)
+		{
+			lhs += rhs;
+
+			return std::move(lhs);
+		}
+
+		friend _utf8string<Alloc> operator + (const _utf8string<Alloc>& lhs, _utf8string<Alloc>&& rhs)
+		{
+			rhs.insert(0, lhs);
+
+			return std::move(rhs);
+		}
+
+		friend _utf8string<Alloc> operator + (_utf8string<Alloc>&& lhs, _utf8string<Alloc>&& rhs)
+		{
+			lhs += rhs;
+
+			return std::move(lhs);
+		}
+
+	private:
+		// used by concat() to get a view of each piece
+		static utf8string_view pieceview(utf8string_view str)
+		{
+			return str;
+		}
+
+		static utf8string_view pieceview(const _char8bit *str)
+		{
+			return utf8string_view(str);
+		}
+
+		static utf8string_view pieceview(const std::string &str)
+		{
+			return utf8string_view(str.data(), str.length());
+		}
+
+		template <class OtherAlloc>
+		static utf8string_view pieceview(const _utf8string<OtherAlloc> &str)
+		{
+			return str;
+		}
+
+	public:
 		static const size_type npos = -1;
 };
 
 typedef _utf8string<> utf8string;
 
+// turns the types that can be looked up in a hash table of strings into views without copying them
+// there's an overload for each type so a _utf8string or a c string doesn't have two ways to convert
+struct utf8string_key
+{
+	static utf8string_view view(utf8string_view str)
+	{
+		return str;
+	}
+
+	static utf8string_view view(const _char8bit *str)
+	{
+		return utf8string_view(str);
+	}
+
+	static utf8string_view view(const std::string &str)
+	{
+		return utf8string_view(str.data(), str.length());
+	}
+
+	template <class Alloc>
+	static utf8string_view view(const _utf8string<Alloc> &str)
+	{
+		return str;
+	}
+};
+
+// a transparent hasher for unordered containers of strings
+// with utf8string_equal, an unordered_map<utf8string, T, utf8string_hash, utf8string_equal> can be searched with
+// a c string, a std::string, a std::string_view or a utf8string_view without building a utf8string
+// (find() with another key type needs C++20)
+struct utf8string_hash
+{
+	typedef void is_transparent;
+
+	template <class T>
+	size_t operator()(const T &str) const
+	{
+		return utf8string_key::view(str).hash();
+	}
+};
+
+// the transparent equality test that goes with utf8string_hash
+struct utf8string_equal
+{
+	typedef void is_transparent;
+
+	template <class T, class U>
+	bool operator()(const T &lhs, const U &rhs) const
+	{
+		return utf8string_key::view(lhs) == utf8string_key::view(rhs);
+	}
+};
+
+#if defined(UTF8STRING_HAS_PMR)
+namespace pmr
+{
+
+// a utf8string that gets its memory from a std::pmr::memory_resource
+typedef _utf8string<std::pmr::polymorphic_allocator<_uchar8bit>> utf8string;
+
+// an arena for strings that all live for about the same time, like the strings made while handling one request
+// memory comes from a buffer inside the arena and then from blocks that grow geometrically, so allocating is
+// usually a pointer bump. Freeing does nothing until release() or the arena is destroyed, so strings made
+// from it must not outlive either
+template <size_t InitialSize = 4096>
+class utf8arena
+{
+	private:
+		alignas(std::max_align_t) unsigned char arena_buffer[InitialSize];
+		std::pmr::monotonic_buffer_resource arena_resource;
+
+		// the strings point into the arena
+		utf8arena(const utf8arena &);
+		utf8arena &operator=(const utf8arena &);
+
+	public:
+		// upstream is where the arena gets more memory after the inside buffer is used up
+		explicit utf8arena(std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+			:arena_resource(arena_buffer, sizeof(arena_buffer), upstream)
+		{
+		}
+
+		// the allocator to pass to pmr::utf8string and other std::pmr containers
+		std::pmr::polymorphic_allocator<_uchar8bit> allocator()
+		{
+			return std::pmr::polymorphic_allocator<_uchar8bit>(&arena_resource);
+		}
+
+		std::pmr::memory_resource *resource()
+		{
+			return &arena_resource;
+		}
+
+		// copies str into the arena
+		utf8string make_string(utf8string_view str)
+		{
+			return utf8string(str, allocator());
+		}
+
+		// frees everything the arena has given out so it can be used for the next request
+		void release()
+		{
+			arena_resource.release();
+		}
+};
+
+}
+#endif
+
+}
+
+// lets strings and views be used as keys in std::unordered_map and std::unordered_set
+namespace std
+{
+
+template <class Alloc>
+struct hash<sd_utf8::_utf8string<Alloc>>
+{
+	size_t operator()(const sd_utf8::_utf8string<Alloc> &str) const
+	{
+		return str.hash();
+	}
+};
+
+template <>
+struct hash<sd_utf8::utf8string_view>
+{
+	size_t operator()(sd_utf8::utf8string_view str) const
+	{
+		return str.hash();
+	}
+};
+
 }
 
 #endif 
\ No newline at end of file
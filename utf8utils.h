@@ -27,12 +27,62 @@
 //
 // 2012-12-12  - added GetCharPosFromBufferPosition()
 //
+// 2026-10-16: - added CountUTF8Characters() with SSE2 and AVX2 versions. GetNumCharactersInUTF8String()
+//               and GetCharPosFromBufferPosition() now use it
+//             - added FindInvalidUTF8(), IsValidUTF8() and CopyValidUTF8() with SSSE3 and AVX2 versions
+//             - fixed the lead byte of 4 byte encodings in GetUTF8Encoding()
+//             - fixed GetMinimumBufferSize(). It now gives the exact size and handles surrogate pairs
+//             - added GetUTF8BufferSize() and EncodeUTF8(). MakeUTF8StringImpl() uses them to size the output
+//               once and encode with SSE2/SSSE3, and joins UTF-16 surrogate pairs
+//             - added GetUTF16BufferSize() and DecodeUTF8() to decode a range into UTF-16 or UTF-32
+//             - added AdvanceUTF8Characters(), FindUTF8Bytes(), FindLastUTF8Bytes(), UTF8CharacterSet,
+//               FindFirstOfUTF8(), FindLastOfUTF8() and GetUTF8Hash() for ranges that aren't null terminated
+//             - GetUTF8Hash() now uses wyhash instead of FNV-1a
+//             - FindUTF8Bytes() filters with SSE2/AVX2 and falls back to the new FindUTF8BytesTwoWay()
+//             - added DecodeUTF8Block(), DecodeUTF8BlockReverse() and RetreatUTF8Characters() for decoding a
+//               fixed number of characters at a time
+//             - DecodeUTF8() decodes mixed blocks a whole block at a time and DecodeUTF8Character() checks a
+//               complete sequence in one step
+//             - added FindIncompleteUTF8Tail() for decoding streams that are split in the middle of a character
+//             - added NextUTF8Boundary() for splitting a buffer between threads
+//
+// 2026-10-17: - DecodeUTF8() takes the size of the output. It used to assume one unit per input byte and the
+//               SIMD path could write past a buffer that was the exact size
+//             - FindLastUTF8Bytes() filters with SSE2/AVX2 too and falls back to the new FindLastUTF8BytesTwoWay().
+//               Both two-way searches share FindBytesTwoWay()
+//             - includes <string> itself so it can be included first
+//             - MultiplyUTF8Hash() marks unsigned __int128 as __extension__ so -Wpedantic builds are clean
+//
 #pragma once
 
 #ifndef UTF8UTILSHEADER
 #define UTF8UTILSHEADER
 
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// SIMD versions of the bulk functions are used when the compiler is targeting a CPU that has them.
+// Define UTF8_DISABLE_SIMD to always use the plain C++ versions.
+#ifndef UTF8_DISABLE_SIMD
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+		#define UTF8_USE_SSE2
+		#include <emmintrin.h>
+	#endif
+	#if defined(__SSSE3__) || defined(__AVX__)
+		#define UTF8_USE_SSSE3
+		#include <tmmintrin.h>
+	#endif
+	#if defined(__AVX2__)
+		#define UTF8_USE_AVX2
+		#include <immintrin.h>
+	#endif
+#endif
 
 namespace sd_utf8
 {
@@ -100,7 +150,7 @@ inline void GetUTF8Encoding(_char32bit in_char, utf8_encoding &out_encoding, siz
 	else
 	{
 		// 4 byte encoding
-		out_encoding[0] = 0xF8 + ((in_char & 0x1C0000) >> 18);
+		out_encoding[0] = 0xF0 + ((in_char & 0x1C0000) >> 18);
 		out_encoding[1] = 0x80 + ((in_char & 0x3F000) >> 12);
 		out_encoding[2] = 0x80 + ((in_char & 0xFC0) >> 6);
 		out_encoding[3] = 0x80 + (in_char & 0x3F);
@@ -203,145 +253,1847 @@ inline size_t GetBufferPosition(const _uchar8bit *string, size_t pos)
 	return (size_t)(string_at_pos - string);
 }
 
+// counts the number of characters that start in the range [begin, end)
+// every byte that isn't a continuation byte (10xxxxxx) starts a character so the buffer doesn't have
+// to be decoded. The range doesn't have to be null terminated.
+inline size_t CountUTF8Characters(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	// count the continuation bytes and subtract them from the total
+	size_t continuation_bytes = 0;
+	const _uchar8bit *cur = begin;
+
+#if defined(UTF8_USE_AVX2)
+	while(end - cur >= 32)
+	{
+		// each 8 bit counter can only be incremented 255 times before it overflows
+		__m256i counters = _mm256_setzero_si256();
+		for(int i = 0; (i < 255) && (end - cur >= 32); ++i, cur += 32)
+		{
+			__m256i bytes = _mm256_loadu_si256((const __m256i *)cur);
+
+			// continuation bytes are the only bytes less than -64 (0xC0) when treated as signed
+			// the compare gives -1 for those bytes so subtracting it adds 1 to the counter
+			counters = _mm256_sub_epi8(counters, _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), bytes));
+		}
+
+		// add the counters together
+		__m256i sums = _mm256_sad_epu8(counters, _mm256_setzero_si256());
+		__m128i half_sums = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+		continuation_bytes += (size_t)_mm_cvtsi128_si32(half_sums) + (size_t)_mm_cvtsi128_si32(_mm_srli_si128(half_sums, 8));
+	}
+#endif
+
+#if defined(UTF8_USE_SSE2)
+	while(end - cur >= 16)
+	{
+		// each 8 bit counter can only be incremented 255 times before it overflows
+		__m128i counters = _mm_setzero_si128();
+		for(int i = 0; (i < 255) && (end - cur >= 16); ++i, cur += 16)
+		{
+			__m128i bytes = _mm_loadu_si128((const __m128i *)cur);
+
+			// continuation bytes are the only bytes less than -64 (0xC0) when treated as signed
+			counters = _mm_sub_epi8(counters, _mm_cmplt_epi8(bytes, _mm_set1_epi8(-64)));
+		}
+
+		// add the counters together
+		__m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+		continuation_bytes += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+	}
+#endif
+
+	// plain C++ version, 8 bytes at a time
+	while(end - cur >= 8)
+	{
+		std::uint64_t bytes;
+		memcpy(&bytes, cur, 8);
+
+		// the top bit of each byte is set if the byte is 10xxxxxx
+		std::uint64_t marks = bytes & ~(bytes << 1) & 0x8080808080808080ULL;
+
+		// add the marks together in the top byte
+		continuation_bytes += (size_t)(((marks >> 7) * 0x0101010101010101ULL) >> 56);
+
+		cur += 8;
+	}
+
+	for(; cur < end; ++cur)
+	{
+		if((*cur & 0xC0) == 0x80) ++continuation_bytes;
+	}
+
+	return (size_t)(end - begin) - continuation_bytes;
+}
+
 // Get's the character's position from the buffer position
 inline size_t GetCharPosFromBufferPosition(const _uchar8bit *string, size_t buffer_pos)
 {
-	const _uchar8bit *end_addr = &string[buffer_pos];
-	size_t pos = 0;
-	while(string < end_addr)
+	return CountUTF8Characters(string, string + buffer_pos);
+}
+
+// moves cur forward by n characters without going past end and returns the number of characters it moved
+// the range doesn't have to be null terminated. Long runs are skipped a block at a time with CountUTF8Characters()
+inline size_t AdvanceUTF8Characters(const _uchar8bit *&cur, const _uchar8bit *end, size_t n)
+{
+	size_t moved = 0;
+
+	// a block of 64 bytes can't start more than 64 characters so it can be skipped whole
+	while((end - cur >= 64) && (n - moved >= 64))
+	{
+		moved += CountUTF8Characters(cur, cur + 64);
+		cur += 64;
+
+		// finish the last character of the block. It was already counted
+		while((cur < end) && ((*cur & 0xC0) == 0x80)) ++cur;
+	}
+
+	while((cur < end) && (moved < n))
 	{
-		IncToNextCharacter(string);
-		++pos;
+		++cur;
+		while((cur < end) && ((*cur & 0xC0) == 0x80)) ++cur;
+
+		++moved;
 	}
-	return pos;
+
+	return moved;
 }
 
-// reads a non-encoded unicode string to get the minium buffer size needed to encoded it in UTF-8
-template <class T>
-inline size_t GetMinimumBufferSize(const T *string)
+// returns the position of the lowest bit that is set. mask must not be 0
+inline size_t GetLowestSetBit(std::uint32_t mask)
 {
-	size_t min_size = 0;
-	while(*string != 0)
+#if defined(__GNUC__) || defined(__clang__)
+	return (size_t)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+	unsigned long bit;
+	_BitScanForward(&bit, mask);
+
+	return (size_t)bit;
+#else
+	size_t bit = 0;
+	while(!((mask >> bit) & 1)) ++bit;
+
+	return bit;
+#endif
+}
+
+// returns the position of the highest bit that is set. mask must not be 0
+inline size_t GetHighestSetBit(std::uint32_t mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (size_t)(31 - __builtin_clz(mask));
+#elif defined(_MSC_VER)
+	unsigned long bit;
+	_BitScanReverse(&bit, mask);
+
+	return (size_t)bit;
+#else
+	size_t bit = 31;
+	while(!((mask >> bit) & 1)) --bit;
+
+	return bit;
+#endif
+}
+
+// reads a range of bytes front to back. start is the first byte
+struct UTF8ForwardBytes
+{
+	const _uchar8bit *start;
+
+	_uchar8bit operator[](size_t i) const
 	{
-		if(*string < 0x80) min_size += 1;
-		else if (string < 2048) min_size += 2;
-		else if (string < 65536) min_size += 3;
-		else min_size += 4;
+		return start[i];
+	}
+};
 
-		++string;
+// reads a range of bytes back to front. start is one past the last byte
+struct UTF8BackwardBytes
+{
+	const _uchar8bit *start;
+
+	_uchar8bit operator[](size_t i) const
+	{
+		return *(start - 1 - i);
 	}
-}
+};
 
-// use a template method because the 16bit and 32 bit implementations are identical
-// except for the type
-template <typename char_type, typename Alloc>
-inline void MakeUTF8StringImpl(const char_type* instring, std::basic_string<_uchar8bit, Alloc> &out, bool appendToOut)
+// the two-way algorithm. Searches the size bytes of text for the l bytes of n, both read through Bytes so the
+// search can also run backwards. returns how far into text the first match starts or (size_t)-1. l must not be 0
+template <class Bytes>
+inline size_t FindBytesTwoWay(Bytes text, size_t size, Bytes n, size_t l)
 {
-	// first empty the string
-	if(!appendToOut) out.clear();
+	// how far the needle can move when the byte under its last position is c
+	size_t shift[256];
+	std::uint32_t in_needle[8] = {};
+	for(size_t i = 0; i < l; ++i)
+	{
+		in_needle[n[i] >> 5] |= (std::uint32_t)1 << (n[i] & 31);
+		shift[n[i]] = i + 1;
+	}
 
-	bool default_order = true; // the string uses the same byte order as the system
-	int start = 0; // index of the first real character in the string
+	// find the critical factorization from the maximal suffixes for both orderings of the bytes
+	size_t ip = (size_t)-1, jp = 0, k = 1, p = 1;
+	while(jp + k < l)
+	{
+		if(n[ip + k] == n[jp + k])
+		{
+			if(k == p)
+			{
+				jp += p;
+				k = 1;
+			}
+			else ++k;
+		}
+		else if(n[ip + k] > n[jp + k])
+		{
+			jp += k;
+			k = 1;
+			p = jp - ip;
+		}
+		else
+		{
+			ip = jp++;
+			k = p = 1;
+		}
+	}
+	size_t ms = ip;
+	size_t p0 = p;
 
-	// check for byte order mark
-	if(instring[0] == 0xfffe)
+	ip = (size_t)-1;
+	jp = 0;
+	k = p = 1;
+	while(jp + k < l)
 	{
-		default_order = false;
-		++start;
+		if(n[ip + k] == n[jp + k])
+		{
+			if(k == p)
+			{
+				jp += p;
+				k = 1;
+			}
+			else ++k;
+		}
+		else if(n[ip + k] < n[jp + k])
+		{
+			jp += k;
+			k = 1;
+			p = jp - ip;
+		}
+		else
+		{
+			ip = jp++;
+			k = p = 1;
+		}
 	}
-	else if(instring[0] == 0xfeff)
+	if(ip + 1 > ms + 1) ms = ip;
+	else p = p0;
+
+	// a periodic needle remembers how much of it matched so those bytes aren't compared again
+	bool periodic = true;
+	for(size_t i = 0; (i < ms + 1) && periodic; ++i) periodic = (n[i] == n[i + p]);
+
+	size_t mem0;
+	if(!periodic)
 	{
-		// jump past the byte order mark
-		++start;
+		mem0 = 0;
+		p = ((ms > l - ms - 1) ? ms : l - ms - 1) + 1;
 	}
+	else mem0 = l - p;
+
+	size_t mem = 0;
+	size_t h = 0;
 
-	// loop until null terminator is reached
-	for(int i = start; instring[i] != 0; ++i)
+	for(;;)
 	{
-		utf8_encoding cur_encoding;
-		size_t encoding_size;
+		if(size - h < l) return (size_t)-1;
 
-		// convert to UTF-8
-		GetUTF8Encoding(instring[i], cur_encoding, encoding_size, default_order);
+		// look at the last byte first and skip ahead if it can't be part of a match here
+		_uchar8bit c = text[h + l - 1];
+		if((in_needle[c >> 5] >> (c & 31)) & 1)
+		{
+			k = l - shift[c];
+			if(k)
+			{
+				if(k < mem) k = mem;
+				h += k;
+				mem = 0;
+				continue;
+			}
+		}
+		else
+		{
+			h += l;
+			mem = 0;
+			continue;
+		}
 
-		// add to the std::string
-		for(size_t j = 0; j < encoding_size; ++j)
+		// compare the right half
+		for(k = (ms + 1 > mem) ? ms + 1 : mem; (k < l) && (n[k] == text[h + k]); ++k);
+		if(k < l)
 		{
-			out += cur_encoding[j];
+			h += k - ms;
+			mem = 0;
+			continue;
 		}
+
+		// compare the left half
+		for(k = ms + 1; (k > mem) && (n[k - 1] == text[h + k - 1]); --k);
+		if(k <= mem) return h;
+
+		h += p;
+		mem = mem0;
 	}
 }
 
-// make this method private to restrict which types can be called
-// use a template method because the 16bit and 32 bit implementations are identical
-// except for the type
-// out should point to a buffer large enough to hold the data
-template <typename char_type>
-inline void MakeUTF8StringImpl(const char_type* instring, _uchar8bit *out)
+// searches [begin, end) for the bytes in [needle_begin, needle_end) with the two-way algorithm
+// returns the buffer position of the first match or (size_t)-1 if there isn't one. the needle must not be empty
+// never looks at a byte of the range more than twice so it's linear even for needles like "aaab" in "aaaa...".
+// FindUTF8Bytes() switches to this when its quicker filter keeps finding bytes that don't lead to a match
+inline size_t FindUTF8BytesTwoWay(const _uchar8bit *begin, const _uchar8bit *end, const _uchar8bit *needle_begin, const _uchar8bit *needle_end)
 {
-	bool default_order = true; // the string uses the same byte order as the system
-	int start = 0; // index of the first real character in the string
+	UTF8ForwardBytes text = { begin };
+	UTF8ForwardBytes needle = { needle_begin };
 
-	// check for byte order mark
-	if(instring[0] == 0xfffe)
+	return FindBytesTwoWay(text, (size_t)(end - begin), needle, (size_t)(needle_end - needle_begin));
+}
+
+// the same as FindUTF8BytesTwoWay() but returns the buffer position of the last match
+// runs the two-way search from end back to begin with the needle read backwards
+inline size_t FindLastUTF8BytesTwoWay(const _uchar8bit *begin, const _uchar8bit *end, const _uchar8bit *needle_begin, const _uchar8bit *needle_end)
+{
+	size_t size = (size_t)(end - begin);
+	size_t needle_size = (size_t)(needle_end - needle_begin);
+
+	UTF8BackwardBytes text = { end };
+	UTF8BackwardBytes needle = { needle_end };
+
+	size_t found = FindBytesTwoWay(text, size, needle, needle_size);
+
+	return (found == (size_t)-1) ? found : size - found - needle_size;
+}
+
+// searches [begin, end) for the bytes in [needle_begin, needle_end)
+// returns the buffer position of the first match or (size_t)-1 if there isn't one. An empty needle matches at 0
+// if both ranges are valid UTF-8 a match always starts at the beginning of a character
+// the SIMD versions compare the first and last bytes of the needle with a block of places at once and only check
+// the places where both match. If too many of those aren't matches it finishes with FindUTF8BytesTwoWay()
+inline size_t FindUTF8Bytes(const _uchar8bit *begin, const _uchar8bit *end, const _uchar8bit *needle_begin, const _uchar8bit *needle_end)
+{
+	size_t needle_size = (size_t)(needle_end - needle_begin);
+	if(needle_size == 0) return 0;
+	if((size_t)(end - begin) < needle_size) return (size_t)-1;
+
+	if(needle_size == 1)
 	{
-		default_order = false;
-		++start;
+		const _uchar8bit *found = (const _uchar8bit *)memchr(begin, needle_begin[0], (size_t)(end - begin));
+
+		return (found == NULL) ? (size_t)-1 : (size_t)(found - begin);
+	}
+
+	const _uchar8bit *last = end - needle_size;
+	const _uchar8bit *cur = begin;
+
+	// places that were checked and weren't a match
+	size_t false_hits = 0;
+
+#if defined(UTF8_USE_AVX2)
+	const __m256i first_byte = _mm256_set1_epi8((char)needle_begin[0]);
+	const __m256i last_byte = _mm256_set1_epi8((char)needle_begin[needle_size - 1]);
+
+	for(; last - cur >= 32; cur += 32)
+	{
+		__m256i firsts = _mm256_cmpeq_epi8(first_byte, _mm256_loadu_si256((const __m256i *)cur));
+		__m256i lasts = _mm256_cmpeq_epi8(last_byte, _mm256_loadu_si256((const __m256i *)(cur + needle_size - 1)));
+		std::uint32_t mask = (std::uint32_t)_mm256_movemask_epi8(_mm256_and_si256(firsts, lasts));
+
+		while(mask != 0)
+		{
+			size_t bit = GetLowestSetBit(mask);
+			if(memcmp(cur + bit + 1, needle_begin + 1, needle_size - 2) == 0) return (size_t)(cur + bit - begin);
+
+			mask &= mask - 1;
+			++false_hits;
+		}
+
+		// more than one false hit every 8 bytes. the two-way search can't be slowed down by the needle
+		if(false_hits > 64 + (size_t)(cur - begin) / 8) break;
+	}
+#elif defined(UTF8_USE_SSE2)
+	const __m128i first_byte = _mm_set1_epi8((char)needle_begin[0]);
+	const __m128i last_byte = _mm_set1_epi8((char)needle_begin[needle_size - 1]);
+
+	for(; last - cur >= 16; cur += 16)
+	{
+		__m128i firsts = _mm_cmpeq_epi8(first_byte, _mm_loadu_si128((const __m128i *)cur));
+		__m128i lasts = _mm_cmpeq_epi8(last_byte, _mm_loadu_si128((const __m128i *)(cur + needle_size - 1)));
+		unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(firsts, lasts));
+
+		while(mask != 0)
+		{
+			size_t bit = GetLowestSetBit(mask);
+			if(memcmp(cur + bit + 1, needle_begin + 1, needle_size - 2) == 0) return (size_t)(cur + bit - begin);
+
+			mask &= mask - 1;
+			++false_hits;
+		}
+
+		if(false_hits > 64 + (size_t)(cur - begin) / 8) break;
 	}
-	else if(instring[0] == 0xfeff)
+#endif
+
+	// the last places or all of them without SIMD
+	for(; (cur <= last) && (false_hits <= 64 + (size_t)(cur - begin) / 8); ++cur)
 	{
-		// jump past the byte order mark
-		++start;
+		// let memchr find the places where the first byte matches
+		cur = (const _uchar8bit *)memchr(cur, needle_begin[0], (size_t)(last - cur) + 1);
+		if(cur == NULL) return (size_t)-1;
+
+		if(memcmp(cur + 1, needle_begin + 1, needle_size - 1) == 0) return (size_t)(cur - begin);
+
+		++false_hits;
 	}
 
-	// loop until null terminator is reached
-	for(int i = start; instring[i] != 0; ++i)
+	if(cur > last) return (size_t)-1;
+
+	// everything before cur was checked
+	size_t found = FindUTF8BytesTwoWay(cur, end, needle_begin, needle_end);
+
+	return (found == (size_t)-1) ? found : (size_t)(cur - begin) + found;
+}
+
+// searches [begin, end) backwards for the bytes in [needle_begin, needle_end)
+// returns the buffer position of the last match or (size_t)-1 if there isn't one. An empty needle matches at end - begin
+// works like FindUTF8Bytes() from the end. The SIMD filter checks a block of places at once, the last one first,
+// and too many places that aren't matches make it finish with FindLastUTF8BytesTwoWay()
+inline size_t FindLastUTF8Bytes(const _uchar8bit *begin, const _uchar8bit *end, const _uchar8bit *needle_begin, const _uchar8bit *needle_end)
+{
+	size_t needle_size = (size_t)(needle_end - needle_begin);
+	if((size_t)(end - begin) < needle_size) return (size_t)-1;
+	if(needle_size == 0) return (size_t)(end - begin);
+
+	// the bytes between the first and the last one
+	size_t middle_size = (needle_size > 2) ? needle_size - 2 : 0;
+
+	// the places before top haven't been checked yet
+	const _uchar8bit *top = end - needle_size + 1;
+	const _uchar8bit *first = top;
+	size_t false_hits = 0;
+
+#if defined(UTF8_USE_AVX2)
+	const __m256i first_byte = _mm256_set1_epi8((char)needle_begin[0]);
+	const __m256i last_byte = _mm256_set1_epi8((char)needle_begin[needle_size - 1]);
+
+	for(; top - begin >= 32; top -= 32)
 	{
-		utf8_encoding cur_encoding;
-		int encoding_size;
+		const _uchar8bit *block = top - 32;
+		__m256i firsts = _mm256_cmpeq_epi8(first_byte, _mm256_loadu_si256((const __m256i *)block));
+		__m256i lasts = _mm256_cmpeq_epi8(last_byte, _mm256_loadu_si256((const __m256i *)(block + needle_size - 1)));
+		std::uint32_t mask = (std::uint32_t)_mm256_movemask_epi8(_mm256_and_si256(firsts, lasts));
+
+		while(mask != 0)
+		{
+			size_t bit = GetHighestSetBit(mask);
+			if(memcmp(block + bit + 1, needle_begin + 1, middle_size) == 0) return (size_t)(block + bit - begin);
 
-		// convert to UTF-8
-		GetUTF8Encoding(instring[i], cur_encoding, encoding_size, default_order);
+			mask &= ~((std::uint32_t)1 << bit);
+			++false_hits;
+		}
+
+		// more than one false hit every 8 bytes. the two-way search can't be slowed down by the needle
+		if(false_hits > 64 + (size_t)(first - top) / 8) break;
+	}
+#elif defined(UTF8_USE_SSE2)
+	const __m128i first_byte = _mm_set1_epi8((char)needle_begin[0]);
+	const __m128i last_byte = _mm_set1_epi8((char)needle_begin[needle_size - 1]);
+
+	for(; top - begin >= 16; top -= 16)
+	{
+		const _uchar8bit *block = top - 16;
+		__m128i firsts = _mm_cmpeq_epi8(first_byte, _mm_loadu_si128((const __m128i *)block));
+		__m128i lasts = _mm_cmpeq_epi8(last_byte, _mm_loadu_si128((const __m128i *)(block + needle_size - 1)));
+		std::uint32_t mask = (std::uint32_t)_mm_movemask_epi8(_mm_and_si128(firsts, lasts));
 
-		// add to the std::string
-		for(int j = 0; j < encoding_size; ++j)
+		while(mask != 0)
 		{
-			*out = cur_encoding[j];
-			++out;
+			size_t bit = GetHighestSetBit(mask);
+			if(memcmp(block + bit + 1, needle_begin + 1, middle_size) == 0) return (size_t)(block + bit - begin);
+
+			mask &= ~((std::uint32_t)1 << bit);
+			++false_hits;
 		}
+
+		if(false_hits > 64 + (size_t)(first - top) / 8) break;
+	}
+#endif
+
+	// the first places or all of them without SIMD
+	for(; (top > begin) && (false_hits <= 64 + (size_t)(first - top) / 8); --top)
+	{
+		const _uchar8bit *cur = top - 1;
+		if(*cur != needle_begin[0]) continue;
+
+		if(memcmp(cur + 1, needle_begin + 1, needle_size - 1) == 0) return (size_t)(cur - begin);
+
+		++false_hits;
 	}
+
+	if(top == begin) return (size_t)-1;
+
+	// everything from top on was checked so the search only has to cover matches that start before it
+	return FindLastUTF8BytesTwoWay(begin, top + needle_size - 1, needle_begin, needle_end);
 }
 
-/// \brief Converts a null-terminated string to UTF-8
-/// This function generates a UTF-8 encoding from a 16 bit null terminated string and places
-/// it inside a std::string.
-/// This is being provided so it can be used with normal std::string objects
-template <typename Alloc>
-inline void MakeUTF8String(const _char16bit* instring_UCS2, std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> &out, bool appendToOut = false)
+// a set of characters for the find_first_of() family of functions
+// ASCII characters are looked up in a bit table, other characters are searched for in the set's buffer
+class UTF8CharacterSet
 {
-	// call the template method
-	MakeUTF8StringImpl(instring_UCS2, out, appendToOut);
+	private:
+		const _uchar8bit *set_begin;
+		const _uchar8bit *set_end;
+		std::uint32_t ascii_bits[4];
+		bool has_multibyte;
+
+	public:
+		// [begin, end) holds the characters of the set in UTF-8
+		UTF8CharacterSet(const _uchar8bit *begin, const _uchar8bit *end)
+			:set_begin(begin), set_end(end), has_multibyte(false)
+		{
+			memset(ascii_bits, 0, sizeof(ascii_bits));
+
+			for(const _uchar8bit *cur = begin; cur < end; ++cur)
+			{
+				if(*cur < 0x80) ascii_bits[*cur >> 5] |= (std::uint32_t)1 << (*cur & 31);
+				else has_multibyte = true;
+			}
+		}
+
+		// checks if the character in [c, c + size) is in the set
+		bool contains(const _uchar8bit *c, size_t size) const
+		{
+			if(*c < 0x80) return ((ascii_bits[*c >> 5] >> (*c & 31)) & 1) != 0;
+			if(!has_multibyte) return false;
+
+			return FindUTF8Bytes(set_begin, set_end, c, c + size) != (size_t)-1;
+		}
+};
+
+// finds the first character in [begin, end) that is in the set, or that isn't in the set if in_set is false
+// returns its buffer position or (size_t)-1 if there isn't one
+// characters are compared whole so a multibyte character only matches itself
+inline size_t FindFirstOfUTF8(const _uchar8bit *begin, const _uchar8bit *end, const UTF8CharacterSet &set, bool in_set = true)
+{
+	for(const _uchar8bit *cur = begin; cur < end; )
+	{
+		const _uchar8bit *next = cur + 1;
+		while((next < end) && ((*next & 0xC0) == 0x80)) ++next;
+
+		if(set.contains(cur, (size_t)(next - cur)) == in_set) return (size_t)(cur - begin);
+
+		cur = next;
+	}
+
+	return (size_t)-1;
 }
 
-/// \brief Converts a null-terminated string to UTF-8
-/// This function generates a UTF-8 encoding from a 16 bit null terminated string and places
-/// it inside a std::string.
-/// This is being provided as a static method so it can be used with normal std::string objects
-template <typename Alloc>
-inline void MakeUTF8String(const _char32bit* instring_UCS4, std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> &out, bool appendToOut = false)
+// finds the last character in [begin, end) that is in the set, or that isn't in the set if in_set is false
+// returns its buffer position or (size_t)-1 if there isn't one
+inline size_t FindLastOfUTF8(const _uchar8bit *begin, const _uchar8bit *end, const UTF8CharacterSet &set, bool in_set = true)
 {
-	// call the template method
-	MakeUTF8StringImpl(instring_UCS4, out, appendToOut);
+	for(const _uchar8bit *cur = end; cur > begin; )
+	{
+		const _uchar8bit *next = cur;
+
+		// step back to the start of the previous character
+		do
+		{
+			--cur;
+		} while((cur > begin) && ((*cur & 0xC0) == 0x80));
+
+		if(set.contains(cur, (size_t)(next - cur)) == in_set) return (size_t)(cur - begin);
+	}
+
+	return (size_t)-1;
 }
 
-inline size_t GetNumCharactersInUTF8String(const _uchar8bit *utf8data)
+// multiplies two 64 bit numbers and gives the low and high halves of the 128 bit result
+inline void MultiplyUTF8Hash(std::uint64_t &a, std::uint64_t &b)
+{
+#if defined(__SIZEOF_INT128__)
+	// __extension__ keeps -Wpedantic quiet about the non standard type
+	__extension__ typedef unsigned __int128 uint128;
+	uint128 r = (uint128)a * b;
+	a = (std::uint64_t)r;
+	b = (std::uint64_t)(r >> 64);
+#else
+	std::uint64_t ha = a >> 32, la = (std::uint32_t)a;
+	std::uint64_t hb = b >> 32, lb = (std::uint32_t)b;
+
+	std::uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+	std::uint64_t mid = (ll >> 32) + (std::uint32_t)hl + (std::uint32_t)lh;
+
+	a = (mid << 32) | (std::uint32_t)ll;
+	b = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+#endif
+}
+
+// folds the 128 bit product of a and b down to 64 bits
+inline std::uint64_t MixUTF8Hash(std::uint64_t a, std::uint64_t b)
+{
+	MultiplyUTF8Hash(a, b);
+
+	return a ^ b;
+}
+
+// unaligned reads for GetUTF8Hash(). they use the byte order of the machine
+inline std::uint64_t ReadUTF8Hash64(const _uchar8bit *p)
+{
+	std::uint64_t v;
+	memcpy(&v, p, 8);
+
+	return v;
+}
+
+inline std::uint64_t ReadUTF8Hash32(const _uchar8bit *p)
+{
+	std::uint32_t v;
+	memcpy(&v, p, 4);
+
+	return v;
+}
+
+// hashes the bytes in [begin, end)
+// this is wyhash (final version 3). Long ranges are hashed 48 bytes at a time in three independent lanes and
+// short ones with at most two multiplies. The result is cut down to size_t on 32 bit systems and can be
+// different on big endian systems
+inline size_t GetUTF8Hash(const _uchar8bit *begin, const _uchar8bit *end)
 {
-	size_t count = 0;
-	while(*utf8data != 0)
+	static const std::uint64_t secret[4] = { 0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL };
+
+	const _uchar8bit *p = begin;
+	size_t len = (size_t)(end - begin);
+
+	std::uint64_t seed = MixUTF8Hash(secret[0], secret[1]);
+	std::uint64_t a, b;
+
+	if(len <= 16)
 	{
-		++count;
-		IncToNextCharacter(utf8data);
+		if(len >= 4)
+		{
+			size_t shift = (len >> 3) << 2;
+			a = (ReadUTF8Hash32(p) << 32) | ReadUTF8Hash32(p + shift);
+			b = (ReadUTF8Hash32(p + len - 4) << 32) | ReadUTF8Hash32(p + len - 4 - shift);
+		}
+		else if(len > 0)
+		{
+			a = ((std::uint64_t)p[0] << 16) | ((std::uint64_t)p[len >> 1] << 8) | p[len - 1];
+			b = 0;
+		}
+		else
+		{
+			a = b = 0;
+		}
+	}
+	else
+	{
+		size_t i = len;
+
+		if(i > 48)
+		{
+			std::uint64_t see1 = seed, see2 = seed;
+
+			do
+			{
+				seed = MixUTF8Hash(ReadUTF8Hash64(p) ^ secret[1], ReadUTF8Hash64(p + 8) ^ seed);
+				see1 = MixUTF8Hash(ReadUTF8Hash64(p + 16) ^ secret[2], ReadUTF8Hash64(p + 24) ^ see1);
+				see2 = MixUTF8Hash(ReadUTF8Hash64(p + 32) ^ secret[3], ReadUTF8Hash64(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			} while(i > 48);
+
+			seed ^= see1 ^ see2;
+		}
+
+		while(i > 16)
+		{
+			seed = MixUTF8Hash(ReadUTF8Hash64(p) ^ secret[1], ReadUTF8Hash64(p + 8) ^ seed);
+			p += 16;
+			i -= 16;
+		}
+
+		// the last 16 bytes. these can overlap bytes that were already hashed
+		a = ReadUTF8Hash64(p + i - 16);
+		b = ReadUTF8Hash64(p + i - 8);
 	}
+
+	a ^= secret[1];
+	b ^= seed;
+	MultiplyUTF8Hash(a, b);
+
+	return (size_t)MixUTF8Hash(a ^ secret[0] ^ len, b ^ secret[1]);
+}
+
+// checks a range for invalid UTF-8 using only plain C++
+// returns the position in the buffer of the first invalid sequence or end - begin if the whole range is valid
+// rejects overlong encodings, surrogates (U+D800 - U+DFFF), values above U+10FFFF and truncated sequences
+inline size_t FindInvalidUTF8Scalar(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	const _uchar8bit *cur = begin;
+
+	while(cur < end)
+	{
+		// skip ASCII 8 bytes at a time
+		if(end - cur >= 8)
+		{
+			std::uint64_t bytes;
+			memcpy(&bytes, cur, 8);
+			if((bytes & 0x8080808080808080ULL) == 0)
+			{
+				cur += 8;
+				continue;
+			}
+		}
+
+		_uchar8bit lead = *cur;
+		size_t remaining = (size_t)(end - cur);
+
+		if(lead < 0x80)
+		{
+			++cur;
+		}
+		else if(lead < 0xC2)
+		{
+			// continuation byte without a lead byte or an overlong 2 byte encoding
+			break;
+		}
+		else if(lead < 0xE0)
+		{
+			// 2 bytes
+			if((remaining < 2) || ((cur[1] & 0xC0) != 0x80)) break;
+			cur += 2;
+		}
+		else if(lead < 0xF0)
+		{
+			// 3 bytes, the range of the second byte is limited to reject overlongs and surrogates
+			_uchar8bit min_second = (lead == 0xE0) ? 0xA0 : 0x80;
+			_uchar8bit max_second = (lead == 0xED) ? 0x9F : 0xBF;
+
+			if((remaining < 3) || (cur[1] < min_second) || (cur[1] > max_second) || ((cur[2] & 0xC0) != 0x80)) break;
+			cur += 3;
+		}
+		else if(lead < 0xF5)
+		{
+			// 4 bytes, the range of the second byte is limited to reject overlongs and values above U+10FFFF
+			_uchar8bit min_second = (lead == 0xF0) ? 0x90 : 0x80;
+			_uchar8bit max_second = (lead == 0xF4) ? 0x8F : 0xBF;
+
+			if((remaining < 4) || (cur[1] < min_second) || (cur[1] > max_second) ||
+				((cur[2] & 0xC0) != 0x80) || ((cur[3] & 0xC0) != 0x80)) break;
+			cur += 4;
+		}
+		else
+		{
+			// would be above U+10FFFF
+			break;
+		}
+	}
+
+	return (size_t)(cur - begin);
+}
+
+#if defined(UTF8_USE_SSSE3) || defined(UTF8_USE_AVX2)
+
+// bits used by the SIMD validator to classify pairs of bytes
+// the method is from "Validating UTF-8 In Less Than One Instruction Per Byte" by John Keiser and Daniel Lemire
+// three table look ups (high nibble of the previous byte, low nibble of the previous byte, and high nibble of the
+// current byte) are ANDed together. Any bit that is left over is an error
+enum UTF8ValidationBits
+{
+	UTF8_TOO_SHORT		= 1 << 0,	// 11______ 0_______ or 11______ 11______
+	UTF8_TOO_LONG		= 1 << 1,	// 0_______ 10______
+	UTF8_OVERLONG_3		= 1 << 2,	// 11100000 100_____
+	UTF8_TOO_LARGE		= 1 << 3,	// 11110100 1001____ and up
+	UTF8_SURROGATE		= 1 << 4,	// 11101101 101_____
+	UTF8_OVERLONG_2		= 1 << 5,	// 1100000_ 10______
+	UTF8_TOO_LARGE_1000	= 1 << 6,	// 11110101 1000____ and up
+	UTF8_OVERLONG_4		= 1 << 6,	// 11110000 1000____
+	UTF8_TWO_CONTS		= 1 << 7,	// 10______ 10______
+	UTF8_CARRY			= UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS
+};
+
+#define UTF8_BYTE_1_HIGH_TABLE \
+	UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, \
+	UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, \
+	UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, \
+	UTF8_TOO_SHORT | UTF8_OVERLONG_2, \
+	UTF8_TOO_SHORT, \
+	UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE, \
+	UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+
+#define UTF8_BYTE_1_LOW_TABLE \
+	UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4, \
+	UTF8_CARRY | UTF8_OVERLONG_2, \
+	UTF8_CARRY, \
+	UTF8_CARRY, \
+	UTF8_CARRY | UTF8_TOO_LARGE, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000, \
+	UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+
+#define UTF8_BYTE_2_HIGH_TABLE \
+	UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, \
+	UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, \
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4, \
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE, \
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE, \
+	UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE, \
+	UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+
+#endif
+
+#if defined(UTF8_USE_AVX2)
+
+// returns the error bits for a 32 byte block. prev_input is the block before it
+inline __m256i CheckUTF8Block(__m256i input, __m256i prev_input)
+{
+	const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+
+	// shift the input right by 1, 2 and 3 bytes, pulling in bytes from the previous block
+	__m256i carried = _mm256_permute2x128_si256(prev_input, input, 0x21);
+	__m256i prev1 = _mm256_alignr_epi8(input, carried, 16 - 1);
+	__m256i prev2 = _mm256_alignr_epi8(input, carried, 16 - 2);
+	__m256i prev3 = _mm256_alignr_epi8(input, carried, 16 - 3);
+
+	__m256i byte_1_high = _mm256_shuffle_epi8(_mm256_setr_epi8(UTF8_BYTE_1_HIGH_TABLE, UTF8_BYTE_1_HIGH_TABLE),
+		_mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble));
+	__m256i byte_1_low = _mm256_shuffle_epi8(_mm256_setr_epi8(UTF8_BYTE_1_LOW_TABLE, UTF8_BYTE_1_LOW_TABLE),
+		_mm256_and_si256(prev1, low_nibble));
+	__m256i byte_2_high = _mm256_shuffle_epi8(_mm256_setr_epi8(UTF8_BYTE_2_HIGH_TABLE, UTF8_BYTE_2_HIGH_TABLE),
+		_mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble));
+
+	__m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+	// the byte after 1110____ or 11110___ must be a continuation byte, and so must the byte after that
+	// only these bytes will have the top bit set after the subtraction
+	__m256i is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+	__m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+	__m256i must_be_23 = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8((char)0x80));
+
+	return _mm256_xor_si256(must_be_23, special_cases);
+}
+
+// returns non zero bytes where the block ends in the middle of a sequence
+inline __m256i IsIncompleteUTF8Block(__m256i input)
+{
+	const __m256i max_value = _mm256_setr_epi8(
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+
+	return _mm256_subs_epu8(input, max_value);
+}
+
+#elif defined(UTF8_USE_SSSE3)
+
+// returns the error bits for a 16 byte block. prev_input is the block before it
+inline __m128i CheckUTF8Block(__m128i input, __m128i prev_input)
+{
+	const __m128i low_nibble = _mm_set1_epi8(0x0F);
+
+	// shift the input right by 1, 2 and 3 bytes, pulling in bytes from the previous block
+	__m128i prev1 = _mm_alignr_epi8(input, prev_input, 16 - 1);
+	__m128i prev2 = _mm_alignr_epi8(input, prev_input, 16 - 2);
+	__m128i prev3 = _mm_alignr_epi8(input, prev_input, 16 - 3);
+
+	__m128i byte_1_high = _mm_shuffle_epi8(_mm_setr_epi8(UTF8_BYTE_1_HIGH_TABLE),
+		_mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble));
+	__m128i byte_1_low = _mm_shuffle_epi8(_mm_setr_epi8(UTF8_BYTE_1_LOW_TABLE),
+		_mm_and_si128(prev1, low_nibble));
+	__m128i byte_2_high = _mm_shuffle_epi8(_mm_setr_epi8(UTF8_BYTE_2_HIGH_TABLE),
+		_mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+
+	__m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+	// the byte after 1110____ or 11110___ must be a continuation byte, and so must the byte after that
+	// only these bytes will have the top bit set after the subtraction
+	__m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80)));
+	__m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)));
+	__m128i must_be_23 = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8((char)0x80));
+
+	return _mm_xor_si128(must_be_23, special_cases);
+}
+
+// returns non zero bytes where the block ends in the middle of a sequence
+inline __m128i IsIncompleteUTF8Block(__m128i input)
+{
+	const __m128i max_value = _mm_setr_epi8(
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+
+	return _mm_subs_epu8(input, max_value);
+}
+
+#endif
+
+// checks a range for invalid UTF-8 and copies it to out at the same time if out isn't NULL
+// returns the position in the buffer of the first invalid sequence or end - begin if the whole range is valid
+// if the range is invalid the contents of out are undefined
+inline size_t ValidateUTF8Impl(const _uchar8bit *begin, const _uchar8bit *end, _uchar8bit *out)
+{
+	const _uchar8bit *cur = begin;
+
+#if defined(UTF8_USE_AVX2) || defined(UTF8_USE_SSSE3)
+
+	#if defined(UTF8_USE_AVX2)
+		typedef __m256i block_type;
+		#define UTF8_BLOCK_LOAD(p) _mm256_loadu_si256((const __m256i *)(p))
+		#define UTF8_BLOCK_STORE(p, v) _mm256_storeu_si256((__m256i *)(p), v)
+		#define UTF8_BLOCK_OR(a, b) _mm256_or_si256(a, b)
+		#define UTF8_BLOCK_ZERO() _mm256_setzero_si256()
+		#define UTF8_BLOCK_IS_ZERO(v) _mm256_testz_si256(v, v)
+		#define UTF8_BLOCK_IS_ASCII(v) (_mm256_movemask_epi8(v) == 0)
+	#else
+		typedef __m128i block_type;
+		#define UTF8_BLOCK_LOAD(p) _mm_loadu_si128((const __m128i *)(p))
+		#define UTF8_BLOCK_STORE(p, v) _mm_storeu_si128((__m128i *)(p), v)
+		#define UTF8_BLOCK_OR(a, b) _mm_or_si128(a, b)
+		#define UTF8_BLOCK_ZERO() _mm_setzero_si128()
+		#define UTF8_BLOCK_IS_ZERO(v) (_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) == 0xFFFF)
+		#define UTF8_BLOCK_IS_ASCII(v) (_mm_movemask_epi8(v) == 0)
+	#endif
+
+	const size_t block_size = sizeof(block_type);
+
+	block_type prev_input = UTF8_BLOCK_ZERO();
+	block_type prev_incomplete = UTF8_BLOCK_ZERO();
+	bool failed = false;
+
+	while((size_t)(end - cur) >= block_size)
+	{
+		block_type input = UTF8_BLOCK_LOAD(cur);
+		if(out) UTF8_BLOCK_STORE(out + (cur - begin), input);
+
+		block_type error;
+		if(UTF8_BLOCK_IS_ASCII(input))
+		{
+			// only an error if the last block ended in the middle of a sequence
+			error = prev_incomplete;
+		}
+		else
+		{
+			error = CheckUTF8Block(input, prev_input);
+			prev_incomplete = IsIncompleteUTF8Block(input);
+		}
+
+		if(!UTF8_BLOCK_IS_ZERO(error))
+		{
+			failed = true;
+			break;
+		}
+
+		prev_input = input;
+		cur += block_size;
+	}
+
+	if(!failed)
+	{
+		// check the rest using a block padded with zeros
+		// a sequence cut off by the end of the range will be followed by a zero so it gets caught here
+		size_t remaining = (size_t)(end - cur);
+		_uchar8bit last_block[block_size];
+		memset(last_block, 0, block_size);
+		memcpy(last_block, cur, remaining);
+		if(out) memcpy(out + (cur - begin), cur, remaining);
+
+		block_type error = CheckUTF8Block(UTF8_BLOCK_LOAD(last_block), prev_input);
+		if(UTF8_BLOCK_IS_ZERO(error)) return (size_t)(end - begin);
+	}
+
+	#undef UTF8_BLOCK_LOAD
+	#undef UTF8_BLOCK_STORE
+	#undef UTF8_BLOCK_OR
+	#undef UTF8_BLOCK_ZERO
+	#undef UTF8_BLOCK_IS_ZERO
+	#undef UTF8_BLOCK_IS_ASCII
+
+	// there is an error in this block or in a sequence that started in the last 3 bytes of the block before it
+	// everything before that is valid so find the first character that starts there and find the error exactly
+	const _uchar8bit *restart = begin;
+	if(cur - begin > 3)
+	{
+		restart = cur - 3;
+		while((restart < cur) && ((*restart & 0xC0) == 0x80)) ++restart;
+	}
+
+	return (size_t)(restart - begin) + FindInvalidUTF8Scalar(restart, end);
+
+#else
+
+	size_t valid_size = FindInvalidUTF8Scalar(cur, end);
+	if(out && (valid_size == (size_t)(end - begin))) memcpy(out, begin, valid_size);
+
+	return valid_size;
+
+#endif
+}
+
+/// \brief Finds the first invalid UTF-8 sequence in a range
+/// Returns the position in the buffer of the first byte of the first invalid sequence or end - begin if the
+/// whole range is valid. Overlong encodings, surrogates (U+D800 - U+DFFF), values above U+10FFFF,
+/// continuation bytes without a lead byte, and sequences cut off by the end of the range are all invalid.
+inline size_t FindInvalidUTF8(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	return ValidateUTF8Impl(begin, end, NULL);
+}
+
+/// \brief Checks that a range is valid UTF-8
+inline bool IsValidUTF8(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	return FindInvalidUTF8(begin, end) == (size_t)(end - begin);
+}
+
+/// \brief Copies a range to out while checking that it's valid UTF-8
+/// Only reads the input once. Returns the same value as FindInvalidUTF8().
+/// out should point to a buffer of at least end - begin bytes. Its contents are undefined if the input isn't valid.
+inline size_t CopyValidUTF8(const _uchar8bit *begin, const _uchar8bit *end, _uchar8bit *out)
+{
+	return ValidateUTF8Impl(begin, end, out);
+}
+
+// returns true if c is the first half of a UTF-16 surrogate pair
+inline bool IsHighSurrogate(_char32bit c)
+{
+	return (c >= 0xD800) && (c <= 0xDBFF);
+}
+
+// returns true if c is the second half of a UTF-16 surrogate pair
+inline bool IsLowSurrogate(_char32bit c)
+{
+	return (c >= 0xDC00) && (c <= 0xDFFF);
+}
+
+// reverses the byte order of a 16 bit or 32 bit code unit
+template <typename char_type>
+inline _char32bit SwapByteOrder(char_type in_char)
+{
+	_char32bit c = (_char32bit)in_char;
+
+	if(sizeof(char_type) == 2)
+	{
+		return ((c & 0x00ff) << 8) + ((c & 0xff00) >> 8);
+	}
+
+	return ((c & 0x000000ff) << 24) + ((c & 0x0000ff00) << 8) + ((c & 0x00ff0000) >> 8) + ((c & 0xff000000) >> 24);
+}
+
+// checks for a byte order mark at the start of a 16 bit or 32 bit string
+// returns the number of code units to skip (0 or 1)
+// default_order is set to false if the byte order doesn't match the system
+template <typename char_type>
+inline size_t ReadByteOrderMark(const char_type *instring, size_t length, bool &default_order)
+{
+	default_order = true;
+
+	if(length == 0) return 0;
+
+	_char32bit first = (_char32bit)instring[0];
+
+	if(first == 0xfeff) return 1;
+
+	if(first == SwapByteOrder((char_type)0xfeff))
+	{
+		default_order = false;
+		return 1;
+	}
+
+	return 0;
+}
+
+// returns the number of code units before the null terminator
+template <typename char_type>
+inline size_t GetStringLength(const char_type *instring)
+{
+	const char_type *end = instring;
+	while(*end != 0) ++end;
+
+	return (size_t)(end - instring);
+}
+
+// reads one character from a UTF-16 or UTF-32 string and moves cur past it
+// surrogate pairs are joined. A surrogate without its other half is returned as is
+template <typename char_type>
+inline _char32bit ReadUnicodeCharacter(const char_type *&cur, const char_type *end, bool default_order)
+{
+	_char32bit c = default_order ? (_char32bit)*cur : SwapByteOrder(*cur);
+	++cur;
+
+	if(IsHighSurrogate(c) && (cur < end))
+	{
+		_char32bit next = default_order ? (_char32bit)*cur : SwapByteOrder(*cur);
+		if(IsLowSurrogate(next))
+		{
+			c = 0x10000 + ((c - 0xD800) << 10) + (next - 0xDC00);
+			++cur;
+		}
+	}
+
+	return c;
+}
+
+// returns the number of bytes needed to encode c in UTF-8
+inline size_t GetUTF8CharacterSize(_char32bit c)
+{
+	if(c < 0x80) return 1;
+	else if(c < 0x800) return 2;
+	else if(c < 0x10000) return 3;
+	return 4;
+}
+
+// writes the UTF-8 encoding of c to out and returns the number of bytes written
+// out must have room for 4 bytes
+inline size_t WriteUTF8Character(_char32bit c, _uchar8bit *out)
+{
+	if(c < 0x80)
+	{
+		out[0] = (_uchar8bit)c;
+		return 1;
+	}
+	else if(c < 0x800)
+	{
+		out[0] = (_uchar8bit)(0xC0 + (c >> 6));
+		out[1] = (_uchar8bit)(0x80 + (c & 0x3F));
+		return 2;
+	}
+	else if(c < 0x10000)
+	{
+		out[0] = (_uchar8bit)(0xE0 + (c >> 12));
+		out[1] = (_uchar8bit)(0x80 + ((c >> 6) & 0x3F));
+		out[2] = (_uchar8bit)(0x80 + (c & 0x3F));
+		return 3;
+	}
+
+	out[0] = (_uchar8bit)(0xF0 + ((c >> 18) & 0x07));
+	out[1] = (_uchar8bit)(0x80 + ((c >> 12) & 0x3F));
+	out[2] = (_uchar8bit)(0x80 + ((c >> 6) & 0x3F));
+	out[3] = (_uchar8bit)(0x80 + (c & 0x3F));
+	return 4;
+}
+
+#if defined(UTF8_USE_SSE2)
+
+// loads a block of 8 16 bit code units or 4 32 bit code units
+// returns the number of UTF-8 bytes needed for the block in each 16 or 32 bit lane
+// has_surrogates is set if any of the code units are surrogates because they need to be checked for pairs
+template <typename char_type>
+inline __m128i GetUTF8BlockSize(__m128i units, bool &has_surrogates)
+{
+	if(sizeof(char_type) == 2)
+	{
+		__m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xF800)), _mm_set1_epi16((short)0xD800));
+		has_surrogates = (_mm_movemask_epi8(surrogates) != 0);
+
+		// 3 bytes, minus 1 if less than 0x800, minus 1 more if less than 0x80
+		__m128i less_than_80 = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128());
+		__m128i less_than_800 = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xF800)), _mm_setzero_si128());
+
+		return _mm_add_epi16(_mm_set1_epi16(3), _mm_add_epi16(less_than_80, less_than_800));
+	}
+
+	__m128i surrogates = _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32((int)0xFFFFF800)), _mm_set1_epi32(0xD800));
+	has_surrogates = (_mm_movemask_epi8(surrogates) != 0);
+
+	// 4 bytes, minus 1 for each limit the character is under
+	__m128i less_than_80 = _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32((int)0xFFFFFF80)), _mm_setzero_si128());
+	__m128i less_than_800 = _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32((int)0xFFFFF800)), _mm_setzero_si128());
+	__m128i less_than_10000 = _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32((int)0xFFFF0000)), _mm_setzero_si128());
+
+	return _mm_add_epi32(_mm_set1_epi32(4), _mm_add_epi32(less_than_80, _mm_add_epi32(less_than_800, less_than_10000)));
+}
+
+// adds the lanes of the counters from GetUTF8BlockSize() together
+template <typename char_type>
+inline size_t SumUTF8BlockSizes(__m128i counters)
+{
+	// make 4 32 bit sums
+	if(sizeof(char_type) == 2) counters = _mm_madd_epi16(counters, _mm_set1_epi16(1));
+
+	counters = _mm_add_epi32(counters, _mm_srli_si128(counters, 8));
+	counters = _mm_add_epi32(counters, _mm_srli_si128(counters, 4));
+
+	return (size_t)(unsigned int)_mm_cvtsi128_si32(counters);
+}
+
+// encodes a block of 8 16 bit or 4 32 bit code units if they're all ASCII, all 2 byte characters, or
+// (with SSSE3) all 3 byte characters
+// returns the number of bytes written or 0 if the block has to be encoded one character at a time
+template <typename char_type>
+inline size_t EncodeUTF8Block(__m128i units, _uchar8bit *out)
+{
+	const int num_units = 16 / sizeof(char_type);
+
+	// mask from _mm_movemask_epi8() when the compare is true for every unit in the block
+	// 32 bit units are narrowed to 16 bits in the low half of the register
+	const int all_lanes = (sizeof(char_type) == 2) ? 0xFFFF : 0xFF;
+
+	if(sizeof(char_type) == 4)
+	{
+		__m128i less_than_800 = _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32((int)0xFFFFF800)), _mm_setzero_si128());
+		if(_mm_movemask_epi8(less_than_800) == 0xFFFF)
+		{
+			// the units fit in a signed 16 bit value so they can be packed
+			units = _mm_packs_epi32(units, units);
+		}
+		else
+		{
+#if defined(UTF8_USE_SSSE3)
+			__m128i less_than_10000 = _mm_cmpeq_epi32(_mm_and_si128(units, _mm_set1_epi32((int)0xFFFF0000)), _mm_setzero_si128());
+			if(_mm_movemask_epi8(less_than_10000) != 0xFFFF) return 0;
+
+			// take the low 16 bits of each unit
+			units = _mm_shuffle_epi8(units, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1));
+#else
+			return 0;
+#endif
+		}
+	}
+
+	__m128i less_than_80 = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128());
+	int ascii_mask = _mm_movemask_epi8(less_than_80) & all_lanes;
+
+	if(ascii_mask == all_lanes)
+	{
+		// all ASCII, just narrow to 8 bits
+		__m128i bytes = _mm_packus_epi16(units, units);
+		if(sizeof(char_type) == 2) _mm_storel_epi64((__m128i *)out, bytes);
+		else
+		{
+			int four_bytes = _mm_cvtsi128_si32(bytes);
+			memcpy(out, &four_bytes, 4);
+		}
+
+		return num_units;
+	}
+
+	__m128i less_than_800 = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xF800)), _mm_setzero_si128());
+	int two_byte_mask = _mm_movemask_epi8(_mm_andnot_si128(less_than_80, less_than_800)) & all_lanes;
+
+	if(two_byte_mask == all_lanes)
+	{
+		// all 2 byte characters. Each 16 bit lane becomes 110xxxxx 10xxxxxx in memory order
+		__m128i lead = _mm_or_si128(_mm_srli_epi16(units, 6), _mm_set1_epi16(0xC0));
+		__m128i trail = _mm_or_si128(_mm_and_si128(units, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+		__m128i bytes = _mm_or_si128(lead, _mm_slli_epi16(trail, 8));
+
+		if(sizeof(char_type) == 2) _mm_storeu_si128((__m128i *)out, bytes);
+		else _mm_storel_epi64((__m128i *)out, bytes);
+
+		return num_units * 2;
+	}
+
+#if defined(UTF8_USE_SSSE3)
+	__m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short)0xF800)), _mm_set1_epi16((short)0xD800));
+	int three_byte_mask = _mm_movemask_epi8(_mm_or_si128(less_than_800, surrogates)) & all_lanes;
+
+	if(three_byte_mask == 0)
+	{
+		// all 3 byte characters
+		// build 1110xxxx 10xxxxxx pairs in 16 bit lanes and the last 10xxxxxx bytes separately
+		// then interleave them into 3 byte groups
+		__m128i lead = _mm_or_si128(_mm_srli_epi16(units, 12), _mm_set1_epi16(0xE0));
+		__m128i middle = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(units, 6), _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+		__m128i last = _mm_or_si128(_mm_and_si128(units, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+
+		__m128i lead_middle = _mm_or_si128(lead, _mm_slli_epi16(middle, 8));
+		__m128i last_bytes = _mm_packus_epi16(last, last);
+
+		__m128i first_16 = _mm_or_si128(
+			_mm_shuffle_epi8(lead_middle, _mm_setr_epi8(0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1, 10)),
+			_mm_shuffle_epi8(last_bytes, _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1)));
+
+		if(sizeof(char_type) == 2)
+		{
+			__m128i next_8 = _mm_or_si128(
+				_mm_shuffle_epi8(lead_middle, _mm_setr_epi8(11, -1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+				_mm_shuffle_epi8(last_bytes, _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1)));
+
+			_mm_storeu_si128((__m128i *)out, first_16);
+			_mm_storel_epi64((__m128i *)(out + 16), next_8);
+		}
+		else
+		{
+			// only the first 12 bytes are used
+			_mm_storel_epi64((__m128i *)out, first_16);
+			int four_bytes = _mm_cvtsi128_si32(_mm_srli_si128(first_16, 8));
+			memcpy(out + 8, &four_bytes, 4);
+		}
+
+		return num_units * 3;
+	}
+#endif
+
+	return 0;
+}
+
+#endif
+
+/// \brief Gets the exact number of bytes needed to encode a UTF-16 or UTF-32 string in UTF-8
+/// Surrogate pairs take 4 bytes. A surrogate without its other half takes 3.
+/// default_order should be false if the byte order of the string doesn't match the system
+template <typename char_type>
+inline size_t GetUTF8BufferSize(const char_type *begin, const char_type *end, bool default_order = true)
+{
+	size_t size = 0;
+	const char_type *cur = begin;
+
+#if defined(UTF8_USE_SSE2)
+	if(default_order)
+	{
+		const size_t block_units = 16 / sizeof(char_type);
+
+		while((size_t)(end - cur) >= block_units)
+		{
+			// the 16 bit counters can go up to 3 * 4096 without overflowing
+			__m128i counters = _mm_setzero_si128();
+			for(int i = 0; (i < 4096) && ((size_t)(end - cur) >= block_units); ++i)
+			{
+				bool has_surrogates;
+				__m128i block_size = GetUTF8BlockSize<char_type>(_mm_loadu_si128((const __m128i *)cur), has_surrogates);
+
+				if(has_surrogates)
+				{
+					// go one character at a time until the block is past the surrogates
+					size += GetUTF8CharacterSize(ReadUnicodeCharacter(cur, end, true));
+				}
+				else
+				{
+					if(sizeof(char_type) == 2) counters = _mm_add_epi16(counters, block_size);
+					else counters = _mm_add_epi32(counters, block_size);
+					cur += block_units;
+				}
+			}
+
+			size += SumUTF8BlockSizes<char_type>(counters);
+		}
+	}
+#endif
+
+	while(cur < end)
+	{
+		size += GetUTF8CharacterSize(ReadUnicodeCharacter(cur, end, default_order));
+	}
+
+	return size;
+}
+
+/// \brief Encodes a UTF-16 or UTF-32 string as UTF-8
+/// out must point to a buffer of at least GetUTF8BufferSize() bytes. Returns a pointer to just after the last byte written.
+/// default_order should be false if the byte order of the string doesn't match the system
+template <typename char_type>
+inline _uchar8bit *EncodeUTF8(const char_type *begin, const char_type *end, _uchar8bit *out, bool default_order = true)
+{
+	const char_type *cur = begin;
+
+#if defined(UTF8_USE_SSE2)
+	if(default_order)
+	{
+		const size_t block_units = 16 / sizeof(char_type);
+
+		while((size_t)(end - cur) >= block_units)
+		{
+			size_t written = EncodeUTF8Block<char_type>(_mm_loadu_si128((const __m128i *)cur), out);
+
+			if(written)
+			{
+				out += written;
+				cur += block_units;
+			}
+			else
+			{
+				// mixed block, do one character and try again from there
+				out += WriteUTF8Character(ReadUnicodeCharacter(cur, end, true), out);
+			}
+		}
+	}
+#endif
+
+	while(cur < end)
+	{
+		out += WriteUTF8Character(ReadUnicodeCharacter(cur, end, default_order), out);
+	}
+
+	return out;
+}
+
+// reads a null-terminated unicode string to get the buffer size needed to encode it in UTF-8
+template <class T>
+inline size_t GetMinimumBufferSize(const T *string)
+{
+	size_t length = GetStringLength(string);
+
+	bool default_order;
+	size_t start = ReadByteOrderMark(string, length, default_order);
+
+	return GetUTF8BufferSize(string + start, string + length, default_order);
+}
+
+// use a template method because the 16bit and 32 bit implementations are identical
+// except for the type
+// the size of the output is worked out first so out only has to grow once
+template <typename char_type, typename Alloc>
+inline void MakeUTF8StringImpl(const char_type* instring, size_t length, std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> &out, bool appendToOut)
+{
+	// first empty the string
+	if(!appendToOut) out.clear();
+
+	// check for byte order mark
+	bool default_order;
+	const char_type *begin = instring + ReadByteOrderMark(instring, length, default_order);
+	const char_type *end = instring + length;
+
+	size_t start = out.length();
+	size_t encoded_size = GetUTF8BufferSize(begin, end, default_order);
+	if(encoded_size == 0) return;
+
+	out.resize(start + encoded_size);
+
+	EncodeUTF8(begin, end, &out[start], default_order);
+}
+
+// use a template method because the 16bit and 32 bit implementations are identical
+// except for the type
+template <typename char_type, typename Alloc>
+inline void MakeUTF8StringImpl(const char_type* instring, std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> &out, bool appendToOut)
+{
+	MakeUTF8StringImpl(instring, GetStringLength(instring), out, appendToOut);
+}
+
+// make this method private to restrict which types can be called
+// use a template method because the 16bit and 32 bit implementations are identical
+// except for the type
+// out should point to a buffer large enough to hold the data. GetMinimumBufferSize() gives the size needed
+template <typename char_type>
+inline void MakeUTF8StringImpl(const char_type* instring, _uchar8bit *out)
+{
+	size_t length = GetStringLength(instring);
+
+	// check for byte order mark
+	bool default_order;
+	size_t start = ReadByteOrderMark(instring, length, default_order);
+
+	EncodeUTF8(instring + start, instring + length, out, default_order);
+}
+
+/// \brief Converts a null-terminated string to UTF-8
+/// This function generates a UTF-8 encoding from a 16 bit null terminated string and places
+/// it inside a std::string.
+/// This is being provided so it can be used with normal std::string objects
+template <typename Alloc>
+inline void MakeUTF8String(const _char16bit* instring_UCS2, std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> &out, bool appendToOut = false)
+{
+	// call the template method
+	MakeUTF8StringImpl(instring_UCS2, out, appendToOut);
+}
+
+/// \brief Converts a null-terminated string to UTF-8
+/// This function generates a UTF-8 encoding from a 16 bit null terminated string and places
+/// it inside a std::string.
+/// This is being provided as a static method so it can be used with normal std::string objects
+template <typename Alloc>
+inline void MakeUTF8String(const _char32bit* instring_UCS4, std::basic_string<_uchar8bit, std::char_traits<unsigned char>, Alloc> &out, bool appendToOut = false)
+{
+	// call the template method
+	MakeUTF8StringImpl(instring_UCS4, out, appendToOut);
+}
+
+inline size_t GetNumCharactersInUTF8String(const _uchar8bit *utf8data)
+{
+	return CountUTF8Characters(utf8data, utf8data + strlen((const char *)utf8data));
+}
+
+/// \brief Gets the number of UTF-16 code units needed to hold a UTF-8 range
+/// Characters above U+FFFF need a surrogate pair so each 4 byte sequence counts twice.
+inline size_t GetUTF16BufferSize(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	size_t four_byte_leads = 0;
+	const _uchar8bit *cur = begin;
+
+#if defined(UTF8_USE_SSE2)
+	while(end - cur >= 16)
+	{
+		// each 8 bit counter can only be incremented 255 times before it overflows
+		__m128i counters = _mm_setzero_si128();
+		for(int i = 0; (i < 255) && (end - cur >= 16); ++i, cur += 16)
+		{
+			__m128i bytes = _mm_loadu_si128((const __m128i *)cur);
+			__m128i is_four_byte_lead = _mm_cmpeq_epi8(_mm_and_si128(bytes, _mm_set1_epi8((char)0xF0)), _mm_set1_epi8((char)0xF0));
+			counters = _mm_sub_epi8(counters, is_four_byte_lead);
+		}
+
+		__m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+		four_byte_leads += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+	}
+#endif
+
+	for(; cur < end; ++cur)
+	{
+		if(*cur >= 0xF0) ++four_byte_leads;
+	}
+
+	return CountUTF8Characters(begin, end) + four_byte_leads;
+}
+
+// moves cur past the continuation bytes of a sequence that is cut short and returns U+FFFD
+// cur must point just after the lead byte
+inline _char32bit SkipBrokenUTF8Character(_uchar8bit lead, const _uchar8bit *&cur, const _uchar8bit *end)
+{
+	size_t needed = (lead < 0xE0) ? 1 : ((lead < 0xF0) ? 2 : 3);
+	for(size_t i = 0; (i < needed) && (cur < end) && ((*cur & 0xC0) == 0x80); ++i) ++cur;
+
+	return 0xFFFD;
+}
+
+// decodes the character starting at cur and moves cur past it without reading past end
+// a sequence that is cut short by end or by a byte that isn't a continuation byte gives U+FFFD
+// cur must point to a lead byte
+inline _char32bit DecodeUTF8Character(const _uchar8bit *&cur, const _uchar8bit *end)
+{
+	_uchar8bit lead = *cur++;
+
+	if(lead < 0x80) return lead;
+
+	// check the whole sequence at once when it's all there. this is the usual case
+	if(lead < 0xE0)
+	{
+		if((cur < end) && ((cur[0] & 0xC0) == 0x80))
+		{
+			_char32bit c = ((lead & 0x1F) << 6) | (cur[0] & 0x3F);
+			cur += 1;
+			return c;
+		}
+	}
+	else if(lead < 0xF0)
+	{
+		if((end - cur >= 2) && ((cur[0] & 0xC0) == 0x80) && ((cur[1] & 0xC0) == 0x80))
+		{
+			_char32bit c = ((lead & 0x0F) << 12) | ((cur[0] & 0x3F) << 6) | (cur[1] & 0x3F);
+			cur += 2;
+			return c;
+		}
+	}
+	else
+	{
+		if((end - cur >= 3) && ((cur[0] & 0xC0) == 0x80) && ((cur[1] & 0xC0) == 0x80) && ((cur[2] & 0xC0) == 0x80))
+		{
+			_char32bit c = ((lead & 0x07) << 18) | ((cur[0] & 0x3F) << 12) | ((cur[1] & 0x3F) << 6) | (cur[2] & 0x3F);
+			cur += 3;
+			return c;
+		}
+	}
+
+	return SkipBrokenUTF8Character(lead, cur, end);
+}
+
+// writes c to out as UTF-16 if char_type is 16 bits wide, or UTF-32 if it isn't
+// returns the number of code units written
+template <typename char_type>
+inline size_t WriteUnicodeCharacter(_char32bit c, char_type *out)
+{
+	if((sizeof(char_type) == 2) && (c >= 0x10000))
+	{
+		c -= 0x10000;
+		out[0] = (char_type)(0xD800 + ((c >> 10) & 0x3FF));
+		out[1] = (char_type)(0xDC00 + (c & 0x3FF));
+		return 2;
+	}
+
+	out[0] = (char_type)c;
+	return 1;
+}
+
+#if defined(UTF8_USE_SSE2)
+
+// stores 4 32 bit values as either 16 bit or 32 bit code units
+template <typename char_type>
+inline void StoreUnicodeBlock(__m128i values, char_type *out)
+{
+	if(sizeof(char_type) == 2)
+	{
+		// the values are all under 0x10000, move the low halves together
+		__m128i low_halves = _mm_shufflelo_epi16(values, _MM_SHUFFLE(3, 3, 2, 0));
+		low_halves = _mm_shufflehi_epi16(low_halves, _MM_SHUFFLE(3, 3, 2, 0));
+		low_halves = _mm_shuffle_epi32(low_halves, _MM_SHUFFLE(3, 3, 2, 0));
+		_mm_storel_epi64((__m128i *)out, low_halves);
+	}
+	else
+	{
+		_mm_storeu_si128((__m128i *)out, values);
+	}
+}
+
+// stores 8 16 bit values as either 16 bit or 32 bit code units
+template <typename char_type>
+inline void StoreUnicodeBlock16(__m128i values, char_type *out)
+{
+	if(sizeof(char_type) == 2)
+	{
+		_mm_storeu_si128((__m128i *)out, values);
+	}
+	else
+	{
+		_mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi16(values, _mm_setzero_si128()));
+		_mm_storeu_si128((__m128i *)(out + 4), _mm_unpackhi_epi16(values, _mm_setzero_si128()));
+	}
+}
+
+#endif
+
+// decodes whole characters from position while they fit in [out, out_end) and moves position past them
+// returns where the next code unit would be written. The output is UTF-16 with surrogate pairs if char_type
+// is 16 bits wide and UTF-32 otherwise. Stops at end or when the next character doesn't fit
+// shared by DecodeUTF8() and DecodeUTF8Block()
+template <typename char_type>
+inline char_type *DecodeUTF8Units(const _uchar8bit *&position, const _uchar8bit *end, char_type *out, char_type *out_end)
+{
+	// work on a copy so the compiler can keep it in a register
+	const _uchar8bit *cur = position;
+
+	// the most code units one character can take
+	const ptrdiff_t widest = (sizeof(char_type) == 2) ? 2 : 1;
+
+#if defined(UTF8_USE_SSE2)
+	while((end - cur >= 16) && (out_end - out >= 16))
+	{
+		// skip anything that isn't the start of a character
+		if((*cur & 0xC0) == 0x80)
+		{
+			++cur;
+			continue;
+		}
+
+		__m128i bytes = _mm_loadu_si128((const __m128i *)cur);
+		int non_ascii = _mm_movemask_epi8(bytes);
+
+		if(non_ascii == 0)
+		{
+			// 16 ASCII characters
+			__m128i low = _mm_unpacklo_epi8(bytes, _mm_setzero_si128());
+			__m128i high = _mm_unpackhi_epi8(bytes, _mm_setzero_si128());
+
+			StoreUnicodeBlock16(low, out);
+			StoreUnicodeBlock16(high, out + 8);
+
+			cur += 16;
+			out += 16;
+			continue;
+		}
+
+		// 8 2 byte characters, each 16 bit lane holds 110xxxxx in its low byte and 10xxxxxx in its high byte
+		__m128i two_byte_check = _mm_cmpeq_epi16(_mm_and_si128(bytes, _mm_set1_epi16((short)0xC0E0)), _mm_set1_epi16((short)0x80C0));
+		if(_mm_movemask_epi8(two_byte_check) == 0xFFFF)
+		{
+			__m128i high_bits = _mm_slli_epi16(_mm_and_si128(bytes, _mm_set1_epi16(0x1F)), 6);
+			__m128i low_bits = _mm_and_si128(_mm_srli_epi16(bytes, 8), _mm_set1_epi16(0x3F));
+
+			StoreUnicodeBlock16(_mm_or_si128(high_bits, low_bits), out);
+
+			cur += 16;
+			out += 8;
+			continue;
+		}
+
+#if defined(UTF8_USE_SSSE3)
+		// 4 3 byte characters in the first 12 bytes
+		__m128i three_byte_check = _mm_cmpeq_epi8(
+			_mm_and_si128(bytes, _mm_setr_epi8((char)0xF0, (char)0xC0, (char)0xC0, (char)0xF0, (char)0xC0, (char)0xC0,
+				(char)0xF0, (char)0xC0, (char)0xC0, (char)0xF0, (char)0xC0, (char)0xC0, 0, 0, 0, 0)),
+			_mm_setr_epi8((char)0xE0, (char)0x80, (char)0x80, (char)0xE0, (char)0x80, (char)0x80,
+				(char)0xE0, (char)0x80, (char)0x80, (char)0xE0, (char)0x80, (char)0x80, 0, 0, 0, 0));
+		if(_mm_movemask_epi8(three_byte_check) == 0xFFFF)
+		{
+			// put each character in a 32 bit lane as last, middle, lead, 0 and pull the bits together
+			__m128i lanes = _mm_shuffle_epi8(bytes, _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1));
+			__m128i values = _mm_or_si128(_mm_and_si128(lanes, _mm_set1_epi32(0x3F)),
+				_mm_or_si128(_mm_and_si128(_mm_srli_epi32(lanes, 2), _mm_set1_epi32(0xFC0)),
+					_mm_and_si128(_mm_srli_epi32(lanes, 4), _mm_set1_epi32(0xF000))));
+
+			StoreUnicodeBlock(values, out);
+
+			cur += 12;
+			out += 4;
+			continue;
+		}
+#endif
+
+		// mixed block. Store all 16 bytes as if they were ASCII and keep the ones before the first non-ASCII byte
+		size_t ascii_count = GetLowestSetBit((std::uint32_t)non_ascii);
+		StoreUnicodeBlock16(_mm_unpacklo_epi8(bytes, _mm_setzero_si128()), out);
+		StoreUnicodeBlock16(_mm_unpackhi_epi8(bytes, _mm_setzero_si128()), out + 8);
+
+		const _uchar8bit *block_end = cur + 16;
+		cur += ascii_count;
+		out += ascii_count;
+
+		// decode the rest of the characters that start in the block one at a time before loading the next one
+		// so runs of characters the checks above can't take only cost one load per 16 bytes
+		while((cur < block_end) && (out_end - out >= 2))
+		{
+			if(*cur < 0x80) *out++ = (char_type)*cur++;
+			else if((*cur & 0xC0) == 0x80) ++cur;
+			else out += WriteUnicodeCharacter(DecodeUTF8Character(cur, end), out);
+		}
+	}
+#endif
+
+	while(cur < end)
+	{
+		if(*cur < 0x80)
+		{
+			if(out == out_end) break;
+
+			*out++ = (char_type)*cur++;
+			continue;
+		}
+
+		// skip anything that isn't the start of a character
+		if((*cur & 0xC0) == 0x80)
+		{
+			++cur;
+			continue;
+		}
+
+		if(out_end - out < widest)
+		{
+			if(out == out_end) break;
+
+			// a character that takes one unit can still go in the last place
+			const _uchar8bit *next = cur;
+			_char32bit c = DecodeUTF8Character(next, end);
+			if(c >= 0x10000) break;
+
+			*out++ = (char_type)c;
+			cur = next;
+			continue;
+		}
+
+		out += WriteUnicodeCharacter(DecodeUTF8Character(cur, end), out);
+	}
+
+	position = cur;
+
+	return out;
+}
+
+/// \brief Decodes a UTF-8 range into UTF-16 or UTF-32
+/// The output is UTF-16 with surrogate pairs if char_type is 16 bits wide and UTF-32 otherwise.
+/// out_size is the number of code units out has room for. GetUTF16BufferSize() units for UTF-16 or
+/// CountUTF8Characters() units for UTF-32 is always enough. Decoding stops at the first character that doesn't
+/// fit. Returns the number of code units written. The input doesn't have to be null terminated and the decoder
+/// never reads past end or writes past out + out_size. Broken sequences are written as U+FFFD.
+template <typename char_type>
+inline size_t DecodeUTF8(const _uchar8bit *begin, const _uchar8bit *end, char_type *out, size_t out_size)
+{
+	const _uchar8bit *cur = begin;
+
+	return (size_t)(DecodeUTF8Units(cur, end, out, out + out_size) - out);
+}
+
+// decodes up to max_chars characters starting at cur into out as UTF-32 and moves cur past them
+// returns the number of characters written. It's less than max_chars only when cur reaches end so a loop can
+// keep calling it until it returns 0. Uses the same SIMD paths as DecodeUTF8()
+inline size_t DecodeUTF8Block(const _uchar8bit *&cur, const _uchar8bit *end, _char32bit *out, size_t max_chars)
+{
+	return (size_t)(DecodeUTF8Units(cur, end, out, out + max_chars) - out);
+}
+
+// returns the start of a sequence at the end of [begin, end) that is cut off by end, or end if there isn't one
+// only the last 3 bytes are looked at. Lets a stream keep the start of a character until the next chunk comes in
+inline const _uchar8bit *FindIncompleteUTF8Tail(const _uchar8bit *begin, const _uchar8bit *end)
+{
+	const _uchar8bit *limit = (end - begin > 3) ? end - 3 : begin;
+
+	for(const _uchar8bit *cur = end; cur > limit;)
+	{
+		--cur;
+
+		if((*cur & 0xC0) == 0x80) continue;
+		if(*cur < 0x80) return end;
+
+		size_t length = (*cur < 0xE0) ? 2 : ((*cur < 0xF0) ? 3 : 4);
+
+		return ((size_t)(end - cur) < length) ? cur : end;
+	}
+
+	return end;
+}
+
+// returns the first character boundary at or after pos without going past end
+// skips the continuation bytes (10xxxxxx) that pos is in the middle of, the same rule DecToNextCharacter() uses
+// going back. At most 3 are skipped so a long run of bad bytes still gives a boundary close to pos
+// used to split a buffer into pieces that can be worked on separately
+inline const _uchar8bit *NextUTF8Boundary(const _uchar8bit *pos, const _uchar8bit *end)
+{
+	for(int i = 0; (i < 3) && (pos < end) && ((*pos & 0xC0) == 0x80); ++i) ++pos;
+
+	return pos;
+}
+
+// moves cur back by n characters without going before begin and returns the number of characters it moved
+// the mirror of AdvanceUTF8Characters(). cur must be at the start of a character or at the end of the range
+inline size_t RetreatUTF8Characters(const _uchar8bit *&cur, const _uchar8bit *begin, size_t n)
+{
+	size_t moved = 0;
+
+	// a block of 64 bytes can't start more than 64 characters so it can be skipped whole
+	while((cur - begin >= 64) && (n - moved >= 64))
+	{
+		// if the block starts in the middle of a character, stop at the next one. The bytes before it belong
+		// to a character that wasn't counted
+		const _uchar8bit *block = cur - 64;
+		while((block < cur) && ((*block & 0xC0) == 0x80)) ++block;
+
+		if(block == cur) break;
+
+		moved += CountUTF8Characters(block, cur);
+		cur = block;
+	}
+
+	while((cur > begin) && (moved < n))
+	{
+		--cur;
+		while((cur > begin) && ((*cur & 0xC0) == 0x80)) --cur;
+
+		++moved;
+	}
+
+	return moved;
+}
+
+// decodes up to max_chars characters that come before cur into out as UTF-32 and moves cur back over them
+// the characters are written in reverse order, out[0] is the one just before cur, so reading backwards a block
+// at a time gives the same order as a reverse iterator. Returns the number written. It's less than max_chars
+// only when cur reaches begin
+inline size_t DecodeUTF8BlockReverse(const _uchar8bit *begin, const _uchar8bit *&cur, _char32bit *out, size_t max_chars)
+{
+	const _uchar8bit *block_end = cur;
+	RetreatUTF8Characters(cur, begin, max_chars);
+
+	// decode forwards with the SIMD paths and turn the block around
+	const _uchar8bit *block_start = cur;
+	size_t count = (size_t)(DecodeUTF8Units(block_start, block_end, out, out + max_chars) - out);
+
+	for(size_t i = 0, j = count; i + 1 < j; ++i)
+	{
+		--j;
+
+		_char32bit temp = out[i];
+		out[i] = out[j];
+		out[j] = temp;
+	}
+
 	return count;
 }
 